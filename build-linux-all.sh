@@ -38,6 +38,8 @@ echo Building X-Mem for GNU/Linux on all supported architectures in parallel usi
 sleep 1
 ./build-linux.sh x64_avx $NUM_THREADS &
 sleep 1
+./build-linux.sh x64_avx512 $NUM_THREADS &
+sleep 1
 ./build-linux.sh x86 $NUM_THREADS &
 sleep 1
 ./build-linux.sh arm $NUM_THREADS &
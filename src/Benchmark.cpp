@@ -35,6 +35,7 @@
 #include <benchmark_kernels.h>
 #include <PowerReader.h>
 #include <util.h>
+#include <LoadWorker.h>
 
 //Libraries
 #include <algorithm>
@@ -71,15 +72,19 @@ Benchmark::Benchmark(
         mem_node_(mem_node),
         mem_region_(mem_region),
         cpu_node_(cpu_node),
+        worker_pool_(NULL),
+        region_cache_(NULL),
         pattern_mode_(pattern_mode),
         rw_mode_(rw_mode),
         chunk_size_(chunk_size),
         stride_size_(stride_size),
+        prefetch_distance_(0),
         dram_power_readers_(dram_power_readers),
         dram_power_threads_(),
         metric_on_iter_(),
         enumerator_metric_on_iter_(),
         denominator_metric_on_iter_(),
+        metric_samples_(),
         mean_metric_(0),
         min_metric_(0),
         percentile_25_metric_(0),
@@ -125,10 +130,11 @@ bool Benchmark::run() {
 
     //Write to all of the memory region of interest to make sure
     //pages are resident in physical memory and are not shared
-    forwSequentialWrite_Word32(mem_array_,
-                               reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_) + len_));
+    touchRegion(mem_array_, reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_) + len_));
 
+    g_prefetch_distance = prefetch_distance_;
     bool success = runCore();
+    g_prefetch_distance = 0;
     if (success) {
         return true;
     } else {
@@ -197,6 +203,9 @@ void Benchmark::reportBenchmarkInfo() const {
         case RANDOM:
             std::cout << "random";
             break;
+        case RANDOM_INDEPENDENT:
+            std::cout << "independent random";
+            break;
         default:
             std::cout << "UNKNOWN";
             break;
@@ -210,17 +219,31 @@ void Benchmark::reportBenchmarkInfo() const {
             std::cout << "read";
             break;
         case WRITE:
-            if (pattern_mode_ == RANDOM) //special case
+            if (pattern_mode_ == RANDOM || pattern_mode_ == RANDOM_INDEPENDENT) //special case
                 std::cout << "read+write";
             else
                 std::cout << "write";
             break;
+        case WRITE_NT:
+            std::cout << "non-temporal write";
+            break;
+        case READ_WRITE_1_1:
+        case READ_WRITE_2_1:
+        case READ_WRITE_3_1:
+            std::cout << rw_ratio_name(rw_mode_) << " read:write mix";
+            break;
+        case READ_MODIFY_WRITE:
+            std::cout << "read-modify-write";
+            break;
         default:
             std::cout << "UNKNOWN";
             break;
     }
     std::cout << std::endl;
 
+    if (prefetch_distance_ > 0)
+        std::cout << "Software Prefetch: " << prefetch_distance_ << " ahead, hint " << prefetch_hint_name(g_prefetch_hint) << std::endl;
+
     std::cout << "Number of worker threads: " << num_worker_threads_;
     std::cout << std::endl;
 
@@ -244,6 +267,10 @@ void Benchmark::reportResults() const {
         }
 
         std::cout << std::endl;
+        if (metric_samples_.size() >= MIN_SAMPLES_FOR_CI)
+            std::cout << "Statistics over " << metric_samples_.size() << " short samples of about " << g_sample_duration_ms << " ms:" << std::endl;
+        else
+            std::cout << "Statistics over " << iterations_ << " iterations:" << std::endl;
         std::cout << std::endl;
 
         std::cout << "Mean: " << mean_metric_ << " " << metric_units_;
@@ -442,6 +469,181 @@ rw_mode_t Benchmark::getRWMode() const {
     return rw_mode_;
 }
 
+void Benchmark::setWorkerPool(WorkerPool* worker_pool) {
+    worker_pool_ = worker_pool;
+}
+
+void Benchmark::setRegionCache(RegionCache* region_cache) {
+    region_cache_ = region_cache;
+}
+
+void Benchmark::setPrefetchDistance(uint32_t lines) {
+    prefetch_distance_ = lines;
+}
+
+uint32_t Benchmark::getPrefetchDistance() const {
+    return prefetch_distance_;
+}
+
+void Benchmark::touchRegion(void* start_address, void* end_address) {
+    if (region_cache_ != NULL && region_cache_->isResident(start_address, end_address))
+        return;
+
+    stridedWrite<Word32_t, 1>(start_address, end_address);
+    if (region_cache_ != NULL)
+        region_cache_->markResident(start_address, end_address);
+}
+
+bool Benchmark::prepareChain(void* start_address, void* end_address, chunk_size_t chunk_size, chain_granularity_t granularity, bool random_offsets, uint64_t seed) {
+    if (region_cache_ != NULL && region_cache_->hasChain(start_address, end_address, chunk_size, granularity, random_offsets, seed))
+        return true;
+
+    if (!build_random_pointer_permutation(start_address, end_address, chunk_size, granularity, random_offsets, seed, mem_node_))
+        return false;
+
+    if (region_cache_ != NULL)
+        region_cache_->addChain(start_address, end_address, chunk_size, granularity, random_offsets, seed);
+    return true;
+}
+
+bool Benchmark::checkPassSpan(size_t len_per_thread) const {
+    size_t span = sequential_pass_span(stride_size_);
+    if (span <= len_per_thread)
+        return true;
+
+    std::cerr << "ERROR: Strides of " << stride_size_ << " chunks walk " << span << " bytes per pass, but each worker thread only has " << len_per_thread << " bytes. Use a larger working set or a smaller stride." << std::endl;
+    return false;
+}
+
+std::vector<double> Benchmark::computeThroughputSamples(std::vector<MemoryWorker*>& workers, uint32_t first, uint32_t last) {
+    std::vector<double> samples;
+    if (first >= last || last > workers.size())
+        return samples;
+
+    //Only slices that every worker has recorded are comparable
+    uint32_t num_samples = workers[first]->getNumSamples();
+    for (uint32_t t = first+1; t < last; t++)
+        num_samples = std::min(num_samples, workers[t]->getNumSamples());
+
+    for (uint32_t k = 0; k < num_samples; k++) {
+        double throughput = 0;
+        bool valid = true;
+        for (uint32_t t = first; t < last; t++) {
+            tick_t ticks = workers[t]->getSampleAdjustedTicks(k);
+            if (ticks == 0) {
+                valid = false;
+                break;
+            }
+            throughput += ((static_cast<double>(workers[t]->getSamplePasses(k)) * static_cast<double>(workers[t]->getBytesPerPass())) / static_cast<double>(MB))   /   ((static_cast<double>(ticks) * g_ns_per_tick) / 1e9);
+        }
+        if (valid)
+            samples.push_back(throughput);
+    }
+
+    return samples;
+}
+
+std::vector<double> Benchmark::computeLatencySamples(MemoryWorker* worker, uint32_t accesses_per_pass) {
+    std::vector<double> samples;
+    uint32_t num_samples = worker->getNumSamples();
+    for (uint32_t k = 0; k < num_samples; k++) {
+        tick_t ticks = worker->getSampleAdjustedTicks(k);
+        uint32_t passes = worker->getSamplePasses(k);
+        if (ticks == 0 || passes == 0)
+            continue;
+        samples.push_back(static_cast<double>(ticks * g_ns_per_tick)  /  static_cast<double>(accesses_per_pass * passes));
+    }
+
+    return samples;
+}
+
+bool Benchmark::recordIterationSamples(uint32_t iter, const std::vector<double>& samples) {
+    if (iter == 0)
+        metric_samples_.clear();
+    metric_samples_.insert(metric_samples_.end(), samples.begin(), samples.end());
+
+    if (g_verbose)
+        std::cout << "...collected " << samples.size() << " samples of about " << g_sample_duration_ms << " ms (" << metric_samples_.size() << " so far)" << std::endl;
+
+    if (median_95_CI_within(metric_samples_, g_ci_width)) {
+        if (!g_log_extended) {
+            // Resizing vectors for keeping the results of the measurements since they are fewer than the max.
+            iterations_ = iter + 1;
+            metric_on_iter_.resize(iterations_);
+            enumerator_metric_on_iter_.resize(iterations_);
+            denominator_metric_on_iter_.resize(iterations_);
+            return true;
+        }
+    } else if (iter == iterations_ - 1) {
+        if (metric_samples_.size() < MIN_SAMPLES_FOR_CI)
+            std::cerr << "WARNING: 95% CI cannot be computed for fewer than " << MIN_SAMPLES_FOR_CI << " samples!" << std::endl;
+        else
+            std::cerr << "WARNING: 95% CI did not converge within " << g_ci_width * 100 << "% of median value!" << std::endl;
+    }
+
+    return false;
+}
+
+bool Benchmark::runWorkers(std::vector<MemoryWorker*>& workers, bool prime_memory) {
+    //Sequential and independent random write kernels overwrite any pointer chain in their load worker's region, and so do the sequential mixed read/write kernels. Random write kernels and read-modify-write kernels store back the values they read, so chains survive them.
+    if (region_cache_ != NULL && (rw_mode_ == WRITE || rw_mode_ == WRITE_NT || rw_mode_reads_per_write(rw_mode_) > 0) && pattern_mode_ != RANDOM) {
+        for (uint32_t t = 0; t < workers.size(); t++) {
+            LoadWorker* load_worker = dynamic_cast<LoadWorker*>(workers[t]);
+            if (load_worker != NULL)
+                region_cache_->invalidate(load_worker->getMemArray(), reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(load_worker->getMemArray()) + load_worker->getLen()));
+        }
+    }
+
+    //Fast path: hand the jobs to the persistent pinned threads
+    if (worker_pool_ != NULL && worker_pool_->isRunning() && worker_pool_->getNumThreads() >= workers.size())
+        return worker_pool_->runWorkers(workers, prime_memory);
+
+    //Slow path: one fresh thread per worker
+    bool success = true;
+    std::vector<Thread*> worker_threads;
+    for (uint32_t t = 0; t < workers.size(); t++)
+        worker_threads.push_back(new Thread(workers[t]));
+
+    //Start worker threads! gogogo
+    for (uint32_t t = 0; t < worker_threads.size(); t++)
+        worker_threads[t]->create_and_start();
+
+    //Wait for all threads to complete
+    for (uint32_t t = 0; t < worker_threads.size(); t++) {
+        if (!worker_threads[t]->join()) {
+            std::cerr << "WARNING: A worker thread failed to complete correctly!" << std::endl;
+            success = false;
+        }
+    }
+
+    for (uint32_t t = 0; t < worker_threads.size(); t++)
+        delete worker_threads[t];
+
+    return success;
+}
+
+double Benchmark::computeLoadOverlap(std::vector<MemoryWorker*>& workers) {
+    if (workers.size() < 2)
+        return 1;
+
+    tick_t lat_start_tick = workers[0]->getWindowStartTick();
+    tick_t lat_stop_tick = workers[0]->getWindowStopTick();
+    if (lat_stop_tick <= lat_start_tick)
+        return 0;
+
+    double min_overlap = 1;
+    for (uint32_t t = 1; t < workers.size(); t++) {
+        tick_t overlap_start_tick = std::max(lat_start_tick, workers[t]->getWindowStartTick());
+        tick_t overlap_stop_tick = std::min(lat_stop_tick, workers[t]->getWindowStopTick());
+        double overlap = 0;
+        if (overlap_stop_tick > overlap_start_tick)
+            overlap = static_cast<double>(overlap_stop_tick - overlap_start_tick) / static_cast<double>(lat_stop_tick - lat_start_tick);
+        min_overlap = std::min(min_overlap, overlap);
+    }
+
+    return min_overlap;
+}
+
 void Benchmark::computeMedian(std::vector<double> metrics, uint32_t n) {
 
     if ((n > metrics.size()) || (n <= 0)) {
@@ -454,52 +656,50 @@ void Benchmark::computeMedian(std::vector<double> metrics, uint32_t n) {
 
     median_metric_ = compute_median(metrics);
 
-    if (n <= 5) {
+    if (n < MIN_SAMPLES_FOR_CI) {
         std::cerr << "WARNING: Number of metrics given is too small to compute the CI of the median." << std::endl;
         return;
     }
 
-    // Build sorted array of metrics from each iteration
-    std::vector<double> sortedMetrics = metrics;
-    std::sort(sortedMetrics.begin(), sortedMetrics.end());
-
-    uint32_t lower_95_CI_rank = std::max((uint32_t) 1, static_cast<uint32_t>(      (n - Z_CI_95 * sqrt(n)) / 2.0));
-    uint32_t upper_95_CI_rank = std::min(           n, static_cast<uint32_t>(ceil(((n + Z_CI_95 * sqrt(n)) / 2.0) + 1.0)));
-
-    lower_95_CI_median_ = sortedMetrics[lower_95_CI_rank - 1]; //-1 since it is zero-indexed
-    upper_95_CI_median_ = sortedMetrics[upper_95_CI_rank - 1]; //-1 since it is zero-indexed
+    compute_median_95_CI(metrics, n, &lower_95_CI_median_, &upper_95_CI_median_);
 }
 
 void Benchmark::computeMetrics() {
     if (has_run_) {
+        //All statistics come from the same data: the short samples when there are enough of them for a CI of the median, otherwise the iterations
+        bool use_samples = metric_samples_.size() >= MIN_SAMPLES_FOR_CI;
+        std::vector<double> sortedMetrics = use_samples ? metric_samples_ : metric_on_iter_;
+        std::sort(sortedMetrics.begin(), sortedMetrics.end());
+
         //Compute mean
         mean_metric_ = 0;
-        for (uint32_t i = 0; i < iterations_; i++)
-            mean_metric_ += metric_on_iter_[i];
-        mean_metric_ /= iterations_;
-
-        //Build sorted array of metrics from each iteration
-        std::vector<double> sortedMetrics = metric_on_iter_;
-        std::sort(sortedMetrics.begin(), sortedMetrics.end());
+        for (uint32_t i = 0; i < sortedMetrics.size(); i++)
+            mean_metric_ += sortedMetrics[i];
+        mean_metric_ /= sortedMetrics.size();
 
         //Compute percentiles
         min_metric_ = sortedMetrics.front();
         percentile_25_metric_ = sortedMetrics[sortedMetrics.size()/4];
         percentile_75_metric_ = sortedMetrics[sortedMetrics.size()*3/4];
-        median_metric_ = compute_median(sortedMetrics);
         percentile_95_metric_ = sortedMetrics[sortedMetrics.size()*95/100];
         percentile_99_metric_ = sortedMetrics[sortedMetrics.size()*99/100];
         max_metric_ = sortedMetrics.back();
+        if (use_samples)
+            computeMedian(sortedMetrics, sortedMetrics.size());
+        else
+            median_metric_ = compute_median(sortedMetrics);
 
         //Compute mode
         std::map<double,uint32_t> metricCounts;
-        for (uint32_t i = 0; i < iterations_; i++)
-            metricCounts[metric_on_iter_[i]]++;
+        for (uint32_t i = 0; i < sortedMetrics.size(); i++)
+            metricCounts[sortedMetrics[i]]++;
         mode_metric_ = 0;
         uint32_t greatest_count = 0;
         for (auto it = metricCounts.cbegin(); it != metricCounts.cend(); it++) {
-            if (it->second > greatest_count)
+            if (it->second > greatest_count) {
                 mode_metric_ = it->first;
+                greatest_count = it->second;
+            }
         }
     }
 }
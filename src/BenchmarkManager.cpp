@@ -33,13 +33,16 @@
 #include <BenchmarkManager.h>
 #include <common.h>
 #include <Configurator.h>
+#include <benchmark_kernels.h>
+#include <RegionPrefaulter.h>
+#include <Thread.h>
 
 #ifdef EXT_DELAY_INJECTED_LOADED_LATENCY_BENCHMARK
 #include <DelayInjectedLoadedLatencyBenchmark.h>
 #endif
 
 #ifdef EXT_STREAM_BENCHMARK
-#include <StreamBenchmark.h> //TODO: implement this class
+#include <StreamBenchmark.h>
 #endif
 
 #ifdef _WIN32
@@ -50,6 +53,7 @@
 #endif
 
 //Libraries
+#include <algorithm>
 #include <assert.h>
 #include <cstdint>
 #include <errno.h>
@@ -57,6 +61,7 @@
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <iterator>
 #include <numaif.h>
 #include <sstream>
 #include <stdio.h>
@@ -72,10 +77,17 @@
 #ifdef HAS_NUMA
 #include <numa.h>
 #endif
-#ifdef HAS_LARGE_PAGES
-extern "C" {
-#include <hugetlbfs.h> //for allocating and freeing huge pages
-}
+#include <cstring> //for strerror
+
+//Older C library headers lack the huge page size flags of mmap()
+#ifndef MAP_HUGE_SHIFT
+#define MAP_HUGE_SHIFT 26
+#endif
+#ifndef MAP_HUGE_2MB
+#define MAP_HUGE_2MB (21 << MAP_HUGE_SHIFT)
+#endif
+#ifndef MAP_HUGE_1GB
+#define MAP_HUGE_1GB (30 << MAP_HUGE_SHIFT)
 #endif
 #endif
 
@@ -88,21 +100,25 @@ BenchmarkManager::BenchmarkManager(
         cpu_numa_node_affinities_(),
         memory_numa_node_affinities_(),
         mem_arrays_(),
-#ifndef HAS_NUMA
-        orig_malloc_addr_(NULL),
-#endif
+        mem_array_mappings_(),
         mem_array_lens_(),
+        mem_array_mapped_lens_(),
         mem_array_node_(),
+        mem_array_phys_addrs_(),
         tp_benchmarks_(),
         lat_benchmarks_(),
         lat_mat_benchmarks_(),
         thr_mat_benchmarks_(),
         dram_power_readers_(),
+        worker_pool_(NULL),
+        region_cache_(),
         results_file_(),
         dec_net_results_file_(),
+        pagemap_file_(),
         lat_mat_logfile_(),
         thr_mat_logfile_(),
-        built_benchmarks_(false)
+        built_benchmarks_(false),
+        page_mode_(config.getPageModes()[0])
     {
     //Set up DRAM power measurement
     for (uint32_t i = 0; i < g_num_physical_packages; i++) { //FIXME: this assumes that each physical package has a DRAM power measurement capability
@@ -126,9 +142,33 @@ BenchmarkManager::BenchmarkManager(
     cpu_numa_node_affinities_ = config_.getCpuNumaNodeAffinities();
     memory_numa_node_affinities_ = config_.getMemoryNumaNodeAffinities();
 
+    //Open the per-page physical address report, which is written while the working sets are set up
+    if (config_.usePagemapFile()) {
+        pagemap_file_.open(config_.getPagemapFilename().c_str(), std::fstream::out);
+        if (!pagemap_file_.is_open())
+            std::cerr << "WARNING: Failed to open " << config_.getPagemapFilename() << " for writing! No pagemap file will be generated." << std::endl;
+        else
+            pagemap_file_ << "Page Size,Memory Region,NUMA Memory Node,Virtual Address,Physical Address,Page NUMA Node," << std::endl;
+    }
+
     //Build working memory regions
     setupWorkingSets(config_.getWorkingSetSizePerThread());
 
+    //Start the persistent worker threads once for the whole run. Throughput matrix benchmarks may use every CPU in a node.
+    uint32_t pool_size = config_.getNumWorkerThreads();
+    if (config_.throughputMatrixTestSelected() && g_num_logical_cpus > pool_size)
+        pool_size = g_num_logical_cpus;
+    if (config_.coreToCoreMatrixSelected() && pool_size < 2) //ping and pong
+        pool_size = 2;
+    if (config_.producerConsumerSelected() && pool_size < 2) //producer and consumer
+        pool_size = 2;
+    worker_pool_ = new WorkerPool(pool_size);
+    if (!worker_pool_->start()) {
+        std::cerr << "WARNING: Failed to start the worker pool. Worker threads will be created for each benchmark iteration instead." << std::endl;
+        delete worker_pool_;
+        worker_pool_ = NULL;
+    }
+
     //Open results file
     if (config_.useOutputFile()) {
         results_file_.open(config_.getOutputFilename().c_str(), std::fstream::out);
@@ -150,6 +190,7 @@ BenchmarkManager::BenchmarkManager(
         }
         results_file_ << "Extension Info,";
         results_file_ << "Notes,";
+        results_file_ << "Page Size,";
         results_file_ << std::endl;
     }
 
@@ -175,7 +216,8 @@ BenchmarkManager::BenchmarkManager(
                          << "region"                                          << ","
                          << "iteration"                                       << ","
                          << "metric"                                          << ","
-                         << "units"                                           << std::endl;
+                         << "units"                                           << ","
+                         << "load_overlap"                                    << std::endl;
     }
 
     // If extended measurements are enabled for throughput matrix benchmark open logfile
@@ -195,50 +237,19 @@ BenchmarkManager::BenchmarkManager(
 }
 
 BenchmarkManager::~BenchmarkManager() {
-    //Free throughput benchmarks
-    for (uint32_t i = 0; i < tp_benchmarks_.size(); i++)
-        delete tp_benchmarks_[i];
-    //Free latency benchmarks
-    for (uint32_t i = 0; i < lat_benchmarks_.size(); i++)
-        delete lat_benchmarks_[i];
-    //Free latency matrix benchmarks
-    for (uint32_t i = 0; i < lat_mat_benchmarks_.size(); i++)
-        delete lat_mat_benchmarks_[i];
-    //Free throughput matrix benchmarks
-    for (uint32_t i = 0; i < thr_mat_benchmarks_.size(); i++)
-        delete thr_mat_benchmarks_[i];
-    //Free memory arrays
-    for (uint32_t i = 0; i < mem_arrays_.size(); i++)
-        if (mem_arrays_[i] != nullptr) {
-#ifdef _WIN32
-            VirtualFreeEx(GetCurrentProcess(), mem_arrays_[i], 0, MEM_RELEASE);
-#endif
-#ifdef __gnu_linux__
-#ifdef HAS_LARGE_PAGES
-            if (config_.useLargePages()) {
-                free_huge_pages(mem_arrays_[i]);
-            } else {
-#endif
-                if (! config_.memoryRegionsInPhysAddr()) {
-#ifdef HAS_NUMA
-                    numa_free(mem_arrays_[i], mem_array_lens_[i]);
-#else
-                    free(orig_malloc_addr_); //this is somewhat of a band-aid
-#endif
-                } else {
-                    if (munmap(mem_arrays_[i], mem_array_lens_[i]) < 0) {
-                        perror("Failed to munmap() memory regions:");
-                    }
-                }
-#ifdef HAS_LARGE_PAGES
-            }
-#endif
-#endif
-        }
+    //Free benchmarks and memory arrays
+    freeWorkingSets();
+    //Stop and join the pooled worker threads
+    if (worker_pool_ != NULL)
+        delete worker_pool_;
     //Close results file
     if (results_file_.is_open())
         results_file_.close();
 
+    //Close pagemap file
+    if (pagemap_file_.is_open())
+        pagemap_file_.close();
+
     //Close latency matrix extended measurements logfile
     if (lat_mat_logfile_.is_open())
         lat_mat_logfile_.close();
@@ -307,6 +318,27 @@ void BenchmarkManager::printMatrix(std::vector<xmem::MatrixBenchmark *> mat_benc
     std::cout << std::endl;
 }
 
+void BenchmarkManager::printCoreToCoreMatrix(const std::vector<uint32_t>& cpus, const std::vector< std::vector<double> >& matrix, std::string units, std::string what) {
+    std::cout << "Measured " << what << " (in " << units << ")..." << std::endl;
+    std::cout << "Rows are the initiating CPUs and columns the responding CPUs" << std::endl << std::endl;
+
+    std::cout << std::setw(3) << "CPU";
+    for (uint32_t col = 0; col < cpus.size(); col++)
+        std::cout << std::setw(12) << cpus[col];
+
+    for (uint32_t row = 0; row < cpus.size(); row++) {
+        std::cout << std::endl;
+        std::cout << std::setw(3) << cpus[row];
+        for (uint32_t col = 0; col < cpus.size(); col++) {
+            if (row == col)
+                std::cout << std::setw(12) << "-";
+            else
+                std::cout << std::setw(12) << matrix[row][col];
+        }
+    }
+    std::cout << std::endl;
+}
+
 bool BenchmarkManager::runThroughputBenchmarks() {
     if (!built_benchmarks_) {
         if (!buildBenchmarks()) {
@@ -336,6 +368,9 @@ bool BenchmarkManager::runThroughputBenchmarks() {
                 case RANDOM:
                     results_file_ << "RANDOM" << ",";
                     break;
+                case RANDOM_INDEPENDENT:
+                    results_file_ << "RANDOM_INDEPENDENT" << ",";
+                    break;
                 default:
                     results_file_ << "UNKNOWN" << ",";
                     break;
@@ -349,6 +384,21 @@ bool BenchmarkManager::runThroughputBenchmarks() {
                 case WRITE:
                     results_file_ << "WRITE" << ",";
                     break;
+                case WRITE_NT:
+                    results_file_ << "WRITE_NT" << ",";
+                    break;
+                case READ_WRITE_1_1:
+                    results_file_ << "READ_WRITE_1_1" << ",";
+                    break;
+                case READ_WRITE_2_1:
+                    results_file_ << "READ_WRITE_2_1" << ",";
+                    break;
+                case READ_WRITE_3_1:
+                    results_file_ << "READ_WRITE_3_1" << ",";
+                    break;
+                case READ_MODIFY_WRITE:
+                    results_file_ << "READ_MODIFY_WRITE" << ",";
+                    break;
                 default:
                     results_file_ << "UNKNOWN" << ",";
                     break;
@@ -411,6 +461,7 @@ bool BenchmarkManager::runThroughputBenchmarks() {
             }
             results_file_ << "N/A" << ",";
             results_file_ << "" << ",";
+            results_file_ << page_mode_name(page_mode_) << ",";
             results_file_ << std::endl;
         }
     }
@@ -456,6 +507,9 @@ bool BenchmarkManager::runLatencyBenchmarks() {
                     case RANDOM:
                         results_file_ << "RANDOM" << ",";
                         break;
+                    case RANDOM_INDEPENDENT:
+                        results_file_ << "RANDOM_INDEPENDENT" << ",";
+                        break;
                     default:
                         results_file_ << "UNKNOWN" << ",";
                         break;
@@ -469,6 +523,21 @@ bool BenchmarkManager::runLatencyBenchmarks() {
                     case WRITE:
                         results_file_ << "WRITE" << ",";
                         break;
+                    case WRITE_NT:
+                        results_file_ << "WRITE_NT" << ",";
+                        break;
+                    case READ_WRITE_1_1:
+                        results_file_ << "READ_WRITE_1_1" << ",";
+                        break;
+                    case READ_WRITE_2_1:
+                        results_file_ << "READ_WRITE_2_1" << ",";
+                        break;
+                    case READ_WRITE_3_1:
+                        results_file_ << "READ_WRITE_3_1" << ",";
+                        break;
+                    case READ_MODIFY_WRITE:
+                        results_file_ << "READ_MODIFY_WRITE" << ",";
+                        break;
                     default:
                         results_file_ << "UNKNOWN" << ",";
                         break;
@@ -533,6 +602,7 @@ bool BenchmarkManager::runLatencyBenchmarks() {
             }
             results_file_ << "N/A" << ",";
             results_file_ << "" << ",";
+            results_file_ << page_mode_name(page_mode_) << ",";
             results_file_ << std::endl;
         }
     }
@@ -551,11 +621,6 @@ bool BenchmarkManager::runLatencyMatrixBenchmarks() {
         }
     }
 
-    std::vector<uint64_t> mem_regions_phys_addr;
-    if (config_.useDecNetFile()) {
-        mem_regions_phys_addr = config_.getMemoryRegionsPhysAddresses();
-    }
-
     for (uint32_t i = 0; i < lat_mat_benchmarks_.size(); i++) {
         lat_mat_benchmarks_[i]->run();
         lat_mat_benchmarks_[i]->reportResults(); //to console
@@ -583,6 +648,9 @@ bool BenchmarkManager::runLatencyMatrixBenchmarks() {
                     case RANDOM:
                         results_file_ << "RANDOM" << ",";
                         break;
+                    case RANDOM_INDEPENDENT:
+                        results_file_ << "RANDOM_INDEPENDENT" << ",";
+                        break;
                     default:
                         results_file_ << "UNKNOWN" << ",";
                         break;
@@ -596,6 +664,21 @@ bool BenchmarkManager::runLatencyMatrixBenchmarks() {
                     case WRITE:
                         results_file_ << "WRITE" << ",";
                         break;
+                    case WRITE_NT:
+                        results_file_ << "WRITE_NT" << ",";
+                        break;
+                    case READ_WRITE_1_1:
+                        results_file_ << "READ_WRITE_1_1" << ",";
+                        break;
+                    case READ_WRITE_2_1:
+                        results_file_ << "READ_WRITE_2_1" << ",";
+                        break;
+                    case READ_WRITE_3_1:
+                        results_file_ << "READ_WRITE_3_1" << ",";
+                        break;
+                    case READ_MODIFY_WRITE:
+                        results_file_ << "READ_MODIFY_WRITE" << ",";
+                        break;
                     default:
                         results_file_ << "UNKNOWN" << ",";
                         break;
@@ -660,14 +743,15 @@ bool BenchmarkManager::runLatencyMatrixBenchmarks() {
             }
             results_file_ << "N/A" << ",";
             results_file_ << "" << ",";
+            results_file_ << page_mode_name(page_mode_) << ",";
             results_file_ << std::endl;
         }
 
-        if (config_.useDecNetFile() && (mem_regions_phys_addr.size() > 0)) {
+        if (config_.useDecNetFile() && (mem_array_phys_addrs_.size() > 0)) {
             dec_net_results_file_ << "bench_result(";
             dec_net_results_file_ << lat_mat_benchmarks_[i]->getCPUId() << ", ";
             uint32_t region_id = lat_mat_benchmarks_[i]->getMemRegion();
-            dec_net_results_file_ << mem_regions_phys_addr[region_id] << ", ";
+            dec_net_results_file_ << mem_array_phys_addrs_[region_id] << ", ";
             dec_net_results_file_ << "'latency'" << ", ";
             dec_net_results_file_ << lat_mat_benchmarks_[i]->getMedianMetric() << ", ";
             dec_net_results_file_ << "'" << lat_mat_benchmarks_[i]->getMetricUnits() << "'" << ").";
@@ -694,11 +778,6 @@ bool BenchmarkManager::runThroughputMatrixBenchmarks() {
         }
     }
 
-    std::vector<uint64_t> mem_regions_phys_addr;
-    if (config_.useDecNetFile()) {
-        mem_regions_phys_addr = config_.getMemoryRegionsPhysAddresses();
-    }
-
     for (uint32_t i = 0; i < thr_mat_benchmarks_.size(); i++) {
         thr_mat_benchmarks_[i]->run();
         thr_mat_benchmarks_[i]->reportResults(); //to console
@@ -726,6 +805,9 @@ bool BenchmarkManager::runThroughputMatrixBenchmarks() {
                     case RANDOM:
                         results_file_ << "RANDOM" << ",";
                         break;
+                    case RANDOM_INDEPENDENT:
+                        results_file_ << "RANDOM_INDEPENDENT" << ",";
+                        break;
                     default:
                         results_file_ << "UNKNOWN" << ",";
                         break;
@@ -739,6 +821,21 @@ bool BenchmarkManager::runThroughputMatrixBenchmarks() {
                     case WRITE:
                         results_file_ << "WRITE" << ",";
                         break;
+                    case WRITE_NT:
+                        results_file_ << "WRITE_NT" << ",";
+                        break;
+                    case READ_WRITE_1_1:
+                        results_file_ << "READ_WRITE_1_1" << ",";
+                        break;
+                    case READ_WRITE_2_1:
+                        results_file_ << "READ_WRITE_2_1" << ",";
+                        break;
+                    case READ_WRITE_3_1:
+                        results_file_ << "READ_WRITE_3_1" << ",";
+                        break;
+                    case READ_MODIFY_WRITE:
+                        results_file_ << "READ_MODIFY_WRITE" << ",";
+                        break;
                     default:
                         results_file_ << "UNKNOWN" << ",";
                         break;
@@ -802,14 +899,15 @@ bool BenchmarkManager::runThroughputMatrixBenchmarks() {
             }
             results_file_ << "N/A" << ",";
             results_file_ << "" << ",";
+            results_file_ << page_mode_name(page_mode_) << ",";
             results_file_ << std::endl;
         }
 
-        if (config_.useDecNetFile() && (mem_regions_phys_addr.size() > 0)) {
+        if (config_.useDecNetFile() && (mem_array_phys_addrs_.size() > 0)) {
             dec_net_results_file_ << "bench_result(";
             dec_net_results_file_ << thr_mat_benchmarks_[i]->getCPUId() << ", ";
             uint32_t region_id = thr_mat_benchmarks_[i]->getMemRegion();
-            dec_net_results_file_ << mem_regions_phys_addr[region_id] << ", ";
+            dec_net_results_file_ << mem_array_phys_addrs_[region_id] << ", ";
             dec_net_results_file_ << "'throughput'" << ", ";
             dec_net_results_file_ << thr_mat_benchmarks_[i]->getMedianMetric() << ", ";
             dec_net_results_file_ << "'" << thr_mat_benchmarks_[i]->getMetricUnits() << "'" << ").";
@@ -828,152 +926,1073 @@ bool BenchmarkManager::runThroughputMatrixBenchmarks() {
     return true;
 }
 
-void BenchmarkManager::setupWorkingSets(size_t working_set_size) {
-    //Allocate memory in each NUMA node to be tested
+bool BenchmarkManager::runPrefetchSweep() {
+#ifndef HAS_SW_PREFETCH
+    std::cerr << "ERROR: Software prefetching is not supported on this platform." << std::endl;
+    return false;
+#else
+    //Put the enumerations into vectors to make constructing benchmarks more loopable
+    std::vector<chunk_size_t> chunks;
+    std::vector<uint32_t> chunk_bits; //For table labels
+    if (config_.useChunk32b()) {
+        chunks.push_back(CHUNK_32b);
+        chunk_bits.push_back(32);
+    }
+#ifdef HAS_WORD_64
+    if (config_.useChunk64b()) {
+        chunks.push_back(CHUNK_64b);
+        chunk_bits.push_back(64);
+    }
+#endif
+#ifdef HAS_WORD_128
+    if (config_.useChunk128b()) {
+        chunks.push_back(CHUNK_128b);
+        chunk_bits.push_back(128);
+    }
+#endif
+#ifdef HAS_WORD_256
+    if (config_.useChunk256b()) {
+        chunks.push_back(CHUNK_256b);
+        chunk_bits.push_back(256);
+    }
+#endif
+#ifdef HAS_WORD_512
+    if (config_.useChunk512b()) {
+        chunks.push_back(CHUNK_512b);
+        chunk_bits.push_back(512);
+    }
+#endif
 
-    uint32_t mem_regions_per_numa = config_.getMemoryRegionsPerNUMANode();
+    std::vector<int32_t> strides = config_.getStrideSizes();
 
-    std::vector<uint64_t> mem_regions_phys_addr = config_.getMemoryRegionsPhysAddresses();
+    std::vector<uint32_t> distances;
+    distances.push_back(0);
+    for (uint32_t d = 1; d <= PREFETCH_SWEEP_MAX_DISTANCE; d *= 2)
+        distances.push_back(d);
 
-    uint32_t mem_regions_per_cpu = config_.memoryRegionsInPhysAddr() ? mem_regions_phys_addr.size()
-                                                                     : g_num_numa_nodes * mem_regions_per_numa;
+    bool success = true;
+    for (auto mem_node_it = memory_numa_node_affinities_.cbegin(); mem_node_it != memory_numa_node_affinities_.cend(); mem_node_it++) { //iterate each memory NUMA node
+        for (uint32_t mem_region = 0; mem_region < config_.getMemoryRegionsPerNUMANode(); mem_region++) {
+            uint32_t mem_node = *mem_node_it;
+            uint32_t region_id = mem_node * config_.getMemoryRegionsPerNUMANode() + mem_region;
+            void* mem_array = mem_arrays_[region_id];
+            size_t mem_array_len = mem_array_lens_[region_id];
 
-    mem_arrays_.resize(mem_regions_per_cpu);
-    mem_array_lens_.resize(mem_regions_per_cpu);
-    mem_array_node_.resize(mem_regions_per_cpu);
+            for (auto cpu_node_it = cpu_numa_node_affinities_.cbegin(); cpu_node_it != cpu_numa_node_affinities_.cend(); cpu_node_it++) { //iterate each cpu NUMA node
+                uint32_t cpu_node = *cpu_node_it;
 
-    if (! config_.memoryRegionsInPhysAddr()) {
-        //We reserve the space for these, but that doesn't mean they will all be used.
-        for (auto it = memory_numa_node_affinities_.cbegin(); it != memory_numa_node_affinities_.cend(); it++) {
-            for (uint32_t mem_region = 0; mem_region < mem_regions_per_numa; mem_region++) {
-                size_t allocation_size = 0;
-                uint32_t numa_node = *it;
-                uint32_t region_id = numa_node * mem_regions_per_numa + mem_region;
-                mem_array_node_[region_id] = numa_node;
+                //Median throughput per distance and chunk/stride combination, and median latency per distance
+                std::vector<std::vector<double> > throughput(distances.size());
+                std::vector<double> latency(distances.size(), 0);
 
-#ifdef HAS_LARGE_PAGES
-                if (config_.useLargePages()) {
-                    size_t remainder = 0;
-                    //For large pages, working set size could be less than a single large page. So let's allocate the right amount of memory, which is the working set size rounded up to nearest large page, which could be more than we actually use.
-                    if (config_.getNumWorkerThreads() * working_set_size < g_large_page_size)
-                        allocation_size = g_large_page_size;
-                    else {
-                        remainder = (config_.getNumWorkerThreads() * working_set_size) % g_large_page_size;
-                        allocation_size = (config_.getNumWorkerThreads() * working_set_size) + remainder;
-                    }
+                for (uint32_t d_index = 0; d_index < distances.size(); d_index++) {
+                    uint32_t d = distances[d_index];
 
-#ifdef _WIN32
-                    //Make sure we have necessary privileges
-                    HANDLE hToken;
-                    if (!OpenProcessToken(GetCurrentProcess(), TOKEN_ADJUST_PRIVILEGES | TOKEN_QUERY, &hToken)) {
-                        std::cerr << "ERROR: Failed to open process token to adjust privileges! Did you remember to run in Administrator mode?" << std::endl;
-                        exit(-1);
-                    }
-                    if (!SetPrivilege(hToken,"SeLockMemoryPrivilege", true)) {
-                        std::cerr << "ERROR: Failed to adjust privileges to allow locking memory pages! Did you remember to run in Administrator mode?" << std::endl;
-                        exit(-1);
+                    if (config_.useSequentialAccessPattern() && config_.useReads()) {
+                        for (uint32_t chunk_index = 0; chunk_index < chunks.size(); chunk_index++) { //iterate different chunk sizes
+                            for (uint32_t stride_index = 0; stride_index < strides.size(); stride_index++) {  //iterate different stride lengths
+                                std::string benchmark_name = static_cast<std::ostringstream*>(&(std::ostringstream() << "Test #" << g_test_index++ << "P (Prefetch Sweep Throughput)"))->str();
+                                ThroughputBenchmark benchmark(mem_array,
+                                                              mem_array_len,
+                                                              config_.getIterationsPerTest(),
+                                                              config_.getNumWorkerThreads(),
+                                                              mem_node,
+                                                              cpu_node,
+                                                              SEQUENTIAL,
+                                                              READ,
+                                                              chunks[chunk_index],
+                                                              strides[stride_index],
+                                                              dram_power_readers_,
+                                                              benchmark_name);
+                                benchmark.setWorkerPool(worker_pool_);
+                                benchmark.setRegionCache(&region_cache_);
+                                benchmark.setPrefetchDistance(d);
+                                if (!benchmark.run())
+                                    success = false;
+                                benchmark.reportResults(); //to console
+                                throughput[d_index].push_back(benchmark.getMedianMetric());
+                            }
+                        }
                     }
-                    CloseHandle(hToken);
 
-                    mem_arrays_[numa_node] = VirtualAllocExNuma(GetCurrentProcess(), NULL, allocation_size, MEM_COMMIT | MEM_RESERVE | MEM_LARGE_PAGES, PAGE_READWRITE, numa_node); //Windows NUMA allocation. Make the allocation one page bigger than necessary so that we can do alignment.
-#endif
-#ifdef __gnu_linux__
-                    mem_arrays_[numa_node] = get_huge_pages(allocation_size, GHP_DEFAULT);
-#endif
-                } else { //Non-large pages (nominal case)
-#endif
-                    //Under normal (not large-page) operation, working set size is a multiple of regular pages.
-                    allocation_size = config_.getNumWorkerThreads() * working_set_size + g_page_size;
-#ifdef _WIN32
-                    mem_arrays_[region_id] = VirtualAllocExNuma(GetCurrentProcess(), NULL, allocation_size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE, numa_node); //Windows NUMA allocation. Make the allocation one page bigger than necessary so that we can do alignment.
-#endif
-#ifdef __gnu_linux__
-#ifdef HAS_NUMA
-                    numa_set_strict(1); //Enforce NUMA memory allocation to land on specified node or fail otherwise. Alternative node fallback is forbidden.
-                    mem_arrays_[region_id] = numa_alloc_onnode(allocation_size, numa_node);
-#endif
-#ifndef HAS_NUMA //special case
-                    mem_arrays_[region_id] = malloc(allocation_size);
-                    orig_malloc_addr_ = mem_arrays_[numa_node];
-#endif
-#endif
-#ifdef HAS_LARGE_PAGES
+                    //Unloaded latency on the first thread's share of the region
+                    std::string benchmark_name = static_cast<std::ostringstream*>(&(std::ostringstream() << "Test #" << g_test_index++ << "P (Prefetch Sweep Latency)"))->str();
+                    LatencyBenchmark benchmark(mem_array,
+                                               mem_array_len / config_.getNumWorkerThreads(),
+                                               config_.getIterationsPerTest(),
+                                               1,
+                                               mem_node,
+                                               cpu_node,
+                                               SEQUENTIAL,
+                                               READ,
+                                               chunks[0],
+                                               1,
+                                               dram_power_readers_,
+                                               benchmark_name);
+                    benchmark.setWorkerPool(worker_pool_);
+                    benchmark.setRegionCache(&region_cache_);
+                    benchmark.setPrefetchDistance(d);
+                    if (!benchmark.run())
+                        success = false;
+                    benchmark.reportResults(); //to console
+                    latency[d_index] = benchmark.getMedianMetric();
                 }
-#endif
 
-                if (mem_arrays_[region_id] != nullptr) {
-                    mem_array_lens_[region_id] = config_.getNumWorkerThreads() * working_set_size;
+                //Summary table
+                std::cout << std::endl;
+                std::cout << "Software prefetch sweep (hint " << prefetch_hint_name(g_prefetch_hint) << "), CPU NUMA Node " << cpu_node << ", Memory NUMA Node " << mem_node << ", Region " << mem_region << std::endl;
+                std::cout << "Throughput columns are chunk size in bits / stride in chunks, in MB/s. Latency is unloaded, in ns/access." << std::endl;
+                std::cout << std::setw(10) << "Distance";
+                for (uint32_t c = 0; c < throughput[0].size(); c++) {
+                    std::ostringstream label;
+                    label << chunk_bits[c / strides.size()] << "b/" << std::showpos << strides[c % strides.size()];
+                    std::cout << std::setw(12) << label.str();
                 }
-                else {
-                    std::cerr << "ERROR: Failed to allocate " << allocation_size << " B on NUMA node " << numa_node << " for " << config_.getNumWorkerThreads() << " worker threads." << std::endl;
-                    exit(-1);
+                std::cout << std::setw(12) << "Latency" << std::endl;
+
+                std::vector<uint32_t> best_throughput(throughput[0].size(), 0);
+                uint32_t best_latency = 0;
+                for (uint32_t d_index = 0; d_index < distances.size(); d_index++) {
+                    std::cout << std::setw(10) << distances[d_index];
+                    for (uint32_t c = 0; c < throughput[d_index].size(); c++) {
+                        std::cout << std::setw(12) << throughput[d_index][c];
+                        if (throughput[d_index][c] > throughput[best_throughput[c]][c])
+                            best_throughput[c] = d_index;
+                    }
+                    std::cout << std::setw(12) << latency[d_index] << std::endl;
+                    if (latency[d_index] > 0 && latency[d_index] < latency[best_latency])
+                        best_latency = d_index;
                 }
 
-                if (g_verbose) {
-                    std::cout << "Virtual address for memory region #" << mem_region << " on NUMA node " << numa_node << ": ";
-                    std::printf("0x%.16llx", reinterpret_cast<long long unsigned int>(mem_arrays_[region_id]));
-                    std::cout << std::endl;
+                std::cout << std::setw(10) << "Best";
+                for (uint32_t c = 0; c < best_throughput.size(); c++)
+                    std::cout << std::setw(12) << distances[best_throughput[c]];
+                std::cout << std::setw(12) << distances[best_latency] << std::endl;
+                std::cout << std::endl;
+            }
+        }
+    }
+
+    return success;
+#endif
+}
+
+bool BenchmarkManager::runMlpSweep() {
+    std::vector<uint32_t> chain_counts;
+    for (uint32_t n = 1; n <= MLP_SWEEP_MAX_CHAINS; n *= 2)
+        chain_counts.push_back(n);
+
+    bool success = true;
+    for (auto mem_node_it = memory_numa_node_affinities_.cbegin(); mem_node_it != memory_numa_node_affinities_.cend(); mem_node_it++) { //iterate each memory NUMA node
+        for (uint32_t mem_region = 0; mem_region < config_.getMemoryRegionsPerNUMANode(); mem_region++) {
+            uint32_t mem_node = *mem_node_it;
+            uint32_t region_id = mem_node * config_.getMemoryRegionsPerNUMANode() + mem_region;
+            void* mem_array = mem_arrays_[region_id];
+            size_t mem_array_len = mem_array_lens_[region_id];
+
+            for (auto cpu_node_it = cpu_numa_node_affinities_.cbegin(); cpu_node_it != cpu_numa_node_affinities_.cend(); cpu_node_it++) { //iterate each cpu NUMA node
+                uint32_t cpu_node = *cpu_node_it;
+
+                //Median latency between hops of the same chain, per chain count
+                std::vector<double> latency(chain_counts.size(), 0);
+
+                for (uint32_t n_index = 0; n_index < chain_counts.size(); n_index++) {
+                    //Unloaded latency on the first thread's share of the region. The load settings are unused with a single thread.
+                    std::string benchmark_name = static_cast<std::ostringstream*>(&(std::ostringstream() << "Test #" << g_test_index++ << "M (MLP Sweep Latency)"))->str();
+                    LatencyBenchmark benchmark(mem_array,
+                                               mem_array_len / config_.getNumWorkerThreads(),
+                                               config_.getIterationsPerTest(),
+                                               1,
+                                               mem_node,
+                                               cpu_node,
+                                               SEQUENTIAL,
+                                               READ,
+                                               CHUNK_32b,
+                                               1,
+                                               dram_power_readers_,
+                                               benchmark_name);
+                    benchmark.setWorkerPool(worker_pool_);
+                    benchmark.setRegionCache(&region_cache_);
+                    benchmark.setChains(chain_counts[n_index]);
+                    if (!benchmark.run())
+                        success = false;
+                    benchmark.reportResults(); //to console
+                    latency[n_index] = benchmark.getMedianMetric();
                 }
 
-                if (config_.latencyMatrixTestSelected() || config_.throughputMatrixTestSelected()) {
-                    std::cout << "Virtual address for memory region #" << mem_region << " on NUMA node " << numa_node << ": ";
-                    std::printf("0x%.16llx", reinterpret_cast<long long unsigned int>(mem_arrays_[region_id]));
-                    std::cout << std::endl;
+                //Summary table. By Little's law, the number of misses in flight is the access rate times the time each access takes. Using the single-chain latency as that time tells how many unloaded misses' worth of work actually overlap.
+                std::cout << std::endl;
+                std::cout << "Memory-level parallelism sweep, CPU NUMA Node " << cpu_node << ", Memory NUMA Node " << mem_node << ", Region " << mem_region << std::endl;
+                std::cout << "Latency is the time between consecutive hops of each chain, in ns. Throughput assumes one " << DEFAULT_CACHE_LINE_SIZE << "-byte cache line per hop, in MB/s." << std::endl;
+                std::cout << "Outstanding is the number of concurrent misses implied by Little's law, i.e., throughput times the latency of a single chain." << std::endl;
+                std::cout << std::setw(10) << "Chains" << std::setw(12) << "Latency" << std::setw(14) << "Throughput" << std::setw(14) << "Outstanding" << std::endl;
+
+                uint32_t best = 0;
+                std::vector<double> outstanding(chain_counts.size(), 0);
+                for (uint32_t n_index = 0; n_index < chain_counts.size(); n_index++) {
+                    double throughput = 0;
+                    if (latency[n_index] > 0) {
+                        throughput = (chain_counts[n_index] * DEFAULT_CACHE_LINE_SIZE / static_cast<double>(MB)) / (latency[n_index] / 1e9);
+                        outstanding[n_index] = chain_counts[n_index] * latency[0] / latency[n_index];
+                    }
+                    std::cout << std::setw(10) << chain_counts[n_index] << std::setw(12) << latency[n_index] << std::setw(14) << throughput << std::setw(14) << outstanding[n_index] << std::endl;
+                    if (outstanding[n_index] > outstanding[best])
+                        best = n_index;
                 }
 
-                //upwards alignment to page boundary
-                uintptr_t mask;
-                if (config_.useLargePages())
-                    mask = static_cast<uintptr_t>(g_large_page_size)-1;
-                else
-                    mask = static_cast<uintptr_t>(g_page_size)-1; //e.g. 4095 bytes
-                uintptr_t tmp_ptr = reinterpret_cast<uintptr_t>(mem_arrays_[region_id]);
-                uintptr_t aligned_addr = (tmp_ptr + mask) & ~mask; //add one page to the address, then truncate least significant bits of address to be page aligned.
-                mem_arrays_[region_id] = reinterpret_cast<void*>(aligned_addr);
+                std::cout << "Peak of " << outstanding[best] << " outstanding misses with " << chain_counts[best] << " chains." << std::endl;
+                std::cout << std::endl;
+            }
+        }
+    }
 
-                if (g_verbose) {
-                    std::cout << " --- ALIGNED --> ";
-                    std::printf("0x%.16llx", reinterpret_cast<long long unsigned int>(mem_arrays_[region_id]));
-                    std::cout << std::endl;
+    return success;
+}
+
+/**
+ * @brief Picks one logical CPU for each thread of a contention benchmark from a set of CPU NUMA nodes.
+ * @param cpu_nodes The CPU NUMA nodes to take CPUs from.
+ * @param num_threads Number of threads to place.
+ * @param scatter If true, threads are dealt round-robin across the nodes. Otherwise each node is filled before the next one is used.
+ * @param cpus Output. Logical CPU of each thread.
+ * @param first_node Output. NUMA node of the first thread.
+ * @returns True if the nodes have enough CPUs for all threads.
+ */
+static bool place_contention_threads(const std::list<uint32_t>& cpu_nodes, uint32_t num_threads, bool scatter, std::vector<int32_t>& cpus, uint32_t& first_node) {
+    std::vector< std::vector<int32_t> > node_cpus;
+    for (auto it = cpu_nodes.cbegin(); it != cpu_nodes.cend(); it++) {
+        std::vector<int32_t> in_node;
+        for (uint32_t c = 0; c < g_num_logical_cpus; c++) {
+            int32_t cpu = cpu_id_in_numa_node(*it, c);
+            if (cpu < 0)
+                break;
+            in_node.push_back(cpu);
+        }
+        node_cpus.push_back(in_node);
+    }
+
+    cpus.clear();
+    if (scatter) {
+        bool found = true;
+        for (uint32_t rank = 0; found && cpus.size() < num_threads; rank++) {
+            found = false;
+            for (uint32_t n = 0; n < node_cpus.size() && cpus.size() < num_threads; n++) {
+                if (rank < node_cpus[n].size()) {
+                    cpus.push_back(node_cpus[n][rank]);
+                    found = true;
                 }
             }
         }
     } else {
-        int flags = O_RDWR;
-        if (config_.syncMemory()) flags |= O_SYNC;
-        int fd = open("/dev/mem", flags);
-        if (fd < 0) {
-            perror("ERROR! Failed to open /dev/mem");
-            exit(-1);
+        for (uint32_t n = 0; n < node_cpus.size() && cpus.size() < num_threads; n++) {
+            for (uint32_t rank = 0; rank < node_cpus[n].size() && cpus.size() < num_threads; rank++)
+                cpus.push_back(node_cpus[n][rank]);
         }
+    }
 
-        for (uint32_t region_id = 0; region_id < mem_regions_phys_addr.size(); region_id++) {
+    //The first thread always comes from the first node that has any CPUs
+    first_node = 0;
+    for (uint32_t n = 0; n < node_cpus.size(); n++) {
+        if (!node_cpus[n].empty()) {
+            first_node = *std::next(cpu_nodes.cbegin(), n);
+            break;
+        }
+    }
 
-            size_t allocation_size = working_set_size;
-            size_t phys_addr = mem_regions_phys_addr[region_id];
+    return cpus.size() == num_threads;
+}
 
-            // Truncate offset to a multiple of the page size, or mmap will fail.
-            size_t page_size = sysconf(_SC_PAGE_SIZE);
-            size_t page_base = (phys_addr / page_size) * page_size;
-            size_t page_offset = phys_addr - page_base;
-            size_t len = page_offset + allocation_size;
+void BenchmarkManager::writeContentionResult(const ContentionBenchmark& benchmark) {
+    results_file_ << benchmark.getName() << ",";
+    results_file_ << benchmark.getIterations() << ",";
+    results_file_ << "N/A" << ",";
+    results_file_ << benchmark.getNumThreads() << ",";
+    results_file_ << benchmark.getNumThreads() << ",";
+    results_file_ << benchmark.getMemNode() << ",";
+    results_file_ << benchmark.getCPUNode() << ",";
+    results_file_ << "CONTENTION" << ",";
+    results_file_ << contention_op_name(benchmark.getOp()) << ",";
+    results_file_ << sizeof(uintptr_t) * 8 << ",";
+    results_file_ << "N/A" << ",";
+    results_file_ << benchmark.getMeanMetric() << ",";
+    results_file_ << benchmark.getMinMetric() << ",";
+    results_file_ << benchmark.get25PercentileMetric() << ",";
+    results_file_ << benchmark.getMedianMetric() << ",";
+    results_file_ << benchmark.get75PercentileMetric() << ",";
+    results_file_ << benchmark.get95PercentileMetric() << ",";
+    results_file_ << benchmark.get99PercentileMetric() << ",";
+    results_file_ << benchmark.getMaxMetric() << ",";
+    results_file_ << benchmark.getModeMetric() << ",";
+    results_file_ << benchmark.getMetricUnits() << ",";
+    results_file_ << "N/A" << ",";
+    results_file_ << "N/A" << ",";
+    results_file_ << "N/A" << ",";
+    results_file_ << benchmark.getMedianLatency() << ",";
+    results_file_ << "N/A" << ",";
+    results_file_ << "N/A" << ",";
+    results_file_ << "N/A" << ",";
+    results_file_ << "N/A" << ",";
+    results_file_ << "N/A" << ",";
+    results_file_ << "ns/op" << ",";
+    for (uint32_t j = 0; j < g_num_physical_packages; j++) {
+        results_file_ << benchmark.getMeanDRAMPower(j) << ",";
+        results_file_ << benchmark.getPeakDRAMPower(j) << ",";
+    }
+    results_file_ << "N/A" << ",";
+    results_file_ << "placement " << benchmark.getPlacement() << " / spacing " << benchmark.getSpacing() << " B / packages " << benchmark.getPackagesSpanned() << " / thread rates";
+    std::vector<double> thread_rates = benchmark.getThreadRates();
+    for (uint32_t t = 0; t < thread_rates.size(); t++)
+        results_file_ << " " << thread_rates[t];
+    results_file_ << " " << benchmark.getMetricUnits() << ",";
+    results_file_ << page_mode_name(page_mode_) << ",";
+    results_file_ << std::endl;
+}
 
+bool BenchmarkManager::runContentionBenchmarks() {
+    //Same word, same line, adjacent lines, a padded pair of lines (adjacent-line prefetchers fetch lines in pairs), and separate pages
+    std::vector<uint32_t> spacings;
+    spacings.push_back(0);
+    spacings.push_back(sizeof(uintptr_t));
+    spacings.push_back(DEFAULT_CACHE_LINE_SIZE);
+    spacings.push_back(2 * DEFAULT_CACHE_LINE_SIZE);
+    spacings.push_back(4096);
+    if (!config_.getSpacings().empty())
+        spacings = config_.getSpacings();
+
+    std::vector<uint32_t> thread_counts;
+    for (uint32_t n = 1; n < config_.getNumWorkerThreads(); n *= 2)
+        thread_counts.push_back(n);
+    thread_counts.push_back(config_.getNumWorkerThreads());
+
+    std::vector<bool> placements;
+    placements.push_back(false); //compact
+    if (cpu_numa_node_affinities_.size() > 1)
+        placements.push_back(true); //scatter
 
-            void *virt_addr = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_SHARED, fd, page_base);
-            if (virt_addr == MAP_FAILED) {
-                perror("ERROR! Failed to mmap /dev/mem");
-                exit(-1);
-            }
+    bool success = true;
+    for (auto mem_node_it = memory_numa_node_affinities_.cbegin(); mem_node_it != memory_numa_node_affinities_.cend(); mem_node_it++) { //iterate each memory NUMA node
+        uint32_t mem_node = *mem_node_it;
+        uint32_t region_id = mem_node * config_.getMemoryRegionsPerNUMANode();
+        void* mem_array = mem_arrays_[region_id];
+        size_t mem_array_len = mem_array_lens_[region_id];
+
+        for (uint32_t p_index = 0; p_index < placements.size(); p_index++) {
+            bool scatter = placements[p_index];
+            std::string placement = scatter ? "scatter" : "compact";
+
+            for (uint32_t op = 0; op < NUM_CONTENTION_OPS; op++) {
+                //Aggregate rate and time per operation, per thread count and spacing
+                std::vector< std::vector<double> > rate(thread_counts.size(), std::vector<double>(spacings.size(), 0));
+                std::vector< std::vector<double> > latency(thread_counts.size(), std::vector<double>(spacings.size(), 0));
+                std::vector<uint32_t> packages(thread_counts.size(), 0);
+                std::vector<bool> placed(thread_counts.size(), false);
+
+                for (uint32_t n_index = 0; n_index < thread_counts.size(); n_index++) {
+                    std::vector<int32_t> cpus;
+                    uint32_t cpu_node = 0;
+                    if (!place_contention_threads(cpu_numa_node_affinities_, thread_counts[n_index], scatter, cpus, cpu_node)) {
+                        std::cerr << "WARNING: The selected CPU NUMA nodes do not have " << thread_counts[n_index] << " logical CPUs. Skipping contention benchmarks with that many threads." << std::endl;
+                        continue;
+                    }
+                    placed[n_index] = true;
+
+                    for (uint32_t s_index = 0; s_index < spacings.size(); s_index++) {
+                        std::string benchmark_name = static_cast<std::ostringstream*>(&(std::ostringstream() << "Test #" << g_test_index++ << "C (Contention)"))->str();
+                        ContentionBenchmark benchmark(mem_array,
+                                                      mem_array_len,
+                                                      config_.getIterationsPerTest(),
+                                                      mem_node,
+                                                      cpu_node,
+                                                      cpus,
+                                                      placement,
+                                                      static_cast<contention_op_t>(op),
+                                                      spacings[s_index],
+                                                      dram_power_readers_,
+                                                      benchmark_name);
+                        benchmark.setWorkerPool(worker_pool_);
+                        benchmark.setRegionCache(&region_cache_);
+                        if (!benchmark.run())
+                            success = false;
+                        benchmark.reportResults(); //to console
+                        rate[n_index][s_index] = benchmark.getMedianMetric();
+                        latency[n_index][s_index] = benchmark.getMedianLatency();
+                        packages[n_index] = benchmark.getPackagesSpanned();
+
+                        //Write to results file if necessary
+                        if (config_.useOutputFile())
+                            writeContentionResult(benchmark);
+                    }
+                }
 
-            mem_arrays_[region_id] = virt_addr;
-            mem_array_lens_[region_id] = allocation_size;
-            mem_array_node_[region_id] = -1;
+                //Summary table. Rows are thread counts and columns are target spacings.
+                std::cout << std::endl;
+                std::cout << "Contention summary, " << contention_op_name(static_cast<contention_op_t>(op)) << ", " << placement << " placement, Memory NUMA Node " << mem_node << std::endl;
+                std::cout << "Each cell is the aggregate rate across all threads in Mops/s, followed by the average time per operation on each thread in ns. Columns are the distances between the targets of consecutive threads." << std::endl;
+                std::cout << std::setw(8) << "Threads" << std::setw(10) << "Packages";
+                for (uint32_t s_index = 0; s_index < spacings.size(); s_index++) {
+                    std::ostringstream heading;
+                    heading << spacings[s_index] << " B";
+                    std::cout << std::setw(22) << heading.str();
+                }
+                std::cout << std::endl;
+                for (uint32_t n_index = 0; n_index < thread_counts.size(); n_index++) {
+                    if (!placed[n_index])
+                        continue;
+                    std::cout << std::setw(8) << thread_counts[n_index] << std::setw(10) << packages[n_index];
+                    for (uint32_t s_index = 0; s_index < spacings.size(); s_index++) {
+                        std::ostringstream cell;
+                        cell.setf(std::ios::fixed);
+                        cell.precision(2);
+                        cell << rate[n_index][s_index] << " / " << latency[n_index][s_index];
+                        std::cout << std::setw(22) << cell.str();
+                    }
+                    std::cout << std::endl;
+                }
+                std::cout << std::endl;
+            }
+        }
+    }
 
-            if (config_.latencyMatrixTestSelected() || config_.throughputMatrixTestSelected()) {
-                std::cout << "Virtual address for memory region #" << region_id << ": ";
-                std::printf("0x%.16llx", static_cast<long long unsigned int>(phys_addr));
-                std::cout << " is ";
-                std::printf("0x%.16llx", reinterpret_cast<long long unsigned int>(virt_addr));
+    return success;
+}
+
+bool BenchmarkManager::runFalseSharingBenchmarks() {
+    //Same line, adjacent lines, a padded pair of lines (adjacent-line prefetchers fetch lines in pairs), and separate pages
+    std::vector<uint32_t> spacings;
+    spacings.push_back(sizeof(uintptr_t));
+    spacings.push_back(DEFAULT_CACHE_LINE_SIZE);
+    spacings.push_back(2 * DEFAULT_CACHE_LINE_SIZE);
+    spacings.push_back(4096);
+    if (!config_.getSpacings().empty())
+        spacings = config_.getSpacings();
+    std::sort(spacings.begin(), spacings.end());
+
+    uint32_t num_threads = config_.getNumWorkerThreads();
+    if (num_threads < 2) {
+        std::cerr << "ERROR: The false sharing benchmarks need at least two worker threads." << std::endl;
+        return false;
+    }
+
+    std::vector<bool> placements;
+    placements.push_back(false); //compact
+    if (cpu_numa_node_affinities_.size() > 1)
+        placements.push_back(true); //scatter
+
+    std::vector<contention_op_t> ops;
+    ops.push_back(CONTENTION_INCREMENT);
+    ops.push_back(CONTENTION_STORE);
+
+    bool success = true;
+    for (auto mem_node_it = memory_numa_node_affinities_.cbegin(); mem_node_it != memory_numa_node_affinities_.cend(); mem_node_it++) { //iterate each memory NUMA node
+        uint32_t mem_node = *mem_node_it;
+        uint32_t region_id = mem_node * config_.getMemoryRegionsPerNUMANode();
+        void* mem_array = mem_arrays_[region_id];
+        size_t mem_array_len = mem_array_lens_[region_id];
+
+        for (uint32_t p_index = 0; p_index < placements.size(); p_index++) {
+            bool scatter = placements[p_index];
+            std::string placement = scatter ? "scatter" : "compact";
+
+            std::vector<int32_t> cpus;
+            uint32_t cpu_node = 0;
+            if (!place_contention_threads(cpu_numa_node_affinities_, num_threads, scatter, cpus, cpu_node)) {
+                std::cerr << "ERROR: The selected CPU NUMA nodes do not have " << num_threads << " logical CPUs for the false sharing benchmarks." << std::endl;
+                return false;
+            }
+
+            for (uint32_t op_index = 0; op_index < ops.size(); op_index++) {
+                //Aggregate rate and the slowest and fastest thread, per spacing
+                std::vector<double> rate(spacings.size(), 0);
+                std::vector<double> min_thread_rate(spacings.size(), 0);
+                std::vector<double> max_thread_rate(spacings.size(), 0);
+
+                for (uint32_t s_index = 0; s_index < spacings.size(); s_index++) {
+                    std::string benchmark_name = static_cast<std::ostringstream*>(&(std::ostringstream() << "Test #" << g_test_index++ << "F (False Sharing)"))->str();
+                    ContentionBenchmark benchmark(mem_array,
+                                                  mem_array_len,
+                                                  config_.getIterationsPerTest(),
+                                                  mem_node,
+                                                  cpu_node,
+                                                  cpus,
+                                                  placement,
+                                                  ops[op_index],
+                                                  spacings[s_index],
+                                                  dram_power_readers_,
+                                                  benchmark_name);
+                    benchmark.setWorkerPool(worker_pool_);
+                    benchmark.setRegionCache(&region_cache_);
+                    if (!benchmark.run())
+                        success = false;
+                    benchmark.reportResults(); //to console
+                    rate[s_index] = benchmark.getMedianMetric();
+                    std::vector<double> thread_rates = benchmark.getThreadRates();
+                    if (!thread_rates.empty()) {
+                        min_thread_rate[s_index] = *std::min_element(thread_rates.begin(), thread_rates.end());
+                        max_thread_rate[s_index] = *std::max_element(thread_rates.begin(), thread_rates.end());
+                    }
+
+                    //Write to results file if necessary
+                    if (config_.useOutputFile())
+                        writeContentionResult(benchmark);
+                }
+
+                //Summary table. Rows are spacings, compared against the widest one, which should be free of any sharing.
+                double widest_rate = rate[spacings.size()-1];
+                std::cout << std::endl;
+                std::cout << "False sharing summary, " << contention_op_name(ops[op_index]) << ", " << num_threads << " threads, " << placement << " placement, Memory NUMA Node " << mem_node << std::endl;
+                std::cout << "Rates are in Mops/s. The last column is the aggregate rate relative to the widest spacing." << std::endl;
+                std::cout << std::setw(12) << "Spacing" << std::setw(14) << "Aggregate" << std::setw(14) << "Min thread" << std::setw(14) << "Max thread" << std::setw(14) << "vs. widest" << std::endl;
+                int32_t padding = -1;
+                for (uint32_t s_index = 0; s_index < spacings.size(); s_index++) {
+                    std::ostringstream spacing;
+                    spacing << spacings[s_index] << " B";
+                    std::ostringstream cells;
+                    cells.setf(std::ios::fixed);
+                    cells.precision(2);
+                    cells << std::setw(14) << rate[s_index] << std::setw(14) << min_thread_rate[s_index] << std::setw(14) << max_thread_rate[s_index];
+                    if (widest_rate > 0)
+                        cells << std::setw(13) << rate[s_index] / widest_rate * 100 << "%";
+                    else
+                        cells << std::setw(14) << "?";
+                    std::cout << std::setw(12) << spacing.str() << cells.str() << std::endl;
+
+                    if (padding < 0 && widest_rate > 0 && rate[s_index] >= (1 - FALSE_SHARING_TOLERANCE) * widest_rate)
+                        padding = static_cast<int32_t>(spacings[s_index]);
+                }
+                if (padding >= 0)
+                    std::cout << "Smallest spacing within " << FALSE_SHARING_TOLERANCE * 100 << "% of the widest: " << padding << " B" << std::endl;
+                std::cout << std::endl;
+            }
+        }
+    }
+
+    if (g_verbose)
+        std::cout << std::endl << "Done running false sharing benchmarks." << std::endl;
+
+    return success;
+}
+
+bool BenchmarkManager::runCoreToCoreMatrix() {
+    //Every logical CPU of the selected CPU NUMA nodes, and the node of each
+    std::vector<uint32_t> cpus;
+    std::vector<uint32_t> cpu_nodes;
+    for (auto cpu_node_it = cpu_numa_node_affinities_.cbegin(); cpu_node_it != cpu_numa_node_affinities_.cend(); cpu_node_it++) {
+        for (uint32_t c = 0; c < g_num_logical_cpus; c++) {
+            int32_t cpu = cpu_id_in_numa_node(*cpu_node_it, c);
+            if (cpu < 0)
+                break;
+            cpus.push_back(static_cast<uint32_t>(cpu));
+            cpu_nodes.push_back(*cpu_node_it);
+        }
+    }
+
+    if (cpus.size() < 2) {
+        std::cerr << "ERROR: The core-to-core latency matrix needs at least two logical CPUs in the selected CPU NUMA nodes." << std::endl;
+        return false;
+    }
+
+    bool success = true;
+    for (auto mem_node_it = memory_numa_node_affinities_.cbegin(); mem_node_it != memory_numa_node_affinities_.cend(); mem_node_it++) { //iterate each memory NUMA node
+        uint32_t mem_node = *mem_node_it;
+        uint32_t region_id = mem_node * config_.getMemoryRegionsPerNUMANode();
+        void* mem_array = mem_arrays_[region_id];
+        size_t mem_array_len = mem_array_lens_[region_id];
+
+        std::vector< std::vector<double> > median(cpus.size(), std::vector<double>(cpus.size(), 0));
+        std::vector< std::vector<double> > tail(cpus.size(), std::vector<double>(cpus.size(), 0));
+
+        for (uint32_t row = 0; row < cpus.size(); row++) {
+            for (uint32_t col = 0; col < cpus.size(); col++) {
+                if (row == col)
+                    continue;
+
+                std::string benchmark_name = static_cast<std::ostringstream*>(&(std::ostringstream() << "Test #" << g_test_index++ << "X (Core-to-Core Latency)"))->str();
+                CoreToCoreBenchmark benchmark(mem_array,
+                                              mem_array_len,
+                                              config_.getIterationsPerTest(),
+                                              mem_node,
+                                              cpu_nodes[row],
+                                              cpus[row],
+                                              cpus[col],
+                                              dram_power_readers_,
+                                              benchmark_name);
+                benchmark.setWorkerPool(worker_pool_);
+                benchmark.setRegionCache(&region_cache_);
+                if (!benchmark.run())
+                    success = false;
+                benchmark.reportResults(); //to console
+                median[row][col] = benchmark.getMedianMetric();
+                tail[row][col] = benchmark.getTailLatency();
+
+                //Write to results file if necessary
+                if (config_.useOutputFile()) {
+                    results_file_ << benchmark.getName() << ",";
+                    results_file_ << benchmark.getIterations() << ",";
+                    results_file_ << "N/A" << ",";
+                    results_file_ << benchmark.getNumThreads() << ",";
+                    results_file_ << 0 << ",";
+                    results_file_ << benchmark.getMemNode() << ",";
+                    results_file_ << benchmark.getCPUNode() << ",";
+                    results_file_ << "N/A" << ",";
+                    results_file_ << "N/A" << ",";
+                    results_file_ << "N/A" << ",";
+                    results_file_ << "N/A" << ",";
+                    results_file_ << "N/A" << ",";
+                    results_file_ << "N/A" << ",";
+                    results_file_ << "N/A" << ",";
+                    results_file_ << "N/A" << ",";
+                    results_file_ << "N/A" << ",";
+                    results_file_ << "N/A" << ",";
+                    results_file_ << "N/A" << ",";
+                    results_file_ << "N/A" << ",";
+                    results_file_ << "N/A" << ",";
+                    results_file_ << "N/A" << ",";
+                    results_file_ << benchmark.getMeanMetric() << ",";
+                    results_file_ << benchmark.getMinMetric() << ",";
+                    results_file_ << benchmark.get25PercentileMetric() << ",";
+                    results_file_ << benchmark.getMedianMetric() << ",";
+                    results_file_ << benchmark.get75PercentileMetric() << ",";
+                    results_file_ << benchmark.get95PercentileMetric() << ",";
+                    results_file_ << benchmark.get99PercentileMetric() << ",";
+                    results_file_ << benchmark.getMaxMetric() << ",";
+                    results_file_ << benchmark.getModeMetric() << ",";
+                    results_file_ << benchmark.getMetricUnits() << ",";
+                    for (uint32_t j = 0; j < g_num_physical_packages; j++) {
+                        results_file_ << benchmark.getMeanDRAMPower(j) << ",";
+                        results_file_ << benchmark.getPeakDRAMPower(j) << ",";
+                    }
+                    results_file_ << "N/A" << ",";
+                    results_file_ << "core-to-core CPU " << benchmark.getInitiatorCPU() << " -> CPU " << benchmark.getResponderCPU() << " / 99th percentile over passes " << benchmark.getTailLatency() << " ns" << ",";
+                    results_file_ << page_mode_name(page_mode_) << ",";
+                    results_file_ << std::endl;
+                }
+
+                if (config_.useDecNetFile()) {
+                    dec_net_results_file_ << "bench_result(";
+                    dec_net_results_file_ << benchmark.getInitiatorCPU() << ", ";
+                    dec_net_results_file_ << benchmark.getResponderCPU() << ", ";
+                    dec_net_results_file_ << "'core_to_core_latency'" << ", ";
+                    dec_net_results_file_ << benchmark.getMedianMetric() << ", ";
+                    dec_net_results_file_ << "'" << benchmark.getMetricUnits() << "'" << ").";
+                    dec_net_results_file_ << std::endl;
+                    dec_net_results_file_ << "bench_result(";
+                    dec_net_results_file_ << benchmark.getInitiatorCPU() << ", ";
+                    dec_net_results_file_ << benchmark.getResponderCPU() << ", ";
+                    dec_net_results_file_ << "'core_to_core_tail_latency'" << ", ";
+                    dec_net_results_file_ << benchmark.getTailLatency() << ", ";
+                    dec_net_results_file_ << "'" << benchmark.getMetricUnits() << "'" << ").";
+                    dec_net_results_file_ << std::endl;
+                }
+            }
+        }
+        std::cout << std::endl;
+
+        //Aggregated report of the core-to-core benchmarks for this memory node
+        std::cout << "Core-to-core latency matrix, line on Memory NUMA Node " << mem_node << std::endl;
+        printCoreToCoreMatrix(cpus, median, "ns", "median one-way latencies");
+        std::cout << std::endl;
+        printCoreToCoreMatrix(cpus, tail, "ns", "99th percentile one-way latencies");
+    }
+
+    if (g_verbose)
+        std::cout << std::endl << "Done running core-to-core latency matrix benchmarks." << std::endl;
+
+    return success;
+}
+
+bool BenchmarkManager::runProducerConsumerBenchmarks() {
+    //Every logical CPU of the selected CPU NUMA nodes, and the node of each
+    std::vector<uint32_t> cpus;
+    std::vector<uint32_t> cpu_nodes;
+    for (auto cpu_node_it = cpu_numa_node_affinities_.cbegin(); cpu_node_it != cpu_numa_node_affinities_.cend(); cpu_node_it++) {
+        for (uint32_t c = 0; c < g_num_logical_cpus; c++) {
+            int32_t cpu = cpu_id_in_numa_node(*cpu_node_it, c);
+            if (cpu < 0)
+                break;
+            cpus.push_back(static_cast<uint32_t>(cpu));
+            cpu_nodes.push_back(*cpu_node_it);
+        }
+    }
+
+    if (cpus.size() < 2) {
+        std::cerr << "ERROR: The producer/consumer benchmarks need at least two logical CPUs in the selected CPU NUMA nodes." << std::endl;
+        return false;
+    }
+
+    //The first pair of each relation, as indices into cpus. The lower-numbered CPU produces.
+    std::vector<int32_t> producers(NUM_CPU_PAIR_RELATIONS, -1);
+    std::vector<int32_t> consumers(NUM_CPU_PAIR_RELATIONS, -1);
+    for (uint32_t a = 0; a < cpus.size(); a++) {
+        for (uint32_t b = a+1; b < cpus.size(); b++) {
+            cpu_pair_relation_t relation = cpu_pair_relation(cpus[a], cpus[b]);
+            if (producers[relation] < 0) {
+                producers[relation] = static_cast<int32_t>(a);
+                consumers[relation] = static_cast<int32_t>(b);
+            }
+        }
+    }
+
+    for (uint32_t r = 0; r < NUM_CPU_PAIR_RELATIONS; r++) {
+        if (producers[r] < 0)
+            std::cerr << "WARNING: The selected CPU NUMA nodes have no pair of logical CPUs of the kind \"" << cpu_pair_relation_name(static_cast<cpu_pair_relation_t>(r)) << "\". Skipping it in the producer/consumer benchmarks." << std::endl;
+    }
+
+    size_t ring_size = config_.getWorkingSetSizePerThread();
+
+    bool success = true;
+    for (auto mem_node_it = memory_numa_node_affinities_.cbegin(); mem_node_it != memory_numa_node_affinities_.cend(); mem_node_it++) { //iterate each memory NUMA node
+        uint32_t mem_node = *mem_node_it;
+        uint32_t region_id = mem_node * config_.getMemoryRegionsPerNUMANode();
+        void* mem_array = mem_arrays_[region_id];
+        size_t mem_array_len = mem_array_lens_[region_id];
+
+        std::vector<double> bandwidth(NUM_CPU_PAIR_RELATIONS, 0);
+        std::vector<double> median_latency(NUM_CPU_PAIR_RELATIONS, 0);
+        std::vector<double> p95_latency(NUM_CPU_PAIR_RELATIONS, 0);
+        std::vector<double> p99_latency(NUM_CPU_PAIR_RELATIONS, 0);
+
+        for (uint32_t r = 0; r < NUM_CPU_PAIR_RELATIONS; r++) {
+            if (producers[r] < 0)
+                continue;
+
+            std::string benchmark_name = static_cast<std::ostringstream*>(&(std::ostringstream() << "Test #" << g_test_index++ << "Q (Producer/Consumer)"))->str();
+            ProducerConsumerBenchmark benchmark(mem_array,
+                                                mem_array_len,
+                                                config_.getIterationsPerTest(),
+                                                ring_size,
+                                                mem_node,
+                                                cpu_nodes[producers[r]],
+                                                cpus[producers[r]],
+                                                cpus[consumers[r]],
+                                                dram_power_readers_,
+                                                benchmark_name);
+            benchmark.setWorkerPool(worker_pool_);
+            benchmark.setRegionCache(&region_cache_);
+            if (!benchmark.run())
+                success = false;
+            benchmark.reportResults(); //to console
+            bandwidth[r] = benchmark.getMedianMetric();
+            median_latency[r] = benchmark.getMedianMessageLatency();
+            p95_latency[r] = benchmark.get95PercentileMessageLatency();
+            p99_latency[r] = benchmark.get99PercentileMessageLatency();
+
+            //Write to results file if necessary
+            if (config_.useOutputFile()) {
+                results_file_ << benchmark.getName() << ",";
+                results_file_ << benchmark.getIterations() << ",";
+                results_file_ << static_cast<size_t>(benchmark.getRingSize() / KB) << ",";
+                results_file_ << benchmark.getNumThreads() << ",";
+                results_file_ << benchmark.getNumThreads() << ",";
+                results_file_ << benchmark.getMemNode() << ",";
+                results_file_ << benchmark.getCPUNode() << ",";
+                results_file_ << "PRODUCER_CONSUMER" << ",";
+                results_file_ << "N/A" << ",";
+                results_file_ << DEFAULT_CACHE_LINE_SIZE * 8 << ",";
+                results_file_ << "N/A" << ",";
+                results_file_ << benchmark.getMeanMetric() << ",";
+                results_file_ << benchmark.getMinMetric() << ",";
+                results_file_ << benchmark.get25PercentileMetric() << ",";
+                results_file_ << benchmark.getMedianMetric() << ",";
+                results_file_ << benchmark.get75PercentileMetric() << ",";
+                results_file_ << benchmark.get95PercentileMetric() << ",";
+                results_file_ << benchmark.get99PercentileMetric() << ",";
+                results_file_ << benchmark.getMaxMetric() << ",";
+                results_file_ << benchmark.getModeMetric() << ",";
+                results_file_ << benchmark.getMetricUnits() << ",";
+                results_file_ << "N/A" << ",";
+                results_file_ << "N/A" << ",";
+                results_file_ << "N/A" << ",";
+                results_file_ << benchmark.getMedianMessageLatency() << ",";
+                results_file_ << "N/A" << ",";
+                results_file_ << benchmark.get95PercentileMessageLatency() << ",";
+                results_file_ << benchmark.get99PercentileMessageLatency() << ",";
+                results_file_ << "N/A" << ",";
+                results_file_ << "N/A" << ",";
+                results_file_ << "ns/message" << ",";
+                for (uint32_t j = 0; j < g_num_physical_packages; j++) {
+                    results_file_ << benchmark.getMeanDRAMPower(j) << ",";
+                    results_file_ << benchmark.getPeakDRAMPower(j) << ",";
+                }
+                results_file_ << "N/A" << ",";
+                results_file_ << "producer CPU " << benchmark.getProducerCPU() << " -> consumer CPU " << benchmark.getConsumerCPU() << " / " << cpu_pair_relation_name(benchmark.getRelation()) << ",";
+                results_file_ << page_mode_name(page_mode_) << ",";
+                results_file_ << std::endl;
+            }
+        }
+
+        //Summary table. Rows are CPU pair relations from closest to farthest.
+        std::cout << std::endl;
+        std::cout << "Producer/consumer summary, " << ring_size / KB << " KB ring buffer on Memory NUMA Node " << mem_node << std::endl;
+        std::cout << "Bandwidth is the median rate at which the consumer receives " << DEFAULT_CACHE_LINE_SIZE << "-byte messages. Latency is from just before the producer writes a message until the consumer finds it, including time queued in the ring." << std::endl;
+        std::cout << std::setw(16) << "CPU pair" << std::setw(10) << "Producer" << std::setw(10) << "Consumer" << std::setw(10) << "GB/s" << std::setw(14) << "Median (ns)" << std::setw(14) << "95th (ns)" << std::setw(14) << "99th (ns)" << std::endl;
+        for (uint32_t r = 0; r < NUM_CPU_PAIR_RELATIONS; r++) {
+            if (producers[r] < 0)
+                continue;
+            std::ostringstream cells; //bandwidth in GB/s
+            cells.setf(std::ios::fixed);
+            cells.precision(2);
+            cells << std::setw(10) << bandwidth[r] / 1024 << std::setw(14) << median_latency[r] << std::setw(14) << p95_latency[r] << std::setw(14) << p99_latency[r];
+            std::cout << std::setw(16) << cpu_pair_relation_name(static_cast<cpu_pair_relation_t>(r)) << std::setw(10) << cpus[producers[r]] << std::setw(10) << cpus[consumers[r]] << cells.str() << std::endl;
+        }
+        std::cout << std::endl;
+    }
+
+    if (g_verbose)
+        std::cout << std::endl << "Done running producer/consumer benchmarks." << std::endl;
+
+    return success;
+}
+
+bool BenchmarkManager::runDRAMMappingBenchmarks() {
+    bool success = true;
+    for (auto mem_node_it = memory_numa_node_affinities_.cbegin(); mem_node_it != memory_numa_node_affinities_.cend(); mem_node_it++) { //iterate each memory NUMA node
+        uint32_t mem_node = *mem_node_it;
+        uint32_t region_id = mem_node * config_.getMemoryRegionsPerNUMANode();
+
+        //Time from the memory node itself if it is selected, so that remote hops do not blur the conflicts
+        uint32_t cpu_node = cpu_numa_node_affinities_.front();
+        if (std::find(cpu_numa_node_affinities_.begin(), cpu_numa_node_affinities_.end(), mem_node) != cpu_numa_node_affinities_.end())
+            cpu_node = mem_node;
+        int32_t cpu = cpu_id_in_numa_node(cpu_node, 0);
+        if (cpu < 0) {
+            std::cerr << "ERROR: No logical CPU found in CPU NUMA node " << cpu_node << "." << std::endl;
+            success = false;
+            continue;
+        }
+
+        std::string benchmark_name = static_cast<std::ostringstream*>(&(std::ostringstream() << "Test #" << g_test_index++ << "D (DRAM Address Mapping)"))->str();
+        DRAMMappingBenchmark benchmark(mem_arrays_[region_id],
+                                       mem_array_lens_[region_id],
+                                       config_.getIterationsPerTest(),
+                                       mem_node,
+                                       cpu_node,
+                                       static_cast<uint32_t>(cpu),
+                                       config_.pagemapSelected(),
+                                       mem_array_phys_addrs_.size() > 0 ? mem_array_phys_addrs_[region_id] : 0,
+                                       dram_power_readers_,
+                                       benchmark_name);
+        benchmark.setWorkerPool(worker_pool_);
+        benchmark.setRegionCache(&region_cache_);
+        if (!benchmark.run()) {
+            success = false;
+            continue;
+        }
+        benchmark.reportResults(); //to console
+
+        std::vector<uint64_t> functions = benchmark.getBankFunctions();
+        std::vector<uint32_t> row_bits = benchmark.getRowBits();
+        std::vector<uint32_t> column_bits = benchmark.getColumnBits();
+        std::vector<uint32_t> interleave_bits = benchmark.getInterleaveBits();
+
+        //Write to results file if necessary
+        if (config_.useOutputFile()) {
+            results_file_ << benchmark.getName() << ",";
+            results_file_ << benchmark.getIterations() << ",";
+            results_file_ << "N/A" << ",";
+            results_file_ << benchmark.getNumThreads() << ",";
+            results_file_ << 0 << ",";
+            results_file_ << benchmark.getMemNode() << ",";
+            results_file_ << benchmark.getCPUNode() << ",";
+            results_file_ << "N/A" << ",";
+            results_file_ << "N/A" << ",";
+            results_file_ << "N/A" << ",";
+            results_file_ << "N/A" << ",";
+            results_file_ << "N/A" << ",";
+            results_file_ << "N/A" << ",";
+            results_file_ << "N/A" << ",";
+            results_file_ << "N/A" << ",";
+            results_file_ << "N/A" << ",";
+            results_file_ << "N/A" << ",";
+            results_file_ << "N/A" << ",";
+            results_file_ << "N/A" << ",";
+            results_file_ << "N/A" << ",";
+            results_file_ << "N/A" << ",";
+            results_file_ << benchmark.getMeanMetric() << ",";
+            results_file_ << benchmark.getMinMetric() << ",";
+            results_file_ << benchmark.get25PercentileMetric() << ",";
+            results_file_ << benchmark.getMedianMetric() << ",";
+            results_file_ << benchmark.get75PercentileMetric() << ",";
+            results_file_ << benchmark.get95PercentileMetric() << ",";
+            results_file_ << benchmark.get99PercentileMetric() << ",";
+            results_file_ << benchmark.getMaxMetric() << ",";
+            results_file_ << benchmark.getModeMetric() << ",";
+            results_file_ << benchmark.getMetricUnits() << ",";
+            for (uint32_t j = 0; j < g_num_physical_packages; j++) {
+                results_file_ << benchmark.getMeanDRAMPower(j) << ",";
+                results_file_ << benchmark.getPeakDRAMPower(j) << ",";
+            }
+            results_file_ << "N/A" << ",";
+            results_file_ << "DRAM mapping CPU " << benchmark.getCPU() << " / " << benchmark.getNumSets() << " same-bank sets / " << functions.size() << " bank functions / conflict threshold " << benchmark.getConflictThreshold() << " ns" << ",";
+            results_file_ << page_mode_name(page_mode_) << ",";
+            results_file_ << std::endl;
+        }
+
+        //Bank functions as lists of XORed bits, e.g., dram_bank_function(0, 1, [14, 18]). for the second function of memory node 0
+        if (config_.useDecNetFile()) {
+            dec_net_results_file_ << "dram_conflict_threshold(" << mem_node << ", " << benchmark.getConflictThreshold() << ", '" << benchmark.getMetricUnits() << "')." << std::endl;
+            for (uint32_t f = 0; f < functions.size(); f++) {
+                dec_net_results_file_ << "dram_bank_function(" << mem_node << ", " << f << ", [";
+                bool first = true;
+                for (uint32_t b = 0; b < 64; b++) {
+                    if ((functions[f] >> b) & 1) {
+                        dec_net_results_file_ << (first ? "" : ", ") << b;
+                        first = false;
+                    }
+                }
+                dec_net_results_file_ << "])." << std::endl;
+            }
+            dec_net_results_file_ << "dram_row_bits(" << mem_node << ", [";
+            for (uint32_t b = 0; b < row_bits.size(); b++)
+                dec_net_results_file_ << (b > 0 ? ", " : "") << row_bits[b];
+            dec_net_results_file_ << "])." << std::endl;
+            dec_net_results_file_ << "dram_column_bits(" << mem_node << ", [";
+            for (uint32_t b = 0; b < column_bits.size(); b++)
+                dec_net_results_file_ << (b > 0 ? ", " : "") << column_bits[b];
+            dec_net_results_file_ << "])." << std::endl;
+            dec_net_results_file_ << "dram_interleave_bits(" << mem_node << ", [";
+            for (uint32_t b = 0; b < interleave_bits.size(); b++)
+                dec_net_results_file_ << (b > 0 ? ", " : "") << interleave_bits[b];
+            dec_net_results_file_ << "])." << std::endl;
+        }
+    }
+
+    if (g_verbose)
+        std::cout << std::endl << "Done running DRAM address mapping benchmarks." << std::endl;
+
+    return success;
+}
+
+void BenchmarkManager::setupWorkingSets(size_t working_set_size) {
+    //Allocate memory in each NUMA node to be tested
+
+    uint32_t mem_regions_per_numa = config_.getMemoryRegionsPerNUMANode();
+
+    std::vector<uint64_t> mem_regions_phys_addr = config_.getMemoryRegionsPhysAddresses();
+
+    uint32_t mem_regions_per_cpu = config_.memoryRegionsInPhysAddr() ? mem_regions_phys_addr.size()
+                                                                     : g_num_numa_nodes * mem_regions_per_numa;
+
+    mem_arrays_.resize(mem_regions_per_cpu);
+    mem_array_mappings_.resize(mem_regions_per_cpu);
+    mem_array_lens_.resize(mem_regions_per_cpu);
+    mem_array_mapped_lens_.resize(mem_regions_per_cpu);
+    mem_array_node_.resize(mem_regions_per_cpu);
+    if (config_.memoryRegionsInPhysAddr() || config_.pagemapSelected())
+        mem_array_phys_addrs_.resize(mem_regions_per_cpu);
+
+    if (! config_.memoryRegionsInPhysAddr()) {
+        //We reserve the space for these, but that doesn't mean they will all be used.
+        for (auto it = memory_numa_node_affinities_.cbegin(); it != memory_numa_node_affinities_.cend(); it++) {
+            for (uint32_t mem_region = 0; mem_region < mem_regions_per_numa; mem_region++) {
+                uint32_t numa_node = *it;
+                uint32_t region_id = numa_node * mem_regions_per_numa + mem_region;
+                mem_array_node_[region_id] = numa_node;
+                size_t allocation_size = config_.getNumWorkerThreads() * working_set_size;
+                tick_t start_tick = start_timer(); //the populate prefault mode faults pages in during allocation
+
+#ifdef _WIN32
+                DWORD allocation_type = MEM_COMMIT | MEM_RESERVE;
+#ifdef HAS_LARGE_PAGES
+                if (page_mode_ == PAGE_MODE_2MB) {
+                    //Make sure we have necessary privileges
+                    HANDLE hToken;
+                    if (!OpenProcessToken(GetCurrentProcess(), TOKEN_ADJUST_PRIVILEGES | TOKEN_QUERY, &hToken)) {
+                        std::cerr << "ERROR: Failed to open process token to adjust privileges! Did you remember to run in Administrator mode?" << std::endl;
+                        exit(-1);
+                    }
+                    if (!SetPrivilege(hToken,"SeLockMemoryPrivilege", true)) {
+                        std::cerr << "ERROR: Failed to adjust privileges to allow locking memory pages! Did you remember to run in Administrator mode?" << std::endl;
+                        exit(-1);
+                    }
+                    CloseHandle(hToken);
+
+                    //Large page allocations must be a whole number of large pages, which could be more than we actually use.
+                    allocation_size = ((allocation_size + g_large_page_size - 1) / g_large_page_size) * g_large_page_size;
+                    allocation_type |= MEM_LARGE_PAGES;
+                }
+#endif
+                mem_arrays_[region_id] = VirtualAllocExNuma(GetCurrentProcess(), NULL, allocation_size, allocation_type, PAGE_READWRITE, numa_node); //Windows NUMA allocation. The result is aligned to the allocation granularity, which is at least a page.
+                mem_array_mapped_lens_[region_id] = allocation_size;
+#endif
+#ifdef __gnu_linux__
+                mem_arrays_[region_id] = allocateRegion(allocation_size, numa_node, &mem_array_mapped_lens_[region_id]);
+#endif
+
+                if (mem_arrays_[region_id] != nullptr) {
+                    mem_array_mappings_[region_id] = mem_arrays_[region_id];
+                    mem_array_lens_[region_id] = config_.getNumWorkerThreads() * working_set_size;
+                }
+                else {
+                    std::cerr << "ERROR: Failed to allocate " << allocation_size << " B with " << page_mode_name(page_mode_) << " pages on NUMA node " << numa_node << " for " << config_.getNumWorkerThreads() << " worker threads." << std::endl;
+                    exit(-1);
+                }
+
+                if (g_verbose || config_.latencyMatrixTestSelected() || config_.throughputMatrixTestSelected()) {
+                    std::cout << "Virtual address for memory region #" << mem_region << " on NUMA node " << numa_node << ": ";
+                    std::printf("0x%.16llx", reinterpret_cast<long long unsigned int>(mem_arrays_[region_id]));
+                    std::cout << std::endl;
+                }
+
+                //Fault the region in now, so that benchmarks only need to warm the caches
+                if (config_.getPrefaultMode() != PREFAULT_NONE) {
+                    if (config_.getPrefaultMode() == PREFAULT_THREADS && !prefaultRegion(region_id)) {
+                        std::cerr << "ERROR: Failed to prefault memory region #" << mem_region << " on NUMA node " << numa_node << "." << std::endl;
+                        exit(-1);
+                    }
+                    tick_t stop_tick = stop_timer();
+                    if (verifyRegion(region_id))
+                        region_cache_.markResident(mem_arrays_[region_id], reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_arrays_[region_id]) + mem_array_lens_[region_id]));
+                    if (g_verbose)
+                        std::cout << "Prefaulted memory region #" << mem_region << " on NUMA node " << numa_node << " with " << prefault_mode_name(config_.getPrefaultMode()) << " in " << (stop_tick - start_tick) * g_ns_per_tick / 1e6 << " ms" << std::endl;
+                }
+
+#ifdef __gnu_linux__
+                if (config_.pagemapSelected() && !resolveRegion(region_id)) {
+                    std::cerr << "ERROR: Failed to resolve the physical addresses of memory region #" << mem_region << " on NUMA node " << numa_node << "." << std::endl;
+                    exit(-1);
+                }
+#endif
+            }
+        }
+    } else {
+        int flags = O_RDWR;
+        if (config_.syncMemory()) flags |= O_SYNC;
+        int fd = open("/dev/mem", flags);
+        if (fd < 0) {
+            perror("ERROR! Failed to open /dev/mem");
+            exit(-1);
+        }
+
+        for (uint32_t region_id = 0; region_id < mem_regions_phys_addr.size(); region_id++) {
+
+            size_t allocation_size = working_set_size;
+            size_t phys_addr = mem_regions_phys_addr[region_id];
+
+            // Truncate offset to a multiple of the page size, or mmap will fail.
+            size_t page_size = sysconf(_SC_PAGE_SIZE);
+            size_t page_base = (phys_addr / page_size) * page_size;
+            size_t page_offset = phys_addr - page_base;
+            size_t len = page_offset + allocation_size;
+
+
+            void *virt_addr = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_SHARED, fd, page_base);
+            if (virt_addr == MAP_FAILED) {
+                perror("ERROR! Failed to mmap /dev/mem");
+                exit(-1);
+            }
+
+            mem_arrays_[region_id] = virt_addr;
+            mem_array_mappings_[region_id] = virt_addr;
+            mem_array_lens_[region_id] = allocation_size;
+            mem_array_mapped_lens_[region_id] = len;
+            mem_array_phys_addrs_[region_id] = phys_addr;
+            mem_array_node_[region_id] = -1;
+
+            if (config_.latencyMatrixTestSelected() || config_.throughputMatrixTestSelected()) {
+                std::cout << "Virtual address for memory region #" << region_id << ": ";
+                std::printf("0x%.16llx", static_cast<long long unsigned int>(phys_addr));
+                std::cout << " is ";
+                std::printf("0x%.16llx", reinterpret_cast<long long unsigned int>(virt_addr));
 
                 // check on which NUMA node this region belongs to
                 size_t num_pages = len / page_size;
@@ -1009,6 +2028,376 @@ void BenchmarkManager::setupWorkingSets(size_t working_set_size) {
     std::cout << std::endl;
 }
 
+void BenchmarkManager::freeWorkingSets() {
+    //Free throughput benchmarks
+    for (uint32_t i = 0; i < tp_benchmarks_.size(); i++)
+        delete tp_benchmarks_[i];
+    tp_benchmarks_.clear();
+    //Free latency benchmarks
+    for (uint32_t i = 0; i < lat_benchmarks_.size(); i++)
+        delete lat_benchmarks_[i];
+    lat_benchmarks_.clear();
+    //Free latency matrix benchmarks
+    for (uint32_t i = 0; i < lat_mat_benchmarks_.size(); i++)
+        delete lat_mat_benchmarks_[i];
+    lat_mat_benchmarks_.clear();
+    //Free throughput matrix benchmarks
+    for (uint32_t i = 0; i < thr_mat_benchmarks_.size(); i++)
+        delete thr_mat_benchmarks_[i];
+    thr_mat_benchmarks_.clear();
+    built_benchmarks_ = false;
+
+    //Free memory arrays
+    for (uint32_t i = 0; i < mem_array_mappings_.size(); i++) {
+        if (mem_array_mappings_[i] != nullptr) {
+            //Forget the preparation state, since new regions may land on the same addresses
+            region_cache_.release(mem_array_mappings_[i], reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_mappings_[i]) + mem_array_mapped_lens_[i]));
+#ifdef _WIN32
+            VirtualFreeEx(GetCurrentProcess(), mem_array_mappings_[i], 0, MEM_RELEASE);
+#endif
+#ifdef __gnu_linux__
+            if (munmap(mem_array_mappings_[i], mem_array_mapped_lens_[i]) < 0) {
+                perror("Failed to munmap() memory regions:");
+            }
+#endif
+        }
+    }
+    mem_arrays_.clear();
+    mem_array_mappings_.clear();
+    mem_array_lens_.clear();
+    mem_array_mapped_lens_.clear();
+    mem_array_node_.clear();
+    mem_array_phys_addrs_.clear();
+}
+
+#ifdef __gnu_linux__
+void* BenchmarkManager::allocateRegion(size_t len, uint32_t numa_node, size_t* mapped_len) {
+    size_t page_size = page_mode_size(page_mode_);
+    size_t map_len = ((len + page_size - 1) / page_size) * page_size; //munmap() of huge pages needs a whole number of them
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+    if (page_mode_ == PAGE_MODE_2MB)
+        flags |= MAP_HUGETLB | MAP_HUGE_2MB;
+    else if (page_mode_ == PAGE_MODE_1GB)
+        flags |= MAP_HUGETLB | MAP_HUGE_1GB;
+
+    //MAP_POPULATE faults pages in before mbind() and madvise() can run, so they are placed with the memory policy of this thread instead.
+    //Transparent huge pages would be populated before they are requested, so those regions are populated after madvise() below.
+    bool populate = config_.getPrefaultMode() == PREFAULT_POPULATE;
+    if (populate && page_mode_ != PAGE_MODE_THP)
+        flags |= MAP_POPULATE;
+#ifdef HAS_NUMA
+    struct bitmask* nodes = numa_allocate_nodemask();
+    numa_bitmask_setbit(nodes, numa_node);
+    if ((flags & MAP_POPULATE) && set_mempolicy(MPOL_BIND, nodes->maskp, nodes->size + 1) != 0)
+        std::cerr << "WARNING: Failed to bind the populated pages to NUMA node " << numa_node << ": " << strerror(errno) << std::endl;
+#endif
+
+    //Transparent huge pages only back aligned ranges, so map one extra huge page and trim the misaligned ends
+    size_t slack = (page_mode_ == PAGE_MODE_THP) ? page_size : 0;
+    void* addr = mmap(NULL, map_len + slack, PROT_READ | PROT_WRITE, flags, -1, 0);
+#ifdef HAS_NUMA
+    if (flags & MAP_POPULATE)
+        set_mempolicy(MPOL_DEFAULT, NULL, 0);
+#endif
+    if (addr == MAP_FAILED) {
+        std::cerr << "ERROR: Failed to map " << map_len << " B with " << page_mode_name(page_mode_) << " pages: " << strerror(errno) << std::endl;
+        if (flags & MAP_HUGETLB)
+            std::cerr << "Are enough " << page_size / KB << " KB huge pages reserved? See /sys/kernel/mm/hugepages." << std::endl;
+#ifdef HAS_NUMA
+        numa_free_nodemask(nodes);
+#endif
+        return nullptr;
+    }
+    if (slack > 0) {
+        uintptr_t start = reinterpret_cast<uintptr_t>(addr);
+        uintptr_t aligned = (start + page_size - 1) & ~(static_cast<uintptr_t>(page_size) - 1);
+        if (aligned > start)
+            munmap(addr, aligned - start);
+        if (start + slack > aligned)
+            munmap(reinterpret_cast<void*>(aligned + map_len), start + slack - aligned);
+        addr = reinterpret_cast<void*>(aligned);
+    }
+
+    if (page_mode_ == PAGE_MODE_THP && madvise(addr, map_len, MADV_HUGEPAGE) != 0)
+        std::cerr << "WARNING: Failed to request transparent huge pages: " << strerror(errno) << ". Check /sys/kernel/mm/transparent_hugepage/enabled." << std::endl;
+    if (page_mode_ == PAGE_MODE_4KB && madvise(addr, map_len, MADV_NOHUGEPAGE) != 0)
+        std::cerr << "WARNING: Failed to disable transparent huge pages: " << strerror(errno) << std::endl;
+
+#ifdef HAS_NUMA
+    //Bind before the first touch, so that every page is faulted in on the node or not at all. Alternative node fallback is forbidden.
+    long bound = mbind(addr, map_len, MPOL_BIND, nodes->maskp, nodes->size + 1, 0);
+    numa_free_nodemask(nodes);
+    if (bound != 0) {
+        std::cerr << "ERROR: Failed to bind memory to NUMA node " << numa_node << ": " << strerror(errno) << std::endl;
+        munmap(addr, map_len);
+        return nullptr;
+    }
+#endif
+
+#ifdef MADV_POPULATE_WRITE
+    if (populate && page_mode_ == PAGE_MODE_THP && madvise(addr, map_len, MADV_POPULATE_WRITE) != 0)
+        std::cerr << "WARNING: Failed to populate transparent huge pages: " << strerror(errno) << ". They will be faulted in by the first benchmark that touches them." << std::endl;
+
+    //Huge pages come from per-node pools, and running out while faulting raises SIGBUS in the middle of a benchmark. Fault them in now so that a short pool is reported here instead. Kernels before 5.14 do not know this advice.
+    //Prefault threads check the pool themselves, so that they can fault the region in parallel.
+    if ((flags & MAP_HUGETLB) && config_.getPrefaultMode() != PREFAULT_THREADS && madvise(addr, map_len, MADV_POPULATE_WRITE) != 0 && errno != EINVAL) {
+        std::cerr << "ERROR: Not enough " << page_size / KB << " KB huge pages are free on NUMA node " << numa_node << ": " << strerror(errno) << ". See /sys/devices/system/node/node" << numa_node << "/hugepages." << std::endl;
+        munmap(addr, map_len);
+        return nullptr;
+    }
+#endif
+
+    *mapped_len = map_len;
+    return addr;
+}
+#endif
+
+bool BenchmarkManager::prefaultRegion(uint32_t region_id) {
+    uint8_t* region_start = reinterpret_cast<uint8_t*>(mem_arrays_[region_id]);
+    uint32_t numa_node = static_cast<uint32_t>(mem_array_node_[region_id]);
+    size_t page_size = page_mode_size(page_mode_);
+    size_t num_pages = (mem_array_lens_[region_id] + page_size - 1) / page_size;
+    size_t touch_size = page_mode_ == PAGE_MODE_THP ? g_page_size : page_size; //THP is only a hint, so write every base page in case no huge page is granted
+
+#ifdef __gnu_linux__
+    //Running out of huge pages while faulting raises SIGBUS, so check the node's pool first. Earlier regions are already faulted in, so the free count is what is left for this one.
+    if (page_mode_ == PAGE_MODE_2MB || page_mode_ == PAGE_MODE_1GB) {
+        std::ostringstream pool_path;
+        pool_path << "/sys/devices/system/node/node" << numa_node << "/hugepages/hugepages-" << page_size / KB << "kB/free_hugepages";
+        std::ifstream pool(pool_path.str().c_str());
+        size_t free_pages = 0;
+        if (pool >> free_pages && free_pages < num_pages) {
+            std::cerr << "ERROR: Only " << free_pages << " of the " << num_pages << " " << page_size / KB << " KB huge pages needed are free on NUMA node " << numa_node << ". See " << pool_path.str() << "." << std::endl;
+            return false;
+        }
+    }
+#endif
+
+    //Use every CPU of the region's NUMA node, each touching a contiguous slice of whole pages
+    std::vector<int32_t> prefault_cpus;
+    for (uint32_t c = 0; c < g_num_logical_cpus && prefault_cpus.size() < num_pages; c++) {
+        int32_t cpu = cpu_id_in_numa_node(numa_node, c);
+        if (cpu < 0)
+            break;
+        prefault_cpus.push_back(cpu);
+    }
+
+    if (prefault_cpus.size() < 2) { //Memory-only nodes and single-CPU nodes are prefaulted on the calling thread
+        RegionPrefaulter prefaulter(region_start, region_start + mem_array_lens_[region_id], touch_size, -1);
+        prefaulter.run();
+        return true;
+    }
+
+    size_t pages_per_slice = (num_pages + prefault_cpus.size() - 1) / prefault_cpus.size();
+    std::vector<RegionPrefaulter*> prefaulters;
+    std::vector<Thread*> threads;
+    bool success = true;
+    for (uint32_t t = 0; t < prefault_cpus.size(); t++) {
+        size_t first_page = t * pages_per_slice;
+        if (first_page >= num_pages)
+            break;
+        size_t last_page = std::min(first_page + pages_per_slice, num_pages);
+        RegionPrefaulter* prefaulter = new RegionPrefaulter(region_start + first_page * page_size, region_start + std::min(last_page * page_size, mem_array_lens_[region_id]), touch_size, prefault_cpus[t]);
+        Thread* thread = new Thread(prefaulter);
+        if (!thread->create_and_start())
+            success = false;
+        prefaulters.push_back(prefaulter);
+        threads.push_back(thread);
+    }
+    for (uint32_t t = 0; t < threads.size(); t++) {
+        if (!threads[t]->join())
+            success = false;
+        delete threads[t];
+        delete prefaulters[t];
+    }
+
+    if (!success)
+        std::cerr << "ERROR: A prefault thread failed to complete correctly!" << std::endl;
+    return success;
+}
+
+bool BenchmarkManager::verifyRegion(uint32_t region_id) {
+#ifdef __gnu_linux__
+    uint8_t* region_start = reinterpret_cast<uint8_t*>(mem_arrays_[region_id]);
+    int32_t numa_node = static_cast<int32_t>(mem_array_node_[region_id]);
+    size_t page_size = page_mode_ == PAGE_MODE_THP ? g_page_size : page_mode_size(page_mode_); //THP regions may be backed partly or wholly by base pages, so check each of them
+    size_t num_pages = (mem_array_lens_[region_id] + page_size - 1) / page_size;
+
+    //Query one address per page in batches. With a NULL node list, move_pages() only reports where each page is.
+    size_t missing_pages = 0;
+    size_t misplaced_pages = 0;
+    std::vector<void*> pages(PAGE_QUERY_BATCH);
+    std::vector<int> status(PAGE_QUERY_BATCH);
+    for (size_t first = 0; first < num_pages; first += PAGE_QUERY_BATCH) {
+        size_t count = std::min(static_cast<size_t>(PAGE_QUERY_BATCH), num_pages - first);
+        for (size_t p = 0; p < count; p++)
+            pages[p] = region_start + (first + p) * page_size;
+        if (move_pages(0 /*self memory */, count, pages.data(), NULL, status.data(), 0) != 0) {
+            std::cerr << "WARNING: Failed to query the placement of memory region #" << region_id << ": " << strerror(errno) << std::endl;
+            return false;
+        }
+        for (size_t p = 0; p < count; p++) {
+            if (status[p] < 0)
+                missing_pages++;
+            else if (status[p] != numa_node)
+                misplaced_pages++;
+        }
+    }
+
+    if (missing_pages > 0)
+        std::cerr << "WARNING: " << missing_pages << " of " << num_pages << " pages of memory region #" << region_id << " are not resident after prefaulting." << std::endl;
+    if (misplaced_pages > 0)
+        std::cerr << "WARNING: " << misplaced_pages << " of " << num_pages << " pages of memory region #" << region_id << " are not on NUMA node " << numa_node << "." << std::endl;
+    return missing_pages == 0 && misplaced_pages == 0;
+#else
+    return true;
+#endif
+}
+
+#ifdef __gnu_linux__
+bool BenchmarkManager::resolveRegion(uint32_t region_id) {
+    uint8_t* region_start = reinterpret_cast<uint8_t*>(mem_arrays_[region_id]);
+    uint32_t numa_node = static_cast<uint32_t>(mem_array_node_[region_id]);
+    uint32_t mem_region = region_id % config_.getMemoryRegionsPerNUMANode();
+    bool select_pages = config_.physContiguousSelected() || config_.physRangeSelected();
+
+    //pagemap has one entry per base page. Explicit huge pages are physically contiguous, so the entry of their first base page is enough.
+    size_t page_size = (page_mode_ == PAGE_MODE_2MB || page_mode_ == PAGE_MODE_1GB) ? page_mode_size(page_mode_) : g_page_size;
+    size_t num_pages = (mem_array_lens_[region_id] + page_size - 1) / page_size;
+
+    int fd = open("/proc/self/pagemap", O_RDONLY);
+    if (fd < 0) {
+        std::cerr << "ERROR: Failed to open /proc/self/pagemap: " << strerror(errno) << std::endl;
+        return false;
+    }
+
+    //Find the longest run of pages that satisfies the selections in one pass, so that huge regions need not be held in memory
+    size_t unresolved_pages = 0;
+    size_t run_start = 0;
+    size_t run_len = 0;
+    uint64_t run_phys = 0;
+    size_t best_start = 0;
+    size_t best_len = 0;
+    uint64_t best_phys = 0;
+    uint64_t prev_phys = 0;
+    uint64_t first_phys = 0;
+    std::vector<uint64_t> entries(PAGE_QUERY_BATCH);
+    std::vector<void*> pages(PAGE_QUERY_BATCH);
+    std::vector<int> status(PAGE_QUERY_BATCH);
+    for (size_t first = 0; first < num_pages; first += PAGE_QUERY_BATCH) {
+        size_t count = std::min(static_cast<size_t>(PAGE_QUERY_BATCH), num_pages - first);
+        bool read_ok = true;
+        for (size_t p = 0; p < count; p++)
+            pages[p] = region_start + (first + p) * page_size;
+        if (page_size == g_page_size) { //consecutive entries
+            off_t offset = static_cast<off_t>(reinterpret_cast<uintptr_t>(pages[0]) / g_page_size * sizeof(uint64_t));
+            read_ok = pread(fd, entries.data(), count * sizeof(uint64_t), offset) == static_cast<ssize_t>(count * sizeof(uint64_t));
+        } else {
+            for (size_t p = 0; p < count && read_ok; p++) {
+                off_t offset = static_cast<off_t>(reinterpret_cast<uintptr_t>(pages[p]) / g_page_size * sizeof(uint64_t));
+                read_ok = pread(fd, &entries[p], sizeof(uint64_t), offset) == static_cast<ssize_t>(sizeof(uint64_t));
+            }
+        }
+        if (!read_ok) {
+            std::cerr << "ERROR: Failed to read /proc/self/pagemap: " << strerror(errno) << std::endl;
+            close(fd);
+            return false;
+        }
+        if (move_pages(0 /*self memory */, count, pages.data(), NULL, status.data(), 0) != 0) {
+            for (size_t p = 0; p < count; p++)
+                status[p] = -1;
+        }
+
+        for (size_t p = 0; p < count; p++) {
+            size_t page = first + p;
+            bool present = (entries[p] >> 63) & 1;
+            uint64_t pfn = entries[p] & ((1ULL << 55) - 1); //bits 0-54
+            bool resolved = present && pfn != 0; //Without CAP_SYS_ADMIN, the frame numbers read as zero
+            uint64_t phys = pfn * g_page_size;
+            if (!resolved)
+                unresolved_pages++;
+            if (page == 0)
+                first_phys = phys;
+
+            if (pagemap_file_.is_open()) {
+                pagemap_file_ << page_mode_name(page_mode_) << ",";
+                pagemap_file_ << mem_region << ",";
+                pagemap_file_ << numa_node << ",";
+                pagemap_file_ << "0x" << std::hex << reinterpret_cast<uintptr_t>(pages[p]) << std::dec << ",";
+                if (resolved)
+                    pagemap_file_ << "0x" << std::hex << phys << std::dec << ",";
+                else
+                    pagemap_file_ << "N/A" << ",";
+                if (status[p] >= 0)
+                    pagemap_file_ << status[p] << ",";
+                else
+                    pagemap_file_ << "N/A" << ",";
+                pagemap_file_ << std::endl;
+            }
+
+            bool usable = resolved && (!config_.physRangeSelected() || (phys >= config_.getPhysRangeStart() && phys + page_size <= config_.getPhysRangeEnd()));
+            if (!usable)
+                run_len = 0;
+            else if (run_len > 0 && (!config_.physContiguousSelected() || phys == prev_phys + page_size))
+                run_len++;
+            else {
+                run_start = page;
+                run_len = 1;
+                run_phys = phys;
+            }
+            if (run_len > best_len) {
+                best_start = run_start;
+                best_len = run_len;
+                best_phys = run_phys;
+            }
+            prev_phys = phys;
+        }
+    }
+    close(fd);
+
+    if (unresolved_pages == num_pages) {
+        std::cerr << "ERROR: /proc/self/pagemap did not report the physical frame of any page of memory region #" << mem_region << " on NUMA node " << numa_node << ". This needs the CAP_SYS_ADMIN capability." << std::endl;
+        return false;
+    }
+    if (unresolved_pages > 0)
+        std::cerr << "WARNING: The physical frames of " << unresolved_pages << " of " << num_pages << " pages of memory region #" << mem_region << " on NUMA node " << numa_node << " could not be resolved." << std::endl;
+
+    std::cout << "Physical address for memory region #" << mem_region << " on NUMA node " << numa_node << ": ";
+    std::printf("0x%.16llx", static_cast<long long unsigned int>(first_phys));
+    std::cout << std::endl;
+    mem_array_phys_addrs_[region_id] = first_phys;
+    if (!select_pages)
+        return true;
+
+    //Narrow the region to the best run, keeping a whole number of pages for each worker thread
+    size_t granule = config_.getNumWorkerThreads() * page_size;
+    size_t run_bytes = std::min(best_len * page_size, mem_array_lens_[region_id] - best_start * page_size);
+    run_bytes = (run_bytes / granule) * granule;
+    if (run_bytes == 0) {
+        std::cerr << "ERROR: No run of pages of memory region #" << mem_region << " on NUMA node " << numa_node << " that satisfies the physical address selections is large enough for " << config_.getNumWorkerThreads() << " worker threads. The longest one has " << best_len << " pages of " << page_size << " B." << std::endl;
+        return false;
+    }
+    mem_arrays_[region_id] = region_start + best_start * page_size;
+    mem_array_lens_[region_id] = run_bytes;
+    mem_array_phys_addrs_[region_id] = best_phys;
+
+    std::cout << "---> Using " << run_bytes << " B of " << num_pages * page_size << " B at physical address ";
+    std::printf("0x%.16llx", static_cast<long long unsigned int>(best_phys));
+    std::cout << ", virtual address ";
+    std::printf("0x%.16llx", reinterpret_cast<long long unsigned int>(mem_arrays_[region_id]));
+    std::cout << std::endl;
+    return true;
+}
+#endif
+
+void BenchmarkManager::setPageMode(page_mode_t mode) {
+    if (mode == page_mode_)
+        return;
+    freeWorkingSets();
+    page_mode_ = mode;
+    setupWorkingSets(config_.getWorkingSetSizePerThread());
+}
+
 bool BenchmarkManager::buildBenchmarks() {
     if (g_verbose)  {
         std::cout << std::endl;
@@ -1041,28 +2430,12 @@ bool BenchmarkManager::buildBenchmarks() {
         rws.push_back(READ);
     if (config_.useWrites())
         rws.push_back(WRITE);
+    if (config_.useNTWrites())
+        rws.push_back(WRITE_NT);
+    std::vector<rw_mode_t> mixed_rws = config_.getMixedRWModes();
+    rws.insert(rws.end(), mixed_rws.begin(), mixed_rws.end());
 
-    std::vector<int32_t> strides;
-    if (config_.useStrideP1())
-        strides.push_back(1);
-    if (config_.useStrideN1())
-        strides.push_back(-1);
-    if (config_.useStrideP2())
-        strides.push_back(2);
-    if (config_.useStrideN2())
-        strides.push_back(-2);
-    if (config_.useStrideP4())
-        strides.push_back(4);
-    if (config_.useStrideN4())
-        strides.push_back(-4);
-    if (config_.useStrideP8())
-        strides.push_back(8);
-    if (config_.useStrideN8())
-        strides.push_back(-8);
-    if (config_.useStrideP16())
-        strides.push_back(16);
-    if (config_.useStrideN16())
-        strides.push_back(-16);
+    std::vector<int32_t> strides = config_.getStrideSizes();
 
     if (g_verbose)
         std::cout << std::endl;
@@ -1110,6 +2483,8 @@ bool BenchmarkManager::buildBenchmarks() {
                                     std::cerr << "ERROR: Failed to build a ThroughputBenchmark!" << std::endl;
                                     return false;
                                 }
+                                tp_benchmarks_[tp_benchmarks_.size()-1]->setWorkerPool(worker_pool_);
+                                tp_benchmarks_[tp_benchmarks_.size()-1]->setRegionCache(&region_cache_);
 
                                 //Add the latency benchmark
 
@@ -1132,6 +2507,8 @@ bool BenchmarkManager::buildBenchmarks() {
                                         std::cerr << "ERROR: Failed to build a LatencyBenchmark!" << std::endl;
                                         return false;
                                     }
+                                    lat_benchmarks_[lat_benchmarks_.size()-1]->setWorkerPool(worker_pool_);
+                                    lat_benchmarks_[lat_benchmarks_.size()-1]->setRegionCache(&region_cache_);
                                     buildLatBench = false; //Wait for next NUMA combo
                                 }
                                 g_test_index++;
@@ -1145,6 +2522,9 @@ bool BenchmarkManager::buildBenchmarks() {
                     for (uint32_t rw_index = 0; rw_index < rws.size(); rw_index++) { //iterate read/write access types
                         rw_mode_t rw = rws[rw_index];
 
+                        if (rw == WRITE_NT) //Special case: non-temporal stores only make sense for streaming patterns, so there are no random kernels for them
+                            continue;
+
                         for (uint32_t chunk_index = 0; chunk_index < chunks.size(); chunk_index++) { //iterate different chunk sizes
                             chunk_size_t chunk = chunks[chunk_index];
 
@@ -1169,6 +2549,8 @@ bool BenchmarkManager::buildBenchmarks() {
                                 std::cerr << "ERROR: Failed to build a ThroughputBenchmark!" << std::endl;
                                 return false;
                             }
+                            tp_benchmarks_[tp_benchmarks_.size()-1]->setWorkerPool(worker_pool_);
+                            tp_benchmarks_[tp_benchmarks_.size()-1]->setRegionCache(&region_cache_);
 
                             //Add the latency benchmark
                             //Special case: number of worker threads is 1, only need 1 latency thread in general to do unloaded latency tests.
@@ -1190,6 +2572,73 @@ bool BenchmarkManager::buildBenchmarks() {
                                     std::cerr << "ERROR: Failed to build a LatencyBenchmark!" << std::endl;
                                     return false;
                                 }
+                                lat_benchmarks_[lat_benchmarks_.size()-1]->setWorkerPool(worker_pool_);
+                                lat_benchmarks_[lat_benchmarks_.size()-1]->setRegionCache(&region_cache_);
+
+                                buildLatBench = false; //Wait for next NUMA combo
+                            }
+
+                            g_test_index++;
+                        }
+                    }
+                }
+
+                if (config_.useIndependentRandomAccessPattern()) {
+                    //DO INDEPENDENT RANDOM TESTS
+                    for (uint32_t rw_index = 0; rw_index < rws.size(); rw_index++) { //iterate read/write access types
+                        rw_mode_t rw = rws[rw_index];
+
+                        for (uint32_t chunk_index = 0; chunk_index < chunks.size(); chunk_index++) { //iterate different chunk sizes
+                            chunk_size_t chunk = chunks[chunk_index];
+
+                            IndependentRandomFunction kernel_fptr = NULL;
+                            IndependentRandomFunction kernel_dummy_fptr = NULL;
+                            if (!determine_independent_random_kernel(rw, chunk, &kernel_fptr, &kernel_dummy_fptr)) //Special case: not every chunk size has every kind of independent random access, e.g., AVX2 has no scatters
+                                continue;
+
+                            //Add the throughput benchmark
+                            benchmark_name = static_cast<std::ostringstream*>(&(std::ostringstream() << "Test #" << g_test_index << "T (Throughput)"))->str();
+                            tp_benchmarks_.push_back(new ThroughputBenchmark(mem_array,
+                                                                            mem_array_len,
+                                                                            config_.getIterationsPerTest(),
+                                                                            config_.getNumWorkerThreads(),
+                                                                            mem_node,
+                                                                            cpu_node,
+                                                                            RANDOM_INDEPENDENT,
+                                                                            rw,
+                                                                            chunk,
+                                                                            0,
+                                                                            dram_power_readers_,
+                                                                            benchmark_name));
+                            if (tp_benchmarks_[tp_benchmarks_.size()-1] == NULL) {
+                                std::cerr << "ERROR: Failed to build a ThroughputBenchmark!" << std::endl;
+                                return false;
+                            }
+                            tp_benchmarks_[tp_benchmarks_.size()-1]->setWorkerPool(worker_pool_);
+                            tp_benchmarks_[tp_benchmarks_.size()-1]->setRegionCache(&region_cache_);
+
+                            //Add the latency benchmark
+                            //Special case: number of worker threads is 1, only need 1 latency thread in general to do unloaded latency tests.
+                            if (config_.getNumWorkerThreads() > 1 || buildLatBench) {
+                                benchmark_name = static_cast<std::ostringstream*>(&(std::ostringstream() << "Test #" << g_test_index << "L (Latency)"))->str();
+                                lat_benchmarks_.push_back(new LatencyBenchmark(mem_array,
+                                                                                mem_array_len,
+                                                                                config_.getIterationsPerTest(),
+                                                                                config_.getNumWorkerThreads(),
+                                                                                mem_node,
+                                                                                cpu_node,
+                                                                                RANDOM_INDEPENDENT,
+                                                                                rw,
+                                                                                chunk,
+                                                                                0,
+                                                                                dram_power_readers_,
+                                                                                benchmark_name));
+                                if (lat_benchmarks_[lat_benchmarks_.size()-1] == NULL) {
+                                    std::cerr << "ERROR: Failed to build a LatencyBenchmark!" << std::endl;
+                                    return false;
+                                }
+                                lat_benchmarks_[lat_benchmarks_.size()-1]->setWorkerPool(worker_pool_);
+                                lat_benchmarks_[lat_benchmarks_.size()-1]->setRegionCache(&region_cache_);
 
                                 buildLatBench = false; //Wait for next NUMA combo
                             }
@@ -1216,6 +2665,13 @@ bool BenchmarkManager::buildBenchmarks() {
 
     std::vector<uint64_t> mem_regions_phys_addr = config_.getMemoryRegionsPhysAddresses();
 
+    //The matrices load memory with sequential reads, followed by any mixed read/write patterns. The latency matrix only applies load with more than one worker thread.
+    std::vector<rw_mode_t> matrix_rws(1, READ);
+    matrix_rws.insert(matrix_rws.end(), mixed_rws.begin(), mixed_rws.end());
+    std::vector<rw_mode_t> lat_matrix_rws(1, READ);
+    if (config_.getNumWorkerThreads() > 1)
+        lat_matrix_rws = matrix_rws;
+
     uint32_t cpu      = -1;
     uint32_t cpu_node = -1;
     //Build latency matrix benchmarks
@@ -1241,31 +2697,36 @@ bool BenchmarkManager::buildBenchmarks() {
 
                 for (uint32_t stride_index = 0; stride_index < strides.size(); stride_index++) {  //iterate different stride lengths
                     int32_t stride = strides[stride_index];
-
-                    // Latency benchmark from every core to every memory region
-                    benchmark_name = static_cast<std::ostringstream*>(&(std::ostringstream() << "Test #"
-                                        << g_test_index << "LM (LatencyMatrix)"))->str();
-                    lat_mat_benchmarks_.push_back(new LatencyMatrixBenchmark(mem_array,
-                                                                             mem_array_len,
-                                                                             config_.getIterationsPerTest(),
-                                                                             config_.getNumWorkerThreads(),
-                                                                             mem_node,
-                                                                             mem_region,
-                                                                             cpu_node,
-                                                                             cpu,
-                                                                             use_cpu_nodes,
-                                                                             SEQUENTIAL,
-                                                                             READ,
-                                                                             chunk,
-                                                                             stride,
-                                                                             dram_power_readers_,
-                                                                             benchmark_name,
-                                                                             lat_mat_logfile_));
-                    if (lat_mat_benchmarks_[lat_mat_benchmarks_.size()-1] == NULL) {
-                        std::cerr << "ERROR: Failed to build a LatencyMatrixBenchmark!" << std::endl;
-                        return false;
+                    for (uint32_t rw_index = 0; rw_index < lat_matrix_rws.size(); rw_index++) { //iterate read/write access types of the load threads
+                        rw_mode_t rw = lat_matrix_rws[rw_index];
+
+                        // Latency benchmark from every core to every memory region
+                        benchmark_name = static_cast<std::ostringstream*>(&(std::ostringstream() << "Test #"
+                                            << g_test_index << "LM (LatencyMatrix)"))->str();
+                        lat_mat_benchmarks_.push_back(new LatencyMatrixBenchmark(mem_array,
+                                                                                 mem_array_len,
+                                                                                 config_.getIterationsPerTest(),
+                                                                                 config_.getNumWorkerThreads(),
+                                                                                 mem_node,
+                                                                                 mem_region,
+                                                                                 cpu_node,
+                                                                                 cpu,
+                                                                                 use_cpu_nodes,
+                                                                                 SEQUENTIAL,
+                                                                                 rw,
+                                                                                 chunk,
+                                                                                 stride,
+                                                                                 dram_power_readers_,
+                                                                                 benchmark_name,
+                                                                                 lat_mat_logfile_));
+                        if (lat_mat_benchmarks_[lat_mat_benchmarks_.size()-1] == NULL) {
+                            std::cerr << "ERROR: Failed to build a LatencyMatrixBenchmark!" << std::endl;
+                            return false;
+                        }
+                        lat_mat_benchmarks_[lat_mat_benchmarks_.size()-1]->setWorkerPool(worker_pool_);
+                        lat_mat_benchmarks_[lat_mat_benchmarks_.size()-1]->setRegionCache(&region_cache_);
+                        g_test_index++;
                     }
-                    g_test_index++;
                 }
             }
         }
@@ -1302,32 +2763,76 @@ bool BenchmarkManager::buildBenchmarks() {
 
                 for (uint32_t stride_index = 0; stride_index < strides.size(); stride_index++) {  //iterate different stride lengths
                     int32_t stride = strides[stride_index];
+                    for (uint32_t rw_index = 0; rw_index < matrix_rws.size(); rw_index++) { //iterate read/write access types
+                        rw_mode_t rw = matrix_rws[rw_index];
+
+                        // Throughput benchmark from every core to every memory region
+                        benchmark_name = static_cast<std::ostringstream*>(&(std::ostringstream()
+                                            << "Test #" << g_test_index << "TM (ThroughputMatrix)"))->str();
+                        thr_mat_benchmarks_.push_back(
+                            new ThroughputMatrixBenchmark(mem_array,
+                                mem_array_len,
+                                config_.getIterationsPerTest(),
+                                use_cpu_nodes ? num_of_cpus_in_cpu_node : 1,
+                                mem_node,
+                                mem_region,
+                                cpu_node,
+                                cpu,
+                                use_cpu_nodes,
+                                SEQUENTIAL,
+                                rw,
+                                chunk,
+                                stride,
+                                dram_power_readers_,
+                                benchmark_name,
+                                thr_mat_logfile_));
+                        if (thr_mat_benchmarks_[thr_mat_benchmarks_.size()-1] == NULL) {
+                            std::cerr << "ERROR: Failed to build a ThroughputMatrixBenchmark!" << std::endl;
+                            return false;
+                        }
+                        thr_mat_benchmarks_[thr_mat_benchmarks_.size()-1]->setWorkerPool(worker_pool_);
+                        thr_mat_benchmarks_[thr_mat_benchmarks_.size()-1]->setRegionCache(&region_cache_);
+                        g_test_index++;
+                    }
+                }
 
-                    // Throughput benchmark from every core to every memory region
-                    benchmark_name = static_cast<std::ostringstream*>(&(std::ostringstream()
-                                        << "Test #" << g_test_index << "TM (ThroughputMatrix)"))->str();
-                    thr_mat_benchmarks_.push_back(
-                        new ThroughputMatrixBenchmark(mem_array,
-                            mem_array_len,
-                            config_.getIterationsPerTest(),
-                            use_cpu_nodes ? num_of_cpus_in_cpu_node : 1,
-                            mem_node,
-                            mem_region,
-                            cpu_node,
-                            cpu,
-                            use_cpu_nodes,
-                            SEQUENTIAL,
-                            READ,
-                            chunk,
-                            stride,
-                            dram_power_readers_,
-                            benchmark_name,
-                            thr_mat_logfile_));
-                    if (thr_mat_benchmarks_[thr_mat_benchmarks_.size()-1] == NULL) {
-                        std::cerr << "ERROR: Failed to build a ThroughputMatrixBenchmark!" << std::endl;
-                        return false;
+                //Random-access bandwidth from every core to every memory region
+                if (config_.useIndependentRandomAccessPattern()) {
+                    for (uint32_t rw_index = 0; rw_index < rws.size(); rw_index++) { //iterate read/write access types
+                        rw_mode_t rw = rws[rw_index];
+
+                        IndependentRandomFunction kernel_fptr = NULL;
+                        IndependentRandomFunction kernel_dummy_fptr = NULL;
+                        if (!determine_independent_random_kernel(rw, chunk, &kernel_fptr, &kernel_dummy_fptr))
+                            continue;
+
+                        benchmark_name = static_cast<std::ostringstream*>(&(std::ostringstream()
+                                            << "Test #" << g_test_index << "TM (ThroughputMatrix)"))->str();
+                        thr_mat_benchmarks_.push_back(
+                            new ThroughputMatrixBenchmark(mem_array,
+                                mem_array_len,
+                                config_.getIterationsPerTest(),
+                                use_cpu_nodes ? num_of_cpus_in_cpu_node : 1,
+                                mem_node,
+                                mem_region,
+                                cpu_node,
+                                cpu,
+                                use_cpu_nodes,
+                                RANDOM_INDEPENDENT,
+                                rw,
+                                chunk,
+                                0,
+                                dram_power_readers_,
+                                benchmark_name,
+                                thr_mat_logfile_));
+                        if (thr_mat_benchmarks_[thr_mat_benchmarks_.size()-1] == NULL) {
+                            std::cerr << "ERROR: Failed to build a ThroughputMatrixBenchmark!" << std::endl;
+                            return false;
+                        }
+                        thr_mat_benchmarks_[thr_mat_benchmarks_.size()-1]->setWorkerPool(worker_pool_);
+                        thr_mat_benchmarks_[thr_mat_benchmarks_.size()-1]->setRegionCache(&region_cache_);
+                        g_test_index++;
                     }
-                    g_test_index++;
                 }
             }
         }
@@ -1356,18 +2861,22 @@ bool BenchmarkManager::runExtDelayInjectedLoadedLatencyBenchmark() {
     chunks.push_back(CHUNK_128b);
 #endif
 #ifdef HAS_WORD_256
-    chunks.push_back(CHUNK_256b);
+    if (chunk_size_supported(CHUNK_256b))
+        chunks.push_back(CHUNK_256b);
 #endif
 #ifdef HAS_WORD_512
-    chunks.push_back(CHUNK_512b);
+    if (chunk_size_supported(CHUNK_512b))
+        chunks.push_back(CHUNK_512b);
 #endif
 
     //Build benchmarks
     for (auto mem_node_it = memory_numa_node_affinities_.cbegin(); mem_node_it != memory_numa_node_affinities_.cend(); mem_node_it++) { //iterate each memory NUMA node
         uint32_t mem_node = *mem_node_it;
 
-        void* mem_array = mem_arrays_[mem_node];
-        size_t mem_array_len = mem_array_lens_[mem_node];
+        uint32_t region_id = mem_node * config_.getMemoryRegionsPerNUMANode(); //first region of the node
+
+        void* mem_array = mem_arrays_[region_id];
+        size_t mem_array_len = mem_array_lens_[region_id];
 
         for (auto cpu_node_it = cpu_numa_node_affinities_.cbegin(); cpu_node_it != cpu_numa_node_affinities_.cend(); cpu_node_it++) { //iterate each cpuory NUMA node
             uint32_t cpu_node = *cpu_node_it;
@@ -1394,6 +2903,7 @@ bool BenchmarkManager::runExtDelayInjectedLoadedLatencyBenchmark() {
                         std::cerr << "ERROR: Failed to build a DelayInjectedLoadedLatencyBenchmark!" << std::endl;
                         return false;
                     }
+                    del_lat_benchmarks[del_lat_benchmarks.size()-1]->setRegionCache(&region_cache_);
 
                     if (d == 0) //special case
                         d = 1;
@@ -1432,6 +2942,9 @@ bool BenchmarkManager::runExtDelayInjectedLoadedLatencyBenchmark() {
                     case RANDOM:
                         results_file_ << "RANDOM" << ",";
                         break;
+                    case RANDOM_INDEPENDENT:
+                        results_file_ << "RANDOM_INDEPENDENT" << ",";
+                        break;
                     default:
                         results_file_ << "UNKNOWN" << ",";
                         break;
@@ -1445,6 +2958,9 @@ bool BenchmarkManager::runExtDelayInjectedLoadedLatencyBenchmark() {
                     case WRITE:
                         results_file_ << "WRITE" << ",";
                         break;
+                    case WRITE_NT:
+                        results_file_ << "WRITE_NT" << ",";
+                        break;
                     default:
                         results_file_ << "UNKNOWN" << ",";
                         break;
@@ -1509,6 +3025,7 @@ bool BenchmarkManager::runExtDelayInjectedLoadedLatencyBenchmark() {
             }
             results_file_ << del_lat_benchmarks[i]->getDelay() << ",";
             results_file_ << "<-- load threads' memory access delay value in nops" << ",";
+            results_file_ << page_mode_name(page_mode_) << ",";
             results_file_ << std::endl;
         }
     }
@@ -1519,7 +3036,179 @@ bool BenchmarkManager::runExtDelayInjectedLoadedLatencyBenchmark() {
 
 #ifdef EXT_STREAM_BENCHMARK
 bool BenchmarkManager::runExtStreamBenchmark() {
-    //TODO: implement me
+    if (config_.memoryRegionsInPhysAddr()) {
+        std::cerr << "ERROR: The STREAM extension places its arrays by NUMA node and does not support memory regions given by physical address." << std::endl;
+        return false;
+    }
+
+    std::vector<StreamBenchmark*> stream_benchmarks;
+
+    //Put the enumerations into vectors to make constructing benchmarks more loopable
+    std::vector<chunk_size_t> chunks;
+    chunks.push_back(CHUNK_32b);
+#ifdef HAS_WORD_64
+    chunks.push_back(CHUNK_64b);
+#endif
+#ifdef HAS_WORD_128
+    chunks.push_back(CHUNK_128b);
+#endif
+#ifdef HAS_WORD_256
+    chunks.push_back(CHUNK_256b);
+#endif
+#ifdef HAS_WORD_512
+    chunks.push_back(CHUNK_512b);
+#endif
+
+    //Each memory node's first region is split into thirds, one per array, so that the three arrays never overlap even when they are on the same node.
+    //Each third is a whole number of passes for every worker so that the arrays stay aligned for the widest chunks.
+    size_t array_granularity = config_.getNumWorkerThreads() * THROUGHPUT_BENCHMARK_BYTES_PER_PASS;
+    std::vector<uint32_t> mem_nodes(memory_numa_node_affinities_.cbegin(), memory_numa_node_affinities_.cend());
+    size_t array_len = 0;
+    for (uint32_t n = 0; n < mem_nodes.size(); n++) {
+        size_t len = mem_array_lens_[mem_nodes[n] * config_.getMemoryRegionsPerNUMANode()] / 3;
+        len -= len % array_granularity;
+        if (n == 0 || len < array_len)
+            array_len = len;
+    }
+    if (array_len == 0) {
+        std::cerr << "ERROR: The working set is too small for the STREAM extension. Each of the three arrays needs at least " << THROUGHPUT_BENCHMARK_BYTES_PER_PASS << " bytes per worker thread." << std::endl;
+        return false;
+    }
+
+    //Build benchmarks. Each of the three arrays is placed on every memory node independently.
+    for (uint32_t a = 0; a < mem_nodes.size(); a++) {
+        for (uint32_t b = 0; b < mem_nodes.size(); b++) {
+            for (uint32_t c = 0; c < mem_nodes.size(); c++) {
+                uint8_t* region_a = reinterpret_cast<uint8_t*>(mem_arrays_[mem_nodes[a] * config_.getMemoryRegionsPerNUMANode()]);
+                uint8_t* region_b = reinterpret_cast<uint8_t*>(mem_arrays_[mem_nodes[b] * config_.getMemoryRegionsPerNUMANode()]);
+                uint8_t* region_c = reinterpret_cast<uint8_t*>(mem_arrays_[mem_nodes[c] * config_.getMemoryRegionsPerNUMANode()]);
+                void* array_a = reinterpret_cast<void*>(region_a);
+                void* array_b = reinterpret_cast<void*>(region_b + array_len);
+                void* array_c = reinterpret_cast<void*>(region_c + 2 * array_len);
+
+                for (auto cpu_node_it = cpu_numa_node_affinities_.cbegin(); cpu_node_it != cpu_numa_node_affinities_.cend(); cpu_node_it++) { //iterate each cpu NUMA node
+                    uint32_t cpu_node = *cpu_node_it;
+
+                    for (uint32_t chunk_index = 0; chunk_index < chunks.size(); chunk_index++) { //iterate different chunk sizes
+                        chunk_size_t chunk = chunks[chunk_index];
+
+                        for (uint32_t k = 0; k < NUM_STREAM_KERNELS; k++) { //iterate STREAM kernels
+                            stream_kernel_t kernel = static_cast<stream_kernel_t>(k);
+                            StreamFunction kernel_fptr = NULL;
+                            StreamFunction kernel_dummy_fptr = NULL;
+                            if (!determine_stream_kernel(kernel, chunk, &kernel_fptr, &kernel_dummy_fptr)) //Skip chunk sizes this build or CPU cannot do
+                                continue;
+
+                            std::string benchmark_name = static_cast<std::ostringstream*>(&(std::ostringstream() << "Test #" << g_test_index++ << "E" << EXT_NUM_STREAM_BENCHMARK << " (Extension: STREAM " << stream_kernel_name(kernel) << ")"))->str();
+
+                            stream_benchmarks.push_back(new StreamBenchmark(array_a,
+                                                                            array_b,
+                                                                            array_c,
+                                                                            array_len,
+                                                                            config_.getIterationsPerTest(),
+                                                                            config_.getNumWorkerThreads(),
+                                                                            mem_nodes[a],
+                                                                            mem_nodes[b],
+                                                                            mem_nodes[c],
+                                                                            cpu_node,
+                                                                            kernel,
+                                                                            chunk,
+                                                                            dram_power_readers_,
+                                                                            benchmark_name));
+                            if (stream_benchmarks[stream_benchmarks.size()-1] == NULL) {
+                                std::cerr << "ERROR: Failed to build a StreamBenchmark!" << std::endl;
+                                return false;
+                            }
+                            stream_benchmarks[stream_benchmarks.size()-1]->setRegionCache(&region_cache_);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    //Run benchmarks
+    for (uint32_t i = 0; i < stream_benchmarks.size(); i++) {
+        stream_benchmarks[i]->run();
+        stream_benchmarks[i]->reportResults(); //to console
+
+        //Write to results file if necessary
+        if (config_.useOutputFile()) {
+            results_file_ << stream_benchmarks[i]->getName() << ",";
+            results_file_ << stream_benchmarks[i]->getIterations() << ",";
+            results_file_ << static_cast<size_t>(stream_benchmarks[i]->getLen() / stream_benchmarks[i]->getNumThreads() / KB) << ",";
+            results_file_ << stream_benchmarks[i]->getNumThreads() << ",";
+            results_file_ << stream_benchmarks[i]->getNumThreads() << ",";
+            results_file_ << stream_benchmarks[i]->getMemNode() << ",";
+            results_file_ << stream_benchmarks[i]->getCPUNode() << ",";
+            results_file_ << "SEQUENTIAL" << ",";
+            results_file_ << "WRITE" << ",";
+
+            chunk_size_t chunk_size = stream_benchmarks[i]->getChunkSize();
+            switch (chunk_size) {
+                case CHUNK_32b:
+                    results_file_ << "32" << ",";
+                    break;
+#ifdef HAS_WORD_64
+                case CHUNK_64b:
+                    results_file_ << "64" << ",";
+                    break;
+#endif
+#ifdef HAS_WORD_128
+                case CHUNK_128b:
+                    results_file_ << "128" << ",";
+                    break;
+#endif
+#ifdef HAS_WORD_256
+                case CHUNK_256b:
+                    results_file_ << "256" << ",";
+                    break;
+#endif
+#ifdef HAS_WORD_512
+                case CHUNK_512b:
+                    results_file_ << "512" << ",";
+                    break;
+#endif
+                default:
+                    results_file_ << "UNKNOWN" << ",";
+                    break;
+            }
+
+            results_file_ << stream_benchmarks[i]->getStrideSize() << ",";
+            results_file_ << stream_benchmarks[i]->getMeanMetric() << ",";
+            results_file_ << stream_benchmarks[i]->getMinMetric() << ",";
+            results_file_ << stream_benchmarks[i]->get25PercentileMetric() << ",";
+            results_file_ << stream_benchmarks[i]->getMedianMetric() << ",";
+            results_file_ << stream_benchmarks[i]->get75PercentileMetric() << ",";
+            results_file_ << stream_benchmarks[i]->get95PercentileMetric() << ",";
+            results_file_ << stream_benchmarks[i]->get99PercentileMetric() << ",";
+            results_file_ << stream_benchmarks[i]->getMaxMetric() << ",";
+            results_file_ << stream_benchmarks[i]->getModeMetric() << ",";
+            results_file_ << stream_benchmarks[i]->getMetricUnits() << ",";
+            results_file_ << "N/A" << ",";
+            results_file_ << "N/A" << ",";
+            results_file_ << "N/A" << ",";
+            results_file_ << "N/A" << ",";
+            results_file_ << "N/A" << ",";
+            results_file_ << "N/A" << ",";
+            results_file_ << "N/A" << ",";
+            results_file_ << "N/A" << ",";
+            results_file_ << "N/A" << ",";
+            results_file_ << "N/A" << ",";
+            for (uint32_t j = 0; j < g_num_physical_packages; j++) {
+                results_file_ << stream_benchmarks[i]->getMeanDRAMPower(j) << ",";
+                results_file_ << stream_benchmarks[i]->getPeakDRAMPower(j) << ",";
+            }
+            results_file_ << stream_kernel_name(stream_benchmarks[i]->getStreamKernel()) << ",";
+            results_file_ << "<-- STREAM kernel. Arrays a/b/c on NUMA nodes " << stream_benchmarks[i]->getNodeA() << "/" << stream_benchmarks[i]->getNodeB() << "/" << stream_benchmarks[i]->getNodeC() << ",";
+            results_file_ << page_mode_name(page_mode_) << ",";
+            results_file_ << std::endl;
+        }
+    }
+
+    for (uint32_t i = 0; i < stream_benchmarks.size(); i++)
+        delete stream_benchmarks[i];
+
     return true;
 }
 #endif
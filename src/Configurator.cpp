@@ -35,11 +35,15 @@
 #include <optionparser.h>
 #include <MyArg.h>
 #include <common.h>
+#include <benchmark_kernels.h>
+#include <jit_kernels.h>
 
 //Libraries
 #include <cstdint>
 #include <iostream>
 #include <string>
+#include <vector>
+#include <algorithm>
 
 using namespace xmem;
 
@@ -58,6 +62,13 @@ Configurator::Configurator(
     run_all_cores_(false),
     run_latency_matrix_(false),
     run_throughput_matrix_(false),
+    run_prefetch_sweep_(false),
+    run_mlp_sweep_(false),
+    run_contention_(false),
+    run_core_to_core_matrix_(false),
+    run_producer_consumer_(false),
+    run_false_sharing_(false),
+    run_dram_mapping_(false),
     sync_mem_(false),
     working_set_size_per_thread_(DEFAULT_WORKING_SET_SIZE_PER_THREAD),
     num_worker_threads_(DEFAULT_NUM_WORKER_THREADS),
@@ -74,7 +85,7 @@ Configurator::Configurator(
     use_chunk_256b_(false),
 #endif
 #ifdef HAS_WORD_512
-    use_chunk_512b(false),
+    use_chunk_512b_(false),
 #endif
 #ifdef HAS_NUMA
     numa_enabled_(true),
@@ -88,26 +99,29 @@ Configurator::Configurator(
     mem_regions_phys_addr_(),
     iterations_(1),
     use_random_access_pattern_(false),
+    use_independent_random_access_pattern_(false),
     use_sequential_access_pattern_(true),
     starting_test_index_(1),
     filename_(),
     use_output_file_(false),
     verbose_(false),
-    use_large_pages_(false),
+    page_modes_(),
+    prefault_mode_(PREFAULT_THREADS),
+    pagemap_(false),
+    pagemap_filename_(),
+    use_pagemap_file_(false),
+    phys_contiguous_(false),
+    phys_range_(false),
+    phys_range_start_(0),
+    phys_range_end_(0),
     use_reads_(true),
     use_writes_(true),
+    use_nt_writes_(false),
+    mixed_rw_modes_(),
     dec_net_filename_(),
     use_dec_net_file_(false),
-    use_stride_p1_(true),
-    use_stride_n1_(false),
-    use_stride_p2_(false),
-    use_stride_n2_(false),
-    use_stride_p4_(false),
-    use_stride_n4_(false),
-    use_stride_p8_(false),
-    use_stride_n8_(false),
-    use_stride_p16_(false),
-    use_stride_n16_(false)
+    stride_sizes_(1, 1),
+    spacings_()
     {
 }
 
@@ -158,12 +172,20 @@ int32_t Configurator::configureFromInput(int argc, char* argv[]) {
 
     //Check runtime modes
     if (options[MEAS_LATENCY] || options[MEAS_THROUGHPUT] || options[EXTENSION] || options[MEAS_LATENCY_MATRIX] ||
-        options[MEAS_THROUGHPUT_MATRIX]) { //User explicitly picked at least one mode, so override default selection
+        options[MEAS_THROUGHPUT_MATRIX] || options[MEAS_PREFETCH_SWEEP] || options[MEAS_MLP_SWEEP] || options[MEAS_CONTENTION] ||
+        options[MEAS_CORE_TO_CORE_MATRIX] || options[MEAS_PRODUCER_CONSUMER] || options[MEAS_FALSE_SHARING] || options[MEAS_DRAM_MAPPING]) { //User explicitly picked at least one mode, so override default selection
         run_latency_           = false;
         run_throughput_        = false;
         run_extensions_        = false;
         run_latency_matrix_    = false;
         run_throughput_matrix_ = false;
+        run_prefetch_sweep_    = false;
+        run_mlp_sweep_         = false;
+        run_contention_        = false;
+        run_core_to_core_matrix_ = false;
+        run_producer_consumer_ = false;
+        run_false_sharing_ = false;
+        run_dram_mapping_ = false;
     }
 
     if (options[MEAS_LATENCY])
@@ -178,6 +200,39 @@ int32_t Configurator::configureFromInput(int argc, char* argv[]) {
     if (options[MEAS_THROUGHPUT_MATRIX])
         run_throughput_matrix_ = true;
 
+    if (options[MEAS_PREFETCH_SWEEP]) {
+#ifdef HAS_SW_PREFETCH
+        run_prefetch_sweep_ = true;
+#else
+        std::cerr << "ERROR: Software prefetching is not supported on this platform." << std::endl;
+        goto error;
+#endif
+    }
+
+    if (options[MEAS_MLP_SWEEP])
+        run_mlp_sweep_ = true;
+
+    if (options[MEAS_CONTENTION])
+        run_contention_ = true;
+
+    if (options[MEAS_CORE_TO_CORE_MATRIX])
+        run_core_to_core_matrix_ = true;
+
+    if (options[MEAS_PRODUCER_CONSUMER])
+        run_producer_consumer_ = true;
+
+    if (options[MEAS_FALSE_SHARING])
+        run_false_sharing_ = true;
+
+    if (options[MEAS_DRAM_MAPPING]) {
+#if defined(ARCH_INTEL) && defined(__gnu_linux__)
+        run_dram_mapping_ = true;
+#else
+        std::cerr << "ERROR: DRAM address mapping discovery is only supported on x86 GNU/Linux." << std::endl;
+        goto error;
+#endif
+    }
+
     if (options[SYNC_MEM])
         sync_mem_ = true;
 
@@ -327,18 +382,72 @@ int32_t Configurator::configureFromInput(int argc, char* argv[]) {
             memory_numa_node_affinities_.push_back(i);
     }
 
-    //Check if large pages should be used for allocation of memory under test.
+    //Check which page sizes should back the memory under test.
     if (options[USE_LARGE_PAGES]) {
-#if defined(__gnu_linux__) && defined(ARCH_INTEL)
-        if (numa_enabled_) { //For now, large pages are not --simultaneously-- supported alongside NUMA. This is due to lack of NUMA support in hugetlbfs on GNU/Linux.
-            std::cerr << "ERROR: On GNU/Linux version of X-Mem for Intel architectures, large pages are not simultaneously supported alongside NUMA due to reasons outside our control. If you want large pages, then force UMA using the \"-u\" option explicitly." << std::endl;
-            goto error;
-        }
-#endif
 #ifndef HAS_LARGE_PAGES
         std::cerr << "WARNING: Huge pages are not supported on this build. Regular-sized pages will be used." << std::endl;
 #else
-        use_large_pages_ = true;
+        page_modes_.push_back(PAGE_MODE_2MB);
+#endif
+    }
+
+    if (options[PAGE_SIZE]) {
+        Option* curr = options[PAGE_SIZE];
+        while (curr) { //PAGE_SIZE may occur more than once, this is perfectly OK.
+            std::string page_arg = curr->arg;
+            bool found = false;
+            for (uint32_t m = 0; m < NUM_PAGE_MODES; m++) {
+                page_mode_t mode = static_cast<page_mode_t>(m);
+                if (page_arg == page_mode_name(mode)) {
+                    found = true;
+#ifdef _WIN32
+                    if (mode != PAGE_MODE_DEFAULT && mode != PAGE_MODE_2MB) {
+                        std::cerr << "ERROR: The page size " << page_arg << " is not supported on Windows. Allowed values: default, 2m." << std::endl;
+                        goto error;
+                    }
+#endif
+#ifndef HAS_LARGE_PAGES
+                    if (mode == PAGE_MODE_THP || mode == PAGE_MODE_2MB || mode == PAGE_MODE_1GB) {
+                        std::cerr << "WARNING: Huge pages are not supported on this build. Regular-sized pages will be used." << std::endl;
+                        mode = PAGE_MODE_DEFAULT;
+                    }
+#endif
+                    if (std::find(page_modes_.begin(), page_modes_.end(), mode) == page_modes_.end())
+                        page_modes_.push_back(mode);
+                }
+            }
+            if (!found) {
+                std::cerr << "ERROR: Invalid page size " << page_arg << ". Allowed values: default, 4k, thp, 2m, 1g." << std::endl;
+                goto error;
+            }
+            curr = curr->next();
+        }
+    }
+
+    if (page_modes_.empty())
+        page_modes_.push_back(PAGE_MODE_DEFAULT);
+
+    if (options[PREFAULT]) { //override defaults
+        if (!check_single_option_occurrence(&options[PREFAULT]))
+            goto error;
+
+        std::string prefault_arg = options[PREFAULT].arg;
+        bool found = false;
+        for (uint32_t m = 0; m < NUM_PREFAULT_MODES; m++) {
+            if (prefault_arg == prefault_mode_name(static_cast<prefault_mode_t>(m))) {
+                prefault_mode_ = static_cast<prefault_mode_t>(m);
+                found = true;
+            }
+        }
+        if (!found) {
+            std::cerr << "ERROR: Invalid prefault mode " << prefault_arg << ". Allowed values: none, populate, threads." << std::endl;
+            goto error;
+        }
+#ifdef _WIN32
+        if (prefault_mode_ == PREFAULT_POPULATE) {
+            std::cerr << "ERROR: The populate prefault mode is not supported on Windows. Allowed values: none, threads." << std::endl;
+            goto error;
+        }
 #endif
     }
 
@@ -369,7 +478,7 @@ int32_t Configurator::configureFromInput(int argc, char* argv[]) {
         use_chunk_256b_ = false;
 #endif
 #ifdef HAS_WORD_512
-        use_chunk_512b = false;
+        use_chunk_512b_ = false;
 #endif
 
         Option* curr = options[CHUNK_SIZE];
@@ -392,12 +501,20 @@ int32_t Configurator::configureFromInput(int argc, char* argv[]) {
 #endif
 #ifdef HAS_WORD_256
                 case 256:
+                    if (!chunk_size_supported(CHUNK_256b)) {
+                        std::cerr << "ERROR: Chunk size 256 requires AVX, which this CPU does not support." << std::endl;
+                        goto error;
+                    }
                     use_chunk_256b_ = true;
                     break;
 #endif
 #ifdef HAS_WORD_512
                 case 512:
-                    use_chunk_512b = true;
+                    if (!chunk_size_supported(CHUNK_512b)) {
+                        std::cerr << "ERROR: Chunk size 512 requires AVX-512F, which this CPU does not support." << std::endl;
+                        goto error;
+                    }
+                    use_chunk_512b_ = true;
                     break;
 #endif
                 default:
@@ -405,7 +522,7 @@ int32_t Configurator::configureFromInput(int argc, char* argv[]) {
 #ifdef HAS_WORD_64
                     << "64 "
 #endif
-#ifdef HAS_WORD_128_
+#ifdef HAS_WORD_128
                     << "128 "
 #endif
 #ifdef HAS_WORD_256
@@ -431,14 +548,18 @@ int32_t Configurator::configureFromInput(int argc, char* argv[]) {
     }
 
     //Check throughput/loaded latency benchmark access patterns
-    if (options[RANDOM_ACCESS_PATTERN] || options[SEQUENTIAL_ACCESS_PATTERN]) { //override defaults
+    if (options[RANDOM_ACCESS_PATTERN] || options[INDEPENDENT_RANDOM_ACCESS_PATTERN] || options[SEQUENTIAL_ACCESS_PATTERN]) { //override defaults
         use_random_access_pattern_ = false;
+        use_independent_random_access_pattern_ = false;
         use_sequential_access_pattern_ = false;
     }
 
     if (options[RANDOM_ACCESS_PATTERN])
         use_random_access_pattern_ = true;
 
+    if (options[INDEPENDENT_RANDOM_ACCESS_PATTERN])
+        use_independent_random_access_pattern_ = true;
+
     if (options[SEQUENTIAL_ACCESS_PATTERN])
         use_sequential_access_pattern_ = true;
 
@@ -463,9 +584,10 @@ int32_t Configurator::configureFromInput(int argc, char* argv[]) {
     }
 
     //Check if reads and/or writes should be used in throughput and loaded latency benchmarks
-    if (options[USE_READS] || options[USE_WRITES]) { //override defaults
+    if (options[USE_READS] || options[USE_WRITES] || options[USE_NT_WRITES] || options[RW_RATIO]) { //override defaults
         use_reads_ = false;
         use_writes_ = false;
+        use_nt_writes_ = false;
     }
 
     if (options[USE_READS])
@@ -474,6 +596,167 @@ int32_t Configurator::configureFromInput(int argc, char* argv[]) {
     if (options[USE_WRITES])
         use_writes_ = true;
 
+    if (options[USE_NT_WRITES]) {
+#ifdef HAS_NT_STORES
+        use_nt_writes_ = true;
+#else
+        std::cerr << "ERROR: Non-temporal writes are not supported on this platform." << std::endl;
+        goto error;
+#endif
+    }
+
+    if (options[RW_RATIO]) {
+        Option* curr = options[RW_RATIO];
+        while (curr) { //RW_RATIO may occur more than once, this is perfectly OK.
+            std::string ratio_arg = curr->arg;
+            bool found = false;
+            for (uint32_t m = READ_WRITE_1_1; m <= READ_MODIFY_WRITE; m++) {
+                rw_mode_t rw_mode = static_cast<rw_mode_t>(m);
+                if (ratio_arg == rw_ratio_name(rw_mode)) {
+                    if (std::find(mixed_rw_modes_.begin(), mixed_rw_modes_.end(), rw_mode) == mixed_rw_modes_.end())
+                        mixed_rw_modes_.push_back(rw_mode);
+                    found = true;
+                }
+            }
+            if (!found) {
+                std::cerr << "ERROR: Invalid read/write ratio " << ratio_arg << ". Allowed values: 1:1, 2:1, 3:1, rmw." << std::endl;
+                goto error;
+            }
+            curr = curr->next();
+        }
+    }
+
+    //Check timer backend
+    if (options[TIMER]) { //override defaults
+        if (!check_single_option_occurrence(&options[TIMER]))
+            goto error;
+
+        std::string timer_arg = options[TIMER].arg;
+        if (timer_arg == timer_backend_name(TIMER_OS))
+            g_timer_backend = TIMER_OS;
+        else if (timer_arg == timer_backend_name(TIMER_TSC) || timer_arg == timer_backend_name(TIMER_INVARIANT_TSC)) {
+#ifdef HAS_TSC_TIMER
+            if (timer_arg == timer_backend_name(TIMER_TSC))
+                g_timer_backend = TIMER_TSC;
+            else if (has_invariant_tsc())
+                g_timer_backend = TIMER_INVARIANT_TSC;
+            else {
+                std::cerr << "WARNING: This CPU does not report an invariant TSC. Falling back to the OS timer." << std::endl;
+                g_timer_backend = TIMER_OS;
+            }
+#else
+            std::cerr << "ERROR: TSC-based timers are not supported on this platform." << std::endl;
+            goto error;
+#endif
+        } else {
+            std::cerr << "ERROR: Invalid timer backend " << timer_arg << ". Allowed values: os, tsc, invariant_tsc." << std::endl;
+            goto error;
+        }
+    }
+
+    //Check run-time kernel generation
+    if (options[JIT_KERNELS]) {
+#ifdef HAS_JIT_KERNELS
+        g_use_jit_kernels = true;
+#else
+        std::cerr << "ERROR: Run-time kernel generation is only supported on x86-64 GNU/Linux." << std::endl;
+        goto error;
+#endif
+    }
+
+    //Check pointer chain settings
+    if (options[RANDOM_SEED]) { //override defaults
+        if (!check_single_option_occurrence(&options[RANDOM_SEED]))
+            goto error;
+
+        char* endptr = NULL;
+        g_random_seed = static_cast<uint64_t>(strtoull(options[RANDOM_SEED].arg, &endptr, 10));
+    }
+
+    if (options[CHAIN_GRANULARITY]) { //override defaults
+        if (!check_single_option_occurrence(&options[CHAIN_GRANULARITY]))
+            goto error;
+
+        std::string granularity_arg = options[CHAIN_GRANULARITY].arg;
+        if (granularity_arg == chain_granularity_name(CHAIN_CHUNK))
+            g_chain_granularity = CHAIN_CHUNK;
+        else if (granularity_arg == chain_granularity_name(CHAIN_CACHE_LINE))
+            g_chain_granularity = CHAIN_CACHE_LINE;
+        else if (granularity_arg == chain_granularity_name(CHAIN_PAGE))
+            g_chain_granularity = CHAIN_PAGE;
+        else {
+            std::cerr << "ERROR: Invalid pointer chain granularity " << granularity_arg << ". Allowed values: chunk, line, page." << std::endl;
+            goto error;
+        }
+    }
+    g_chain_random_offsets = g_chain_granularity == CHAIN_PAGE; //spread page-granular nodes across cache sets by default
+
+    if (options[CHAIN_OFFSETS]) { //override defaults
+        if (!check_single_option_occurrence(&options[CHAIN_OFFSETS]))
+            goto error;
+
+        std::string offsets_arg = options[CHAIN_OFFSETS].arg;
+        if (offsets_arg == "aligned")
+            g_chain_random_offsets = false;
+        else if (offsets_arg == "random")
+            g_chain_random_offsets = true;
+        else {
+            std::cerr << "ERROR: Invalid pointer chain node offsets " << offsets_arg << ". Allowed values: aligned, random." << std::endl;
+            goto error;
+        }
+        if (g_chain_random_offsets && g_chain_granularity == CHAIN_CHUNK)
+            std::cerr << "WARNING: Random node offsets have no effect on chunk-granular pointer chains." << std::endl;
+    }
+
+    if (options[PREFETCH_HINT]) { //override defaults
+        if (!check_single_option_occurrence(&options[PREFETCH_HINT]))
+            goto error;
+
+        std::string hint_arg = options[PREFETCH_HINT].arg;
+        bool found = false;
+        for (uint32_t h = 0; h < NUM_PREFETCH_HINTS; h++) {
+            if (hint_arg == prefetch_hint_name(static_cast<prefetch_hint_t>(h))) {
+                g_prefetch_hint = static_cast<prefetch_hint_t>(h);
+                found = true;
+            }
+        }
+        if (!found) {
+            std::cerr << "ERROR: Invalid prefetch hint " << hint_arg << ". Allowed values: t0, t1, t2, nta." << std::endl;
+            goto error;
+        }
+    }
+
+    //Check sampling settings
+    if (options[SAMPLE_DURATION]) { //override defaults
+        if (!check_single_option_occurrence(&options[SAMPLE_DURATION]))
+            goto error;
+
+        char* endptr = NULL;
+        unsigned long sample_ms = strtoul(options[SAMPLE_DURATION].arg, &endptr, 10);
+        if (*endptr != '\0' || sample_ms == 0) {
+            std::cerr << "ERROR: The sample duration must be a whole number of milliseconds greater than 0." << std::endl;
+            goto error;
+        }
+        if (sample_ms > BENCHMARK_DURATION_MS) {
+            std::cerr << "ERROR: The sample duration may not exceed the benchmark duration of " << BENCHMARK_DURATION_MS << " ms." << std::endl;
+            goto error;
+        }
+        g_sample_duration_ms = static_cast<uint32_t>(sample_ms);
+    }
+
+    if (options[CI_WIDTH]) { //override defaults
+        if (!check_single_option_occurrence(&options[CI_WIDTH]))
+            goto error;
+
+        char* endptr = NULL;
+        double ci_width_percent = strtod(options[CI_WIDTH].arg, &endptr);
+        if (*endptr != '\0' || ci_width_percent <= 0 || ci_width_percent >= 100) {
+            std::cerr << "ERROR: The CI width must be a percentage greater than 0 and less than 100." << std::endl;
+            goto error;
+        }
+        g_ci_width = ci_width_percent / 100;
+    }
+
     if (options[DEC_NET_FILE]) { //override defaults
         if (!check_single_option_occurrence(&options[DEC_NET_FILE]))
             goto error;
@@ -484,75 +767,48 @@ int32_t Configurator::configureFromInput(int argc, char* argv[]) {
 
     //Check stride sizes
     if (options[STRIDE_SIZE]) { //override defaults
-        use_stride_p1_ = false;
-        use_stride_n1_ = false;
-        use_stride_p2_ = false;
-        use_stride_n2_ = false;
-        use_stride_p4_ = false;
-        use_stride_n4_ = false;
-        use_stride_p8_ = false;
-        use_stride_n8_ = false;
-        use_stride_p16_ = false;
-        use_stride_n16_ = false;
+        stride_sizes_.clear();
 
         Option* curr = options[STRIDE_SIZE];
         while (curr) { //STRIDE_SIZE may occur more than once, this is perfectly OK.
             char* endptr = NULL;
             int32_t stride_size = static_cast<int32_t>(strtoul(curr->arg, &endptr, 10));
-            switch (stride_size) {
-                case 1:
-                    use_stride_p1_ = true;
-                    break;
-                case -1:
-                    use_stride_n1_ = true;
-                    break;
-                case 2:
-                    use_stride_p2_ = true;
-                    break;
-                case -2:
-                    use_stride_n2_ = true;
-                    break;
-                case 4:
-                    use_stride_p4_ = true;
-                    break;
-                case -4:
-                    use_stride_n4_ = true;
-                    break;
-                case 8:
-                    use_stride_p8_ = true;
-                    break;
-                case -8:
-                    use_stride_n8_ = true;
-                    break;
-                case 16:
-                    use_stride_p16_ = true;
-                    break;
-                case -16:
-                    use_stride_n16_ = true;
-                    break;
+            if (std::find(stride_sizes_.begin(), stride_sizes_.end(), stride_size) == stride_sizes_.end())
+                stride_sizes_.push_back(stride_size);
+            curr = curr->next();
+        }
+    }
 
-                default:
-                    std::cerr << "ERROR: Invalid stride size " << stride_size << ". Stride sizes can be 1, -1, 2, -2, 4, -4, 8, -8, 16, or -16." << std::endl;
-                    goto error;
+    //Check contention and false sharing spacings
+    if (options[SPACING]) {
+        Option* curr = options[SPACING];
+        while (curr) { //SPACING may occur more than once, this is perfectly OK.
+            char* endptr = NULL;
+            uint32_t spacing = static_cast<uint32_t>(strtoul(curr->arg, &endptr, 10));
+            if (spacing % sizeof(uintptr_t) != 0) {
+                std::cerr << "ERROR: The spacing " << spacing << " is not a multiple of the pointer size of " << sizeof(uintptr_t) << " bytes." << std::endl;
+                goto error;
             }
+            if (std::find(spacings_.begin(), spacings_.end(), spacing) == spacings_.end())
+                spacings_.push_back(spacing);
             curr = curr->next();
         }
     }
 
     //Make sure at least one mode is available
-    if (!run_latency_ && !run_throughput_ && !run_extensions_ && !run_latency_matrix_ && !run_throughput_matrix_) {
+    if (!run_latency_ && !run_throughput_ && !run_extensions_ && !run_latency_matrix_ && !run_throughput_matrix_ && !run_prefetch_sweep_ && !run_mlp_sweep_ && !run_contention_ && !run_core_to_core_matrix_ && !run_producer_consumer_ && !run_false_sharing_ && !run_dram_mapping_) {
         std::cerr << "ERROR: At least one benchmark type must be selected." << std::endl;
         goto error;
     }
 
     //Make sure at least one access pattern is selectee
-    if (!use_random_access_pattern_ && !use_sequential_access_pattern_) {
+    if (!use_random_access_pattern_ && !use_independent_random_access_pattern_ && !use_sequential_access_pattern_) {
         std::cerr << "ERROR: No access pattern was specified!" << std::endl;
         goto error;
     }
 
     //Make sure at least one read/write pattern is selected
-    if (!use_reads_ && !use_writes_) {
+    if (!use_reads_ && !use_writes_ && !use_nt_writes_ && mixed_rw_modes_.empty()) {
         std::cerr << "ERROR: Throughput benchmark was selected, but no read/write pattern was specified!" << std::endl;
         goto error;
     }
@@ -578,25 +834,62 @@ int32_t Configurator::configureFromInput(int argc, char* argv[]) {
         use_chunk_128b_ = true;
 #endif
 #ifdef HAS_WORD_256
-        use_chunk_256b_ = true;
+        use_chunk_256b_ = chunk_size_supported(CHUNK_256b);
 #endif
 #ifdef HAS_WORD_512
-        use_chunk_512b = true;
+        use_chunk_512b_ = chunk_size_supported(CHUNK_512b);
 #endif
         use_random_access_pattern_ = true;
+        use_independent_random_access_pattern_ = true;
         use_sequential_access_pattern_ = true;
         use_reads_ = true;
         use_writes_ = true;
-        use_stride_p1_ = true;
-        use_stride_n1_ = true;
-        use_stride_p2_ = true;
-        use_stride_n2_ = true;
-        use_stride_p4_ = true;
-        use_stride_n4_ = true;
-        use_stride_p8_ = true;
-        use_stride_n8_ = true;
-        use_stride_p16_ = true;
-        use_stride_n16_ = true;
+#ifdef HAS_NT_STORES
+        use_nt_writes_ = true;
+#endif
+        mixed_rw_modes_.clear();
+        for (uint32_t m = READ_WRITE_1_1; m <= READ_MODIFY_WRITE; m++)
+            mixed_rw_modes_.push_back(static_cast<rw_mode_t>(m));
+        stride_sizes_.clear();
+        for (int32_t stride_size = 1; stride_size <= 16; stride_size *= 2) {
+            stride_sizes_.push_back(stride_size);
+            stride_sizes_.push_back(-stride_size);
+        }
+    }
+
+    //Make sure kernels were generated for every stride with every chunk size
+    for (auto it = stride_sizes_.cbegin(); it != stride_sizes_.cend(); it++) {
+        if (use_chunk_32b_ && !check_stride_size(*it, CHUNK_32b, 32))
+            goto error;
+#ifdef HAS_WORD_64
+        if (use_chunk_64b_ && !check_stride_size(*it, CHUNK_64b, 64))
+            goto error;
+#endif
+#ifdef HAS_WORD_128
+        if (use_chunk_128b_ && !check_stride_size(*it, CHUNK_128b, 128))
+            goto error;
+#endif
+#ifdef HAS_WORD_256
+        if (use_chunk_256b_ && !check_stride_size(*it, CHUNK_256b, 256))
+            goto error;
+#endif
+#ifdef HAS_WORD_512
+        if (use_chunk_512b_ && !check_stride_size(*it, CHUNK_512b, 512))
+            goto error;
+#endif
+    }
+
+    //Each pass of a strided load kernel makes one access per stride, so the pass must fit in the working set of each thread
+    for (auto it = stride_sizes_.begin(); it != stride_sizes_.end(); ) {
+        if (sequential_pass_span(*it) <= working_set_size_per_thread_) {
+            it++;
+        } else if (options[STRIDE_SIZE]) {
+            std::cerr << "ERROR: Strides of " << *it << " chunks walk " << sequential_pass_span(*it) << " bytes per pass, which is more than the working set size per thread. Use a larger working set or a smaller stride." << std::endl;
+            goto error;
+        } else {
+            std::cerr << "NOTE: Strides of " << *it << " chunks walk " << sequential_pass_span(*it) << " bytes per pass, which is more than the working set size per thread. They will be omitted." << std::endl;
+            it = stride_sizes_.erase(it);
+        }
     }
 
 #ifdef HAS_WORD_64
@@ -637,6 +930,67 @@ int32_t Configurator::configureFromInput(int argc, char* argv[]) {
             mem_regions_phys_addr_.push_back(addr);
             mem_regions_++;
         }
+
+        if (page_modes_.size() > 1 || page_modes_[0] != PAGE_MODE_DEFAULT) {
+            std::cerr << "ERROR: Page sizes cannot be chosen for regions given by physical address, which are mapped from /dev/mem." << std::endl;
+            goto error;
+        }
+    }
+
+    //Check physical address resolution through pagemap
+    if (options[PAGEMAP])
+        pagemap_ = true;
+
+    if (options[PAGEMAP_FILE]) {
+        if (!check_single_option_occurrence(&options[PAGEMAP_FILE]))
+            goto error;
+
+        pagemap_filename_ = options[PAGEMAP_FILE].arg;
+        use_pagemap_file_ = true;
+        pagemap_ = true;
+    }
+
+    if (options[PHYS_CONTIGUOUS]) {
+        phys_contiguous_ = true;
+        pagemap_ = true;
+    }
+
+    if (options[PHYS_RANGE]) {
+        if (!check_single_option_occurrence(&options[PHYS_RANGE]))
+            goto error;
+
+        std::string addr_string;
+        std::stringstream ss(options[PHYS_RANGE].arg);
+        std::vector<uint64_t> range;
+        while (getline(ss, addr_string, ','))
+            range.push_back(static_cast<uint64_t>(strtoull(addr_string.c_str(), NULL, 16)));
+        if (range.size() != 2 || range[0] >= range[1]) {
+            std::cerr << "ERROR: The physical address range must be given as START,END with START below END." << std::endl;
+            goto error;
+        }
+        phys_range_start_ = range[0];
+        phys_range_end_ = range[1];
+        phys_range_ = true;
+        pagemap_ = true;
+    }
+
+    //DRAM address mapping discovery needs the physical address of every line, which regions mapped from /dev/mem give directly
+    if (run_dram_mapping_ && !mem_regions_in_phys_addr_)
+        pagemap_ = true;
+
+    if (pagemap_) {
+#ifndef __gnu_linux__
+        std::cerr << "ERROR: Physical addresses can only be resolved through pagemap on GNU/Linux." << std::endl;
+        goto error;
+#endif
+        if (mem_regions_in_phys_addr_) {
+            std::cerr << "ERROR: Physical addresses cannot be resolved through pagemap for regions given by physical address, which are mapped from /dev/mem." << std::endl;
+            goto error;
+        }
+        if (prefault_mode_ == PREFAULT_NONE) {
+            std::cerr << "ERROR: Physical addresses can only be resolved through pagemap for prefaulted memory regions." << std::endl;
+            goto error;
+        }
     }
 
     if (options[ALL_CORES]) { //Override default value
@@ -679,6 +1033,20 @@ int32_t Configurator::configureFromInput(int argc, char* argv[]) {
                 std::cout << "Unloaded ";
             std::cout << "throughput matrix" << std::endl;
         }
+        if (run_prefetch_sweep_)
+            std::cout << "---> Software prefetch distance sweep" << std::endl;
+        if (run_mlp_sweep_)
+            std::cout << "---> Memory-level parallelism sweep" << std::endl;
+        if (run_contention_)
+            std::cout << "---> Cache line contention" << std::endl;
+        if (run_core_to_core_matrix_)
+            std::cout << "---> Core-to-core latency matrix" << std::endl;
+        if (run_producer_consumer_)
+            std::cout << "---> Producer/consumer ring buffer" << std::endl;
+        if (run_false_sharing_)
+            std::cout << "---> False sharing" << std::endl;
+        if (run_dram_mapping_)
+            std::cout << "---> DRAM address mapping" << std::endl;
         if (run_extensions_)
             std::cout << "---> Extensions" << std::endl;
         std::cout << std::endl;
@@ -690,6 +1058,12 @@ int32_t Configurator::configureFromInput(int argc, char* argv[]) {
         else
             std::cout << "no";
         std::cout << std::endl;
+        std::cout << "---> Independent random access:       ";
+        if (use_independent_random_access_pattern_)
+            std::cout << "yes";
+        else
+            std::cout << "no";
+        std::cout << std::endl;
         std::cout << "---> Sequential access:               ";
         if (use_sequential_access_pattern_)
             std::cout << "yes";
@@ -708,6 +1082,18 @@ int32_t Configurator::configureFromInput(int argc, char* argv[]) {
         else
             std::cout << "no";
         std::cout << std::endl;
+        std::cout << "---> Use non-temporal writes:         ";
+        if (use_nt_writes_)
+            std::cout << "yes";
+        else
+            std::cout << "no";
+        std::cout << std::endl;
+        std::cout << "---> Read:write ratios:               ";
+        if (mixed_rw_modes_.empty())
+            std::cout << "none";
+        for (auto it = mixed_rw_modes_.cbegin(); it != mixed_rw_modes_.cend(); it++)
+            std::cout << rw_ratio_name(*it) << " ";
+        std::cout << std::endl;
         std::cout << "---> Chunk sizes:                     ";
         if (use_chunk_32b_)
             std::cout << "32 ";
@@ -724,32 +1110,20 @@ int32_t Configurator::configureFromInput(int argc, char* argv[]) {
             std::cout << "256 ";
 #endif
 #ifdef HAS_WORD_512
-        if (use_chunk_512b)
+        if (use_chunk_512b_)
             std::cout << "512 ";
 #endif
         std::cout << std::endl;
         std::cout << "---> Stride sizes:                    ";
-        if (use_stride_p1_)
-            std::cout << "1 ";
-        if (use_stride_n1_)
-            std::cout << "-1 ";
-        if (use_stride_p2_)
-            std::cout << "2 ";
-        if (use_stride_n2_)
-            std::cout << "-2 ";
-        if (use_stride_p4_)
-            std::cout << "4 ";
-        if (use_stride_n4_)
-            std::cout << "-4 ";
-        if (use_stride_p8_)
-            std::cout << "8 ";
-        if (use_stride_n8_)
-            std::cout << "-8 ";
-        if (use_stride_p16_)
-            std::cout << "16 ";
-        if (use_stride_n16_)
-            std::cout << "-16 ";
+        for (auto it = stride_sizes_.cbegin(); it != stride_sizes_.cend(); it++)
+            std::cout << *it << " ";
         std::cout << std::endl;
+        if (!spacings_.empty()) {
+            std::cout << "---> Spacings (B):                    ";
+            for (auto it = spacings_.cbegin(); it != spacings_.cend(); it++)
+                std::cout << *it << " ";
+            std::cout << std::endl;
+        }
         std::cout << "---> Number of worker threads:        ";
         std::cout << num_worker_threads_ << std::endl;
         std::cout << "---> NUMA enabled:                    ";
@@ -769,15 +1143,40 @@ int32_t Configurator::configureFromInput(int argc, char* argv[]) {
 #else
         std::cout << "not supported" << std::endl;
 #endif
-        std::cout << "---> Large pages:                     ";
-#ifdef HAS_LARGE_PAGES
-        if (use_large_pages_)
-            std::cout << "yes" << std::endl;
+        std::cout << "---> Page sizes:                      ";
+        for (auto it = page_modes_.cbegin(); it != page_modes_.cend(); it++)
+            std::cout << page_mode_name(*it) << " ";
+        std::cout << std::endl;
+        std::cout << "---> Prefault:                        ";
+        std::cout << prefault_mode_name(prefault_mode_) << std::endl;
+        std::cout << "---> Physical addresses:              ";
+        if (mem_regions_in_phys_addr_)
+            std::cout << "/dev/mem";
+        else if (pagemap_)
+            std::cout << "pagemap";
         else
-            std::cout << "no" << std::endl;
-#else
-        std::cout << "not supported" << std::endl;
-#endif
+            std::cout << "not resolved";
+        if (phys_contiguous_)
+            std::cout << ", physically contiguous runs";
+        if (phys_range_)
+            std::cout << ", within [0x" << std::hex << phys_range_start_ << ", 0x" << phys_range_end_ << ")" << std::dec;
+        std::cout << std::endl;
+        std::cout << "---> Timer:                           ";
+        std::cout << timer_backend_name(g_timer_backend) << std::endl;
+        std::cout << "---> Latency chain granularity:       ";
+        std::cout << chain_granularity_name(g_chain_granularity) << std::endl;
+        std::cout << "---> Latency chain node offsets:      ";
+        std::cout << (g_chain_random_offsets ? "random" : "aligned") << std::endl;
+        std::cout << "---> Software prefetch hint:          ";
+        std::cout << prefetch_hint_name(g_prefetch_hint) << std::endl;
+        std::cout << "---> Kernels:                         ";
+        std::cout << (g_use_jit_kernels ? "generated at run time" : "compiled") << std::endl;
+        std::cout << "---> Random seed:                     ";
+        std::cout << g_random_seed << std::endl;
+        std::cout << "---> Sample duration:                 ";
+        std::cout << g_sample_duration_ms << " ms" << std::endl;
+        std::cout << "---> CI width:                        ";
+        std::cout << g_ci_width * 100 << "% of median" << std::endl;
         std::cout << "---> Iterations:                      ";
         std::cout << iterations_ << std::endl;
         std::cout << "---> Starting test index:             ";
@@ -786,18 +1185,13 @@ int32_t Configurator::configureFromInput(int argc, char* argv[]) {
     }
 
         std::cout << "Working set per thread:               ";
-    if (use_large_pages_) {
-        size_t num_large_pages = 0;
-        if (working_set_size_per_thread_ <= g_large_page_size) //sub one large page, round up to one
-            num_large_pages = 1;
-        else if (working_set_size_per_thread_ % g_large_page_size == 0) //multiple of large page
-            num_large_pages = working_set_size_per_thread_ / g_large_page_size;
-        else //larger than one large page but not a multiple of large page
-            num_large_pages = working_set_size_per_thread_ / g_large_page_size + 1;
-        std::cout << working_set_size_per_thread_ << " B == " << working_set_size_per_thread_ / KB  << " KB == " << working_set_size_per_thread_ / MB << " MB (fits in " << num_large_pages << " large pages)" << std::endl;
-    } else {
-        std::cout << working_set_size_per_thread_ << " B == " << working_set_size_per_thread_ / KB  << " KB == " << working_set_size_per_thread_ / MB << " MB (" << working_set_size_per_thread_/(g_page_size) << " pages)" << std::endl;
+    std::cout << working_set_size_per_thread_ << " B == " << working_set_size_per_thread_ / KB  << " KB == " << working_set_size_per_thread_ / MB << " MB";
+    for (auto it = page_modes_.cbegin(); it != page_modes_.cend(); it++) {
+        size_t page_size = page_mode_size(*it);
+        size_t num_pages = (working_set_size_per_thread_ + page_size - 1) / page_size; //a partial page still takes a whole one
+        std::cout << (it == page_modes_.cbegin() ? " (" : ", ") << num_pages << " x " << page_size / KB << " KB " << (num_pages == 1 ? "page" : "pages") << " for " << page_mode_name(*it);
     }
+    std::cout << ")" << std::endl;
     std::cout << std::endl;
 
     //Free up options memory
@@ -825,3 +1219,24 @@ bool Configurator::check_single_option_occurrence(Option* opt) const {
     }
     return true;
 }
+
+bool Configurator::check_stride_size(int32_t stride_size, chunk_size_t chunk_size, uint32_t chunk_bits) const {
+#ifdef HAS_JIT_KERNELS
+    if (g_use_jit_kernels) {
+        if (jit_supports_stride(chunk_size, stride_size))
+            return true;
+        std::cerr << "ERROR: Invalid stride size " << stride_size << " for " << chunk_bits << "-bit chunks. Generated kernels support any non-zero stride of at most " << KERNEL_BATCH_SIZE << " bytes." << std::endl;
+        return false;
+    }
+#endif
+
+    std::vector<int32_t> allowed = sequential_kernel_strides(chunk_size);
+    if (std::find(allowed.begin(), allowed.end(), stride_size) != allowed.end())
+        return true;
+
+    std::cerr << "ERROR: Invalid stride size " << stride_size << " for " << chunk_bits << "-bit chunks. Stride sizes can be";
+    for (uint32_t i = 0; i < allowed.size(); i++)
+        std::cerr << (i == 0 ? " " : ", ") << allowed[i];
+    std::cerr << "." << std::endl;
+    return false;
+}
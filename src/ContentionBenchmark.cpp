@@ -0,0 +1,315 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ *
+ * @brief Implementation file for the ContentionBenchmark class.
+ */
+
+//Headers
+#include <ContentionBenchmark.h>
+#include <ContentionWorker.h>
+#include <benchmark_kernels.h>
+#include <common.h>
+
+//Libraries
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+using namespace xmem;
+
+ContentionBenchmark::ContentionBenchmark(
+        void* mem_array,
+        size_t len,
+        uint32_t iterations,
+        uint32_t mem_node,
+        uint32_t cpu_node,
+        std::vector<int32_t> cpus,
+        std::string placement,
+        contention_op_t op,
+        uint32_t spacing,
+        std::vector<PowerReader*> dram_power_readers,
+        std::string name
+    ) :
+        Benchmark(
+            mem_array,
+            len,
+            iterations,
+            static_cast<uint32_t>(cpus.size()),
+            mem_node,
+            0,
+            cpu_node,
+            SEQUENTIAL,
+            (op == CONTENTION_STORE) ? WRITE : READ_MODIFY_WRITE,
+#ifdef HAS_WORD_64
+            CHUNK_64b,
+#else
+            CHUNK_32b,
+#endif
+            1,
+            dram_power_readers,
+            "Mops/s",
+            name
+        ),
+        cpus_(cpus),
+        placement_(placement),
+        op_(op),
+        spacing_(spacing),
+        thread_rates_()
+    {
+}
+
+void ContentionBenchmark::reportBenchmarkInfo() const {
+    std::cout << "CPU NUMA Node: " << cpu_node_ << std::endl;
+    std::cout << "Memory NUMA Node: " << mem_node_ << std::endl;
+    std::cout << "Operation: " << contention_op_name(op_) << std::endl;
+    std::cout << "Target spacing: ";
+    if (spacing_ == 0)
+        std::cout << "none (all threads share one word)";
+    else
+        std::cout << spacing_ << " B";
+    std::cout << std::endl;
+    std::cout << "Thread placement: " << placement_ << std::endl;
+    std::cout << "Logical CPUs:";
+    for (uint32_t t = 0; t < cpus_.size(); t++)
+        std::cout << " " << cpus_[t];
+    std::cout << std::endl;
+    std::cout << "Physical packages spanned: ";
+    uint32_t packages = getPackagesSpanned();
+    if (packages == 0)
+        std::cout << "?";
+    else
+        std::cout << packages;
+    std::cout << std::endl;
+    std::cout << std::endl;
+}
+
+void ContentionBenchmark::reportResults() const {
+    Benchmark::reportResults();
+    if (has_run_) {
+        std::cout << "Average time per operation per thread: " << getMedianLatency() << " ns";
+        if (warning_)
+            std::cout << " (WARNING)";
+        std::cout << std::endl;
+        std::cout << "Mean rate of each thread:";
+        for (uint32_t t = 0; t < thread_rates_.size(); t++)
+            std::cout << " " << thread_rates_[t];
+        std::cout << " " << metric_units_ << std::endl;
+    }
+}
+
+contention_op_t ContentionBenchmark::getOp() const {
+    return op_;
+}
+
+uint32_t ContentionBenchmark::getSpacing() const {
+    return spacing_;
+}
+
+std::string ContentionBenchmark::getPlacement() const {
+    return placement_;
+}
+
+uint32_t ContentionBenchmark::getPackagesSpanned() const {
+    std::vector<uint32_t> packages;
+    for (uint32_t t = 0; t < cpus_.size(); t++) {
+        if (cpus_[t] < 0 || static_cast<uint32_t>(cpus_[t]) >= g_physical_package_of_cpu.size())
+            return 0;
+        uint32_t package = g_physical_package_of_cpu[cpus_[t]];
+        if (std::find(packages.begin(), packages.end(), package) == packages.end())
+            packages.push_back(package);
+    }
+    return static_cast<uint32_t>(packages.size());
+}
+
+double ContentionBenchmark::getMedianLatency() const {
+    if (!has_run_ || median_metric_ <= 0)
+        return 0;
+    return static_cast<double>(num_worker_threads_) * 1e3 / median_metric_; //Mops/s across all threads to ns per op on each thread
+}
+
+std::vector<double> ContentionBenchmark::getThreadRates() const {
+    return thread_rates_;
+}
+
+bool ContentionBenchmark::runCore() {
+    //Make sure all targets fit in the region and do not straddle cache lines
+    if (spacing_ % sizeof(uintptr_t) != 0) {
+        std::cerr << "ERROR: Contention target spacing must be a multiple of " << sizeof(uintptr_t) << " bytes." << std::endl;
+        return false;
+    }
+    size_t span = static_cast<size_t>(spacing_) * (num_worker_threads_ - 1) + sizeof(uintptr_t);
+    if (span > len_) {
+        std::cerr << "ERROR: Contention targets of " << num_worker_threads_ << " threads spaced " << spacing_ << " B apart need " << span << " B, but the memory region only has " << len_ << " B." << std::endl;
+        return false;
+    }
+
+    //Set up kernel function pointers
+    ContentionFunction kernel_fptr = NULL;
+    ContentionFunction kernel_dummy_fptr = NULL;
+    if (!determine_contention_kernel(op_, &kernel_fptr, &kernel_dummy_fptr)) {
+        std::cerr << "ERROR: Failed to find appropriate benchmark kernel." << std::endl;
+        return false;
+    }
+
+    //The targets overwrite whatever pointer chain was in that part of the region
+    if (region_cache_ != NULL)
+        region_cache_->invalidate(mem_array_, reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_) + span));
+    memset(mem_array_, 0, span);
+
+    //Set up some stuff for worker threads
+    std::vector<MemoryWorker*> workers;
+    SpinBarrier start_barrier;
+    std::vector<double> thread_rate_sums(num_worker_threads_, 0);
+    uint32_t iterations_run = 0;
+
+    //Start power measurement
+    if (g_verbose)
+        std::cout << "Starting power measurement threads...";
+    if (!startPowerThreads()) {
+        if (g_verbose)
+            std::cout << "FAIL" << std::endl;
+        std::cerr << "WARNING: Failed to start power measurement threads." << std::endl;
+    } else if (g_verbose)
+        std::cout << "done" << std::endl;
+
+    //Run benchmark
+    if (g_verbose)
+        std::cout << "Running benchmark." << std::endl << std::endl;
+
+    //Do a bunch of iterations of the core benchmark routines
+    for (uint32_t i = 0; i < iterations_; i++) {
+        //Create workers. Pooled threads already start together, but freshly created ones do not, so the workers hold each other up at their own barrier too.
+        start_barrier.reset(num_worker_threads_);
+        for (uint32_t t = 0; t < num_worker_threads_; t++) {
+            workers.push_back(new ContentionWorker(reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_) + t * spacing_),
+                                                   kernel_fptr,
+                                                   kernel_dummy_fptr,
+                                                   &start_barrier,
+                                                   cpus_[t]));
+        }
+
+        //All workers stop together once the first one has converged, since the others would otherwise run on without contention
+        SampleControl sample_control;
+        for (uint32_t t = 0; t < workers.size(); t++)
+            workers[t]->setSampleControl(&sample_control, t == 0);
+
+        if (!runWorkers(workers, i == 0))
+            std::cerr << "WARNING: A worker thread failed to complete correctly!" << std::endl;
+
+        //Compute the aggregate rate of all workers, each over its own timed window
+        uint32_t total_passes = 0;
+        tick_t total_adjusted_ticks = 0;
+        tick_t total_elapsed_dummy_ticks = 0;
+        double ops_per_sec = 0;
+        bool iter_warning = false;
+        for (uint32_t t = 0; t < num_worker_threads_; t++) {
+            tick_t adjusted_ticks = workers[t]->getAdjustedTicks();
+            total_passes += workers[t]->getPasses();
+            total_adjusted_ticks += adjusted_ticks;
+            total_elapsed_dummy_ticks += workers[t]->getElapsedDummyTicks();
+            iter_warning |= workers[t]->hadWarning();
+            if (adjusted_ticks > 0) {
+                double thread_ops_per_sec = (static_cast<double>(workers[t]->getPasses()) * CONTENTION_BENCHMARK_OPS_PER_PASS) / ((static_cast<double>(adjusted_ticks) * g_ns_per_tick) / 1e9);
+                ops_per_sec += thread_ops_per_sec;
+                thread_rate_sums[t] += thread_ops_per_sec / 1e6;
+            } else
+                iter_warning = true;
+        }
+        iterations_run++;
+
+        if (iter_warning)
+            warning_ = true;
+
+        if (g_verbose) { //Report duration for this iteration
+            std::cout << "Iter " << i+1 << " had " << total_passes << " passes in total across " << num_worker_threads_ << " threads, with " << CONTENTION_BENCHMARK_OPS_PER_PASS << " operations per pass:";
+            if (iter_warning) std::cout << " -- WARNING";
+            std::cout << std::endl;
+
+            std::cout << "...clock ticks in total across " << num_worker_threads_ << " threads == " << total_adjusted_ticks << " (adjusted by -" << total_elapsed_dummy_ticks << ")";
+            if (iter_warning) std::cout << " -- WARNING";
+            std::cout << std::endl;
+
+            std::cout << "...ns in total across " << num_worker_threads_ << " threads == " << total_adjusted_ticks * g_ns_per_tick << " (adjusted by -" << total_elapsed_dummy_ticks * g_ns_per_tick << ")";
+            if (iter_warning) std::cout << " -- WARNING";
+            std::cout << std::endl;
+        }
+
+        //Compute metric for this iteration
+        metric_on_iter_[i] = ops_per_sec / 1e6;
+
+        //Sample k of every worker covers the same slice of the iteration
+        std::vector<double> samples;
+        uint32_t num_samples = workers[0]->getNumSamples();
+        for (uint32_t t = 1; t < num_worker_threads_; t++)
+            num_samples = std::min(num_samples, workers[t]->getNumSamples());
+        for (uint32_t k = 0; k < num_samples; k++) {
+            double sample_ops_per_sec = 0;
+            bool valid = true;
+            for (uint32_t t = 0; t < num_worker_threads_; t++) {
+                tick_t ticks = workers[t]->getSampleAdjustedTicks(k);
+                if (ticks == 0) {
+                    valid = false;
+                    break;
+                }
+                sample_ops_per_sec += (static_cast<double>(workers[t]->getSamplePasses(k)) * CONTENTION_BENCHMARK_OPS_PER_PASS) / ((static_cast<double>(ticks) * g_ns_per_tick) / 1e9);
+            }
+            if (valid)
+                samples.push_back(sample_ops_per_sec / 1e6);
+        }
+
+        //Clean up workers for this iteration
+        for (uint32_t t = 0; t < num_worker_threads_; t++) {
+            delete workers[t];
+        }
+        workers.clear();
+
+        if (recordIterationSamples(i, samples))
+            break;
+    }
+
+    //Stopping power measurement
+    if (g_verbose)
+        std::cout << "Stopping power measurement threads...";
+    if (!stopPowerThreads()) {
+        if (g_verbose)
+            std::cout << "FAIL" << std::endl;
+        std::cerr << "WARNING: Failed to stop power measurement threads." << std::endl;
+    } else if (g_verbose)
+        std::cout << "done" << std::endl;
+
+    thread_rates_.resize(num_worker_threads_);
+    for (uint32_t t = 0; t < num_worker_threads_; t++)
+        thread_rates_[t] = (iterations_run > 0) ? thread_rate_sums[t] / iterations_run : 0;
+
+    //Run metadata
+    has_run_ = true;
+    computeMetrics();
+
+    return true;
+}
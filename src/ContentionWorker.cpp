@@ -0,0 +1,153 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ * 
+ * @brief Implementation file for the ContentionWorker class.
+ */
+
+//Headers
+#include <ContentionWorker.h>
+#include <benchmark_kernels.h>
+#include <common.h>
+
+//Libraries
+#include <iostream>
+
+using namespace xmem;
+
+ContentionWorker::ContentionWorker(
+        void* target,
+        ContentionFunction kernel_fptr,
+        ContentionFunction kernel_dummy_fptr,
+        SpinBarrier* start_barrier,
+        int32_t cpu_affinity
+    ) :
+        MemoryWorker(
+            target,
+            sizeof(uintptr_t),
+            cpu_affinity
+        ),
+        kernel_fptr_(kernel_fptr),
+        kernel_dummy_fptr_(kernel_dummy_fptr),
+        start_barrier_(start_barrier)
+    {
+}
+
+ContentionWorker::~ContentionWorker() {
+}
+
+uint32_t ContentionWorker::getOpsPerPass() {
+    return CONTENTION_BENCHMARK_OPS_PER_PASS;
+}
+
+void ContentionWorker::runKernels() {
+    //Set up relevant state -- localized to this thread's stack
+    ContentionFunction kernel_fptr = NULL;
+    ContentionFunction kernel_dummy_fptr = NULL;
+    SpinBarrier* start_barrier = NULL;
+    void* target = NULL;
+    uintptr_t value = 0;
+    uintptr_t dummy_value = 0;
+    uint32_t bytes_per_pass = CONTENTION_BENCHMARK_OPS_PER_PASS * sizeof(uintptr_t);
+    uint32_t passes = 0;
+    tick_t start_tick = 0;
+    tick_t stop_tick = 0;
+    tick_t elapsed_ticks = 0;
+    tick_t elapsed_dummy_ticks = 0;
+    tick_t adjusted_ticks = 0;
+    bool warning = false;
+    tick_t target_ticks = g_ticks_per_ms * BENCHMARK_DURATION_MS; //Rough target run duration in ticks
+    SampleControl* sample_control = NULL;
+    bool sample_leader = false;
+    tick_t window_start_tick = 0;
+    tick_t window_stop_tick = 0;
+    uint32_t p = 0;
+
+    //Grab relevant setup state thread-safely and keep it local
+    if (acquireLock(-1)) {
+        target = mem_array_;
+        kernel_fptr = kernel_fptr_;
+        kernel_dummy_fptr = kernel_dummy_fptr_;
+        start_barrier = start_barrier_;
+        sample_control = sample_control_;
+        sample_leader = sample_leader_;
+        releaseLock();
+    }
+
+    SampleRecorder recorder(sample_control, sample_leader);
+
+    //Contention only exists while all workers are hammering, so start together
+    if (start_barrier != NULL)
+        start_barrier->wait();
+
+    //Run the benchmark!
+    window_start_tick = start_timer();
+
+    //Run actual version of function and loop overhead
+    while (elapsed_ticks < target_ticks) {
+        start_tick = start_timer();
+        UNROLL64((*kernel_fptr)(target, &value);)
+        stop_tick = stop_timer();
+        passes+=64;
+        elapsed_ticks += (stop_tick - start_tick);
+        if (recorder.addBlock(64, stop_tick - start_tick))
+            break;
+    }
+    window_stop_tick = stop_timer();
+
+    //Run dummy version of function and loop overhead
+    p = 0;
+    while (p < passes) {
+        start_tick = start_timer();
+        UNROLL64((*kernel_dummy_fptr)(target, &dummy_value);)
+        stop_tick = stop_timer();
+        p+=64;
+        elapsed_dummy_ticks += (stop_tick - start_tick);
+    }
+
+    adjusted_ticks = elapsed_ticks - elapsed_dummy_ticks;
+    recorder.finish(passes, elapsed_dummy_ticks);
+
+    //Warn if something looks fishy
+    if (elapsed_dummy_ticks >= elapsed_ticks || elapsed_ticks < MIN_ELAPSED_TICKS || adjusted_ticks < 0.5 * elapsed_ticks)
+        warning = true;
+
+    //Update the object state thread-safely
+    if (acquireLock(-1)) {
+        adjusted_ticks_ = adjusted_ticks;
+        elapsed_ticks_ = elapsed_ticks;
+        elapsed_dummy_ticks_ = elapsed_dummy_ticks;
+        warning_ = warning;
+        bytes_per_pass_ = bytes_per_pass;
+        completed_ = true;
+        passes_ = passes;
+        window_start_tick_ = window_start_tick;
+        window_stop_tick_ = window_stop_tick;
+        storeSamples(recorder);
+        releaseLock();
+    }
+}
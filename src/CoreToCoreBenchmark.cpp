@@ -0,0 +1,218 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ *
+ * @brief Implementation file for the CoreToCoreBenchmark class.
+ */
+
+//Headers
+#include <CoreToCoreBenchmark.h>
+#include <CoreToCoreWorker.h>
+#include <common.h>
+
+//Libraries
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+using namespace xmem;
+
+CoreToCoreBenchmark::CoreToCoreBenchmark(
+        void* mem_array,
+        size_t len,
+        uint32_t iterations,
+        uint32_t mem_node,
+        uint32_t cpu_node,
+        uint32_t initiator_cpu,
+        uint32_t responder_cpu,
+        std::vector<PowerReader*> dram_power_readers,
+        std::string name
+    ) :
+        Benchmark(
+            mem_array,
+            len,
+            iterations,
+            2,
+            mem_node,
+            0,
+            cpu_node,
+            SEQUENTIAL,
+            WRITE,
+#ifdef HAS_WORD_64
+            CHUNK_64b,
+#else
+            CHUNK_32b,
+#endif
+            1,
+            dram_power_readers,
+            "ns",
+            name
+        ),
+        initiator_cpu_(initiator_cpu),
+        responder_cpu_(responder_cpu),
+        tail_latency_(0)
+    {
+}
+
+void CoreToCoreBenchmark::reportBenchmarkInfo() const {
+    std::cout << "CPU NUMA Node: " << cpu_node_ << std::endl;
+    std::cout << "Memory NUMA Node: " << mem_node_ << std::endl;
+    std::cout << "Initiating logical CPU: " << initiator_cpu_ << std::endl;
+    std::cout << "Responding logical CPU: " << responder_cpu_ << std::endl;
+    std::cout << std::endl;
+}
+
+void CoreToCoreBenchmark::reportResults() const {
+    Benchmark::reportResults();
+    if (has_run_) {
+        std::cout << "99th percentile over passes of " << CORE_TO_CORE_ROUND_TRIPS_PER_PASS << " round trips: " << tail_latency_ << " " << metric_units_;
+        if (warning_)
+            std::cout << " (WARNING)";
+        std::cout << std::endl;
+    }
+}
+
+uint32_t CoreToCoreBenchmark::getInitiatorCPU() const {
+    return initiator_cpu_;
+}
+
+uint32_t CoreToCoreBenchmark::getResponderCPU() const {
+    return responder_cpu_;
+}
+
+double CoreToCoreBenchmark::getTailLatency() const {
+    return tail_latency_;
+}
+
+bool CoreToCoreBenchmark::runCore() {
+    if (initiator_cpu_ == responder_cpu_) {
+        std::cerr << "ERROR: The core-to-core benchmark needs two different logical CPUs." << std::endl;
+        return false;
+    }
+
+    //The line overwrites whatever pointer chain was there
+    if (region_cache_ != NULL)
+        region_cache_->invalidate(mem_array_, reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_) + DEFAULT_CACHE_LINE_SIZE));
+
+    //Set up some stuff for worker threads
+    std::vector<MemoryWorker*> workers;
+    std::vector<double> pass_latencies;
+    uint32_t transfers_per_pass = 2 * CORE_TO_CORE_ROUND_TRIPS_PER_PASS;
+
+    //Start power measurement
+    if (g_verbose)
+        std::cout << "Starting power measurement threads...";
+    if (!startPowerThreads()) {
+        if (g_verbose)
+            std::cout << "FAIL" << std::endl;
+        std::cerr << "WARNING: Failed to start power measurement threads." << std::endl;
+    } else if (g_verbose)
+        std::cout << "done" << std::endl;
+
+    //Run benchmark
+    if (g_verbose)
+        std::cout << "Running benchmark." << std::endl << std::endl;
+
+    //Do a bunch of iterations of the core benchmark routines
+    for (uint32_t i = 0; i < iterations_; i++) {
+        //Restart the sequence numbers
+        memset(mem_array_, 0, DEFAULT_CACHE_LINE_SIZE);
+
+        workers.push_back(new CoreToCoreWorker(mem_array_, true, initiator_cpu_));
+        workers.push_back(new CoreToCoreWorker(mem_array_, false, responder_cpu_));
+
+        //The initiator ends the run once its samples have converged, and the responder follows its stop value
+        SampleControl sample_control;
+        workers[0]->setSampleControl(&sample_control, true);
+
+        if (!runWorkers(workers, i == 0))
+            std::cerr << "WARNING: A worker thread failed to complete correctly!" << std::endl;
+
+        uint32_t passes = workers[0]->getPasses();
+        tick_t elapsed_ticks = workers[0]->getElapsedTicks();
+        bool iter_warning = workers[0]->hadWarning() || passes == 0;
+        if (iter_warning)
+            warning_ = true;
+
+        if (g_verbose) { //Report duration for this iteration
+            std::cout << "Iter " << i+1 << " had " << passes << " passes of " << CORE_TO_CORE_ROUND_TRIPS_PER_PASS << " round trips:";
+            if (iter_warning) std::cout << " -- WARNING";
+            std::cout << std::endl;
+
+            std::cout << "...clock ticks == " << elapsed_ticks;
+            if (iter_warning) std::cout << " -- WARNING";
+            std::cout << std::endl;
+
+            std::cout << "...ns == " << elapsed_ticks * g_ns_per_tick;
+            if (iter_warning) std::cout << " -- WARNING";
+            std::cout << std::endl;
+        }
+
+        //Compute metric for this iteration
+        if (passes > 0)
+            metric_on_iter_[i] = static_cast<double>(elapsed_ticks * g_ns_per_tick) / static_cast<double>(transfers_per_pass * passes);
+        else
+            metric_on_iter_[i] = 0;
+
+        std::vector<tick_t> pass_ticks = static_cast<CoreToCoreWorker*>(workers[0])->getPassTicks();
+        for (uint32_t p = 0; p < pass_ticks.size(); p++)
+            pass_latencies.push_back(static_cast<double>(pass_ticks[p] * g_ns_per_tick) / transfers_per_pass);
+
+        std::vector<double> samples = computeLatencySamples(workers[0], transfers_per_pass);
+
+        //Clean up workers for this iteration
+        for (uint32_t t = 0; t < workers.size(); t++) {
+            delete workers[t];
+        }
+        workers.clear();
+
+        if (recordIterationSamples(i, samples))
+            break;
+    }
+
+    //Stopping power measurement
+    if (g_verbose)
+        std::cout << "Stopping power measurement threads...";
+    if (!stopPowerThreads()) {
+        if (g_verbose)
+            std::cout << "FAIL" << std::endl;
+        std::cerr << "WARNING: Failed to stop power measurement threads." << std::endl;
+    } else if (g_verbose)
+        std::cout << "done" << std::endl;
+
+    //Tail over every pass rather than over iterations, which would hide rare slow transfers
+    if (!pass_latencies.empty()) {
+        std::sort(pass_latencies.begin(), pass_latencies.end());
+        tail_latency_ = pass_latencies[pass_latencies.size() * 99 / 100];
+    }
+
+    //Run metadata
+    has_run_ = true;
+    computeMetrics();
+
+    return true;
+}
@@ -0,0 +1,156 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ * 
+ * @brief Implementation file for the CoreToCoreWorker class.
+ */
+
+//Headers
+#include <CoreToCoreWorker.h>
+#include <common.h>
+
+//Libraries
+#include <atomic>
+#include <iostream>
+
+using namespace xmem;
+
+/**
+ * @brief Value stored by the initiator to release the responder. Odd, so the responder would otherwise answer it, but never reached by the sequence numbers.
+ */
+#define CORE_TO_CORE_STOP (~static_cast<uintptr_t>(0))
+
+CoreToCoreWorker::CoreToCoreWorker(
+        void* line,
+        bool initiator,
+        int32_t cpu_affinity
+    ) :
+        MemoryWorker(
+            line,
+            sizeof(uintptr_t),
+            cpu_affinity
+        ),
+        initiator_(initiator),
+        pass_ticks_()
+    {
+}
+
+CoreToCoreWorker::~CoreToCoreWorker() {
+}
+
+std::vector<tick_t> CoreToCoreWorker::getPassTicks() {
+    std::vector<tick_t> retval;
+    if (acquireLock(-1)) {
+        retval = pass_ticks_;
+        releaseLock();
+    }
+    return retval;
+}
+
+void CoreToCoreWorker::runKernels() {
+    //Set up relevant state -- localized to this thread's stack
+    std::atomic<uintptr_t>* line = NULL;
+    bool initiator = false;
+    uint32_t bytes_per_pass = 2 * CORE_TO_CORE_ROUND_TRIPS_PER_PASS * sizeof(uintptr_t);
+    uint32_t passes = 0;
+    tick_t start_tick = 0;
+    tick_t stop_tick = 0;
+    tick_t elapsed_ticks = 0;
+    bool warning = false;
+    tick_t target_ticks = g_ticks_per_ms * BENCHMARK_DURATION_MS; //Rough target run duration in ticks
+    SampleControl* sample_control = NULL;
+    bool sample_leader = false;
+    tick_t window_start_tick = 0;
+    tick_t window_stop_tick = 0;
+    std::vector<tick_t> pass_ticks;
+
+    //Grab relevant setup state thread-safely and keep it local
+    if (acquireLock(-1)) {
+        line = static_cast<std::atomic<uintptr_t>*>(mem_array_);
+        initiator = initiator_;
+        sample_control = sample_control_;
+        sample_leader = sample_leader_;
+        releaseLock();
+    }
+
+    SampleRecorder recorder(sample_control, sample_leader);
+
+    window_start_tick = start_timer();
+    if (initiator) {
+        uintptr_t next = 1;
+        while (elapsed_ticks < target_ticks) {
+            start_tick = start_timer();
+            for (uint32_t r = 0; r < CORE_TO_CORE_ROUND_TRIPS_PER_PASS; r++) {
+                line->store(next, std::memory_order_release);
+                while (line->load(std::memory_order_acquire) != next + 1) //Spin without pausing so the line is pulled back as soon as it is answered
+                    ;
+                next += 2;
+            }
+            stop_tick = stop_timer();
+            passes++;
+            elapsed_ticks += (stop_tick - start_tick);
+            pass_ticks.push_back(stop_tick - start_tick);
+            if (recorder.addBlock(1, stop_tick - start_tick))
+                break;
+        }
+        line->store(CORE_TO_CORE_STOP, std::memory_order_release);
+    } else {
+        //Answer every ping until told to stop
+        uintptr_t expected = 1;
+        uintptr_t value = 0;
+        while ((value = line->load(std::memory_order_acquire)) != CORE_TO_CORE_STOP) {
+            if (value == expected) {
+                line->store(value + 1, std::memory_order_release);
+                expected += 2;
+            }
+        }
+    }
+    window_stop_tick = stop_timer();
+
+    //There is no dummy version: the round trips are nothing but the wait for the line. The timer is read once per pass of many round trips.
+    recorder.finish(passes, 0);
+
+    //Warn if something looks fishy
+    if (initiator && elapsed_ticks < MIN_ELAPSED_TICKS)
+        warning = true;
+
+    //Update the object state thread-safely
+    if (acquireLock(-1)) {
+        adjusted_ticks_ = elapsed_ticks;
+        elapsed_ticks_ = elapsed_ticks;
+        elapsed_dummy_ticks_ = 0;
+        warning_ = warning;
+        bytes_per_pass_ = bytes_per_pass;
+        completed_ = true;
+        passes_ = passes;
+        window_start_tick_ = window_start_tick;
+        window_stop_tick_ = window_stop_tick;
+        pass_ticks_ = pass_ticks;
+        storeSamples(recorder);
+        releaseLock();
+    }
+}
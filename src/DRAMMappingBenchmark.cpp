@@ -0,0 +1,588 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ *
+ * @brief Implementation file for the DRAMMappingBenchmark class.
+ */
+
+//Headers
+#include <DRAMMappingBenchmark.h>
+#include <common.h>
+
+//Libraries
+#include <algorithm>
+#include <cstdio>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <set>
+#include <sstream>
+
+#ifdef __gnu_linux__
+#include <cstring> //for strerror
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace xmem;
+
+/**
+ * @brief Computes the parity of the set bits of a word.
+ * @param x The word.
+ * @returns 1 if an odd number of bits is set, 0 otherwise.
+ */
+static uint32_t parity64(uint64_t x) {
+    x ^= x >> 32;
+    x ^= x >> 16;
+    x ^= x >> 8;
+    x ^= x >> 4;
+    x ^= x >> 2;
+    x ^= x >> 1;
+    return static_cast<uint32_t>(x & 1);
+}
+
+/**
+ * @brief Formats the bits of a mask as a list for the console.
+ * @param mask The mask.
+ * @param separator Text between two bits.
+ * @returns The bit positions in increasing order.
+ */
+static std::string mask_bits(uint64_t mask, const char* separator) {
+    std::ostringstream out;
+    bool first = true;
+    for (uint32_t b = 0; b < 64; b++) {
+        if ((mask >> b) & 1) {
+            if (!first)
+                out << separator;
+            out << b;
+            first = false;
+        }
+    }
+    return out.str();
+}
+
+DRAMMappingBenchmark::DRAMMappingBenchmark(
+        void* mem_array,
+        size_t len,
+        uint32_t iterations,
+        uint32_t mem_node,
+        uint32_t cpu_node,
+        uint32_t cpu,
+        bool use_pagemap,
+        uint64_t phys_base,
+        std::vector<PowerReader*> dram_power_readers,
+        std::string name
+    ) :
+        Benchmark(
+            mem_array,
+            len,
+            iterations,
+            1,
+            mem_node,
+            0,
+            cpu_node,
+            RANDOM,
+            READ,
+            CHUNK_32b,
+            1,
+            dram_power_readers,
+            "ns",
+            name
+        ),
+        cpu_(cpu),
+        use_pagemap_(use_pagemap),
+        phys_base_(phys_base),
+        page_phys_(),
+        phys_pages_(),
+        pool_(),
+        sets_(),
+        top_bit_(0),
+        threshold_(0),
+        no_conflict_latency_(0),
+        functions_(),
+        row_bits_(),
+        column_bits_(),
+        interleave_bits_()
+    {
+}
+
+void DRAMMappingBenchmark::reportBenchmarkInfo() const {
+    std::cout << "CPU NUMA Node: " << cpu_node_ << std::endl;
+    std::cout << "Memory NUMA Node: " << mem_node_ << std::endl;
+    std::cout << "Timing logical CPU: " << cpu_ << std::endl;
+    std::cout << "Physical addresses: " << (use_pagemap_ ? "/proc/self/pagemap" : "contiguous region") << std::endl;
+    std::cout << "Pool: " << DRAM_MAPPING_POOL_SIZE << " cache lines" << std::endl;
+    std::cout << std::endl;
+}
+
+void DRAMMappingBenchmark::reportResults() const {
+    Benchmark::reportResults();
+    if (!has_run_)
+        return;
+
+    std::cout << "Row buffer conflict threshold: " << threshold_ << " " << metric_units_ << std::endl;
+    std::cout << "Latency without conflict: " << no_conflict_latency_ << " " << metric_units_ << std::endl;
+    std::cout << "Same-bank sets: " << sets_.size() << std::endl;
+    std::cout << "Bank, rank and channel functions:" << std::endl;
+    for (uint32_t f = 0; f < functions_.size(); f++) {
+        std::cout << "---> " << f << ": ";
+        std::printf("0x%.16llx", static_cast<long long unsigned int>(functions_[f]));
+        std::cout << " (" << mask_bits(functions_[f], " ^ ") << ")" << std::endl;
+    }
+    uint64_t mask = 0;
+    for (uint32_t i = 0; i < row_bits_.size(); i++)
+        mask |= 1ULL << row_bits_[i];
+    std::cout << "Row bits: " << mask_bits(mask, ", ") << std::endl;
+    mask = 0;
+    for (uint32_t i = 0; i < column_bits_.size(); i++)
+        mask |= 1ULL << column_bits_[i];
+    std::cout << "Column bits: " << mask_bits(mask, ", ") << std::endl;
+    mask = 0;
+    for (uint32_t i = 0; i < interleave_bits_.size(); i++)
+        mask |= 1ULL << interleave_bits_[i];
+    std::cout << "Channel interleave bits: " << mask_bits(mask, ", ") << std::endl;
+    if (warning_)
+        std::cout << "WARNING: Some results may be unreliable." << std::endl;
+}
+
+uint32_t DRAMMappingBenchmark::getCPU() const {
+    return cpu_;
+}
+
+double DRAMMappingBenchmark::getConflictThreshold() const {
+    return threshold_;
+}
+
+double DRAMMappingBenchmark::getNoConflictLatency() const {
+    return no_conflict_latency_;
+}
+
+uint32_t DRAMMappingBenchmark::getNumSets() const {
+    return static_cast<uint32_t>(sets_.size());
+}
+
+std::vector<uint64_t> DRAMMappingBenchmark::getBankFunctions() const {
+    return functions_;
+}
+
+std::vector<uint32_t> DRAMMappingBenchmark::getRowBits() const {
+    return row_bits_;
+}
+
+std::vector<uint32_t> DRAMMappingBenchmark::getColumnBits() const {
+    return column_bits_;
+}
+
+std::vector<uint32_t> DRAMMappingBenchmark::getInterleaveBits() const {
+    return interleave_bits_;
+}
+
+bool DRAMMappingBenchmark::runCore() {
+#ifndef ARCH_INTEL
+    std::cerr << "ERROR: The DRAM address mapping benchmark needs cache line flush instructions, which are only used on x86." << std::endl;
+    return false;
+#else
+    size_t num_lines = len_ / DEFAULT_CACHE_LINE_SIZE;
+    if (num_lines < 4 * DRAM_MAPPING_POOL_SIZE) {
+        std::cerr << "ERROR: The DRAM address mapping benchmark needs a memory region of at least " << 4 * DRAM_MAPPING_POOL_SIZE * DEFAULT_CACHE_LINE_SIZE << " B, but it has " << len_ << " B. Much larger regions, ideally backed by huge pages, find more of the mapping." << std::endl;
+        return false;
+    }
+
+    if (!resolvePages())
+        return false;
+
+    //Pick the pool of lines at random, from pages whose physical address is known
+    std::mt19937_64 gen(g_random_seed);
+    std::uniform_int_distribution<size_t> dist(0, num_lines - 1);
+    std::set<size_t> picked;
+    uint64_t all_bits = 0;
+    for (size_t tries = 0; pool_.size() < DRAM_MAPPING_POOL_SIZE && tries < 16 * DRAM_MAPPING_POOL_SIZE; tries++) {
+        size_t line = dist(gen);
+        uint8_t* addr = reinterpret_cast<uint8_t*>(mem_array_) + line * DEFAULT_CACHE_LINE_SIZE;
+        uint64_t phys = virtToPhys(addr);
+        if (phys == 0 || !picked.insert(line).second)
+            continue;
+        pool_.push_back(addr);
+        all_bits |= phys;
+    }
+    if (pool_.size() < DRAM_MAPPING_POOL_SIZE) {
+        std::cerr << "ERROR: Only " << pool_.size() << " of " << DRAM_MAPPING_POOL_SIZE << " cache lines of the DRAM address mapping pool have a known physical address." << std::endl;
+        return false;
+    }
+    while (top_bit_ < 63 && (all_bits >> (top_bit_ + 1)) != 0)
+        top_bit_++;
+
+    bool locked = lock_thread_to_cpu(cpu_);
+    if (!locked)
+        std::cerr << "WARNING: Failed to lock thread to logical CPU " << cpu_ << "! Results may not be correct." << std::endl;
+
+    //Start power measurement
+    if (g_verbose)
+        std::cout << "Starting power measurement threads...";
+    if (!startPowerThreads()) {
+        if (g_verbose)
+            std::cout << "FAIL" << std::endl;
+        std::cerr << "WARNING: Failed to start power measurement threads." << std::endl;
+    } else if (g_verbose)
+        std::cout << "done" << std::endl;
+
+    //Run benchmark
+    if (g_verbose)
+        std::cout << "Running benchmark." << std::endl << std::endl;
+
+    bool success = findSets();
+    if (success) {
+        findFunctions();
+        findRowBits();
+
+        //Every iteration times the conflicting pairs again, which gives the metric
+        for (uint32_t i = 0; i < iterations_; i++) {
+            std::vector<double> samples;
+            for (uint32_t s = 0; s < sets_.size(); s++) {
+                for (uint32_t m = 1; m < sets_[s].size(); m++)
+                    samples.push_back(timePair(sets_[s][0], sets_[s][m]));
+            }
+            std::vector<double> sorted = samples;
+            std::sort(sorted.begin(), sorted.end());
+            metric_on_iter_[i] = sorted[sorted.size() / 2];
+
+            if (g_verbose)
+                std::cout << "Iter " << i+1 << ": median of " << samples.size() << " same-bank/different-row pairs == " << metric_on_iter_[i] << " ns" << std::endl;
+
+            if (recordIterationSamples(i, samples))
+                break;
+        }
+    } else
+        std::cerr << "ERROR: No row buffer conflicts could be told apart. The memory region may be too small, or the timer too coarse." << std::endl;
+
+    //Stopping power measurement
+    if (g_verbose)
+        std::cout << "Stopping power measurement threads...";
+    if (!stopPowerThreads()) {
+        if (g_verbose)
+            std::cout << "FAIL" << std::endl;
+        std::cerr << "WARNING: Failed to stop power measurement threads." << std::endl;
+    } else if (g_verbose)
+        std::cout << "done" << std::endl;
+
+    if (locked)
+        unlock_thread_to_cpu();
+
+    if (!success)
+        return false;
+
+    //Run metadata
+    has_run_ = true;
+    computeMetrics();
+
+    return true;
+#endif
+}
+
+bool DRAMMappingBenchmark::resolvePages() {
+    size_t num_pages = (len_ + g_page_size - 1) / g_page_size;
+    page_phys_.assign(num_pages, 0);
+
+    if (!use_pagemap_) {
+        for (size_t p = 0; p < num_pages; p++)
+            page_phys_[p] = phys_base_ + p * g_page_size;
+    } else {
+#ifdef __gnu_linux__
+        int fd = open("/proc/self/pagemap", O_RDONLY);
+        if (fd < 0) {
+            std::cerr << "ERROR: Failed to open /proc/self/pagemap: " << strerror(errno) << std::endl;
+            return false;
+        }
+
+        std::vector<uint64_t> entries(PAGE_QUERY_BATCH);
+        off_t base = static_cast<off_t>(reinterpret_cast<uintptr_t>(mem_array_) / g_page_size * sizeof(uint64_t));
+        for (size_t first = 0; first < num_pages; first += PAGE_QUERY_BATCH) {
+            size_t count = std::min(static_cast<size_t>(PAGE_QUERY_BATCH), num_pages - first);
+            if (pread(fd, entries.data(), count * sizeof(uint64_t), base + static_cast<off_t>(first * sizeof(uint64_t))) != static_cast<ssize_t>(count * sizeof(uint64_t))) {
+                std::cerr << "ERROR: Failed to read /proc/self/pagemap: " << strerror(errno) << std::endl;
+                close(fd);
+                return false;
+            }
+            for (size_t p = 0; p < count; p++) {
+                bool present = (entries[p] >> 63) & 1;
+                uint64_t pfn = entries[p] & ((1ULL << 55) - 1); //bits 0-54
+                if (present) //Without CAP_SYS_ADMIN, the frame numbers read as zero
+                    page_phys_[first + p] = pfn * g_page_size;
+            }
+        }
+        close(fd);
+#else
+        std::cerr << "ERROR: Physical addresses can only be resolved through pagemap on GNU/Linux." << std::endl;
+        return false;
+#endif
+    }
+
+    phys_pages_.clear();
+    for (size_t p = 0; p < num_pages; p++) {
+        if (page_phys_[p] != 0)
+            phys_pages_.push_back(std::make_pair(page_phys_[p], p));
+    }
+    if (phys_pages_.empty()) {
+        std::cerr << "ERROR: The physical address of no page of the memory region is known. Resolving them through /proc/self/pagemap needs the CAP_SYS_ADMIN capability." << std::endl;
+        return false;
+    }
+    std::sort(phys_pages_.begin(), phys_pages_.end());
+    return true;
+}
+
+uint64_t DRAMMappingBenchmark::virtToPhys(const uint8_t* addr) const {
+    size_t offset = static_cast<size_t>(addr - reinterpret_cast<uint8_t*>(mem_array_));
+    uint64_t page_phys = page_phys_[offset / g_page_size];
+    if (page_phys == 0)
+        return 0;
+    return page_phys + offset % g_page_size;
+}
+
+uint8_t* DRAMMappingBenchmark::physToVirt(uint64_t phys) const {
+    uint64_t page_phys = phys - phys % g_page_size;
+    auto it = std::lower_bound(phys_pages_.begin(), phys_pages_.end(), std::make_pair(page_phys, static_cast<size_t>(0)));
+    if (it == phys_pages_.end() || it->first != page_phys)
+        return NULL;
+    size_t offset = it->second * g_page_size + static_cast<size_t>(phys % g_page_size);
+    if (offset + DEFAULT_CACHE_LINE_SIZE > len_)
+        return NULL;
+    return reinterpret_cast<uint8_t*>(mem_array_) + offset;
+}
+
+double DRAMMappingBenchmark::timePair(uint8_t* a, uint8_t* b) const {
+#ifdef ARCH_INTEL
+    volatile Word32_t* va = reinterpret_cast<volatile Word32_t*>(a);
+    volatile Word32_t* vb = reinterpret_cast<volatile Word32_t*>(b);
+    std::vector<double> latencies(DRAM_MAPPING_REPEATS);
+
+    for (uint32_t rep = 0; rep < DRAM_MAPPING_REPEATS; rep++) {
+        _mm_clflush(a);
+        _mm_clflush(b);
+        _mm_mfence();
+
+        //Both reads miss the caches and are in flight together, so they only collide in the bank if both lines are in it
+        tick_t start_tick = start_timer();
+        for (uint32_t r = 0; r < DRAM_MAPPING_ROUNDS; r++) {
+            *va;
+            *vb;
+            _mm_clflush(a);
+            _mm_clflush(b);
+            _mm_mfence();
+        }
+        tick_t stop_tick = stop_timer();
+        latencies[rep] = static_cast<double>((stop_tick - start_tick) * g_ns_per_tick) / (2 * DRAM_MAPPING_ROUNDS);
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+    return latencies[DRAM_MAPPING_REPEATS / 2];
+#else
+    return 0;
+#endif
+}
+
+bool DRAMMappingBenchmark::findSets() {
+    std::vector<uint8_t*> remaining = pool_;
+    std::vector<double> latencies;
+
+    for (uint32_t pivots = 0; remaining.size() >= DRAM_MAPPING_MIN_SET_SIZE && pivots < DRAM_MAPPING_MAX_PIVOTS; pivots++) {
+        uint8_t* pivot = remaining[0];
+        latencies.assign(remaining.size(), 0);
+        for (size_t k = 1; k < remaining.size(); k++)
+            latencies[k] = timePair(pivot, remaining[k]);
+
+        //The first pivot sets the threshold by splitting its latencies into two clusters
+        if (pivots == 0) {
+            std::vector<double> sorted(latencies.begin() + 1, latencies.end());
+            std::sort(sorted.begin(), sorted.end());
+            double low = sorted.front();
+            double high = sorted.back();
+            size_t split = 0;
+            for (uint32_t step = 0; step < 100 && high > low; step++) {
+                double threshold = (low + high) / 2;
+                size_t new_split = std::upper_bound(sorted.begin(), sorted.end(), threshold) - sorted.begin();
+                if (new_split == split || new_split == sorted.size())
+                    break;
+                split = new_split;
+                double sum = 0;
+                for (size_t k = 0; k < split; k++)
+                    sum += sorted[k];
+                low = sum / split;
+                sum = 0;
+                for (size_t k = split; k < sorted.size(); k++)
+                    sum += sorted[k];
+                high = sum / (sorted.size() - split);
+            }
+            if (split == 0 || split < sorted.size() / 2) //Conflicts are the rare case, one in every bank
+                return false;
+            threshold_ = (low + high) / 2;
+            no_conflict_latency_ = sorted[split / 2];
+
+            if (g_verbose)
+                std::cout << "Row buffer conflict threshold: " << threshold_ << " ns (" << sorted.size() - split << " of " << sorted.size() << " pairs above)" << std::endl;
+        }
+
+        //Time the candidates once more, so that a single noisy measurement does not put a line in the wrong set
+        std::vector<uint8_t*> set(1, pivot);
+        std::vector<uint8_t*> rest;
+        for (size_t k = 1; k < remaining.size(); k++) {
+            if (latencies[k] > threshold_ && timePair(pivot, remaining[k]) > threshold_)
+                set.push_back(remaining[k]);
+            else
+                rest.push_back(remaining[k]);
+        }
+
+        if (set.size() >= DRAM_MAPPING_MIN_SET_SIZE) {
+            if (g_verbose)
+                std::cout << "Same-bank set " << sets_.size() << ": " << set.size() << " lines" << std::endl;
+            sets_.push_back(set);
+        } else //Too small to tell anything, so give the other lines another chance as pivots
+            rest.insert(rest.end(), set.begin() + 1, set.end());
+        remaining = rest;
+    }
+
+    return sets_.size() >= 2;
+}
+
+void DRAMMappingBenchmark::findFunctions() {
+    std::vector< std::vector<uint64_t> > set_phys(sets_.size());
+    for (uint32_t s = 0; s < sets_.size(); s++) {
+        for (uint32_t m = 0; m < sets_[s].size(); m++)
+            set_phys[s].push_back(virtToPhys(sets_[s][m]));
+    }
+
+    //Candidate bits are above the line offset and vary within some set. A bit that never does cannot be told apart from a constant.
+    uint64_t varying = 0;
+    for (uint32_t s = 0; s < set_phys.size(); s++) {
+        for (uint32_t m = 1; m < set_phys[s].size(); m++)
+            varying |= set_phys[s][m] ^ set_phys[s][0];
+    }
+    std::vector<uint32_t> bits;
+    for (uint32_t b = 0; b <= top_bit_; b++) {
+        if ((1ULL << b) >= DEFAULT_CACHE_LINE_SIZE && ((varying >> b) & 1))
+            bits.push_back(b);
+    }
+
+    //Try every mask of up to DRAM_MAPPING_MAX_FUNCTION_BITS bits, fewest bits first, and keep those that are linearly independent of the ones already kept
+    std::vector<uint64_t> basis;
+    for (uint32_t num_bits = 1; num_bits <= DRAM_MAPPING_MAX_FUNCTION_BITS && num_bits <= bits.size(); num_bits++) {
+        std::vector<uint32_t> index(num_bits);
+        for (uint32_t k = 0; k < num_bits; k++)
+            index[k] = k;
+
+        while (true) {
+            uint64_t mask = 0;
+            for (uint32_t k = 0; k < num_bits; k++)
+                mask |= 1ULL << bits[index[k]];
+
+            //Constant within every set, but not the same for all of them
+            bool constant = true;
+            bool differs = false;
+            uint32_t first_parity = parity64(set_phys[0][0] & mask);
+            for (uint32_t s = 0; s < set_phys.size() && constant; s++) {
+                uint32_t parity = parity64(set_phys[s][0] & mask);
+                if (parity != first_parity)
+                    differs = true;
+                for (uint32_t m = 1; m < set_phys[s].size() && constant; m++) {
+                    if (parity64(set_phys[s][m] & mask) != parity)
+                        constant = false;
+                }
+            }
+
+            if (constant && differs) {
+                uint64_t reduced = mask;
+                for (uint32_t k = 0; k < basis.size(); k++) {
+                    uint64_t top = basis[k];
+                    uint32_t top_pos = 63;
+                    while (((top >> top_pos) & 1) == 0)
+                        top_pos--;
+                    if ((reduced >> top_pos) & 1)
+                        reduced ^= basis[k];
+                }
+                if (reduced != 0) {
+                    basis.push_back(reduced);
+                    std::sort(basis.begin(), basis.end(), std::greater<uint64_t>()); //Keeps leading bits in decreasing order for the reduction
+                    functions_.push_back(mask);
+                }
+            }
+
+            //Next combination of num_bits indices
+            int32_t k = static_cast<int32_t>(num_bits) - 1;
+            while (k >= 0 && index[k] == bits.size() - num_bits + k)
+                k--;
+            if (k < 0)
+                break;
+            index[k]++;
+            for (uint32_t j = k + 1; j < num_bits; j++)
+                index[j] = index[j-1] + 1;
+        }
+    }
+
+    if (functions_.empty()) {
+        std::cerr << "WARNING: No DRAM bank function of up to " << DRAM_MAPPING_MAX_FUNCTION_BITS << " bits fits the same-bank sets." << std::endl;
+        warning_ = true;
+    }
+}
+
+void DRAMMappingBenchmark::findRowBits() {
+    uint64_t function_bits = 0;
+    for (uint32_t f = 0; f < functions_.size(); f++)
+        function_bits |= functions_[f];
+
+    //Flipping a bit outside all functions stays in the bank, so the pair conflicts exactly if the bit selects the row
+    for (uint32_t b = 0; b <= top_bit_; b++) {
+        if ((1ULL << b) < DEFAULT_CACHE_LINE_SIZE || ((function_bits >> b) & 1))
+            continue;
+
+        uint32_t tried = 0;
+        uint32_t conflicts = 0;
+        for (size_t k = 0; k < pool_.size() && tried < DRAM_MAPPING_REPEATS; k++) {
+            uint8_t* partner = physToVirt(virtToPhys(pool_[k]) ^ (1ULL << b));
+            if (partner == NULL)
+                continue;
+            tried++;
+            if (timePair(pool_[k], partner) > threshold_)
+                conflicts++;
+        }
+
+        if (tried == 0) {
+            if (g_verbose)
+                std::cout << "Bit " << b << " could not be classified: no line of the pool has its partner in the memory region." << std::endl;
+        } else if (2 * conflicts > tried)
+            row_bits_.push_back(b);
+        else
+            column_bits_.push_back(b);
+    }
+
+    //Bank bits lie above the column bits, so function bits among the column bits can only pick the channel
+    if (!column_bits_.empty()) {
+        for (uint32_t b = 0; b < column_bits_.back(); b++) {
+            if ((function_bits >> b) & 1)
+                interleave_bits_.push_back(b);
+        }
+    }
+}
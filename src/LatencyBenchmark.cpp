@@ -36,6 +36,7 @@
 #include <MemoryWorker.h>
 #include <LatencyWorker.h>
 #include <LoadWorker.h>
+#include <util.h>
 
 //Libraries
 #include <iostream>
@@ -81,11 +82,15 @@ LatencyBenchmark::LatencyBenchmark(
             name
         ),
         load_metric_on_iter_(),
-        mean_load_metric_(0)
+        mean_load_metric_(0),
+        load_overlap_on_iter_(),
+        rejected_iterations_(0),
+        chains_(1)
     {
 
     for (uint32_t i = 0; i < iterations_; i++)
         load_metric_on_iter_.push_back(0);
+    load_overlap_on_iter_.resize(iterations_, 1);
 }
 
 void LatencyBenchmark::reportBenchmarkInfo() const {
@@ -94,6 +99,10 @@ void LatencyBenchmark::reportBenchmarkInfo() const {
     std::cout << "Latency measurement chunk size: ";
     std::cout << sizeof(uintptr_t)*8 << "-bit" << std::endl;
     std::cout << "Latency measurement access pattern: random read (pointer-chasing)" << std::endl;
+    if (prefetch_distance_ > 0)
+        std::cout << "Latency measurement software prefetch: " << prefetch_distance_ << " hops ahead, hint " << prefetch_hint_name(g_prefetch_hint) << std::endl;
+    if (chains_ > 1)
+        std::cout << "Latency measurement independent chains: " << chains_ << std::endl;
 
     if (num_worker_threads_ > 1) {
         std::cout << "Load Chunk Size: ";
@@ -140,6 +149,9 @@ void LatencyBenchmark::reportBenchmarkInfo() const {
             case RANDOM:
                 std::cout << "random";
                 break;
+            case RANDOM_INDEPENDENT:
+                std::cout << "independent random";
+                break;
             default:
                 std::cout << "UNKNOWN";
                 break;
@@ -155,6 +167,17 @@ void LatencyBenchmark::reportBenchmarkInfo() const {
             case WRITE:
                 std::cout << "write";
                 break;
+            case WRITE_NT:
+                std::cout << "non-temporal write";
+                break;
+            case READ_WRITE_1_1:
+            case READ_WRITE_2_1:
+            case READ_WRITE_3_1:
+                std::cout << rw_ratio_name(rw_mode_) << " read:write mix";
+                break;
+            case READ_MODIFY_WRITE:
+                std::cout << "read-modify-write";
+                break;
             default:
                 std::cout << "UNKNOWN";
                 break;
@@ -185,6 +208,10 @@ void LatencyBenchmark::reportResults() const {
         }
 
         std::cout << std::endl;
+        if (metric_samples_.size() >= MIN_SAMPLES_FOR_CI)
+            std::cout << "Statistics over " << metric_samples_.size() << " short samples of about " << g_sample_duration_ms << " ms:" << std::endl;
+        else
+            std::cout << "Statistics over " << iterations_ << " iterations:" << std::endl;
         std::cout << std::endl;
 
         std::cout << "Mean: " << mean_metric_ << " " << metric_units_ << " and " << mean_load_metric_ << " MB/s mean imposed load (not necessarily matched)";
@@ -269,33 +296,96 @@ bool LatencyBenchmark::runCore() {
     RandomFunction lat_kernel_dummy_fptr = &dummy_chasePointers;
 
     //Initialize memory regions for all threads by writing to them, causing the memory to be physically resident.
-    forwSequentialWrite_Word32(mem_array_,
-                               reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_)+len_)); //static casts to silence compiler warnings
+    touchRegion(mem_array_,
+                reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_)+len_)); //static casts to silence compiler warnings
+
+    //Software prefetching needs a spare word next to each node to hold its lookahead pointer, so nodes are whole cache lines at the start of the line.
+    chain_granularity_t granularity = g_chain_granularity;
+    bool random_offsets = g_chain_random_offsets;
+    if (prefetch_distance_ > 0) {
+#ifdef HAS_SW_PREFETCH
+        lat_kernel_fptr = &chasePointersPrefetch;
+        granularity = CHAIN_CACHE_LINE;
+        random_offsets = false;
+#else
+        std::cerr << "ERROR: Software prefetching is not supported on this architecture." << std::endl;
+        return false;
+#endif
+    }
 
     //Build pointer indices for random-access latency thread. We assume that latency thread is the first one, so we use beginning of memory region.
-    if (!build_random_pointer_permutation(mem_array_,
-                                       reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_)+len_per_thread), //static casts to silence compiler warnings
+    if (chains_ > 1) {
+        if (prefetch_distance_ > 0) {
+            std::cerr << "ERROR: Software prefetching is not supported with multiple pointer chains." << std::endl;
+            return false;
+        }
+        if (!determine_interleaved_chase_kernel(chains_, &lat_kernel_fptr, &lat_kernel_dummy_fptr)) {
+            std::cerr << "ERROR: Failed to find a pointer-chasing kernel for " << chains_ << " chains." << std::endl;
+            return false;
+        }
+
+        //The first page holds the current node of every chain. The rest is split into one disjoint part per chain, each of which is a random cycle of its own.
+        size_t part_len = len_per_thread > g_page_size ? ((len_per_thread - g_page_size) / chains_) / g_page_size * g_page_size : 0;
+        if (part_len == 0) {
+            std::cerr << "ERROR: The working set is too small to hold " << chains_ << " pointer chains of at least one page each." << std::endl;
+            return false;
+        }
+
+        uintptr_t* heads = static_cast<uintptr_t*>(mem_array_);
+        for (uint32_t c = 0; c < chains_; c++) {
+            uint8_t* part = static_cast<uint8_t*>(mem_array_) + g_page_size + c * part_len;
+            if (!prepareChain(part,
+                           part + part_len,
 #ifndef HAS_WORD_64 //special case: 32-bit architectures
-                                       CHUNK_32b)) {
+                           CHUNK_32b,
 #endif
 #ifdef HAS_WORD_64
-                                       CHUNK_64b)) {
+                           CHUNK_64b,
 #endif
+                           granularity,
+                           random_offsets,
+                           g_random_seed + c)) {
+                std::cerr << "ERROR: Failed to build a random pointer permutation for the latency measurement thread!" << std::endl;
+                return false;
+            }
+        }
+
+        if (region_cache_ != NULL) //The heads overwrite whatever the first page held
+            region_cache_->invalidate(heads, heads + chains_);
+        for (uint32_t c = 0; c < chains_; c++)
+            heads[c] = reinterpret_cast<uintptr_t>(static_cast<uint8_t*>(mem_array_) + g_page_size + c * part_len);
+    } else if (!prepareChain(mem_array_,
+                   reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_)+len_per_thread), //static casts to silence compiler warnings
+#ifndef HAS_WORD_64 //special case: 32-bit architectures
+                   CHUNK_32b,
+#endif
+#ifdef HAS_WORD_64
+                   CHUNK_64b,
+#endif
+                   granularity,
+                   random_offsets,
+                   g_random_seed)) {
         std::cerr << "ERROR: Failed to build a random pointer permutation for the latency measurement thread!" << std::endl;
         return false;
     }
+    if (prefetch_distance_ > 0 && !build_chain_lookahead(mem_array_, reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_)+len_per_thread), prefetch_distance_))
+        return false;
 
     //Set up load generation kernel function pointers
     SequentialFunction load_kernel_fptr_seq = NULL;
     SequentialFunction load_kernel_dummy_fptr_seq = NULL;
     RandomFunction load_kernel_fptr_ran = NULL;
     RandomFunction load_kernel_dummy_fptr_ran = NULL;
+    IndependentRandomFunction load_kernel_fptr_ind = NULL;
+    IndependentRandomFunction load_kernel_dummy_fptr_ind = NULL;
     if (num_worker_threads_ > 1) { //If we only have one worker thread, it is used for latency measurement only, and no load threads will be used.
         if (pattern_mode_ == SEQUENTIAL) {
             if (!determine_sequential_kernel(rw_mode_, chunk_size_, stride_size_, &load_kernel_fptr_seq, &load_kernel_dummy_fptr_seq)) {
                 std::cerr << "ERROR: Failed to find appropriate benchmark kernel." << std::endl;
                 return false;
             }
+            if (!checkPassSpan(len_per_thread))
+                return false;
         } else if (pattern_mode_ == RANDOM) {
             if (!determine_random_kernel(rw_mode_, chunk_size_, &load_kernel_fptr_ran, &load_kernel_dummy_fptr_ran)) {
                 std::cerr << "ERROR: Failed to find appropriate benchmark kernel." << std::endl;
@@ -304,13 +394,21 @@ bool LatencyBenchmark::runCore() {
 
             //Build pointer indices for random-access load threads. Note that the pointers for each load thread must stay within its respective region, otherwise sharing may occur.
             for (uint32_t i = 1; i < num_worker_threads_; i++) {
-                if (!build_random_pointer_permutation(reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_) + i*len_per_thread), //static casts to silence compiler warnings
-                                                   reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_) + (i+1)*len_per_thread), //static casts to silence compiler warnings
-                                                   chunk_size_)) {
+                if (!prepareChain(reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_) + i*len_per_thread), //static casts to silence compiler warnings
+                               reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_) + (i+1)*len_per_thread), //static casts to silence compiler warnings
+                               chunk_size_,
+                               CHAIN_CHUNK,
+                               false,
+                               g_random_seed + i)) {
                     std::cerr << "ERROR: Failed to build a random pointer permutation for a load generation thread!" << std::endl;
                     return false;
                 }
             }
+        } else if (pattern_mode_ == RANDOM_INDEPENDENT) {
+            if (!determine_independent_random_kernel(rw_mode_, chunk_size_, &load_kernel_fptr_ind, &load_kernel_dummy_fptr_ind)) {
+                std::cerr << "ERROR: Failed to find appropriate benchmark kernel." << std::endl;
+                return false;
+            }
         } else {
             std::cerr << "ERROR: Got an invalid pattern mode." << std::endl;
             return false;
@@ -319,7 +417,6 @@ bool LatencyBenchmark::runCore() {
 
     //Set up some stuff for worker threads
     std::vector<MemoryWorker*> workers;
-    std::vector<Thread*> worker_threads;
 
     //Start power measurement
     if (g_verbose)
@@ -336,8 +433,10 @@ bool LatencyBenchmark::runCore() {
     if (g_verbose)
         std::cout << "Running benchmark." << std::endl << std::endl;
 
-    //Do a bunch of iterations of the core benchmark routine
-    for (uint32_t i = 0; i < iterations_; i++) {
+    //Do a bunch of iterations of the core benchmark routine. Iterations rejected for poor load overlap are run again under the same index.
+    for (uint32_t i = 0; i < iterations_; ) {
+        //All workers of this iteration follow one phase protocol: load first, then the latency window, then stop together
+        LoadedLatencyPhase phase(num_worker_threads_ - 1);
 
         //Create load workers and load worker threads
         for (uint32_t t = 0; t < num_worker_threads_; t++) {
@@ -357,6 +456,7 @@ bool LatencyBenchmark::runCore() {
                                                      len_per_thread,
                                                      load_kernel_fptr_seq,
                                                      load_kernel_dummy_fptr_seq,
+                                                     stride_size_,
                                                      cpu_id));
                 else if (pattern_mode_ == RANDOM)
                     workers.push_back(new LoadWorker(thread_mem_array,
@@ -364,20 +464,30 @@ bool LatencyBenchmark::runCore() {
                                                      load_kernel_fptr_ran,
                                                      load_kernel_dummy_fptr_ran,
                                                      cpu_id));
+                else if (pattern_mode_ == RANDOM_INDEPENDENT)
+                    workers.push_back(new LoadWorker(thread_mem_array,
+                                                     len_per_thread,
+                                                     load_kernel_fptr_ind,
+                                                     load_kernel_dummy_fptr_ind,
+                                                     g_random_seed + t,
+                                                     cpu_id));
                 else
                     std::cerr << "WARNING: Invalid benchmark pattern mode." << std::endl;
             }
-            worker_threads.push_back(new Thread(workers[t]));
         }
 
-        //Start worker threads! gogogo
-        for (uint32_t t = 0; t < num_worker_threads_; t++)
-            worker_threads[t]->create_and_start();
+        if (num_worker_threads_ > 1) {
+            for (uint32_t t = 0; t < num_worker_threads_; t++)
+                workers[t]->setPhase(&phase);
+        }
+
+        //Only the latency worker's samples decide when the window may close early
+        SampleControl sample_control;
+        workers[0]->setSampleControl(&sample_control, true);
 
-        //Wait for all threads to complete
-        for (uint32_t t = 0; t < num_worker_threads_; t++)
-            if (!worker_threads[t]->join())
-                std::cerr << "WARNING: A worker thread failed to complete correctly!" << std::endl;
+        //Run the workers. Memory only needs to be primed before the first iteration since the pooled threads stay put.
+        if (!runWorkers(workers, i == 0))
+            std::cerr << "WARNING: A worker thread failed to complete correctly!" << std::endl;
 
         //Compute metrics for this iteration
         bool iterwarning = false;
@@ -387,7 +497,7 @@ bool LatencyBenchmark::runCore() {
         tick_t lat_adjusted_ticks = workers[0]->getAdjustedTicks();
         tick_t lat_elapsed_dummy_ticks = workers[0]->getElapsedDummyTicks();
         uint32_t lat_bytes_per_pass = workers[0]->getBytesPerPass();
-        uint32_t lat_accesses_per_pass = lat_bytes_per_pass / 8;
+        uint32_t lat_accesses_per_pass = lat_bytes_per_pass / 8 / chains_; //Hops of each chain, which overlap with those of the other chains
         iterwarning |= workers[0]->hadWarning();
 
         //Compute throughput generated by load threads
@@ -404,6 +514,21 @@ bool LatencyBenchmark::runCore() {
             iterwarning |= workers[t]->hadWarning();
         }
 
+        //Reject iterations where the load did not cover the whole latency window, so that they never reach the metrics or the sample pool
+        load_overlap_on_iter_[i] = computeLoadOverlap(workers);
+        if (load_overlap_on_iter_[i] < LOADED_LATENCY_MIN_OVERLAP) {
+            if (rejected_iterations_ < LOADED_LATENCY_MAX_REJECTED_ITERATIONS) {
+                rejected_iterations_++;
+                if (g_verbose)
+                    std::cout << "Iter " << i+1 << " rejected: load covered only " << load_overlap_on_iter_[i] * 100 << "% of the latency window. Running it again." << std::endl;
+                for (uint32_t t = 0; t < num_worker_threads_; t++)
+                    delete workers[t];
+                workers.clear();
+                continue;
+            }
+            iterwarning = true;
+        }
+
         //Compute load metrics for this iteration
         load_avg_adjusted_ticks = static_cast<double>(load_total_adjusted_ticks) / (num_worker_threads_-1);
         if (num_worker_threads_ > 1)
@@ -447,6 +572,10 @@ bool LatencyBenchmark::runCore() {
                 std::cout << "...load total sec across " << num_worker_threads_-1 << " threads == " << load_total_adjusted_ticks * g_ns_per_tick / 1e9 << " (adjusted by -" << load_total_elapsed_dummy_ticks * g_ns_per_tick / 1e9 << ")";
                 if (iterwarning) std::cout << " -- WARNING";
                 std::cout << std::endl;
+
+                std::cout << "...load overlap with latency window == " << load_overlap_on_iter_[i] * 100 << "%";
+                if (load_overlap_on_iter_[i] < LOADED_LATENCY_MIN_OVERLAP) std::cout << " -- WARNING";
+                std::cout << std::endl;
             }
 
         }
@@ -454,15 +583,25 @@ bool LatencyBenchmark::runCore() {
         //Compute overall metrics for this iteration
         metric_on_iter_[i] = static_cast<double>(lat_adjusted_ticks * g_ns_per_tick)  /  static_cast<double>(lat_accesses_per_pass * lat_passes);
 
-        //Clean up workers and threads for this iteration
+        std::vector<double> samples = computeLatencySamples(workers[0], lat_accesses_per_pass);
+
+        //Clean up workers for this iteration
         for (uint32_t t = 0; t < num_worker_threads_; t++) {
-            delete worker_threads[t];
             delete workers[t];
         }
-        worker_threads.clear();
         workers.clear();
+
+        if (recordIterationSamples(i, samples)) {
+            load_metric_on_iter_.resize(iterations_);
+            load_overlap_on_iter_.resize(iterations_);
+            break;
+        }
+        i++;
     }
 
+    if (rejected_iterations_ > 0)
+        std::cout << "Rejected " << rejected_iterations_ << " iteration(s) whose load covered less than " << LOADED_LATENCY_MIN_OVERLAP * 100 << "% of the latency window." << std::endl;
+
     //Stop power measurement
     if (g_verbose) {
         std::cout << std::endl;
@@ -487,3 +626,22 @@ bool LatencyBenchmark::runCore() {
 
     return true;
 }
+
+double LatencyBenchmark::getLoadOverlapOnIter(uint32_t iter) const {
+    if (has_run_ && iter >= 1 && iter <= iterations_)
+        return load_overlap_on_iter_[iter - 1];
+    else //bad call
+        return -1;
+}
+
+uint32_t LatencyBenchmark::getRejectedIterations() const {
+    return rejected_iterations_;
+}
+
+void LatencyBenchmark::setChains(uint32_t chains) {
+    chains_ = chains;
+}
+
+uint32_t LatencyBenchmark::getChains() const {
+    return chains_;
+}
@@ -65,8 +65,12 @@ LatencyMatrixBenchmark::LatencyMatrixBenchmark(
             "ns/access",
             name,
             logfile
-        )
-    {}
+        ),
+        load_overlap_on_iter_(),
+        rejected_iterations_(0)
+    {
+    load_overlap_on_iter_.resize(iterations_, 1);
+}
 
 bool LatencyMatrixBenchmark::runCore() {
     size_t len_per_thread = len_ / num_worker_threads_; //Carve up memory space so each worker has its own area to play in
@@ -76,18 +80,21 @@ bool LatencyMatrixBenchmark::runCore() {
     RandomFunction lat_kernel_dummy_fptr = &dummy_chasePointers;
 
     //Initialize memory regions for all threads by writing to them, causing the memory to be physically resident.
-    forwSequentialWrite_Word32(mem_array_,
-                               reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_)+len_)); //static casts to silence compiler warnings
+    touchRegion(mem_array_,
+                reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_)+len_)); //static casts to silence compiler warnings
 
     //Build pointer indices for random-access latency thread. We assume that latency thread is the first one, so we use beginning of memory region.
-    if (!build_random_pointer_permutation(mem_array_,
-                                       reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_)+len_per_thread), //static casts to silence compiler warnings
+    if (!prepareChain(mem_array_,
+                   reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_)+len_per_thread), //static casts to silence compiler warnings
 #ifndef HAS_WORD_64 //special case: 32-bit architectures
-                                       CHUNK_32b)) {
+                   CHUNK_32b,
 #endif
 #ifdef HAS_WORD_64
-                                       CHUNK_64b)) {
+                   CHUNK_64b,
 #endif
+                   g_chain_granularity,
+                   g_chain_random_offsets,
+                   g_random_seed)) {
         std::cerr << "ERROR: Failed to build a random pointer permutation for the latency measurement thread!" << std::endl;
         return false;
     }
@@ -97,12 +104,16 @@ bool LatencyMatrixBenchmark::runCore() {
     SequentialFunction load_kernel_dummy_fptr_seq = NULL;
     RandomFunction load_kernel_fptr_ran = NULL;
     RandomFunction load_kernel_dummy_fptr_ran = NULL;
+    IndependentRandomFunction load_kernel_fptr_ind = NULL;
+    IndependentRandomFunction load_kernel_dummy_fptr_ind = NULL;
     if (num_worker_threads_ > 1) { //If we only have one worker thread, it is used for latency measurement only, and no load threads will be used.
         if (pattern_mode_ == SEQUENTIAL) {
             if (!determine_sequential_kernel(rw_mode_, chunk_size_, stride_size_, &load_kernel_fptr_seq, &load_kernel_dummy_fptr_seq)) {
                 std::cerr << "ERROR: Failed to find appropriate benchmark kernel." << std::endl;
                 return false;
             }
+            if (!checkPassSpan(len_per_thread))
+                return false;
         } else if (pattern_mode_ == RANDOM) {
             if (!determine_random_kernel(rw_mode_, chunk_size_, &load_kernel_fptr_ran, &load_kernel_dummy_fptr_ran)) {
                 std::cerr << "ERROR: Failed to find appropriate benchmark kernel." << std::endl;
@@ -111,13 +122,21 @@ bool LatencyMatrixBenchmark::runCore() {
 
             //Build pointer indices for random-access load threads. Note that the pointers for each load thread must stay within its respective region, otherwise sharing may occur.
             for (uint32_t i = 1; i < num_worker_threads_; i++) {
-                if (!build_random_pointer_permutation(reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_) + i*len_per_thread), //static casts to silence compiler warnings
-                                                   reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_) + (i+1)*len_per_thread), //static casts to silence compiler warnings
-                                                   chunk_size_)) {
+                if (!prepareChain(reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_) + i*len_per_thread), //static casts to silence compiler warnings
+                               reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_) + (i+1)*len_per_thread), //static casts to silence compiler warnings
+                               chunk_size_,
+                               CHAIN_CHUNK,
+                               false,
+                               g_random_seed + i)) {
                     std::cerr << "ERROR: Failed to build a random pointer permutation for a load generation thread!" << std::endl;
                     return false;
                 }
             }
+        } else if (pattern_mode_ == RANDOM_INDEPENDENT) {
+            if (!determine_independent_random_kernel(rw_mode_, chunk_size_, &load_kernel_fptr_ind, &load_kernel_dummy_fptr_ind)) {
+                std::cerr << "ERROR: Failed to find appropriate benchmark kernel." << std::endl;
+                return false;
+            }
         } else {
             std::cerr << "ERROR: Got an invalid pattern mode." << std::endl;
             return false;
@@ -126,7 +145,6 @@ bool LatencyMatrixBenchmark::runCore() {
 
     //Set up some stuff for worker threads
     std::vector<MemoryWorker*> workers;
-    std::vector<Thread*> worker_threads;
 
     //Start power measurement
     if (g_verbose)
@@ -143,8 +161,10 @@ bool LatencyMatrixBenchmark::runCore() {
     if (g_verbose)
         std::cout << "Running benchmark." << std::endl << std::endl;
 
-    //Do a bunch of iterations of the core benchmark routine
-    for (uint32_t i = 0; i < iterations_; i++) {
+    //Do a bunch of iterations of the core benchmark routine. Iterations rejected for poor load overlap are run again under the same index.
+    for (uint32_t i = 0; i < iterations_; ) {
+        //All workers of this iteration follow one phase protocol: load first, then the latency window, then stop together
+        LoadedLatencyPhase phase(num_worker_threads_ - 1);
 
         //Create load workers and load worker threads
         for (uint32_t t = 0; t < num_worker_threads_; t++) {
@@ -168,6 +188,7 @@ bool LatencyMatrixBenchmark::runCore() {
                                                      len_per_thread,
                                                      load_kernel_fptr_seq,
                                                      load_kernel_dummy_fptr_seq,
+                                                     stride_size_,
                                                      cpu_id));
                 else if (pattern_mode_ == RANDOM)
                     workers.push_back(new LoadWorker(thread_mem_array,
@@ -175,20 +196,30 @@ bool LatencyMatrixBenchmark::runCore() {
                                                      load_kernel_fptr_ran,
                                                      load_kernel_dummy_fptr_ran,
                                                      cpu_id));
+                else if (pattern_mode_ == RANDOM_INDEPENDENT)
+                    workers.push_back(new LoadWorker(thread_mem_array,
+                                                     len_per_thread,
+                                                     load_kernel_fptr_ind,
+                                                     load_kernel_dummy_fptr_ind,
+                                                     g_random_seed + t,
+                                                     cpu_id));
                 else
                     std::cerr << "WARNING: Invalid benchmark pattern mode." << std::endl;
             }
-            worker_threads.push_back(new Thread(workers[t]));
         }
 
-        //Start worker threads! gogogo
-        for (uint32_t t = 0; t < num_worker_threads_; t++)
-            worker_threads[t]->create_and_start();
+        if (num_worker_threads_ > 1) {
+            for (uint32_t t = 0; t < num_worker_threads_; t++)
+                workers[t]->setPhase(&phase);
+        }
+
+        //Only the latency worker's samples decide when the window may close early
+        SampleControl sample_control;
+        workers[0]->setSampleControl(&sample_control, true);
 
-        //Wait for all threads to complete
-        for (uint32_t t = 0; t < num_worker_threads_; t++)
-            if (!worker_threads[t]->join())
-                std::cerr << "WARNING: A worker thread failed to complete correctly!" << std::endl;
+        //Run the workers. Memory only needs to be primed before the first iteration since the pooled threads stay put.
+        if (!runWorkers(workers, i == 0))
+            std::cerr << "WARNING: A worker thread failed to complete correctly!" << std::endl;
 
         //Compute metrics for this iteration
         bool iterwarning = false;
@@ -215,6 +246,21 @@ bool LatencyMatrixBenchmark::runCore() {
             iterwarning |= workers[t]->hadWarning();
         }
 
+        //Reject iterations where the load did not cover the whole latency window, so that they never reach the metrics or the sample pool
+        load_overlap_on_iter_[i] = computeLoadOverlap(workers);
+        if (load_overlap_on_iter_[i] < LOADED_LATENCY_MIN_OVERLAP) {
+            if (rejected_iterations_ < LOADED_LATENCY_MAX_REJECTED_ITERATIONS) {
+                rejected_iterations_++;
+                if (g_verbose)
+                    std::cout << "Iter " << i+1 << " rejected: load covered only " << load_overlap_on_iter_[i] * 100 << "% of the latency window. Running it again." << std::endl;
+                for (uint32_t t = 0; t < num_worker_threads_; t++)
+                    delete workers[t];
+                workers.clear();
+                continue;
+            }
+            iterwarning = true;
+        }
+
         //Compute load metrics for this iteration
         load_avg_adjusted_ticks = static_cast<double>(load_total_adjusted_ticks) / (num_worker_threads_-1);
         if (num_worker_threads_ > 1)
@@ -258,6 +304,10 @@ bool LatencyMatrixBenchmark::runCore() {
                 std::cout << "...load total sec across " << num_worker_threads_-1 << " threads == " << load_total_adjusted_ticks * g_ns_per_tick / 1e9 << " (adjusted by -" << load_total_elapsed_dummy_ticks * g_ns_per_tick / 1e9 << ")";
                 if (iterwarning) std::cout << " -- WARNING";
                 std::cout << std::endl;
+
+                std::cout << "...load overlap with latency window == " << load_overlap_on_iter_[i] * 100 << "%";
+                if (load_overlap_on_iter_[i] < LOADED_LATENCY_MIN_OVERLAP) std::cout << " -- WARNING";
+                std::cout << std::endl;
             }
         }
 
@@ -269,38 +319,25 @@ bool LatencyMatrixBenchmark::runCore() {
         //           << " per " << denominator_metric_on_iter_[i] << " " << denominator_metric_units_ << " -> " << metric_on_iter_[i]
         //           << " " << metric_units_ << std::endl;
 
-        //Clean up workers and threads for this iteration
+        std::vector<double> samples = computeLatencySamples(workers[0], lat_accesses_per_pass);
+
+        //Clean up workers for this iteration
         for (uint32_t t = 0; t < num_worker_threads_; t++) {
-            delete worker_threads[t];
             delete workers[t];
         }
-        worker_threads.clear();
         workers.clear();
 
-        if (i >= 5) {
-            // 95% CI must not be computed for lower than 6 iterations of the experiment
-            computeMedian(metric_on_iter_, i + 1);
-
-            if (   (lower_95_CI_median_ >= (1 - DEV_FROM_MEDIAN) * median_metric_)
-                && (upper_95_CI_median_ <= (1 + DEV_FROM_MEDIAN) * median_metric_)) {
-                if (! g_log_extended) {
-                    // 95% CI is within DEV_FROM_MEDIAN % of the median
-                    uint32_t iterations_needed_ = i + 1;
-                    // Resizing vector for keeping the results of the measurements since they are fewer than the max.
-                    iterations_ = iterations_needed_;
-                    metric_on_iter_.resize(iterations_needed_);
-                    enumerator_metric_on_iter_.resize(iterations_needed_);
-                    denominator_metric_on_iter_.resize(iterations_needed_);
-                    break;
-                }
-            } else if (i == iterations_ - 1) {
-                std::cerr << "WARNING: 95% CI did not converge within " << DEV_FROM_MEDIAN * 100 << "% of median value!" << std::endl;
-            }
-        } else if (i == iterations_ - 1) {
-            std::cerr << "WARNING: 95% CI cannot be computed for fewer than six iterations!" << std::endl;
+        if (recordIterationSamples(i, samples)) {
+            load_metric_on_iter_.resize(iterations_);
+            load_overlap_on_iter_.resize(iterations_);
+            break;
         }
+        i++;
     }
 
+    if (rejected_iterations_ > 0)
+        std::cout << "Rejected " << rejected_iterations_ << " iteration(s) whose load covered less than " << LOADED_LATENCY_MIN_OVERLAP * 100 << "% of the latency window." << std::endl;
+
     //Stop power measurement
     if (g_verbose) {
         std::cout << std::endl;
@@ -321,7 +358,8 @@ bool LatencyMatrixBenchmark::runCore() {
                      << mem_region_                         << ","
                      << i                                   << ","
                      << metric_on_iter_[i]                  << ","
-                     << metric_units_                       << std::endl;
+                     << metric_units_                       << ","
+                     << load_overlap_on_iter_[i]            << std::endl;
         }
     }
 
@@ -336,3 +374,14 @@ bool LatencyMatrixBenchmark::runCore() {
 
     return true;
 }
+
+double LatencyMatrixBenchmark::getLoadOverlapOnIter(uint32_t iter) const {
+    if (has_run_ && iter >= 1 && iter <= iterations_)
+        return load_overlap_on_iter_[iter - 1];
+    else //bad call
+        return -1;
+}
+
+uint32_t LatencyMatrixBenchmark::getRejectedIterations() const {
+    return rejected_iterations_;
+}
@@ -68,9 +68,8 @@ LatencyWorker::LatencyWorker(
 LatencyWorker::~LatencyWorker() {
 }
 
-void LatencyWorker::run() {
+void LatencyWorker::runKernels() {
     //Set up relevant state -- localized to this thread's stack
-    int32_t cpu_affinity = 0;
     RandomFunction kernel_fptr = NULL;
     RandomFunction kernel_dummy_fptr = NULL;
     uintptr_t* next_address = NULL;
@@ -86,51 +85,57 @@ void LatencyWorker::run() {
     void* mem_array = NULL;
     size_t len = 0;
     tick_t target_ticks = g_ticks_per_ms * BENCHMARK_DURATION_MS; //Rough target run duration in ticks
+    LoadedLatencyPhase* phase = NULL;
+    SampleControl* sample_control = NULL;
+    bool sample_leader = false;
+    tick_t window_start_tick = 0;
+    tick_t window_stop_tick = 0;
     
     //Grab relevant setup state thread-safely and keep it local
     if (acquireLock(-1)) {
         mem_array = mem_array_;
         len = len_;
         bytes_per_pass = LATENCY_BENCHMARK_UNROLL_LENGTH * 8;
-        cpu_affinity = cpu_affinity_;
         kernel_fptr = kernel_fptr_;
         kernel_dummy_fptr = kernel_dummy_fptr_;
+        phase = phase_;
+        sample_control = sample_control_;
+        sample_leader = sample_leader_;
         releaseLock();
     }
     
-    //Set processor affinity
-    bool locked = lock_thread_to_cpu(cpu_affinity);
-    if (!locked)
-        std::cerr << "WARNING: Failed to lock thread to logical CPU " << cpu_affinity << "! Results may not be correct." << std::endl;
+    next_address = static_cast<uintptr_t*>(mem_array); 
 
-    //Increase scheduling priority
-#ifdef _WIN32
-    DWORD original_priority_class;
-    DWORD original_priority;
-    if (!boost_scheduling_priority(original_priority_class, original_priority))
-#endif
-#ifdef __gnu_linux__
-    if (!boost_scheduling_priority())
-#endif
-        std::cerr << "WARNING: Failed to boost scheduling priority. Perhaps running in Administrator mode would help." << std::endl;
+    //Under load, wait for every load worker to be running and give them time to reach steady state before opening the window
+    if (phase != NULL) {
+        if (!phase->waitForLoads(target_ticks))
+            warning = true;
 
-    //Prime memory
-    for (uint32_t i = 0; i < 4; i++) {
-        void* prime_start_address = mem_array; 
-        void* prime_end_address = reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array) + len);
-        forwSequentialRead_Word32(prime_start_address, prime_end_address); //dependent reads on the memory, make sure caches are ready, coherence, etc...
+        tick_t warmup_ticks = g_ticks_per_ms * LOADED_LATENCY_WARMUP_MS;
+        tick_t warmup_start_tick = start_timer();
+        while (stop_timer() - warmup_start_tick < warmup_ticks)
+            (*kernel_fptr)(next_address, &next_address, 0);
     }
 
+    SampleRecorder recorder(sample_control, sample_leader);
+
     //Run benchmark
     //Run actual version of function and loop overhead
-    next_address = static_cast<uintptr_t*>(mem_array); 
+    window_start_tick = start_timer();
     while (elapsed_ticks < target_ticks) {
         start_tick = start_timer();
         UNROLL256((*kernel_fptr)(next_address, &next_address, 0);)
         stop_tick = stop_timer();
         elapsed_ticks += (stop_tick - start_tick);
         passes+=256;
+        if (recorder.addBlock(256, stop_tick - start_tick))
+            break;
     }
+    window_stop_tick = stop_timer();
+
+    //Release the load workers
+    if (phase != NULL)
+        phase->signalLatencyDone();
 
     //Run dummy version of function and loop overhead
     next_address = static_cast<uintptr_t*>(mem_array); 
@@ -143,24 +148,12 @@ void LatencyWorker::run() {
     }
 
     adjusted_ticks = elapsed_ticks - elapsed_dummy_ticks;
+    recorder.finish(passes, elapsed_dummy_ticks);
     
     //Warn if something looks fishy
     if (elapsed_dummy_ticks >= elapsed_ticks || elapsed_ticks < MIN_ELAPSED_TICKS || adjusted_ticks < 0.5 * elapsed_ticks)
         warning = true;
 
-    //Unset processor affinity
-    if (locked)
-        unlock_thread_to_numa_node();
-
-    //Revert thread priority
-#ifdef _WIN32
-    if (!revert_scheduling_priority(original_priority_class, original_priority))
-#endif
-#ifdef __gnu_linux__
-    if (!revert_scheduling_priority())
-#endif
-        std::cerr << "WARNING: Failed to revert scheduling priority. Perhaps running in Administrator mode would help." << std::endl;
-
     //Update the object state thread-safely
     if (acquireLock(-1)) {
         adjusted_ticks_ = adjusted_ticks;
@@ -170,6 +163,9 @@ void LatencyWorker::run() {
         bytes_per_pass_ = bytes_per_pass;
         completed_ = true;
         passes_ = passes;
+        window_start_tick_ = window_start_tick;
+        window_stop_tick_ = window_stop_tick;
+        storeSamples(recorder);
         releaseLock();
     }
 }
@@ -53,6 +53,7 @@ LoadWorker::LoadWorker(
         size_t len,
         SequentialFunction kernel_fptr,
         SequentialFunction kernel_dummy_fptr,
+        int32_t stride_size,
         int32_t cpu_affinity
     ) :
         MemoryWorker(
@@ -60,11 +61,15 @@ LoadWorker::LoadWorker(
             len,
             cpu_affinity
         ),
-        use_sequential_kernel_fptr_(true),
+        pattern_mode_(SEQUENTIAL),
         kernel_fptr_seq_(kernel_fptr),
         kernel_dummy_fptr_seq_(kernel_dummy_fptr),
         kernel_fptr_ran_(NULL),
-        kernel_dummy_fptr_ran_(NULL)
+        kernel_dummy_fptr_ran_(NULL),
+        kernel_fptr_ind_(NULL),
+        kernel_dummy_fptr_ind_(NULL),
+        seed_(0),
+        pass_span_(sequential_pass_span(stride_size))
     {
 }
 
@@ -80,30 +85,62 @@ LoadWorker::LoadWorker(
             len,
             cpu_affinity
         ),
-        use_sequential_kernel_fptr_(false),
+        pattern_mode_(RANDOM),
         kernel_fptr_seq_(NULL),
         kernel_dummy_fptr_seq_(NULL),
         kernel_fptr_ran_(kernel_fptr),
-        kernel_dummy_fptr_ran_(kernel_dummy_fptr)
+        kernel_dummy_fptr_ran_(kernel_dummy_fptr),
+        kernel_fptr_ind_(NULL),
+        kernel_dummy_fptr_ind_(NULL),
+        seed_(0),
+        pass_span_(THROUGHPUT_BENCHMARK_BYTES_PER_PASS)
+    {
+}
+
+LoadWorker::LoadWorker(
+        void* mem_array,
+        size_t len,
+        IndependentRandomFunction kernel_fptr,
+        IndependentRandomFunction kernel_dummy_fptr,
+        uint64_t seed,
+        int32_t cpu_affinity
+    ) :
+        MemoryWorker(
+            mem_array,
+            len,
+            cpu_affinity
+        ),
+        pattern_mode_(RANDOM_INDEPENDENT),
+        kernel_fptr_seq_(NULL),
+        kernel_dummy_fptr_seq_(NULL),
+        kernel_fptr_ran_(NULL),
+        kernel_dummy_fptr_ran_(NULL),
+        kernel_fptr_ind_(kernel_fptr),
+        kernel_dummy_fptr_ind_(kernel_dummy_fptr),
+        seed_(seed),
+        pass_span_(THROUGHPUT_BENCHMARK_BYTES_PER_PASS)
     {
 }
 
 LoadWorker::~LoadWorker() {
 }
 
-void LoadWorker::run() {
+void LoadWorker::runKernels() {
     //Set up relevant state -- localized to this thread's stack
-    int32_t cpu_affinity = 0;
-    bool use_sequential_kernel_fptr = false;
+    pattern_mode_t pattern_mode = SEQUENTIAL;
     SequentialFunction kernel_fptr_seq = NULL;
     SequentialFunction kernel_dummy_fptr_seq = NULL;
     RandomFunction kernel_fptr_ran = NULL;
     RandomFunction kernel_dummy_fptr_ran = NULL;
+    IndependentRandomFunction kernel_fptr_ind = NULL;
+    IndependentRandomFunction kernel_dummy_fptr_ind = NULL;
+    uint64_t streams[RANDOM_STREAMS];
+    size_t table_len = 0;
     void* start_address = NULL;
     void* end_address = NULL;
-    void* prime_start_address = NULL;
-    void* prime_end_address = NULL;
     uint32_t bytes_per_pass = 0;
+    size_t pass_span = 0;
+    size_t pass_offset = 0;
     uint32_t passes = 0;
     tick_t start_tick = 0;
     tick_t stop_tick = 0;
@@ -114,6 +151,11 @@ void LoadWorker::run() {
     void* mem_array = NULL;
     size_t len = 0;
     tick_t target_ticks = g_ticks_per_ms * BENCHMARK_DURATION_MS; //Rough target run duration in ticks
+    LoadedLatencyPhase* phase = NULL;
+    SampleControl* sample_control = NULL;
+    bool sample_leader = false;
+    tick_t window_start_tick = 0;
+    tick_t window_stop_tick = 0;
     uint32_t p = 0;
     bytes_per_pass = THROUGHPUT_BENCHMARK_BYTES_PER_PASS;
     
@@ -121,53 +163,55 @@ void LoadWorker::run() {
     if (acquireLock(-1)) {
         mem_array = mem_array_;
         len = len_;
-        cpu_affinity = cpu_affinity_;
-        use_sequential_kernel_fptr = use_sequential_kernel_fptr_;
+        pattern_mode = pattern_mode_;
         kernel_fptr_seq = kernel_fptr_seq_;
         kernel_dummy_fptr_seq = kernel_dummy_fptr_seq_;
         kernel_fptr_ran = kernel_fptr_ran_;
         kernel_dummy_fptr_ran = kernel_dummy_fptr_ran_;
+        kernel_fptr_ind = kernel_fptr_ind_;
+        kernel_dummy_fptr_ind = kernel_dummy_fptr_ind_;
+        seed_random_streams(seed_, streams);
+        phase = phase_;
+        sample_control = sample_control_;
+        sample_leader = sample_leader_;
+        pass_span = pass_span_;
         start_address = mem_array_;
-        end_address = reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_)+bytes_per_pass);
-        prime_start_address = mem_array_; 
-        prime_end_address = reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_) + len_);
+        end_address = reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_)+pass_span);
         releaseLock();
     }
     
-    //Set processor affinity
-    bool locked = lock_thread_to_cpu(cpu_affinity);
-    if (!locked)
-        std::cerr << "WARNING: Failed to lock thread to logical CPU " << cpu_affinity << "! Results may not be correct." << std::endl;
+    //Under the loaded latency phase protocol, keep loading until the latency worker closes its window. The target then only serves as a safety cap.
+    if (phase != NULL)
+        target_ticks = g_ticks_per_ms * 4 * (BENCHMARK_DURATION_MS + LOADED_LATENCY_WARMUP_MS);
 
-    //Increase scheduling priority
-#ifdef _WIN32
-    DWORD original_priority_class;
-    DWORD original_priority;
-    if (!boost_scheduling_priority(original_priority_class, original_priority))
-#endif
-#ifdef __gnu_linux__
-    if (!boost_scheduling_priority())
-#endif
-        std::cerr << "WARNING: Failed to boost scheduling priority. Perhaps running in Administrator mode would help." << std::endl;
+    //Independent random accesses map random numbers to locations with a mask, so they stay within a power-of-two table
+    table_len = independent_random_table_length(len);
 
-    //Prime memory
-    for (uint32_t i = 0; i < 4; i++) {
-        forwSequentialRead_Word32(prime_start_address, prime_end_address); //dependent reads on the memory, make sure caches are ready, coherence, etc...
-    }
+    SampleRecorder recorder(sample_control, sample_leader);
 
     //Run the benchmark!
     uintptr_t* next_address = static_cast<uintptr_t*>(mem_array);
+    window_start_tick = start_timer();
+    if (phase != NULL)
+        phase->loadStarted();
+
     //Run actual version of function and loop overhead
-    while (elapsed_ticks < target_ticks) {
-        if (use_sequential_kernel_fptr) { //sequential function semantics
+    while (elapsed_ticks < target_ticks && (phase == NULL || !phase->latencyDone())) {
+        if (pattern_mode == SEQUENTIAL) { //sequential function semantics
             start_tick = start_timer();
             UNROLL1024(
                 (*kernel_fptr_seq)(start_address, end_address);
-                start_address = reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array)+(reinterpret_cast<uintptr_t>(start_address)+bytes_per_pass) % len);
-                end_address = reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(start_address) + bytes_per_pass);
+                pass_offset = pass_offset + 2 * pass_span <= len ? pass_offset + pass_span : 0; //Wrap before the next pass would run off the end
+                start_address = reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array) + pass_offset);
+                end_address = reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(start_address) + pass_span);
             )
             stop_tick = stop_timer();
             passes+=1024;
+        } else if (pattern_mode == RANDOM_INDEPENDENT) { //independent random function semantics
+            start_tick = start_timer();
+            UNROLL1024((*kernel_fptr_ind)(mem_array, table_len, streams, bytes_per_pass);)
+            stop_tick = stop_timer();
+            passes+=1024;
         } else { //random function semantics
             start_tick = start_timer();
             UNROLL1024((*kernel_fptr_ran)(next_address, &next_address, bytes_per_pass);)
@@ -175,23 +219,37 @@ void LoadWorker::run() {
             passes+=1024;
         }
         elapsed_ticks += (stop_tick - start_tick);
+        if (recorder.addBlock(1024, stop_tick - start_tick))
+            break;
     }
+    window_stop_tick = stop_timer();
+
+    //Hitting the safety cap means the latency window never closed while we were loading
+    if (phase != NULL && !phase->latencyDone())
+        warning = true;
 
     //Run dummy version of function and loop overhead
     p = 0;
+    pass_offset = 0;
     start_address = mem_array;
-    end_address = reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array) + bytes_per_pass);
+    end_address = reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array) + pass_span);
     next_address = static_cast<uintptr_t*>(mem_array);
     while (p < passes) {
-        if (use_sequential_kernel_fptr) { //sequential function semantics
+        if (pattern_mode == SEQUENTIAL) { //sequential function semantics
             start_tick = start_timer();
             UNROLL1024(
                 (*kernel_dummy_fptr_seq)(start_address, end_address);
-                start_address = reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array)+(reinterpret_cast<uintptr_t>(start_address)+bytes_per_pass) % len);
-                end_address = reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(start_address) + bytes_per_pass);
+                pass_offset = pass_offset + 2 * pass_span <= len ? pass_offset + pass_span : 0; //Wrap before the next pass would run off the end
+                start_address = reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array) + pass_offset);
+                end_address = reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(start_address) + pass_span);
             )
             stop_tick = stop_timer();
             p+=1024;
+        } else if (pattern_mode == RANDOM_INDEPENDENT) { //independent random function semantics
+            start_tick = start_timer();
+            UNROLL1024((*kernel_dummy_fptr_ind)(mem_array, table_len, streams, bytes_per_pass);)
+            stop_tick = stop_timer();
+            p+=1024;
         } else { //random function semantics
             start_tick = start_timer();
             UNROLL1024((*kernel_dummy_fptr_ran)(next_address, &next_address, bytes_per_pass);)
@@ -202,20 +260,8 @@ void LoadWorker::run() {
         elapsed_dummy_ticks += (stop_tick - start_tick);
     }
 
-    //Unset processor affinity
-    if (locked)
-        unlock_thread_to_numa_node();
-
-    //Revert thread priority
-#ifdef _WIN32
-    if (!revert_scheduling_priority(original_priority_class, original_priority))
-#endif
-#ifdef __gnu_linux__
-    if (!revert_scheduling_priority())
-#endif
-        std::cerr << "WARNING: Failed to revert scheduling priority. Perhaps running in Administrator mode would help." << std::endl;
-
     adjusted_ticks = elapsed_ticks - elapsed_dummy_ticks;
+    recorder.finish(passes, elapsed_dummy_ticks);
 
     //Warn if something looks fishy
     if (elapsed_dummy_ticks >= elapsed_ticks || elapsed_ticks < MIN_ELAPSED_TICKS || adjusted_ticks < 0.5 * elapsed_ticks)
@@ -230,6 +276,9 @@ void LoadWorker::run() {
         bytes_per_pass_ = bytes_per_pass;
         completed_ = true;
         passes_ = passes;
+        window_start_tick_ = window_start_tick;
+        window_stop_tick_ = window_stop_tick;
+        storeSamples(recorder);
         releaseLock();
     }
 }
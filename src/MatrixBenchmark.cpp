@@ -133,6 +133,9 @@ void MatrixBenchmark::reportBenchmarkInfo() const {
             case RANDOM:
                 std::cout << "random";
                 break;
+            case RANDOM_INDEPENDENT:
+                std::cout << "independent random";
+                break;
             default:
                 std::cout << "UNKNOWN";
                 break;
@@ -148,6 +151,17 @@ void MatrixBenchmark::reportBenchmarkInfo() const {
             case WRITE:
                 std::cout << "write";
                 break;
+            case WRITE_NT:
+                std::cout << "non-temporal write";
+                break;
+            case READ_WRITE_1_1:
+            case READ_WRITE_2_1:
+            case READ_WRITE_3_1:
+                std::cout << rw_ratio_name(rw_mode_) << " read:write mix";
+                break;
+            case READ_MODIFY_WRITE:
+                std::cout << "read-modify-write";
+                break;
             default:
                 std::cout << "UNKNOWN";
                 break;
@@ -199,39 +213,9 @@ double MatrixBenchmark::getMeanLoadMetric() const {
 }
 
 void MatrixBenchmark::computeMetrics() {
-    if (has_run_) {
-
-        // Resize vector according to iterations executed.
+    // Resize vector according to iterations executed.
+    if (has_run_)
         metric_on_iter_.resize(iterations_);
 
-        //Compute mean
-        mean_metric_ = 0;
-        for (uint32_t i = 0; i < iterations_; i++)
-            mean_metric_ += metric_on_iter_[i];
-        mean_metric_ /= iterations_;
-
-        //Build sorted array of metrics from each iteration
-        std::vector<double> sortedMetrics = metric_on_iter_;
-        std::sort(sortedMetrics.begin(), sortedMetrics.end());
-
-        //Compute percentiles
-        min_metric_ = sortedMetrics.front();
-        percentile_25_metric_ = sortedMetrics[sortedMetrics.size()/4];
-        percentile_75_metric_ = sortedMetrics[sortedMetrics.size()*3/4];
-        median_metric_ = compute_median(metric_on_iter_);
-        percentile_95_metric_ = sortedMetrics[sortedMetrics.size()*95/100];
-        percentile_99_metric_ = sortedMetrics[sortedMetrics.size()*99/100];
-        max_metric_ = sortedMetrics.back();
-
-        //Compute mode
-        std::map<double,uint32_t> metricCounts;
-        for (uint32_t i = 0; i < iterations_; i++)
-            metricCounts[metric_on_iter_[i]]++;
-        mode_metric_ = 0;
-        uint32_t greatest_count = 0;
-        for (auto it = metricCounts.cbegin(); it != metricCounts.cend(); it++) {
-            if (it->second > greatest_count)
-                mode_metric_ = it->first;
-        }
-    }
+    Benchmark::computeMetrics();
 }
@@ -32,9 +32,104 @@
 //Headers
 #include <MemoryWorker.h>
 #include <common.h>
+#include <benchmark_kernels.h>
+#include <util.h>
+
+//Libraries
+#include <iostream>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <processthreadsapi.h>
+#endif
+
+#ifdef __gnu_linux__
+#include <unistd.h>
+#endif
 
 using namespace xmem;
 
+LoadedLatencyPhase::LoadedLatencyPhase(uint32_t num_load_workers) :
+    num_load_workers_(num_load_workers),
+    loads_running_(0),
+    latency_done_(false)
+{
+}
+
+void LoadedLatencyPhase::loadStarted() {
+    loads_running_.fetch_add(1, std::memory_order_release);
+}
+
+bool LoadedLatencyPhase::waitForLoads(tick_t timeout_ticks) const {
+    tick_t start_tick = start_timer();
+    while (loads_running_.load(std::memory_order_acquire) < num_load_workers_) {
+        if (stop_timer() - start_tick > timeout_ticks)
+            return false;
+    }
+    return true;
+}
+
+void LoadedLatencyPhase::signalLatencyDone() {
+    latency_done_.store(true, std::memory_order_release);
+}
+
+SampleControl::SampleControl() :
+    stop_(false)
+{
+}
+
+SampleRecorder::SampleRecorder(SampleControl* control, bool leader) :
+    passes_(),
+    adjusted_ticks_(),
+    control_(control),
+    leader_(leader),
+    sample_ticks_(g_ticks_per_ms * g_sample_duration_ms),
+    open_passes_(0),
+    open_ticks_(0)
+{
+}
+
+bool SampleRecorder::addBlock(uint32_t passes, tick_t ticks) {
+    open_passes_ += passes;
+    open_ticks_ += ticks;
+
+    if (open_ticks_ >= sample_ticks_) {
+        passes_.push_back(open_passes_);
+        adjusted_ticks_.push_back(open_ticks_);
+        open_passes_ = 0;
+        open_ticks_ = 0;
+
+        //The dummy cost is not known yet, so convergence is judged on raw ticks per pass. With extended logging we want every iteration to run for the whole window.
+        if (leader_ && control_ != NULL && !g_log_extended && passes_.size() >= MIN_SAMPLES_FOR_CI) {
+            std::vector<double> ticks_per_pass;
+            for (uint32_t i = 0; i < passes_.size(); i++)
+                ticks_per_pass.push_back(static_cast<double>(adjusted_ticks_[i]) / passes_[i]);
+            if (median_95_CI_within(ticks_per_pass, g_ci_width))
+                control_->requestStop();
+        }
+    }
+
+    return control_ != NULL && control_->stopRequested();
+}
+
+void SampleRecorder::finish(uint32_t total_passes, tick_t elapsed_dummy_ticks) {
+    //A trailing partial sample is only kept if there is nothing else
+    if (open_passes_ > 0 && passes_.empty()) {
+        passes_.push_back(open_passes_);
+        adjusted_ticks_.push_back(open_ticks_);
+    }
+    open_passes_ = 0;
+    open_ticks_ = 0;
+
+    if (total_passes == 0)
+        return;
+
+    for (uint32_t i = 0; i < passes_.size(); i++) {
+        tick_t dummy_share = static_cast<tick_t>(static_cast<double>(elapsed_dummy_ticks) * passes_[i] / total_passes);
+        adjusted_ticks_[i] = (adjusted_ticks_[i] > dummy_share) ? adjusted_ticks_[i] - dummy_share : 0;
+    }
+}
+
 MemoryWorker::MemoryWorker(
         void* mem_array,
         size_t len,
@@ -49,13 +144,96 @@ MemoryWorker::MemoryWorker(
         elapsed_dummy_ticks_(0),
         adjusted_ticks_(0),
         warning_(false),
-        completed_(false)
+        completed_(false),
+        phase_(NULL),
+        window_start_tick_(0),
+        window_stop_tick_(0),
+        sample_control_(NULL),
+        sample_leader_(false),
+        sample_passes_(),
+        sample_adjusted_ticks_()
     {
 }
 
 MemoryWorker::~MemoryWorker() {
 }
 
+void MemoryWorker::run() {
+    int32_t cpu_affinity = getCPUAffinity();
+
+    //Set processor affinity
+    bool locked = lock_thread_to_cpu(cpu_affinity);
+    if (!locked)
+        std::cerr << "WARNING: Failed to lock thread to logical CPU " << cpu_affinity << "! Results may not be correct." << std::endl;
+
+    //Increase scheduling priority
+#ifdef _WIN32
+    DWORD original_priority_class;
+    DWORD original_priority;
+    if (!boost_scheduling_priority(original_priority_class, original_priority))
+#endif
+#ifdef __gnu_linux__
+    if (!boost_scheduling_priority())
+#endif
+        std::cerr << "WARNING: Failed to boost scheduling priority. Perhaps running in Administrator mode would help." << std::endl;
+
+    primeMemory();
+
+    //Run the benchmark!
+    runKernels();
+
+    //Unset processor affinity
+    if (locked)
+        unlock_thread_to_numa_node();
+
+    //Revert thread priority
+#ifdef _WIN32
+    if (!revert_scheduling_priority(original_priority_class, original_priority))
+#endif
+#ifdef __gnu_linux__
+    if (!revert_scheduling_priority())
+#endif
+        std::cerr << "WARNING: Failed to revert scheduling priority. Perhaps running in Administrator mode would help." << std::endl;
+}
+
+void MemoryWorker::primeMemory() {
+    void* prime_start_address = NULL;
+    void* prime_end_address = NULL;
+
+    if (acquireLock(-1)) {
+        prime_start_address = mem_array_;
+        prime_end_address = reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_) + len_);
+        releaseLock();
+    }
+
+    if (prime_start_address == NULL)
+        return;
+
+    for (uint32_t i = 0; i < 4; i++) {
+        stridedRead<Word32_t, 1>(prime_start_address, prime_end_address); //dependent reads on the memory, make sure caches are ready, coherence, etc...
+    }
+}
+
+int32_t MemoryWorker::getCPUAffinity() {
+    int32_t retval = 0;
+    if (acquireLock(-1)) {
+        retval = cpu_affinity_;
+        releaseLock();
+    }
+
+    return retval;
+}
+
+void* MemoryWorker::getMemArray() {
+    void* retval = NULL;
+    if (acquireLock(-1)) {
+        retval = mem_array_;
+        releaseLock();
+    }
+
+    return retval;
+}
+
 size_t MemoryWorker::getLen() {
     size_t retval = 0;
     if (acquireLock(-1)) {
@@ -125,3 +303,75 @@ bool MemoryWorker::hadWarning() {
 
     return retval;
 }
+
+void MemoryWorker::setPhase(LoadedLatencyPhase* phase) {
+    if (acquireLock(-1)) {
+        phase_ = phase;
+        releaseLock();
+    }
+}
+
+tick_t MemoryWorker::getWindowStartTick() {
+    tick_t retval = 0;
+    if (acquireLock(-1)) {
+        retval = window_start_tick_;
+        releaseLock();
+    }
+
+    return retval;
+}
+
+tick_t MemoryWorker::getWindowStopTick() {
+    tick_t retval = 0;
+    if (acquireLock(-1)) {
+        retval = window_stop_tick_;
+        releaseLock();
+    }
+
+    return retval;
+}
+
+void MemoryWorker::setSampleControl(SampleControl* control, bool leader) {
+    if (acquireLock(-1)) {
+        sample_control_ = control;
+        sample_leader_ = leader;
+        releaseLock();
+    }
+}
+
+uint32_t MemoryWorker::getNumSamples() {
+    uint32_t retval = 0;
+    if (acquireLock(-1)) {
+        retval = sample_passes_.size();
+        releaseLock();
+    }
+
+    return retval;
+}
+
+uint32_t MemoryWorker::getSamplePasses(uint32_t i) {
+    uint32_t retval = 0;
+    if (acquireLock(-1)) {
+        if (i < sample_passes_.size())
+            retval = sample_passes_[i];
+        releaseLock();
+    }
+
+    return retval;
+}
+
+tick_t MemoryWorker::getSampleAdjustedTicks(uint32_t i) {
+    tick_t retval = 0;
+    if (acquireLock(-1)) {
+        if (i < sample_adjusted_ticks_.size())
+            retval = sample_adjusted_ticks_[i];
+        releaseLock();
+    }
+
+    return retval;
+}
+
+void MemoryWorker::storeSamples(const SampleRecorder& recorder) {
+    sample_passes_ = recorder.passes_;
+    sample_adjusted_ticks_ = recorder.adjusted_ticks_;
+}
@@ -0,0 +1,142 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ *
+ * @brief Implementation file for the PointerChainBuilder class.
+ */
+
+//Headers
+#include <PointerChainBuilder.h>
+#include <common.h>
+
+//Libraries
+#include <iostream>
+#include <random>
+#include <algorithm>
+
+using namespace xmem;
+
+/**
+ * @brief SplitMix64 mixing function. Used to derive reproducible per-node offsets and per-block seeds without storing them.
+ * @param x Value to mix.
+ * @returns The mixed value.
+ */
+static inline uint64_t splitmix64(uint64_t x) {
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+PointerChainBuilder::PointerChainBuilder(
+        uint8_t* mem_region_base,
+        size_t num_nodes,
+        size_t node_size,
+        size_t chunk_bytes,
+        size_t nodes_per_block,
+        uint32_t first_block,
+        uint32_t block_stride,
+        bool random_offsets,
+        uint64_t seed,
+        int32_t cpu_affinity
+    ) :
+        Runnable(),
+        mem_region_base_(mem_region_base),
+        num_nodes_(num_nodes),
+        node_size_(node_size),
+        chunk_bytes_(chunk_bytes),
+        nodes_per_block_(nodes_per_block),
+        first_block_(first_block),
+        block_stride_(block_stride),
+        random_offsets_(random_offsets),
+        seed_(seed),
+        cpu_affinity_(cpu_affinity),
+        phase_(CHAIN_BUILD_SHUFFLE)
+    {
+}
+
+PointerChainBuilder::~PointerChainBuilder() {
+}
+
+void PointerChainBuilder::setPhase(chain_build_phase_t phase) {
+    phase_ = phase;
+}
+
+void PointerChainBuilder::run() {
+    //Pin to a CPU in the region's NUMA node so that construction traffic stays node-local
+    if (cpu_affinity_ >= 0 && !lock_thread_to_cpu(static_cast<uint32_t>(cpu_affinity_)))
+        std::cerr << "WARNING: Failed to lock pointer chain builder thread to logical CPU " << cpu_affinity_ << std::endl;
+
+    uint32_t num_blocks = static_cast<uint32_t>((num_nodes_ + nodes_per_block_ - 1) / nodes_per_block_);
+    for (uint32_t block = first_block_; block < num_blocks; block += block_stride_) {
+        if (phase_ == CHAIN_BUILD_SHUFFLE)
+            shuffleBlock(block);
+        else if (phase_ == CHAIN_BUILD_LINK)
+            linkBlock(block);
+    }
+
+    if (cpu_affinity_ >= 0)
+        unlock_thread_to_cpu();
+}
+
+void PointerChainBuilder::shuffleBlock(uint32_t block) {
+    size_t block_start = block * nodes_per_block_;
+    size_t block_end = std::min(block_start + nodes_per_block_, num_nodes_);
+
+    for (size_t i = block_start; i < block_end; i++)
+        *reinterpret_cast<uintptr_t*>(mem_region_base_ + i*node_size_) = static_cast<uintptr_t>(i);
+
+    //Block 0 uses the chain seed directly, so chains that fit in one block do not depend on the block size.
+    std::mt19937_64 gen(block == 0 ? seed_ : splitmix64(seed_ + block)); //Mersenne Twister random number generator
+    for (size_t i = block_end-1; i > block_start; i--) {
+        std::uniform_int_distribution<size_t> dist(block_start, i-1); //j < i is what makes this a single cycle
+        size_t j = dist(gen);
+        std::swap(*reinterpret_cast<uintptr_t*>(mem_region_base_ + i*node_size_), *reinterpret_cast<uintptr_t*>(mem_region_base_ + j*node_size_));
+    }
+}
+
+void PointerChainBuilder::linkBlock(uint32_t block) {
+    size_t block_start = block * nodes_per_block_;
+    size_t block_end = std::min(block_start + nodes_per_block_, num_nodes_);
+    size_t words_per_chunk = chunk_bytes_ / sizeof(uintptr_t);
+
+    for (size_t i = block_start; i < block_end; i++) {
+        size_t next = static_cast<size_t>(*reinterpret_cast<uintptr_t*>(mem_region_base_ + i*node_size_));
+        uintptr_t* node = reinterpret_cast<uintptr_t*>(mem_region_base_ + i*node_size_ + nodeOffset(i));
+        node[0] = reinterpret_cast<uintptr_t>(mem_region_base_ + next*node_size_ + nodeOffset(next));
+        for (size_t w = 1; w < words_per_chunk; w++) //1-fill the rest of the chunk
+            node[w] = static_cast<uintptr_t>(-1);
+    }
+}
+
+size_t PointerChainBuilder::nodeOffset(size_t node) {
+    //The first node is always at offset 0 because that is where the workers start chasing.
+    size_t slots_per_node = node_size_ / chunk_bytes_;
+    if (!random_offsets_ || slots_per_node < 2 || node == 0)
+        return 0;
+    return static_cast<size_t>(splitmix64(seed_ + node) % slots_per_node) * chunk_bytes_;
+}
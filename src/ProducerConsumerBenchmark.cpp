@@ -0,0 +1,247 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ *
+ * @brief Implementation file for the ProducerConsumerBenchmark class.
+ */
+
+//Headers
+#include <ProducerConsumerBenchmark.h>
+#include <ProducerConsumerWorker.h>
+#include <common.h>
+
+//Libraries
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+using namespace xmem;
+
+ProducerConsumerBenchmark::ProducerConsumerBenchmark(
+        void* mem_array,
+        size_t len,
+        uint32_t iterations,
+        size_t ring_size,
+        uint32_t mem_node,
+        uint32_t cpu_node,
+        uint32_t producer_cpu,
+        uint32_t consumer_cpu,
+        std::vector<PowerReader*> dram_power_readers,
+        std::string name
+    ) :
+        Benchmark(
+            mem_array,
+            len,
+            iterations,
+            2,
+            mem_node,
+            0,
+            cpu_node,
+            SEQUENTIAL,
+            WRITE,
+#ifdef HAS_WORD_64
+            CHUNK_64b,
+#else
+            CHUNK_32b,
+#endif
+            1,
+            dram_power_readers,
+            "MB/s",
+            name
+        ),
+        ring_size_(ring_size),
+        producer_cpu_(producer_cpu),
+        consumer_cpu_(consumer_cpu),
+        median_message_latency_(0),
+        p95_message_latency_(0),
+        p99_message_latency_(0)
+    {
+}
+
+void ProducerConsumerBenchmark::reportBenchmarkInfo() const {
+    std::cout << "CPU NUMA Node: " << cpu_node_ << std::endl;
+    std::cout << "Memory NUMA Node: " << mem_node_ << std::endl;
+    std::cout << "Producing logical CPU: " << producer_cpu_ << std::endl;
+    std::cout << "Consuming logical CPU: " << consumer_cpu_ << std::endl;
+    std::cout << "CPU pair: " << cpu_pair_relation_name(getRelation()) << std::endl;
+    std::cout << "Ring buffer: " << ring_size_ << " B (" << ring_size_ / DEFAULT_CACHE_LINE_SIZE << " messages of " << DEFAULT_CACHE_LINE_SIZE << " B)" << std::endl;
+    std::cout << std::endl;
+}
+
+void ProducerConsumerBenchmark::reportResults() const {
+    Benchmark::reportResults();
+    if (has_run_) {
+        std::cout << "Message latency (median / 95th / 99th percentile): " << median_message_latency_ << " / " << p95_message_latency_ << " / " << p99_message_latency_ << " ns";
+        if (warning_)
+            std::cout << " (WARNING)";
+        std::cout << std::endl;
+    }
+}
+
+uint32_t ProducerConsumerBenchmark::getProducerCPU() const {
+    return producer_cpu_;
+}
+
+uint32_t ProducerConsumerBenchmark::getConsumerCPU() const {
+    return consumer_cpu_;
+}
+
+cpu_pair_relation_t ProducerConsumerBenchmark::getRelation() const {
+    return cpu_pair_relation(producer_cpu_, consumer_cpu_);
+}
+
+size_t ProducerConsumerBenchmark::getRingSize() const {
+    return ring_size_;
+}
+
+double ProducerConsumerBenchmark::getMedianMessageLatency() const {
+    return median_message_latency_;
+}
+
+double ProducerConsumerBenchmark::get95PercentileMessageLatency() const {
+    return p95_message_latency_;
+}
+
+double ProducerConsumerBenchmark::get99PercentileMessageLatency() const {
+    return p99_message_latency_;
+}
+
+bool ProducerConsumerBenchmark::runCore() {
+    if (producer_cpu_ == consumer_cpu_) {
+        std::cerr << "ERROR: The producer/consumer benchmark needs two different logical CPUs." << std::endl;
+        return false;
+    }
+
+    if (ring_size_ < DEFAULT_CACHE_LINE_SIZE || ring_size_ % DEFAULT_CACHE_LINE_SIZE != 0 || ring_size_ > len_) {
+        std::cerr << "ERROR: The ring buffer of " << ring_size_ << " B must be a multiple of " << DEFAULT_CACHE_LINE_SIZE << " B and fit in the memory region of " << len_ << " B." << std::endl;
+        return false;
+    }
+
+    //The messages overwrite whatever pointer chain was there
+    void* ring_end = reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_) + ring_size_);
+    if (region_cache_ != NULL)
+        region_cache_->invalidate(mem_array_, ring_end);
+
+    //Set up some stuff for worker threads
+    std::vector<MemoryWorker*> workers;
+    std::vector<double> message_latencies;
+
+    //Start power measurement
+    if (g_verbose)
+        std::cout << "Starting power measurement threads...";
+    if (!startPowerThreads()) {
+        if (g_verbose)
+            std::cout << "FAIL" << std::endl;
+        std::cerr << "WARNING: Failed to start power measurement threads." << std::endl;
+    } else if (g_verbose)
+        std::cout << "done" << std::endl;
+
+    //Run benchmark
+    if (g_verbose)
+        std::cout << "Running benchmark." << std::endl << std::endl;
+
+    //Do a bunch of iterations of the core benchmark routines
+    for (uint32_t i = 0; i < iterations_; i++) {
+        //Free every slot and restart the sequence numbers
+        memset(mem_array_, 0, ring_size_);
+
+        workers.push_back(new ProducerConsumerWorker(mem_array_, ring_size_, false, consumer_cpu_));
+        workers.push_back(new ProducerConsumerWorker(mem_array_, ring_size_, true, producer_cpu_));
+
+        //The consumer ends the run once its samples have converged, and the producer follows its stop value
+        SampleControl sample_control;
+        workers[0]->setSampleControl(&sample_control, true);
+
+        if (!runWorkers(workers, i == 0))
+            std::cerr << "WARNING: A worker thread failed to complete correctly!" << std::endl;
+
+        uint32_t passes = workers[0]->getPasses();
+        tick_t elapsed_ticks = workers[0]->getElapsedTicks();
+        bool iter_warning = workers[0]->hadWarning() || passes == 0;
+        if (iter_warning)
+            warning_ = true;
+
+        if (g_verbose) { //Report duration for this iteration
+            std::cout << "Iter " << i+1 << " had " << passes << " passes of " << PRODUCER_CONSUMER_MESSAGES_PER_PASS << " messages:";
+            if (iter_warning) std::cout << " -- WARNING";
+            std::cout << std::endl;
+
+            std::cout << "...clock ticks == " << elapsed_ticks;
+            if (iter_warning) std::cout << " -- WARNING";
+            std::cout << std::endl;
+
+            std::cout << "...ns == " << elapsed_ticks * g_ns_per_tick;
+            if (iter_warning) std::cout << " -- WARNING";
+            std::cout << std::endl;
+        }
+
+        //Compute metric for this iteration
+        if (elapsed_ticks > 0)
+            metric_on_iter_[i] = ((static_cast<double>(passes) * static_cast<double>(workers[0]->getBytesPerPass())) / static_cast<double>(MB))   /   ((static_cast<double>(elapsed_ticks) * g_ns_per_tick) / 1e9);
+        else
+            metric_on_iter_[i] = 0;
+
+        std::vector<tick_t> message_ticks = static_cast<ProducerConsumerWorker*>(workers[0])->getMessageTicks();
+        for (uint32_t m = 0; m < message_ticks.size(); m++)
+            message_latencies.push_back(static_cast<double>(message_ticks[m] * g_ns_per_tick));
+
+        std::vector<double> samples = computeThroughputSamples(workers, 0, 1);
+
+        //Clean up workers for this iteration
+        for (uint32_t t = 0; t < workers.size(); t++) {
+            delete workers[t];
+        }
+        workers.clear();
+
+        if (recordIterationSamples(i, samples))
+            break;
+    }
+
+    //Stopping power measurement
+    if (g_verbose)
+        std::cout << "Stopping power measurement threads...";
+    if (!stopPowerThreads()) {
+        if (g_verbose)
+            std::cout << "FAIL" << std::endl;
+        std::cerr << "WARNING: Failed to stop power measurement threads." << std::endl;
+    } else if (g_verbose)
+        std::cout << "done" << std::endl;
+
+    //Percentiles over every stamped message rather than over iterations
+    if (!message_latencies.empty()) {
+        std::sort(message_latencies.begin(), message_latencies.end());
+        median_message_latency_ = message_latencies[message_latencies.size() / 2];
+        p95_message_latency_ = message_latencies[message_latencies.size() * 95 / 100];
+        p99_message_latency_ = message_latencies[message_latencies.size() * 99 / 100];
+    }
+
+    //Run metadata
+    has_run_ = true;
+    computeMetrics();
+
+    return true;
+}
@@ -0,0 +1,201 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ * 
+ * @brief Implementation file for the ProducerConsumerWorker class.
+ */
+
+//Headers
+#include <ProducerConsumerWorker.h>
+#include <common.h>
+
+//Libraries
+#include <atomic>
+#include <iostream>
+
+using namespace xmem;
+
+/**
+ * @brief Sequence number stored by the consumer to release the producer. It is never reached by the real sequence numbers, which start at 1.
+ */
+#define PRODUCER_CONSUMER_STOP (~static_cast<uint64_t>(0))
+
+/**
+ * @brief One message of the ring buffer, exactly one cache line.
+ */
+struct ProducerConsumerSlot {
+    std::atomic<uint64_t> sequence; /**< Sequence number of the message in the slot, or 0 if the slot is free. */
+    uint64_t send_tick; /**< Timer value just before the producer filled the slot. Only valid for stamped messages. */
+    uint64_t payload[(DEFAULT_CACHE_LINE_SIZE - 2 * sizeof(uint64_t)) / sizeof(uint64_t)]; /**< Rest of the line, written by the producer and read by the consumer. */
+};
+
+static_assert(sizeof(ProducerConsumerSlot) == DEFAULT_CACHE_LINE_SIZE, "A ring buffer slot must fill exactly one cache line");
+
+ProducerConsumerWorker::ProducerConsumerWorker(
+        void* ring,
+        size_t ring_size,
+        bool producer,
+        int32_t cpu_affinity
+    ) :
+        MemoryWorker(
+            ring,
+            ring_size,
+            cpu_affinity
+        ),
+        producer_(producer),
+        message_ticks_(),
+        checksum_(0)
+    {
+}
+
+ProducerConsumerWorker::~ProducerConsumerWorker() {
+}
+
+std::vector<tick_t> ProducerConsumerWorker::getMessageTicks() {
+    std::vector<tick_t> retval;
+    if (acquireLock(-1)) {
+        retval = message_ticks_;
+        releaseLock();
+    }
+    return retval;
+}
+
+void ProducerConsumerWorker::runKernels() {
+    //Set up relevant state -- localized to this thread's stack
+    ProducerConsumerSlot* ring = NULL;
+    uint32_t num_slots = 0;
+    bool producer = false;
+    uint32_t bytes_per_pass = PRODUCER_CONSUMER_MESSAGES_PER_PASS * sizeof(ProducerConsumerSlot);
+    uint32_t passes = 0;
+    tick_t start_tick = 0;
+    tick_t stop_tick = 0;
+    tick_t elapsed_ticks = 0;
+    bool warning = false;
+    tick_t target_ticks = g_ticks_per_ms * BENCHMARK_DURATION_MS; //Rough target run duration in ticks
+    SampleControl* sample_control = NULL;
+    bool sample_leader = false;
+    tick_t window_start_tick = 0;
+    tick_t window_stop_tick = 0;
+    std::vector<tick_t> message_ticks;
+    uint64_t checksum = 0;
+
+    //Grab relevant setup state thread-safely and keep it local
+    if (acquireLock(-1)) {
+        ring = static_cast<ProducerConsumerSlot*>(mem_array_);
+        num_slots = static_cast<uint32_t>(len_ / sizeof(ProducerConsumerSlot));
+        producer = producer_;
+        sample_control = sample_control_;
+        sample_leader = sample_leader_;
+        releaseLock();
+    }
+
+    SampleRecorder recorder(sample_control, sample_leader);
+
+    window_start_tick = start_timer();
+    uint64_t sequence = 1;
+    uint32_t slot = 0;
+    if (producer) {
+        //Fill slots as soon as they are free until the consumer leaves the stop value in one
+        bool stopped = false;
+        while (!stopped) {
+            uint64_t current = 0;
+            while ((current = ring[slot].sequence.load(std::memory_order_acquire)) != 0) {
+                if (current == PRODUCER_CONSUMER_STOP) {
+                    stopped = true;
+                    break;
+                }
+            }
+            if (stopped)
+                break;
+
+            if ((sequence & (PRODUCER_CONSUMER_LATENCY_STRIDE-1)) == 0)
+                ring[slot].send_tick = static_cast<uint64_t>(start_timer());
+            for (uint32_t w = 0; w < sizeof(ring[slot].payload) / sizeof(uint64_t); w++)
+                ring[slot].payload[w] = sequence;
+            ring[slot].sequence.store(sequence, std::memory_order_release);
+
+            sequence++;
+            if (++slot == num_slots)
+                slot = 0;
+        }
+    } else {
+        tick_t pass_message_ticks[PRODUCER_CONSUMER_MESSAGES_PER_PASS / PRODUCER_CONSUMER_LATENCY_STRIDE];
+        while (elapsed_ticks < target_ticks) {
+            uint32_t stamped = 0;
+            start_tick = start_timer();
+            for (uint32_t m = 0; m < PRODUCER_CONSUMER_MESSAGES_PER_PASS; m++) {
+                while (ring[slot].sequence.load(std::memory_order_acquire) != sequence) //Spin without pausing so the message is picked up as soon as it is published
+                    ;
+                for (uint32_t w = 0; w < sizeof(ring[slot].payload) / sizeof(uint64_t); w++)
+                    checksum += ring[slot].payload[w];
+                if ((sequence & (PRODUCER_CONSUMER_LATENCY_STRIDE-1)) == 0)
+                    pass_message_ticks[stamped++] = stop_timer() - static_cast<tick_t>(ring[slot].send_tick);
+                ring[slot].sequence.store(0, std::memory_order_release);
+
+                sequence++;
+                if (++slot == num_slots)
+                    slot = 0;
+            }
+            stop_tick = stop_timer();
+            passes++;
+            elapsed_ticks += (stop_tick - start_tick);
+            message_ticks.insert(message_ticks.end(), pass_message_ticks, pass_message_ticks + stamped);
+            if (recorder.addBlock(1, stop_tick - start_tick))
+                break;
+        }
+
+        //Release the producer once it has wrapped around to the next message
+        while (ring[slot].sequence.load(std::memory_order_acquire) != sequence)
+            ;
+        ring[slot].sequence.store(PRODUCER_CONSUMER_STOP, std::memory_order_release);
+    }
+    window_stop_tick = stop_timer();
+
+    //There is no dummy version: most of each pass is the wait for the producer's lines. The timer is read once per pass and once per stamped message.
+    recorder.finish(passes, 0);
+
+    //Warn if something looks fishy
+    if (!producer && elapsed_ticks < MIN_ELAPSED_TICKS)
+        warning = true;
+
+    //Update the object state thread-safely
+    if (acquireLock(-1)) {
+        adjusted_ticks_ = elapsed_ticks;
+        elapsed_ticks_ = elapsed_ticks;
+        elapsed_dummy_ticks_ = 0;
+        warning_ = warning;
+        bytes_per_pass_ = bytes_per_pass;
+        completed_ = true;
+        passes_ = passes;
+        window_start_tick_ = window_start_tick;
+        window_stop_tick_ = window_stop_tick;
+        message_ticks_ = message_ticks;
+        checksum_ = checksum;
+        storeSamples(recorder);
+        releaseLock();
+    }
+}
@@ -0,0 +1,126 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ *
+ * @brief Implementation file for the RegionCache class.
+ */
+
+//Headers
+#include <RegionCache.h>
+#include <common.h>
+
+using namespace xmem;
+
+RegionCache::RegionCache() :
+    chains_(),
+    resident_(),
+    hits_(0),
+    misses_(0)
+{
+}
+
+bool RegionCache::isResident(void* start_address, void* end_address) {
+    uintptr_t start = reinterpret_cast<uintptr_t>(start_address);
+    uintptr_t end = reinterpret_cast<uintptr_t>(end_address);
+    for (auto it = resident_.cbegin(); it != resident_.cend(); it++) {
+        if (it->start <= start && end <= it->end) {
+            hits_++;
+            return true;
+        }
+    }
+    misses_++;
+    return false;
+}
+
+void RegionCache::markResident(void* start_address, void* end_address) {
+    invalidate(start_address, end_address);
+
+    resident_range_t range;
+    range.start = reinterpret_cast<uintptr_t>(start_address);
+    range.end = reinterpret_cast<uintptr_t>(end_address);
+    resident_.push_back(range);
+}
+
+bool RegionCache::hasChain(void* start_address, void* end_address, chunk_size_t chunk_size, chain_granularity_t granularity, bool random_offsets, uint64_t seed) {
+    uintptr_t start = reinterpret_cast<uintptr_t>(start_address);
+    uintptr_t end = reinterpret_cast<uintptr_t>(end_address);
+    for (auto it = chains_.cbegin(); it != chains_.cend(); it++) {
+        if (it->start == start && it->end == end && it->chunk_size == chunk_size && it->granularity == granularity && it->random_offsets == random_offsets && it->seed == seed) {
+            hits_++;
+            return true;
+        }
+    }
+    misses_++;
+    return false;
+}
+
+void RegionCache::addChain(void* start_address, void* end_address, chunk_size_t chunk_size, chain_granularity_t granularity, bool random_offsets, uint64_t seed) {
+    invalidate(start_address, end_address);
+
+    chain_entry_t entry;
+    entry.start = reinterpret_cast<uintptr_t>(start_address);
+    entry.end = reinterpret_cast<uintptr_t>(end_address);
+    entry.chunk_size = chunk_size;
+    entry.granularity = granularity;
+    entry.random_offsets = random_offsets;
+    entry.seed = seed;
+    chains_.push_back(entry);
+}
+
+void RegionCache::invalidate(void* start_address, void* end_address) {
+    uintptr_t start = reinterpret_cast<uintptr_t>(start_address);
+    uintptr_t end = reinterpret_cast<uintptr_t>(end_address);
+    auto it = chains_.begin();
+    while (it != chains_.end()) {
+        if (it->start < end && start < it->end) //overlaps
+            it = chains_.erase(it);
+        else
+            it++;
+    }
+}
+
+void RegionCache::release(void* start_address, void* end_address) {
+    invalidate(start_address, end_address);
+
+    uintptr_t start = reinterpret_cast<uintptr_t>(start_address);
+    uintptr_t end = reinterpret_cast<uintptr_t>(end_address);
+    auto it = resident_.begin();
+    while (it != resident_.end()) {
+        if (it->start < end && start < it->end) //overlaps
+            it = resident_.erase(it);
+        else
+            it++;
+    }
+}
+
+uint64_t RegionCache::getHits() const {
+    return hits_;
+}
+
+uint64_t RegionCache::getMisses() const {
+    return misses_;
+}
@@ -0,0 +1,69 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ *
+ * @brief Implementation file for the RegionPrefaulter class.
+ */
+
+//Headers
+#include <RegionPrefaulter.h>
+#include <common.h>
+
+//Libraries
+#include <iostream>
+
+using namespace xmem;
+
+RegionPrefaulter::RegionPrefaulter(
+        void* start_address,
+        void* end_address,
+        size_t page_size,
+        int32_t cpu_affinity
+    ) :
+        Runnable(),
+        start_address_(reinterpret_cast<uint8_t*>(start_address)),
+        end_address_(reinterpret_cast<uint8_t*>(end_address)),
+        page_size_(page_size),
+        cpu_affinity_(cpu_affinity)
+    {
+}
+
+RegionPrefaulter::~RegionPrefaulter() {
+}
+
+void RegionPrefaulter::run() {
+    //Pin to a CPU in the region's NUMA node so that the page faults are handled on the node that owns the memory
+    if (cpu_affinity_ >= 0 && !lock_thread_to_cpu(static_cast<uint32_t>(cpu_affinity_)))
+        std::cerr << "WARNING: Failed to lock prefault thread to logical CPU " << cpu_affinity_ << std::endl;
+
+    //Write rather than read, so that private anonymous pages are really allocated instead of mapped to the shared zero page
+    for (uint8_t* page = start_address_; page < end_address_; page += page_size_)
+        *reinterpret_cast<volatile Word32_t*>(page) = 0;
+
+    if (cpu_affinity_ >= 0)
+        unlock_thread_to_cpu();
+}
@@ -83,12 +83,27 @@ bool ThroughputBenchmark::runCore() {
     SequentialFunction kernel_dummy_fptr_seq = NULL;
     RandomFunction kernel_fptr_ran = NULL;
     RandomFunction kernel_dummy_fptr_ran = NULL;
+    IndependentRandomFunction kernel_fptr_ind = NULL;
+    IndependentRandomFunction kernel_dummy_fptr_ind = NULL;
 
-    if (pattern_mode_ == SEQUENTIAL) {
+    if (prefetch_distance_ > 0) {
+        if (pattern_mode_ != SEQUENTIAL || rw_mode_ != READ) {
+            std::cerr << "ERROR: Software prefetching is only supported for sequential read throughput benchmarks." << std::endl;
+            return false;
+        }
+        if (!determine_sequential_prefetch_kernel(chunk_size_, stride_size_, &kernel_fptr_seq, &kernel_dummy_fptr_seq)) {
+            std::cerr << "ERROR: Failed to find appropriate software-prefetching benchmark kernel." << std::endl;
+            return false;
+        }
+        if (!checkPassSpan(len_per_thread))
+            return false;
+    } else if (pattern_mode_ == SEQUENTIAL) {
         if (!determine_sequential_kernel(rw_mode_, chunk_size_, stride_size_, &kernel_fptr_seq, &kernel_dummy_fptr_seq)) {
             std::cerr << "ERROR: Failed to find appropriate benchmark kernel." << std::endl;
             return false;
         }
+        if (!checkPassSpan(len_per_thread))
+            return false;
     } else if (pattern_mode_ == RANDOM) {
         if (!determine_random_kernel(rw_mode_, chunk_size_, &kernel_fptr_ran, &kernel_dummy_fptr_ran)) {
             std::cerr << "ERROR: Failed to find appropriate benchmark kernel." << std::endl;
@@ -97,21 +112,28 @@ bool ThroughputBenchmark::runCore() {
 
         //Build pointer indices. Note that the pointers for each thread must stay within its respective region, otherwise sharing may occur.
         for (uint32_t i = 0; i < num_worker_threads_; i++) {
-            if (!build_random_pointer_permutation(reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_) + i*len_per_thread), //casts to silence compiler warnings
-                                               reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_) + (i+1)*len_per_thread), //casts to silence compiler warnings
-                                               chunk_size_)) {
+            if (!prepareChain(reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_) + i*len_per_thread), //casts to silence compiler warnings
+                           reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_) + (i+1)*len_per_thread), //casts to silence compiler warnings
+                           chunk_size_,
+                           CHAIN_CHUNK,
+                           false,
+                           g_random_seed + i)) {
                 std::cerr << "ERROR: Failed to build a random pointer permutation for a worker thread!" << std::endl;
                 return false;
             }
         }
+    } else if (pattern_mode_ == RANDOM_INDEPENDENT) {
+        if (!determine_independent_random_kernel(rw_mode_, chunk_size_, &kernel_fptr_ind, &kernel_dummy_fptr_ind)) {
+            std::cerr << "ERROR: Failed to find appropriate benchmark kernel." << std::endl;
+            return false;
+        }
     } else {
         std::cerr << "ERROR: Got an invalid pattern mode." << std::endl;
         return false;
     }
 
     //Set up some stuff for worker threads
-    std::vector<LoadWorker*> workers;
-    std::vector<Thread*> worker_threads;
+    std::vector<MemoryWorker*> workers;
 
     //Start power measurement
     if (g_verbose)
@@ -140,6 +162,7 @@ bool ThroughputBenchmark::runCore() {
                                                  len_per_thread,
                                                  kernel_fptr_seq,
                                                  kernel_dummy_fptr_seq,
+                                                 stride_size_,
                                                  cpu_id));
             else if (pattern_mode_ == RANDOM)
                 workers.push_back(new LoadWorker(threadmem_array_,
@@ -147,19 +170,25 @@ bool ThroughputBenchmark::runCore() {
                                                  kernel_fptr_ran,
                                                  kernel_dummy_fptr_ran,
                                                  cpu_id));
+            else if (pattern_mode_ == RANDOM_INDEPENDENT)
+                workers.push_back(new LoadWorker(threadmem_array_,
+                                                 len_per_thread,
+                                                 kernel_fptr_ind,
+                                                 kernel_dummy_fptr_ind,
+                                                 g_random_seed + t,
+                                                 cpu_id));
             else
                 std::cerr << "WARNING: Invalid benchmark pattern mode." << std::endl;
-            worker_threads.push_back(new Thread(workers[t]));
         }
 
-        //Start worker threads! gogogo
-        for (uint32_t t = 0; t < num_worker_threads_; t++)
-            worker_threads[t]->create_and_start();
+        //All workers stop together once the first one has converged
+        SampleControl sample_control;
+        for (uint32_t t = 0; t < workers.size(); t++)
+            workers[t]->setSampleControl(&sample_control, t == 0);
 
-        //Wait for all threads to complete
-        for (uint32_t t = 0; t < num_worker_threads_; t++)
-            if (!worker_threads[t]->join())
-                std::cerr << "WARNING: A worker thread failed to complete correctly!" << std::endl;
+        //Run the workers. Memory only needs to be primed before the first iteration since the pooled threads stay put.
+        if (!runWorkers(workers, i == 0))
+            std::cerr << "WARNING: A worker thread failed to complete correctly!" << std::endl;
 
         //Compute throughput achieved with all workers
         uint32_t total_passes = 0;
@@ -201,13 +230,16 @@ bool ThroughputBenchmark::runCore() {
         //Compute metric for this iteration
         metric_on_iter_[i] = ((static_cast<double>(total_passes) * static_cast<double>(bytes_per_pass)) / static_cast<double>(MB))   /   ((static_cast<double>(avg_adjusted_ticks) * g_ns_per_tick) / 1e9);
 
-        //Clean up workers and threads for this iteration
+        std::vector<double> samples = computeThroughputSamples(workers, 0, num_worker_threads_);
+
+        //Clean up workers for this iteration
         for (uint32_t t = 0; t < num_worker_threads_; t++) {
-            delete worker_threads[t];
             delete workers[t];
         }
-        worker_threads.clear();
         workers.clear();
+
+        if (recordIterationSamples(i, samples))
+            break;
     }
 
     //Stopping power measurement
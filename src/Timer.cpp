@@ -44,31 +44,44 @@
 
 using namespace xmem;
 
-Timer::Timer() :
-    ticks_per_ms_(0),
-    ns_per_tick_(0)
-{   
-
-#if defined(_WIN32) && defined(USE_QPC_TIMER) //special case
-    LARGE_INTEGER freq;
-    BOOL success = QueryPerformanceFrequency(&freq);
-    ticks_per_ms_ = static_cast<tick_t>(freq.QuadPart)/1000;
-#else
-    tick_t start_tick, stop_tick;
-    start_tick = start_timer();
+/**
+ * @brief Reads the OS reference clock used to calibrate hardware timers.
+ * @returns The current time in nanoseconds. On GNU/Linux this is CLOCK_MONOTONIC_RAW, which is not subject to NTP slewing.
+ */
+static double read_reference_clock_ns() {
 #ifdef _WIN32
-    Sleep(BENCHMARK_DURATION_MS);
+    LARGE_INTEGER freq, count;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&count);
+    return static_cast<double>(count.QuadPart) * 1e9 / static_cast<double>(freq.QuadPart);
 #endif
 #ifdef __gnu_linux__
-    struct timespec duration, remainder;
-    duration.tv_sec = BENCHMARK_DURATION_MS / 1000;
-    duration.tv_nsec = (BENCHMARK_DURATION_MS % 1000) * 1e6; 
-    nanosleep(&duration, &remainder);
+    struct timespec tp;
+    clock_gettime(CLOCK_MONOTONIC_RAW, &tp);
+    return static_cast<double>(tp.tv_sec) * 1e9 + static_cast<double>(tp.tv_nsec);
 #endif
-    stop_tick = stop_timer();
-    ticks_per_ms_ = static_cast<tick_t>((stop_tick - start_tick) / BENCHMARK_DURATION_MS);
+}
+
+Timer::Timer() :
+    ticks_per_ms_(0),
+    ns_per_tick_(0),
+    overhead_ticks_(0),
+    resolution_ticks_(0)
+{   
+    if (g_timer_backend == TIMER_OS) { //The OS timer frequency is known, no need to calibrate
+#ifdef USE_QPC_TIMER
+        LARGE_INTEGER freq;
+        QueryPerformanceFrequency(&freq);
+        ticks_per_ms_ = static_cast<tick_t>(freq.QuadPart)/1000;
+#endif
+#ifdef USE_POSIX_TIMER
+        ticks_per_ms_ = 1000000; //clock_gettime() ticks are nanoseconds
 #endif
+    } else
+        calibrateAgainstOsClock();
+
     ns_per_tick_ = 1/(static_cast<float>(ticks_per_ms_)) * static_cast<float>(1e6);
+    measureOverheadAndResolution();
 }
 
 tick_t Timer::getTicksPerMs() {
@@ -78,3 +91,50 @@ tick_t Timer::getTicksPerMs() {
 float Timer::getNsPerTick() {
     return ns_per_tick_;
 }
+
+tick_t Timer::getOverheadTicks() {
+    return overhead_ticks_;
+}
+
+tick_t Timer::getResolutionTicks() {
+    return resolution_ticks_;
+}
+
+void Timer::calibrateAgainstOsClock() {
+    //Bracket each reference clock read with timer reads so that the timer tick matching the reference time can be taken as the midpoint.
+    tick_t before = start_timer();
+    double ref_start_ns = read_reference_clock_ns();
+    tick_t after = start_timer();
+    tick_t start_tick = before + (after - before) / 2;
+
+    double ref_stop_ns = ref_start_ns;
+    while (ref_stop_ns - ref_start_ns < TIMER_CALIBRATION_MS * 1e6) //Busy-wait rather than sleep so the core does not enter a deep idle state
+        ref_stop_ns = read_reference_clock_ns();
+
+    before = stop_timer();
+    ref_stop_ns = read_reference_clock_ns();
+    after = stop_timer();
+    tick_t stop_tick = before + (after - before) / 2;
+
+    ticks_per_ms_ = static_cast<tick_t>(static_cast<double>(stop_tick - start_tick) / ((ref_stop_ns - ref_start_ns) / 1e6) + 0.5);
+}
+
+void Timer::measureOverheadAndResolution() {
+    overhead_ticks_ = static_cast<tick_t>(-1);
+    resolution_ticks_ = static_cast<tick_t>(-1);
+
+    for (uint32_t i = 0; i < TIMER_OVERHEAD_SAMPLES; i++) {
+        tick_t start_tick = start_timer();
+        tick_t stop_tick = stop_timer();
+        if (stop_tick - start_tick < overhead_ticks_)
+            overhead_ticks_ = stop_tick - start_tick;
+
+        //Spin until the timer visibly advances
+        tick_t first_tick = start_timer();
+        tick_t next_tick = first_tick;
+        while (next_tick == first_tick)
+            next_tick = start_timer();
+        if (next_tick - first_tick < resolution_ticks_)
+            resolution_ticks_ = next_tick - first_tick;
+    }
+}
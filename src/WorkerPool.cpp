@@ -0,0 +1,289 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ *
+ * @brief Implementation file for the WorkerPool class.
+ */
+
+//Headers
+#include <WorkerPool.h>
+#include <common.h>
+
+//Libraries
+#include <iostream>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <processthreadsapi.h>
+#endif
+
+#ifdef __gnu_linux__
+#include <unistd.h>
+#endif
+
+using namespace xmem;
+
+/**
+ * @brief Number of busy-wait iterations before an idle thread parks. Keeps back-to-back iterations on the fast path without burning every core while the main thread builds pointer chains or writes results.
+ */
+#define POOL_SPIN_LIMIT 100000
+
+/**
+ * @brief Hints to the CPU that the caller is in a spin-wait loop.
+ */
+static inline void cpu_relax() {
+#if defined(ARCH_INTEL) && !defined(ARCH_INTEL_MIC)
+    _mm_pause();
+#endif
+}
+
+SpinBarrier::SpinBarrier() :
+    num_participants_(0),
+    arrived_(0),
+    generation_(0)
+{
+}
+
+void SpinBarrier::reset(uint32_t num_participants) {
+    num_participants_ = num_participants;
+    arrived_.store(0, std::memory_order_relaxed);
+}
+
+void SpinBarrier::wait() {
+    uint32_t generation = generation_.load(std::memory_order_acquire);
+    if (arrived_.fetch_add(1, std::memory_order_acq_rel) + 1 == num_participants_) {
+        arrived_.store(0, std::memory_order_relaxed);
+        generation_.fetch_add(1, std::memory_order_release); //Last one in opens the gate for everyone
+    } else {
+        while (generation_.load(std::memory_order_acquire) == generation)
+            cpu_relax();
+    }
+}
+
+PoolWorker::PoolWorker(SpinBarrier* barrier, std::mutex* done_mutex, std::condition_variable* done_cv) :
+    Runnable(),
+    barrier_(barrier),
+    done_mutex_(done_mutex),
+    done_cv_(done_cv),
+    park_mutex_(),
+    park_cv_(),
+    job_(NULL),
+    command_(POOL_CMD_IDLE),
+    seq_posted_(0),
+    seq_done_(0),
+    pinned_cpu_(-1)
+{
+}
+
+PoolWorker::~PoolWorker() {
+}
+
+void PoolWorker::post(pool_command_t command, MemoryWorker* job) {
+    job_ = job;
+    command_ = command;
+    seq_posted_.fetch_add(1, std::memory_order_release); //Publishes job_ and command_ to the pooled thread
+
+    //Wake the thread in case it has parked. Taking the lock orders this against the predicate check in run().
+    {
+        std::lock_guard<std::mutex> lock(park_mutex_);
+    }
+    park_cv_.notify_one();
+}
+
+bool PoolWorker::isDone() const {
+    return seq_done_.load(std::memory_order_acquire) == seq_posted_.load(std::memory_order_acquire);
+}
+
+void PoolWorker::run() {
+    //Increase scheduling priority once for the lifetime of the thread
+#ifdef _WIN32
+    DWORD original_priority_class;
+    DWORD original_priority;
+    if (!boost_scheduling_priority(original_priority_class, original_priority))
+#endif
+#ifdef __gnu_linux__
+    if (!boost_scheduling_priority())
+#endif
+        std::cerr << "WARNING: Failed to boost scheduling priority. Perhaps running in Administrator mode would help." << std::endl;
+
+    uint32_t seq_seen = 0;
+    bool exit = false;
+    while (!exit) {
+        //Wait for a new command. Spin first, then park so an idle pool does not starve the main thread.
+        uint32_t spins = 0;
+        while (seq_posted_.load(std::memory_order_acquire) == seq_seen && spins < POOL_SPIN_LIMIT) {
+            cpu_relax();
+            spins++;
+        }
+        if (seq_posted_.load(std::memory_order_acquire) == seq_seen) {
+            std::unique_lock<std::mutex> lock(park_mutex_);
+            park_cv_.wait(lock, [this, seq_seen]{ return seq_posted_.load(std::memory_order_acquire) != seq_seen; });
+        }
+        seq_seen = seq_posted_.load(std::memory_order_acquire);
+
+        MemoryWorker* job = job_;
+        switch (command_) {
+            case POOL_CMD_RUN:
+            case POOL_CMD_RUN_PRIMED:
+                if (job != NULL) {
+                    //Only re-pin when the requested CPU differs from where we already are
+                    int32_t cpu = job->getCPUAffinity();
+                    if (cpu != pinned_cpu_) {
+                        if (lock_thread_to_cpu(cpu))
+                            pinned_cpu_ = cpu;
+                        else {
+                            pinned_cpu_ = -1;
+                            std::cerr << "WARNING: Failed to lock thread to logical CPU " << cpu << "! Results may not be correct." << std::endl;
+                        }
+                    }
+
+                    if (command_ == POOL_CMD_RUN_PRIMED)
+                        job->primeMemory();
+
+                    barrier_->wait(); //All jobs start their timed phase together
+                    job->runKernels();
+                }
+                break;
+            case POOL_CMD_EXIT:
+                exit = true;
+                break;
+            default:
+                break;
+        }
+
+        seq_done_.store(seq_seen, std::memory_order_release);
+        {
+            std::lock_guard<std::mutex> lock(*done_mutex_);
+        }
+        done_cv_->notify_all();
+    }
+
+    //Unset processor affinity
+    if (pinned_cpu_ >= 0)
+        unlock_thread_to_numa_node();
+
+    //Revert thread priority
+#ifdef _WIN32
+    if (!revert_scheduling_priority(original_priority_class, original_priority))
+#endif
+#ifdef __gnu_linux__
+    if (!revert_scheduling_priority())
+#endif
+        std::cerr << "WARNING: Failed to revert scheduling priority. Perhaps running in Administrator mode would help." << std::endl;
+}
+
+WorkerPool::WorkerPool(uint32_t num_threads) :
+    num_threads_(num_threads),
+    running_(false),
+    barrier_(),
+    done_mutex_(),
+    done_cv_(),
+    pool_workers_(),
+    pool_threads_()
+{
+}
+
+WorkerPool::~WorkerPool() {
+    stop();
+}
+
+bool WorkerPool::start() {
+    if (running_)
+        return true;
+
+    for (uint32_t t = 0; t < num_threads_; t++) {
+        pool_workers_.push_back(new PoolWorker(&barrier_, &done_mutex_, &done_cv_));
+        pool_threads_.push_back(new Thread(pool_workers_[t]));
+        if (!pool_threads_[t]->create_and_start()) {
+            std::cerr << "ERROR: Failed to start pooled worker thread " << t << "!" << std::endl;
+            running_ = true; //So that stop() tears down whatever did start
+            num_threads_ = t;
+            stop();
+            return false;
+        }
+    }
+
+    running_ = true;
+    return true;
+}
+
+bool WorkerPool::stop() {
+    bool success = true;
+
+    if (running_) {
+        for (uint32_t t = 0; t < pool_workers_.size(); t++) {
+            if (pool_threads_[t]->started())
+                pool_workers_[t]->post(POOL_CMD_EXIT, NULL);
+        }
+        for (uint32_t t = 0; t < pool_threads_.size(); t++) {
+            if (pool_threads_[t]->started() && !pool_threads_[t]->join()) {
+                std::cerr << "WARNING: A pooled worker thread failed to exit correctly!" << std::endl;
+                success = false;
+            }
+        }
+    }
+
+    for (uint32_t t = 0; t < pool_threads_.size(); t++) {
+        delete pool_threads_[t];
+        delete pool_workers_[t];
+    }
+    pool_threads_.clear();
+    pool_workers_.clear();
+    running_ = false;
+
+    return success;
+}
+
+bool WorkerPool::runWorkers(std::vector<MemoryWorker*>& workers, bool prime_memory) {
+    if (!running_) {
+        std::cerr << "ERROR: Worker pool is not running." << std::endl;
+        return false;
+    }
+
+    if (workers.size() > num_threads_) {
+        std::cerr << "ERROR: Worker pool has " << num_threads_ << " threads but " << workers.size() << " workers were submitted." << std::endl;
+        return false;
+    }
+
+    barrier_.reset(static_cast<uint32_t>(workers.size()));
+
+    pool_command_t command = prime_memory ? POOL_CMD_RUN_PRIMED : POOL_CMD_RUN;
+    for (uint32_t t = 0; t < workers.size(); t++)
+        pool_workers_[t]->post(command, workers[t]);
+
+    //Wait for all jobs to complete. The main thread is not pinned and may share a core with a pooled thread, so it blocks rather than spins.
+    std::unique_lock<std::mutex> lock(done_mutex_);
+    done_cv_.wait(lock, [this, &workers]{
+        for (uint32_t t = 0; t < workers.size(); t++) {
+            if (!pool_workers_[t]->isDone())
+                return false;
+        }
+        return true;
+    });
+
+    return true;
+}
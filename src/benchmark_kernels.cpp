@@ -40,700 +40,276 @@
 //Headers
 #include <benchmark_kernels.h>
 #include <common.h>
+#include <PointerChainBuilder.h>
+#include <Thread.h>
+#include <kernel_intrinsics.h>
+#include <kernel_templates.h>
+#include <jit_kernels.h>
 
 //Libraries
+#include <atomic>
 #include <iostream>
 #include <random>
 #include <algorithm>
-#include <time.h>
-#if defined(ARCH_INTEL) && (defined(HAS_WORD_128) || defined(HAS_WORD_256) || defined(HAS_WORD_512)) 
-//Intel intrinsics
-#include <emmintrin.h>
-#include <immintrin.h>
-#include <smmintrin.h>
-#endif
-
-#if defined(ARCH_ARM) && defined(ARCH_ARM_NEON)
-#include <arm_neon.h>
-#endif
+#include <vector>
 
 using namespace xmem;
 
-#if defined(__gnu_linux__) && defined(ARCH_INTEL)
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64) && defined(HAS_WORD_128)
+WIN_X86_64_ASM_STRIDED_KERNELS(Word128, Sequential, 1)
+WIN_X86_64_ASM_STRIDED_KERNELS(Word128, Stride2, 2)
+WIN_X86_64_ASM_STRIDED_KERNELS(Word128, Stride4, 4)
+WIN_X86_64_ASM_STRIDED_KERNELS(Word128, Stride8, 8)
+WIN_X86_64_ASM_STRIDED_KERNELS(Word128, Stride16, 16)
+#endif
 
+//The scalar and 128-bit kernels are generated here. The wider ones are generated in the translation units built for their ISA.
+template const SequentialKernelEntry* xmem::sequential_kernel_table<Word32_t>(size_t*);
+#ifdef HAS_WORD_64
+template const SequentialKernelEntry* xmem::sequential_kernel_table<Word64_t>(size_t*);
+#endif
 #ifdef HAS_WORD_128
-#define my_32b_set_128b_word(a, b, c, d) _mm_set_epi32(a, b, c, d) //SSE2 intrinsic, corresponds to ??? instruction. Header: emmintrin.h
-#define my_64b_set_128b_word(a, b) _mm_set_epi64x(a, b) //SSE2 intrinsic, corresponds to ??? instruction. Header: emmintrin.h
-#define my_32b_extractLSB_128b(w) _mm_extract_epi32(w, 0) //SSE 4.1 intrinsic, corresponds to "pextrd" instruction. Header: smmintrin.h
-#define my_64b_extractLSB_128b(w) _mm_extract_epi64(w, 0) //SSE 4.1 intrinsic, corresponds to "pextrq" instruction. Header: smmintrin.h
+template const SequentialKernelEntry* xmem::sequential_kernel_table<Word128_t>(size_t*);
 #endif
-
 #ifdef HAS_WORD_256
-#define my_32b_set_256b_word(a, b, c, d, e, f, g, h) _mm256_set_epi32(a, b, c, d, e, f, g, h) //AVX intrinsic, corresponds to ??? (pseudo?) instruction. Header: immintrin.h
-#define my_64b_set_256b_word(a, b, c, d) _mm256_set_epi64x(a, b, c, d) //AVX intrinsic, corresponds to ??? (pseudo?) instruction. Header: immintrin.h
-#define my_32b_extractLSB_256b(w) _mm256_extract_epi32(w, 0) //AVX intrinsic, corresponds to ??? (pseudo?) instruction. Header: immintrin.h
-#define my_64b_extractLSB_256b(w) _mm256_extract_epi64(w, 0) //AVX intrinsic, corresponds to ??? (pseudo?) instruction. Header: immintrin.h
+extern template const SequentialKernelEntry* xmem::sequential_kernel_table<Word256_t>(size_t*);
 #endif
-
-
-#if defined(HAS_WORD_512) 
-
-#if !defined(ARCH_INTEL_MIC) //MIC (Knight's Corner) has partial ISA overlap with AVX-512. Neither are subsets of the other. What a headache. Knight's Corner also doesn't support legacy SSE or AVX stuff... agh!!!
-#define my_32b_set_512b_word(a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p) _mm512_set_epi32(a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p) //AVX-512 intrinsic, corresponds to ??? (pseudo?) instruction. Header: immintrin.h
-#define my_64b_set_512b_word(a, b, c, d, e, f, g, h) _mm512_set_epi64x(a, b, c, d, e, f, g, h) //AVX-512 intrinsic, corresponds to ??? (pseudo?) instruction. Header: immintrin.h
-#ifdef HAS_WORD_128 //Two-step extraction required for AVX-512. First to either 128 or 256-bit word, then down to 32/64 native words. We chose 128-bit words mid-step here.
-#define my_32b_extractLSB_512b(w) _mm_extract_epi32(_mm512_extracti32x4_epi32(w, 0),0) //AVX-512 intrinsic, corresponds to ??? (pseudo?) instruction. Header: immintrin.h
-#define my_64b_extractLSB_512b(w) _mm_extract_epi32(_mm512_extracti64x2_epi64(w, 0),0) //AVX-512 intrinsic, corresponds to ??? (pseudo?) instruction. Header: immintrin.h
+#ifdef HAS_WORD_512
+extern template const SequentialKernelEntry* xmem::sequential_kernel_table<Word512_t>(size_t*);
 #endif
-#else
-//These are hacks to allow me to set a 512-bit word in Knight's Corner using 32-bit or 64-bit packed components. I store them on the stack one piece at a time, then use a 512-bit vector load to get them into a vector register. What a mess. Is there an easier way??
-#define my_32b_set_512b_word(ret, scratchptr, a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p) \
-scratchptr[0] = a;\
-scratchptr[1] = b;\
-scratchptr[2] = c;\
-scratchptr[3] = d;\
-scratchptr[4] = e;\
-scratchptr[5] = f;\
-scratchptr[6] = g;\
-scratchptr[7] = h;\
-scratchptr[8] = i;\
-scratchptr[9] = j;\
-scratchptr[10] = k;\
-scratchptr[11] = l;\
-scratchptr[12] = m;\
-scratchptr[13] = n;\
-scratchptr[14] = o;\
-scratchptr[15] = p;\
-ret = _mm512_load_epi32(scratchptr);
-
-#define my_64b_set_512b_word(ret, scratchptr, a, b, c, d, e, f, g, h) \
-scratchptr[0] = a;\
-scratchptr[1] = b;\
-scratchptr[2] = c;\
-scratchptr[3] = d;\
-scratchptr[4] = e;\
-scratchptr[5] = f;\
-scratchptr[6] = g;\
-scratchptr[7] = h;\
-ret = _mm512_load_epi64(scratchptr);
-
-#define my_32b_extractLSB_512b(ret, scratchptr, w) \
-_mm512_store_epi32(scratchptr, w);\
-ret = scratchptr[0];
-
-#define my_64b_extractLSB_512b(ret, scratchptr, w) \
-_mm512_store_epi64(scratchptr, w);\
-ret = scratchptr[0];
 
+//Mixed read/write random kernels, generated alongside the other kernels of the same word type
+#ifndef HAS_WORD_64 //special case: 32-bit machine
+template int32_t xmem::randomMixed<Word32_t, 1>(uintptr_t*, uintptr_t**, size_t);
+template int32_t xmem::randomMixed<Word32_t, 2>(uintptr_t*, uintptr_t**, size_t);
+template int32_t xmem::randomMixed<Word32_t, 3>(uintptr_t*, uintptr_t**, size_t);
+#else
+template int32_t xmem::randomMixed<Word64_t, 1>(uintptr_t*, uintptr_t**, size_t);
+template int32_t xmem::randomMixed<Word64_t, 2>(uintptr_t*, uintptr_t**, size_t);
+template int32_t xmem::randomMixed<Word64_t, 3>(uintptr_t*, uintptr_t**, size_t);
 #endif
-
+#if !(defined(_WIN32) && defined(ARCH_INTEL_X86_64)) //Like the other wide random kernels, these are not implemented for Windows yet
+#ifdef HAS_WORD_128
+template int32_t xmem::randomMixed<Word128_t, 1>(uintptr_t*, uintptr_t**, size_t);
+template int32_t xmem::randomMixed<Word128_t, 2>(uintptr_t*, uintptr_t**, size_t);
+template int32_t xmem::randomMixed<Word128_t, 3>(uintptr_t*, uintptr_t**, size_t);
 #endif
-
+#ifdef HAS_WORD_256
+extern template int32_t xmem::randomMixed<Word256_t, 1>(uintptr_t*, uintptr_t**, size_t);
+extern template int32_t xmem::randomMixed<Word256_t, 2>(uintptr_t*, uintptr_t**, size_t);
+extern template int32_t xmem::randomMixed<Word256_t, 3>(uintptr_t*, uintptr_t**, size_t);
 #endif
-
-#if defined(ARCH_ARM) && (defined(ARCH_ARM_NEON) || defined(HAS_WORD_128))
-#define my_32b_set_128b_word(a, b) vcombine_u32(a, b)
-#define my_64b_set_128b_word(a, b) vcombine_u64(a, b)
-
-#define my_32b_extractLSB_128b(w) static_cast<uint32_t>(vget_low_u64(w)) //NEON intrinsic, corresponds to "vmov" instruction. Header: arm_neon.h
-#define my_64b_extractLSB_128b(w) vget_low_u64(w) //NEON intrinsic, corresponds to "vmov" instruction. Header: arm_neon.h
+#ifdef HAS_WORD_512
+extern template int32_t xmem::randomMixed<Word512_t, 1>(uintptr_t*, uintptr_t**, size_t);
+extern template int32_t xmem::randomMixed<Word512_t, 2>(uintptr_t*, uintptr_t**, size_t);
+extern template int32_t xmem::randomMixed<Word512_t, 3>(uintptr_t*, uintptr_t**, size_t);
 #endif
-
-#if defined(HAS_WORD_512) && defined(ARCH_INTEL_MIC)
-#define my_512b_load(p) _mm512_load_epi64(p) //This is needed because I get the compiler error 'error: class "__m512i" has no suitable assignment operator' using icc for Knight's Corner Xeon Phi. Also, I cannot use do a load on a volatile piece of memory. So the 512-bit code may not work...
 #endif
 
+//Used directly to touch memory outside of the benchmarks
+template int32_t xmem::stridedRead<Word32_t, 1>(void*, void*);
+template int32_t xmem::stridedWrite<Word32_t, 1>(void*, void*);
 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-/* Hand-coded assembly functions for the 128-bit and 256-bit benchmark kernels on Windows x86-64 where applicable.
- * These are needed because the VC++ compiler, like gcc, optimizes away the vector instructions unless I use the volatile keyword.
- * But I can't use something like volatile Word256_t* because it is incompatible with _mm_load_si256() with VC++, etc.
- * Then, an alternative is to use inline assembly for Windows. However, the VC++ compiler does not support inline assembly in x86-64!
- * The only remaining choice for this unfortunate circumstance is to use hand-coded assembly on Windows x86-64 builds.
- * In this special case, I implemented the routine as a wrapper around the assembler function.
+/**
+ * @brief Looks up the dispatch table row for a chunk size and stride.
+ * @param chunk_size Access granularity.
+ * @param stride_size Distance between successive accesses.
+ * @returns The row, or NULL if no kernels were generated for this combination.
  */
+static const SequentialKernelEntry* find_sequential_kernels(chunk_size_t chunk_size, int32_t stride_size) {
+    const SequentialKernelEntry* table = NULL;
+    size_t num_entries = 0;
 
-#ifdef HAS_WORD_128
-//128-bit
-extern "C" int32_t win_x86_64_asm_forwSequentialRead_Word128(Word128_t* first_word, Word128_t* last_word);
-extern "C" int32_t win_x86_64_asm_revSequentialRead_Word128(Word128_t* last_word, Word128_t* first_word);
-extern "C" int32_t win_x86_64_asm_forwSequentialWrite_Word128(Word128_t* first_word, Word128_t* last_word);
-extern "C" int32_t win_x86_64_asm_revSequentialWrite_Word128(Word128_t* last_word, Word128_t* first_word); 
-extern "C" int32_t win_x86_64_asm_forwStride2Read_Word128(Word128_t* first_word, Word128_t* last_word);
-extern "C" int32_t win_x86_64_asm_revStride2Read_Word128(Word128_t* first_word, Word128_t* last_word);
-extern "C" int32_t win_x86_64_asm_forwStride2Write_Word128(Word128_t* first_word, Word128_t* last_word);
-extern "C" int32_t win_x86_64_asm_revStride2Write_Word128(Word128_t* first_word, Word128_t* last_word);
-extern "C" int32_t win_x86_64_asm_forwStride4Read_Word128(Word128_t* first_word, Word128_t* last_word);
-extern "C" int32_t win_x86_64_asm_revStride4Read_Word128(Word128_t* first_word, Word128_t* last_word);
-extern "C" int32_t win_x86_64_asm_forwStride4Write_Word128(Word128_t* first_word, Word128_t* last_word);
-extern "C" int32_t win_x86_64_asm_revStride4Write_Word128(Word128_t* first_word, Word128_t* last_word);
-extern "C" int32_t win_x86_64_asm_forwStride8Read_Word128(Word128_t* first_word, Word128_t* last_word);
-extern "C" int32_t win_x86_64_asm_revStride8Read_Word128(Word128_t* first_word, Word128_t* last_word);
-extern "C" int32_t win_x86_64_asm_forwStride8Write_Word128(Word128_t* first_word, Word128_t* last_word);
-extern "C" int32_t win_x86_64_asm_revStride8Write_Word128(Word128_t* first_word, Word128_t* last_word);
-extern "C" int32_t win_x86_64_asm_forwStride16Read_Word128(Word128_t* first_word, Word128_t* last_word);
-extern "C" int32_t win_x86_64_asm_revStride16Read_Word128(Word128_t* first_word, Word128_t* last_word);
-extern "C" int32_t win_x86_64_asm_forwStride16Write_Word128(Word128_t* first_word, Word128_t* last_word);
-extern "C" int32_t win_x86_64_asm_revStride16Write_Word128(Word128_t* first_word, Word128_t* last_word);
+    switch (chunk_size) {
+        case CHUNK_32b:
+            table = sequential_kernel_table<Word32_t>(&num_entries);
+            break;
+#ifdef HAS_WORD_64
+        case CHUNK_64b:
+            table = sequential_kernel_table<Word64_t>(&num_entries);
+            break;
 #endif
-
-#ifdef HAS_WORD_256
-//256-bit
-extern "C" int32_t win_x86_64_asm_forwSequentialRead_Word256(Word256_t* first_word, Word256_t* last_word);
-extern "C" int32_t win_x86_64_asm_revSequentialRead_Word256(Word256_t* last_word, Word256_t* first_word);
-extern "C" int32_t win_x86_64_asm_forwSequentialWrite_Word256(Word256_t* first_word, Word256_t* last_word);
-extern "C" int32_t win_x86_64_asm_revSequentialWrite_Word256(Word256_t* last_word, Word256_t* first_word);
-extern "C" int32_t win_x86_64_asm_forwStride2Read_Word256(Word256_t* first_word, Word256_t* last_word);
-extern "C" int32_t win_x86_64_asm_revStride2Read_Word256(Word256_t* first_word, Word256_t* last_word);
-extern "C" int32_t win_x86_64_asm_forwStride2Write_Word256(Word256_t* first_word, Word256_t* last_word);
-extern "C" int32_t win_x86_64_asm_revStride2Write_Word256(Word256_t* first_word, Word256_t* last_word);
-extern "C" int32_t win_x86_64_asm_forwStride4Read_Word256(Word256_t* first_word, Word256_t* last_word);
-extern "C" int32_t win_x86_64_asm_revStride4Read_Word256(Word256_t* first_word, Word256_t* last_word);
-extern "C" int32_t win_x86_64_asm_forwStride4Write_Word256(Word256_t* first_word, Word256_t* last_word);
-extern "C" int32_t win_x86_64_asm_revStride4Write_Word256(Word256_t* first_word, Word256_t* last_word);
-extern "C" int32_t win_x86_64_asm_forwStride8Read_Word256(Word256_t* first_word, Word256_t* last_word);
-extern "C" int32_t win_x86_64_asm_revStride8Read_Word256(Word256_t* first_word, Word256_t* last_word);
-extern "C" int32_t win_x86_64_asm_forwStride8Write_Word256(Word256_t* first_word, Word256_t* last_word);
-extern "C" int32_t win_x86_64_asm_revStride8Write_Word256(Word256_t* first_word, Word256_t* last_word);
-extern "C" int32_t win_x86_64_asm_forwStride16Read_Word256(Word256_t* first_word, Word256_t* last_word);
-extern "C" int32_t win_x86_64_asm_revStride16Read_Word256(Word256_t* first_word, Word256_t* last_word);
-extern "C" int32_t win_x86_64_asm_forwStride16Write_Word256(Word256_t* first_word, Word256_t* last_word);
-extern "C" int32_t win_x86_64_asm_revStride16Write_Word256(Word256_t* first_word, Word256_t* last_word);
-#endif
-
-//Dummies
 #ifdef HAS_WORD_128
-//128-bit
-extern "C" int32_t win_x86_64_asm_dummy_forwSequentialLoop_Word128(Word128_t* first_word, Word128_t* last_word);
-extern "C" int32_t win_x86_64_asm_dummy_revSequentialLoop_Word128(Word128_t* first_word, Word128_t* last_word); 
-extern "C" int32_t win_x86_64_asm_dummy_forwStride2Loop_Word128(Word128_t* first_word, Word128_t* last_word);
-extern "C" int32_t win_x86_64_asm_dummy_revStride2Loop_Word128(Word128_t* first_word, Word128_t* last_word);
-extern "C" int32_t win_x86_64_asm_dummy_forwStride4Loop_Word128(Word128_t* first_word, Word128_t* last_word);
-extern "C" int32_t win_x86_64_asm_dummy_revStride4Loop_Word128(Word128_t* first_word, Word128_t* last_word);
-extern "C" int32_t win_x86_64_asm_dummy_forwStride8Loop_Word128(Word128_t* first_word, Word128_t* last_word);
-extern "C" int32_t win_x86_64_asm_dummy_revStride8Loop_Word128(Word128_t* first_word, Word128_t* last_word);
-extern "C" int32_t win_x86_64_asm_dummy_forwStride16Loop_Word128(Word128_t* first_word, Word128_t* last_word);
-extern "C" int32_t win_x86_64_asm_dummy_revStride16Loop_Word128(Word128_t* first_word, Word128_t* last_word);
+        case CHUNK_128b:
+            table = sequential_kernel_table<Word128_t>(&num_entries);
+            break;
 #endif
-
 #ifdef HAS_WORD_256
-//256-bit
-extern "C" int32_t win_x86_64_asm_dummy_forwSequentialLoop_Word256(Word256_t* first_word, Word256_t* last_word);
-extern "C" int32_t win_x86_64_asm_dummy_revSequentialLoop_Word256(Word256_t* first_word, Word256_t* last_word);
-extern "C" int32_t win_x86_64_asm_dummy_forwStride2Loop_Word256(Word256_t* first_word, Word256_t* last_word);
-extern "C" int32_t win_x86_64_asm_dummy_revStride2Loop_Word256(Word256_t* first_word, Word256_t* last_word);
-extern "C" int32_t win_x86_64_asm_dummy_forwStride4Loop_Word256(Word256_t* first_word, Word256_t* last_word);
-extern "C" int32_t win_x86_64_asm_dummy_revStride4Loop_Word256(Word256_t* first_word, Word256_t* last_word);
-extern "C" int32_t win_x86_64_asm_dummy_forwStride8Loop_Word256(Word256_t* first_word, Word256_t* last_word);
-extern "C" int32_t win_x86_64_asm_dummy_revStride8Loop_Word256(Word256_t* first_word, Word256_t* last_word);
-extern "C" int32_t win_x86_64_asm_dummy_forwStride16Loop_Word256(Word256_t* first_word, Word256_t* last_word);
-extern "C" int32_t win_x86_64_asm_dummy_revStride16Loop_Word256(Word256_t* first_word, Word256_t* last_word);
+        case CHUNK_256b:
+            table = sequential_kernel_table<Word256_t>(&num_entries);
+            break;
 #endif
+#ifdef HAS_WORD_512
+        case CHUNK_512b:
+            table = sequential_kernel_table<Word512_t>(&num_entries);
+            break;
 #endif
+        default:
+            return NULL;
+    }
 
+    for (size_t i = 0; i < num_entries; i++) {
+        if (table[i].stride == stride_size && table[i].read != NULL)
+            return &table[i];
+    }
+    return NULL;
+}
 
 bool xmem::determine_sequential_kernel(rw_mode_t rw_mode, chunk_size_t chunk_size, int32_t stride_size, SequentialFunction* kernel_function, SequentialFunction* dummy_kernel_function) {
+    if (!chunk_size_supported(chunk_size)) //The kernel exists in the binary but the CPU cannot execute it
+        return false;
+
+#ifdef HAS_JIT_KERNELS
+    if (g_use_jit_kernels && (rw_mode == READ || rw_mode == WRITE || rw_mode == WRITE_NT)) //The mixed read/write kernels are always compiled
+        return jit_sequential_kernel(rw_mode, chunk_size, stride_size, 0, false, kernel_function, dummy_kernel_function);
+#endif
+
+    const SequentialKernelEntry* kernels = find_sequential_kernels(chunk_size, stride_size);
+    if (kernels == NULL)
+        return false;
+
+    SequentialFunction kernel = NULL;
+    SequentialFunction dummy = kernels->dummy;
     switch (rw_mode) {
         case READ:
-            switch (chunk_size) {
-                case CHUNK_32b:
-                    switch (stride_size) {
-                        case 1:
-                            *kernel_function = &forwSequentialRead_Word32;
-                            *dummy_kernel_function = &dummy_forwSequentialLoop_Word32;
-                            return true;
-                        case -1:
-                            *kernel_function = &revSequentialRead_Word32;
-                            *dummy_kernel_function = &dummy_revSequentialLoop_Word32;
-                            return true;
-                        case 2:
-                            *kernel_function = &forwStride2Read_Word32;
-                            *dummy_kernel_function = &dummy_forwStride2Loop_Word32;
-                            return true;
-                        case -2:
-                            *kernel_function = &revStride2Read_Word32;
-                            *dummy_kernel_function = &dummy_revStride2Loop_Word32;
-                            return true;
-                        case 4:
-                            *kernel_function = &forwStride4Read_Word32;
-                            *dummy_kernel_function = &dummy_forwStride4Loop_Word32;
-                            return true;
-                        case -4:
-                            *kernel_function = &revStride4Read_Word32;
-                            *dummy_kernel_function = &dummy_revStride4Loop_Word32;
-                            return true;
-                        case 8:
-                            *kernel_function = &forwStride8Read_Word32;
-                            *dummy_kernel_function = &dummy_forwStride8Loop_Word32;
-                            return true;
-                        case -8:
-                            *kernel_function = &revStride8Read_Word32;
-                            *dummy_kernel_function = &dummy_revStride8Loop_Word32;
-                            return true;
-                        case 16:
-                            *kernel_function = &forwStride16Read_Word32;
-                            *dummy_kernel_function = &dummy_forwStride16Loop_Word32;
-                            return true;
-                        case -16:
-                            *kernel_function = &revStride16Read_Word32;
-                            *dummy_kernel_function = &dummy_revStride16Loop_Word32;
-                            return true;
-                        default:
-                            return false;
-                    }
-                    return true;
-#ifdef HAS_WORD_64
-                case CHUNK_64b:
-                    switch (stride_size) {
-                        case 1:
-                            *kernel_function = &forwSequentialRead_Word64;
-                            *dummy_kernel_function = &dummy_forwSequentialLoop_Word64;
-                            return true;
-                        case -1:
-                            *kernel_function = &revSequentialRead_Word64;
-                            *dummy_kernel_function = &dummy_revSequentialLoop_Word64;
-                            return true;
-                        case 2:
-                            *kernel_function = &forwStride2Read_Word64;
-                            *dummy_kernel_function = &dummy_forwStride2Loop_Word64;
-                            return true;
-                        case -2:
-                            *kernel_function = &revStride2Read_Word64;
-                            *dummy_kernel_function = &dummy_revStride2Loop_Word64;
-                            return true;
-                        case 4:
-                            *kernel_function = &forwStride4Read_Word64;
-                            *dummy_kernel_function = &dummy_forwStride4Loop_Word64;
-                            return true;
-                        case -4:
-                            *kernel_function = &revStride4Read_Word64;
-                            *dummy_kernel_function = &dummy_revStride4Loop_Word64;
-                            return true;
-                        case 8:
-                            *kernel_function = &forwStride8Read_Word64;
-                            *dummy_kernel_function = &dummy_forwStride8Loop_Word64;
-                            return true;
-                        case -8:
-                            *kernel_function = &revStride8Read_Word64;
-                            *dummy_kernel_function = &dummy_revStride8Loop_Word64;
-                            return true;
-                        case 16:
-                            *kernel_function = &forwStride16Read_Word64;
-                            *dummy_kernel_function = &dummy_forwStride16Loop_Word64;
-                            return true;
-                        case -16:
-                            *kernel_function = &revStride16Read_Word64;
-                            *dummy_kernel_function = &dummy_revStride16Loop_Word64;
-                            return true;
-                        default:
-                            return false;
-                    }
-                    return true;
-#endif
-#ifdef HAS_WORD_128
-                case CHUNK_128b:
-                    switch (stride_size) {
-                        case 1:
-                            *kernel_function = &forwSequentialRead_Word128;
-                            *dummy_kernel_function = &dummy_forwSequentialLoop_Word128;
-                            return true;
-                        case -1:
-                            *kernel_function = &revSequentialRead_Word128;
-                            *dummy_kernel_function = &dummy_revSequentialLoop_Word128;
-                            return true;
-                        case 2:
-                            *kernel_function = &forwStride2Read_Word128;
-                            *dummy_kernel_function = &dummy_forwStride2Loop_Word128;
-                            return true;
-                        case -2:
-                            *kernel_function = &revStride2Read_Word128;
-                            *dummy_kernel_function = &dummy_revStride2Loop_Word128;
-                            return true;
-                        case 4:
-                            *kernel_function = &forwStride4Read_Word128;
-                            *dummy_kernel_function = &dummy_forwStride4Loop_Word128;
-                            return true;
-                        case -4:
-                            *kernel_function = &revStride4Read_Word128;
-                            *dummy_kernel_function = &dummy_revStride4Loop_Word128;
-                            return true;
-                        case 8:
-                            *kernel_function = &forwStride8Read_Word128;
-                            *dummy_kernel_function = &dummy_forwStride8Loop_Word128;
-                            return true;
-                        case -8:
-                            *kernel_function = &revStride8Read_Word128;
-                            *dummy_kernel_function = &dummy_revStride8Loop_Word128;
-                            return true;
-                        case 16:
-                            *kernel_function = &forwStride16Read_Word128;
-                            *dummy_kernel_function = &dummy_forwStride16Loop_Word128;
-                            return true;
-                        case -16:
-                            *kernel_function = &revStride16Read_Word128;
-                            *dummy_kernel_function = &dummy_revStride16Loop_Word128;
-                            return true;
-                        default:
-                            return false;
-                    }
-                    return true;
-#endif
-#ifdef HAS_WORD_256
-                case CHUNK_256b:
-                    switch (stride_size) {
-                        case 1:
-                            *kernel_function = &forwSequentialRead_Word256;
-                            *dummy_kernel_function = &dummy_forwSequentialLoop_Word256;
-                            return true;
-                        case -1:
-                            *kernel_function = &revSequentialRead_Word256;
-                            *dummy_kernel_function = &dummy_revSequentialLoop_Word256;
-                            return true;
-                        case 2:
-                            *kernel_function = &forwStride2Read_Word256;
-                            *dummy_kernel_function = &dummy_forwStride2Loop_Word256;
-                            return true;
-                        case -2:
-                            *kernel_function = &revStride2Read_Word256;
-                            *dummy_kernel_function = &dummy_revStride2Loop_Word256;
-                            return true;
-                        case 4:
-                            *kernel_function = &forwStride4Read_Word256;
-                            *dummy_kernel_function = &dummy_forwStride4Loop_Word256;
-                            return true;
-                        case -4:
-                            *kernel_function = &revStride4Read_Word256;
-                            *dummy_kernel_function = &dummy_revStride4Loop_Word256;
-                            return true;
-                        case 8:
-                            *kernel_function = &forwStride8Read_Word256;
-                            *dummy_kernel_function = &dummy_forwStride8Loop_Word256;
-                            return true;
-                        case -8:
-                            *kernel_function = &revStride8Read_Word256;
-                            *dummy_kernel_function = &dummy_revStride8Loop_Word256;
-                            return true;
-                        case 16:
-                            *kernel_function = &forwStride16Read_Word256;
-                            *dummy_kernel_function = &dummy_forwStride16Loop_Word256;
-                            return true;
-                        case -16:
-                            *kernel_function = &revStride16Read_Word256;
-                            *dummy_kernel_function = &dummy_revStride16Loop_Word256;
-                            return true;
-                        default:
-                            return false;
-                    }
-                    return true;
-#endif
-#ifdef HAS_WORD_512
-                case CHUNK_512b:
-                    switch (stride_size) {
-                        case 1:
-                            *kernel_function = &forwSequentialRead_Word512;
-                            *dummy_kernel_function = &dummy_forwSequentialLoop_Word512;
-                            return true;
-                        case -1:
-                            *kernel_function = &revSequentialRead_Word512;
-                            *dummy_kernel_function = &dummy_revSequentialLoop_Word512;
-                            return true;
-                        case 2:
-                            *kernel_function = &forwStride2Read_Word512;
-                            *dummy_kernel_function = &dummy_forwStride2Loop_Word512;
-                            return true;
-                        case -2:
-                            *kernel_function = &revStride2Read_Word512;
-                            *dummy_kernel_function = &dummy_revStride2Loop_Word512;
-                            return true;
-                        case 4:
-                            *kernel_function = &forwStride4Read_Word512;
-                            *dummy_kernel_function = &dummy_forwStride4Loop_Word512;
-                            return true;
-                        case -4:
-                            *kernel_function = &revStride4Read_Word512;
-                            *dummy_kernel_function = &dummy_revStride4Loop_Word512;
-                            return true;
-                        case 8:
-                            *kernel_function = &forwStride8Read_Word512;
-                            *dummy_kernel_function = &dummy_forwStride8Loop_Word512;
-                            return true;
-                        case -8:
-                            *kernel_function = &revStride8Read_Word512;
-                            *dummy_kernel_function = &dummy_revStride8Loop_Word512;
-                            return true;
-                        case 16:
-                            *kernel_function = &forwStride16Read_Word512;
-                            *dummy_kernel_function = &dummy_forwStride16Loop_Word512;
-                            return true;
-                        case -16:
-                            *kernel_function = &revStride16Read_Word512;
-                            *dummy_kernel_function = &dummy_revStride16Loop_Word512;
-                            return true;
-                        default:
-                            return false;
-                    }
-                    return true;
+            kernel = kernels->read;
+            break;
+        case WRITE:
+            kernel = kernels->write;
+            break;
+        case WRITE_NT:
+            kernel = kernels->write_nt;
+            break;
+        case READ_WRITE_1_1:
+        case READ_WRITE_2_1:
+        case READ_WRITE_3_1:
+            kernel = kernels->mixed[rw_mode_reads_per_write(rw_mode)-1];
+            dummy = kernels->mixed_dummy[rw_mode_reads_per_write(rw_mode)-1];
+            break;
+        case READ_MODIFY_WRITE:
+            kernel = kernels->read_modify_write;
+            break;
+        default:
+            break;
+    }
+    if (kernel == NULL)
+        return false;
+
+    *kernel_function = kernel;
+    *dummy_kernel_function = dummy;
+    return true;
+}
+
+bool xmem::determine_sequential_prefetch_kernel(chunk_size_t chunk_size, int32_t stride_size, SequentialFunction* kernel_function, SequentialFunction* dummy_kernel_function) {
+    if (!chunk_size_supported(chunk_size))
+        return false;
+
+#ifdef HAS_JIT_KERNELS
+    if (g_use_jit_kernels)
+        return jit_sequential_kernel(READ, chunk_size, stride_size, 0, true, kernel_function, dummy_kernel_function);
 #endif
 
-                default:
-                    return false;
-            }
-            return true;
+    const SequentialKernelEntry* kernels = find_sequential_kernels(chunk_size, stride_size);
+    if (kernels == NULL || kernels->read_prefetch == NULL)
+        return false;
 
-        case WRITE:
-            switch (chunk_size) {
-                case CHUNK_32b:
-                    switch (stride_size) {
-                        case 1:
-                            *kernel_function = &forwSequentialWrite_Word32;
-                            *dummy_kernel_function = &dummy_forwSequentialLoop_Word32;
-                            return true;
-                        case -1:
-                            *kernel_function = &revSequentialWrite_Word32;
-                            *dummy_kernel_function = &dummy_revSequentialLoop_Word32;
-                            return true;
-                        case 2:
-                            *kernel_function = &forwStride2Write_Word32;
-                            *dummy_kernel_function = &dummy_forwStride2Loop_Word32;
-                            return true;
-                        case -2:
-                            *kernel_function = &revStride2Write_Word32;
-                            *dummy_kernel_function = &dummy_revStride2Loop_Word32;
-                            return true;
-                        case 4:
-                            *kernel_function = &forwStride4Write_Word32;
-                            *dummy_kernel_function = &dummy_forwStride4Loop_Word32;
-                            return true;
-                        case -4:
-                            *kernel_function = &revStride4Write_Word32;
-                            *dummy_kernel_function = &dummy_revStride4Loop_Word32;
-                            return true;
-                        case 8:
-                            *kernel_function = &forwStride8Write_Word32;
-                            *dummy_kernel_function = &dummy_forwStride8Loop_Word32;
-                            return true;
-                        case -8:
-                            *kernel_function = &revStride8Write_Word32;
-                            *dummy_kernel_function = &dummy_revStride8Loop_Word32;
-                            return true;
-                        case 16:
-                            *kernel_function = &forwStride16Write_Word32;
-                            *dummy_kernel_function = &dummy_forwStride16Loop_Word32;
-                            return true;
-                        case -16:
-                            *kernel_function = &revStride16Write_Word32;
-                            *dummy_kernel_function = &dummy_revStride16Loop_Word32;
-                            return true;
-                        default:
-                            return false;
-                    }
-                    return true;
+    *kernel_function = kernels->read_prefetch;
+    *dummy_kernel_function = kernels->dummy;
+    return true;
+}
+
+std::vector<int32_t> xmem::sequential_kernel_strides(chunk_size_t chunk_size) {
+    std::vector<int32_t> strides;
+    size_t num_entries = 0;
+    const SequentialKernelEntry* table = sequential_kernel_table<Word32_t>(&num_entries); //Every chunk size lists the same strides
+
+    for (size_t i = 0; i < num_entries; i++) {
+        if (find_sequential_kernels(chunk_size, table[i].stride) != NULL)
+            strides.push_back(table[i].stride);
+    }
+    return strides;
+}
+
+size_t xmem::sequential_pass_span(int32_t stride_size) {
+    size_t step = static_cast<size_t>(stride_size < 0 ? -static_cast<int64_t>(stride_size) : stride_size);
+    return THROUGHPUT_BENCHMARK_BYTES_PER_PASS * step;
+}
+
+/**
+ * @brief Gets a mixed read/write random kernel of one word type.
+ * @tparam WordT The chunk type.
+ * @param reads Loads per store, from 1 to 3.
+ * @returns The kernel.
+ */
+template <typename WordT>
+static RandomFunction random_mixed_kernel(uint32_t reads) {
+    switch (reads) {
+        case 1:
+            return &randomMixed<WordT, 1>;
+        case 2:
+            return &randomMixed<WordT, 2>;
+        default:
+            return &randomMixed<WordT, 3>;
+    }
+}
+
+/**
+ * @brief Looks up the mixed read/write random kernel for a ratio and chunk size.
+ * @param reads Loads per store, from 1 to 3.
+ * @param chunk_size Access granularity.
+ * @param kernel_function Set to the kernel.
+ * @param dummy_kernel_function Set to the matching dummy kernel.
+ * @returns True if there is a kernel for this chunk size.
+ */
+static bool determine_random_mixed_kernel(uint32_t reads, chunk_size_t chunk_size, RandomFunction* kernel_function, RandomFunction* dummy_kernel_function) {
+    switch (chunk_size) {
+        //special case on 32-bit architectures only.
+#ifndef HAS_WORD_64
+        case CHUNK_32b:
+            *kernel_function = random_mixed_kernel<Word32_t>(reads);
+            *dummy_kernel_function = &dummy_randomLoop_Word32;
+            return true;
+#endif
 #ifdef HAS_WORD_64
-                case CHUNK_64b:
-                    switch (stride_size) {
-                        case 1:
-                            *kernel_function = &forwSequentialWrite_Word64;
-                            *dummy_kernel_function = &dummy_forwSequentialLoop_Word64;
-                            return true;
-                        case -1:
-                            *kernel_function = &revSequentialWrite_Word64;
-                            *dummy_kernel_function = &dummy_revSequentialLoop_Word64;
-                            return true;
-                        case 2:
-                            *kernel_function = &forwStride2Write_Word64;
-                            *dummy_kernel_function = &dummy_forwStride2Loop_Word64;
-                            return true;
-                        case -2:
-                            *kernel_function = &revStride2Write_Word64;
-                            *dummy_kernel_function = &dummy_revStride2Loop_Word64;
-                            return true;
-                        case 4:
-                            *kernel_function = &forwStride4Write_Word64;
-                            *dummy_kernel_function = &dummy_forwStride4Loop_Word64;
-                            return true;
-                        case -4:
-                            *kernel_function = &revStride4Write_Word64;
-                            *dummy_kernel_function = &dummy_revStride4Loop_Word64;
-                            return true;
-                        case 8:
-                            *kernel_function = &forwStride8Write_Word64;
-                            *dummy_kernel_function = &dummy_forwStride8Loop_Word64;
-                            return true;
-                        case -8:
-                            *kernel_function = &revStride8Write_Word64;
-                            *dummy_kernel_function = &dummy_revStride8Loop_Word64;
-                            return true;
-                        case 16:
-                            *kernel_function = &forwStride16Write_Word64;
-                            *dummy_kernel_function = &dummy_forwStride16Loop_Word64;
-                            return true;
-                        case -16:
-                            *kernel_function = &revStride16Write_Word64;
-                            *dummy_kernel_function = &dummy_revStride16Loop_Word64;
-                            return true;
-                        default:
-                            return false;
-                    }
-                    return true;
+        case CHUNK_64b:
+            *kernel_function = random_mixed_kernel<Word64_t>(reads);
+            *dummy_kernel_function = &dummy_randomLoop_Word64;
+            return true;
 #endif
+#if !(defined(_WIN32) && defined(ARCH_INTEL_X86_64))
 #ifdef HAS_WORD_128
-                case CHUNK_128b:
-                    switch (stride_size) {
-                        case 1:
-                            *kernel_function = &forwSequentialWrite_Word128;
-                            *dummy_kernel_function = &dummy_forwSequentialLoop_Word128;
-                            return true;
-                        case -1:
-                            *kernel_function = &revSequentialWrite_Word128;
-                            *dummy_kernel_function = &dummy_revSequentialLoop_Word128;
-                            return true;
-                        case 2:
-                            *kernel_function = &forwStride2Write_Word128;
-                            *dummy_kernel_function = &dummy_forwStride2Loop_Word128;
-                            return true;
-                        case -2:
-                            *kernel_function = &revStride2Write_Word128;
-                            *dummy_kernel_function = &dummy_revStride2Loop_Word128;
-                            return true;
-                        case 4:
-                            *kernel_function = &forwStride4Write_Word128;
-                            *dummy_kernel_function = &dummy_forwStride4Loop_Word128;
-                            return true;
-                        case -4:
-                            *kernel_function = &revStride4Write_Word128;
-                            *dummy_kernel_function = &dummy_revStride4Loop_Word128;
-                            return true;
-                        case 8:
-                            *kernel_function = &forwStride8Write_Word128;
-                            *dummy_kernel_function = &dummy_forwStride8Loop_Word128;
-                            return true;
-                        case -8:
-                            *kernel_function = &revStride8Write_Word128;
-                            *dummy_kernel_function = &dummy_revStride8Loop_Word128;
-                            return true;
-                        case 16:
-                            *kernel_function = &forwStride16Write_Word128;
-                            *dummy_kernel_function = &dummy_forwStride16Loop_Word128;
-                            return true;
-                        case -16:
-                            *kernel_function = &revStride16Write_Word128;
-                            *dummy_kernel_function = &dummy_revStride16Loop_Word128;
-                            return true;
-                        default:
-                            return false;
-                    }
-                    return true;
+        case CHUNK_128b:
+            *kernel_function = random_mixed_kernel<Word128_t>(reads);
+            *dummy_kernel_function = &dummy_randomLoop_Word128;
+            return true;
 #endif
 #ifdef HAS_WORD_256
-                case CHUNK_256b:
-                    switch (stride_size) {
-                        case 1:
-                            *kernel_function = &forwSequentialWrite_Word256;
-                            *dummy_kernel_function = &dummy_forwSequentialLoop_Word256;
-                            return true;
-                        case -1:
-                            *kernel_function = &revSequentialWrite_Word256;
-                            *dummy_kernel_function = &dummy_revSequentialLoop_Word256;
-                            return true;
-                        case 2:
-                            *kernel_function = &forwStride2Write_Word256;
-                            *dummy_kernel_function = &dummy_forwStride2Loop_Word256;
-                            return true;
-                        case -2:
-                            *kernel_function = &revStride2Write_Word256;
-                            *dummy_kernel_function = &dummy_revStride2Loop_Word256;
-                            return true;
-                        case 4:
-                            *kernel_function = &forwStride4Write_Word256;
-                            *dummy_kernel_function = &dummy_forwStride4Loop_Word256;
-                            return true;
-                        case -4:
-                            *kernel_function = &revStride4Write_Word256;
-                            *dummy_kernel_function = &dummy_revStride4Loop_Word256;
-                            return true;
-                        case 8:
-                            *kernel_function = &forwStride8Write_Word256;
-                            *dummy_kernel_function = &dummy_forwStride8Loop_Word256;
-                            return true;
-                        case -8:
-                            *kernel_function = &revStride8Write_Word256;
-                            *dummy_kernel_function = &dummy_revStride8Loop_Word256;
-                            return true;
-                        case 16:
-                            *kernel_function = &forwStride16Write_Word256;
-                            *dummy_kernel_function = &dummy_forwStride16Loop_Word256;
-                            return true;
-                        case -16:
-                            *kernel_function = &revStride16Write_Word256;
-                            *dummy_kernel_function = &dummy_revStride16Loop_Word256;
-                            return true;
-                        default:
-                            return false;
-                    }
-                    return true;
+        case CHUNK_256b:
+            *kernel_function = random_mixed_kernel<Word256_t>(reads);
+            *dummy_kernel_function = &dummy_randomLoop_Word256;
+            return true;
 #endif
 #ifdef HAS_WORD_512
-                case CHUNK_512b:
-                    switch (stride_size) {
-                        case 1:
-                            *kernel_function = &forwSequentialWrite_Word512;
-                            *dummy_kernel_function = &dummy_forwSequentialLoop_Word512;
-                            return true;
-                        case -1:
-                            *kernel_function = &revSequentialWrite_Word512;
-                            *dummy_kernel_function = &dummy_revSequentialLoop_Word512;
-                            return true;
-                        case 2:
-                            *kernel_function = &forwStride2Write_Word512;
-                            *dummy_kernel_function = &dummy_forwStride2Loop_Word512;
-                            return true;
-                        case -2:
-                            *kernel_function = &revStride2Write_Word512;
-                            *dummy_kernel_function = &dummy_revStride2Loop_Word512;
-                            return true;
-                        case 4:
-                            *kernel_function = &forwStride4Write_Word512;
-                            *dummy_kernel_function = &dummy_forwStride4Loop_Word512;
-                            return true;
-                        case -4:
-                            *kernel_function = &revStride4Write_Word512;
-                            *dummy_kernel_function = &dummy_revStride4Loop_Word512;
-                            return true;
-                        case 8:
-                            *kernel_function = &forwStride8Write_Word512;
-                            *dummy_kernel_function = &dummy_forwStride8Loop_Word512;
-                            return true;
-                        case -8:
-                            *kernel_function = &revStride8Write_Word512;
-                            *dummy_kernel_function = &dummy_revStride8Loop_Word512;
-                            return true;
-                        case 16:
-                            *kernel_function = &forwStride16Write_Word512;
-                            *dummy_kernel_function = &dummy_forwStride16Loop_Word512;
-                            return true;
-                        case -16:
-                            *kernel_function = &revStride16Write_Word512;
-                            *dummy_kernel_function = &dummy_revStride16Loop_Word512;
-                            return true;
-                        default:
-                            return false;
-                    }
-                    return true;
-#endif
-
-                default:
-                    return false;
-            }
+        case CHUNK_512b:
+            *kernel_function = random_mixed_kernel<Word512_t>(reads);
+            *dummy_kernel_function = &dummy_randomLoop_Word512;
             return true;
-
+#endif
+#endif
         default:
             return false;
     }
-
-    return false; //shouldn't reach this point
 }
-    
+
 bool xmem::determine_random_kernel(rw_mode_t rw_mode, chunk_size_t chunk_size, RandomFunction* kernel_function, RandomFunction* dummy_kernel_function) {
+    if (!chunk_size_supported(chunk_size))
+        return false;
+
+#ifdef HAS_JIT_KERNELS
+    if (g_use_jit_kernels && jit_random_kernel(rw_mode == READ_MODIFY_WRITE ? WRITE : rw_mode, chunk_size, 0, kernel_function, dummy_kernel_function))
+        return true; //Other chunk sizes use the compiled kernels
+#endif
+
     switch (rw_mode) {
         case READ:
             switch (chunk_size) {
@@ -774,6 +350,7 @@ bool xmem::determine_random_kernel(rw_mode_t rw_mode, chunk_size_t chunk_size, R
             return true;
 
         case WRITE:
+        case READ_MODIFY_WRITE: //Random writes already store back the chunk they load
             switch (chunk_size) {
                 //special case on 32-bit architectures only.
 #ifndef HAS_WORD_64
@@ -811,6 +388,11 @@ bool xmem::determine_random_kernel(rw_mode_t rw_mode, chunk_size_t chunk_size, R
             }
             return true;
 
+        case READ_WRITE_1_1:
+        case READ_WRITE_2_1:
+        case READ_WRITE_3_1:
+            return determine_random_mixed_kernel(rw_mode_reads_per_write(rw_mode), chunk_size, kernel_function, dummy_kernel_function);
+
         default:
             return false;
     }
@@ -818,37 +400,198 @@ bool xmem::determine_random_kernel(rw_mode_t rw_mode, chunk_size_t chunk_size, R
     return false;
 }
 
-bool xmem::build_random_pointer_permutation(void* start_address, void* end_address, chunk_size_t chunk_size) {
+bool xmem::determine_interleaved_chase_kernel(uint32_t chains, RandomFunction* kernel_function, RandomFunction* dummy_kernel_function) {
+    switch (chains) {
+        case 1:
+            *kernel_function = &chasePointers;
+            break;
+        case 2:
+            *kernel_function = &chaseInterleavedPointers<2>;
+            break;
+        case 4:
+            *kernel_function = &chaseInterleavedPointers<4>;
+            break;
+        case 8:
+            *kernel_function = &chaseInterleavedPointers<8>;
+            break;
+        case 16:
+            *kernel_function = &chaseInterleavedPointers<16>;
+            break;
+        case 32:
+            *kernel_function = &chaseInterleavedPointers<32>;
+            break;
+        default:
+            return false;
+    }
+    *dummy_kernel_function = &dummy_chasePointers;
+    return true;
+}
+
+bool xmem::determine_contention_kernel(contention_op_t op, ContentionFunction* kernel_function, ContentionFunction* dummy_kernel_function) {
+    switch (op) {
+        case CONTENTION_XADD:
+            *kernel_function = &contentionXadd;
+            break;
+        case CONTENTION_CMPXCHG:
+            *kernel_function = &contentionCmpxchg;
+            break;
+        case CONTENTION_XCHG:
+            *kernel_function = &contentionXchg;
+            break;
+        case CONTENTION_STORE:
+            *kernel_function = &contentionStore;
+            break;
+        case CONTENTION_INCREMENT:
+            *kernel_function = &contentionIncrement;
+            break;
+        default:
+            return false;
+    }
+    *dummy_kernel_function = &dummy_contentionLoop;
+    return true;
+}
+
+bool xmem::determine_independent_random_kernel(rw_mode_t rw_mode, chunk_size_t chunk_size, IndependentRandomFunction* kernel_function, IndependentRandomFunction* dummy_kernel_function) {
+    IndependentRandomFunction kernel = NULL;
+
+    switch (chunk_size) {
+        case CHUNK_32b:
+            if (rw_mode == READ)
+                kernel = &independentRead_Word32;
+            else if (rw_mode == WRITE)
+                kernel = &independentUpdate_Word32;
+#ifdef HAS_NT_STORES
+            else if (rw_mode == WRITE_NT)
+                kernel = &independentWriteNT_Word32;
+#endif
+            break;
+#ifdef HAS_WORD_64
+        case CHUNK_64b:
+            if (rw_mode == READ)
+                kernel = &independentRead_Word64;
+            else if (rw_mode == WRITE)
+                kernel = &independentUpdate_Word64;
+#ifdef HAS_NT_STORES
+            else if (rw_mode == WRITE_NT)
+                kernel = &independentWriteNT_Word64;
+#endif
+            break;
+#endif
+#ifdef HAS_GATHER_KERNELS
+        //AVX2 has gathers but no scatters, so the 128-bit and 256-bit chunks are read-only
+        case CHUNK_128b:
+            if (!g_cpu_has_avx2)
+                return false;
+            if (rw_mode == READ)
+                kernel = &independentRead_Word128;
+            break;
+        case CHUNK_256b:
+            if (!g_cpu_has_avx2)
+                return false;
+            if (rw_mode == READ)
+                kernel = &independentRead_Word256;
+            break;
+        case CHUNK_512b:
+            if (!g_cpu_has_avx512f)
+                return false;
+            if (rw_mode == READ)
+                kernel = &independentRead_Word512;
+            else if (rw_mode == WRITE)
+                kernel = &independentUpdate_Word512;
+            break;
+#endif
+        default:
+            break;
+    }
+
+    if (kernel == NULL)
+        return false;
+
+    *kernel_function = kernel;
+    *dummy_kernel_function = &dummy_independentLoop;
+    return true;
+}
+
+void xmem::seed_random_streams(uint64_t seed, uint64_t* streams) {
+    //SplitMix64 spreads consecutive seeds over the whole state space, as recommended for seeding xorshift generators
+    for (uint32_t i = 0; i < RANDOM_STREAMS; i++) {
+        uint64_t z = seed + (i+1) * 0x9E3779B97F4A7C15ULL;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        z ^= z >> 31;
+        streams[i] = z != 0 ? z : 1; //xorshift never leaves the all-zero state
+    }
+}
+
+size_t xmem::independent_random_table_length(size_t len) {
+    size_t table_len = 1;
+    while (table_len <= len / 2)
+        table_len *= 2;
+    return table_len;
+}
+
+/**
+ * @brief Runs one step of pointer chain construction on all builders. A single builder runs on the calling thread.
+ * @param builders The builders.
+ * @param phase The step to perform.
+ * @returns True if every builder thread completed.
+ */
+static bool run_pointer_chain_builders(std::vector<PointerChainBuilder*>& builders, chain_build_phase_t phase) {
+    for (auto it = builders.begin(); it != builders.end(); it++)
+        (*it)->setPhase(phase);
+
+    if (builders.size() == 1) {
+        builders[0]->run();
+        return true;
+    }
+
+    std::vector<Thread*> threads;
+    bool success = true;
+    for (auto it = builders.begin(); it != builders.end(); it++) {
+        Thread* thread = new Thread(*it);
+        if (!thread->create_and_start())
+            success = false;
+        threads.push_back(thread);
+    }
+    for (auto it = threads.begin(); it != threads.end(); it++) {
+        if (!(*it)->join())
+            success = false;
+        delete *it;
+    }
+    return success;
+}
+
+bool xmem::build_random_pointer_permutation(void* start_address, void* end_address, chunk_size_t chunk_size, chain_granularity_t granularity, bool random_offsets, uint64_t seed, uint32_t numa_node) {
     if (g_verbose)
         std::cout << "Preparing a memory region under test. This might take a while...";
 
     size_t length = reinterpret_cast<uint8_t*>(end_address) - reinterpret_cast<uint8_t*>(start_address); //length of region in bytes
-    size_t num_pointers = 0; //Number of pointers that fit into the memory region of interest
+    size_t chunk_bytes = 0; //Size of the word read at each node of the chain
     switch (chunk_size) {
         //special case on 32-bit architectures only.
 #ifndef HAS_WORD_64
         case CHUNK_32b:
-            num_pointers = length / sizeof(Word32_t);
+            chunk_bytes = sizeof(Word32_t);
             break;
 #endif
 #ifdef HAS_WORD_64
         case CHUNK_64b:
-            num_pointers = length / sizeof(Word64_t);
+            chunk_bytes = sizeof(Word64_t);
             break;
 #endif
 #ifdef HAS_WORD_128
         case CHUNK_128b:
-            num_pointers = length / sizeof(Word128_t);
+            chunk_bytes = sizeof(Word128_t);
             break;
 #endif
 #ifdef HAS_WORD_256
         case CHUNK_256b:
-            num_pointers = length / sizeof(Word256_t);
+            chunk_bytes = sizeof(Word256_t);
             break;
 #endif
 #ifdef HAS_WORD_512
         case CHUNK_512b:
-            num_pointers = length / sizeof(Word512_t);
+            chunk_bytes = sizeof(Word512_t);
             break;
 #endif
         default:
@@ -863,109 +606,83 @@ bool xmem::build_random_pointer_permutation(void* start_address, void* end_addre
             << "bits for building a random pointer permutation. This should not have happened." << std::endl;
             return false;
     }
-            
-    std::mt19937_64 gen(time(NULL)); //Mersenne Twister random number generator, seeded at current time
-    
-    //Do a random shuffle of memory pointers. 
-    //I had originally used a random Hamiltonian Cycle generator, but this was much slower and aside from
-    //rare instances, did not make any difference in random-access performance measurement.
-#ifdef HAS_WORD_64
-    Word64_t* mem_region_base = reinterpret_cast<Word64_t*>(start_address);
-#else //special case for 32-bit architectures
-    Word32_t* mem_region_base = reinterpret_cast<Word32_t*>(start_address);
-#endif
-    switch (chunk_size) {
-#ifdef HAS_WORD_64
-        case CHUNK_64b:
-            for (size_t i = 0; i < num_pointers; i++) { //Initialize pointers to point at themselves (identity mapping)
-                mem_region_base[i] = reinterpret_cast<Word64_t>(mem_region_base+i);
-            }
-            std::shuffle(mem_region_base, mem_region_base + num_pointers, gen);
-            break;
-#else //special case for 32-bit architectures
-        case CHUNK_32b:
-            for (size_t i = 0; i < num_pointers; i++) { //Initialize pointers to point at themselves (identity mapping)
-                mem_region_base[i] = reinterpret_cast<Word32_t>(mem_region_base+i);
-            }
-            std::shuffle(mem_region_base, mem_region_base + num_pointers, gen);
-            break;
-#endif
-#ifdef HAS_WORD_128
-        case CHUNK_128b:
-            for (size_t i = 0; i < num_pointers; i++) { //Initialize pointers to point at themselves (identity mapping)
-#ifdef HAS_WORD_64
-                mem_region_base[i*2] = reinterpret_cast<Word64_t>(mem_region_base+(i*2));
-                mem_region_base[(i*2)+1] = 0xFFFFFFFFFFFFFFFF; //1-fill upper 64 bits
-#else //special case for 32-bit architectures
-                mem_region_base[i*4] = reinterpret_cast<Word32_t>(mem_region_base+(i*4));
-                mem_region_base[(i*4)+1] = 0xFFFFFFFF; //1-fill upper 96 bits
-                mem_region_base[(i*4)+2] = 0xFFFFFFFF; 
-                mem_region_base[(i*4)+3] = 0xFFFFFFFF; 
-#endif
-            }
-            std::shuffle(reinterpret_cast<Word128_t*>(mem_region_base), reinterpret_cast<Word128_t*>(mem_region_base) + num_pointers, gen);
+
+    size_t node_size = chunk_bytes; //Distance between consecutive candidate nodes of the chain in bytes
+    switch (granularity) {
+        case CHAIN_CHUNK:
             break;
-#endif
-#ifdef HAS_WORD_256
-        case CHUNK_256b:
-            for (size_t i = 0; i < num_pointers; i++) { //Initialize pointers to point at themselves (identity mapping)
-#ifdef HAS_WORD_64
-                mem_region_base[i*4] = reinterpret_cast<Word64_t>(mem_region_base+(i*4));
-                mem_region_base[(i*4)+1] = 0xFFFFFFFFFFFFFFFF; //1-fill upper 192 bits
-                mem_region_base[(i*4)+2] = 0xFFFFFFFFFFFFFFFF; 
-                mem_region_base[(i*4)+3] = 0xFFFFFFFFFFFFFFFF;
-#else //special case for 32-bit architectures
-                mem_region_base[i*8] = reinterpret_cast<Word32_t>(mem_region_base+(i*8));
-                mem_region_base[(i*8)+1] = 0xFFFFFFFF; //1-fill upper 224 bits
-                mem_region_base[(i*8)+2] = 0xFFFFFFFF;
-                mem_region_base[(i*8)+3] = 0xFFFFFFFF;
-                mem_region_base[(i*8)+4] = 0xFFFFFFFF;
-                mem_region_base[(i*8)+5] = 0xFFFFFFFF;
-                mem_region_base[(i*8)+6] = 0xFFFFFFFF;
-                mem_region_base[(i*8)+7] = 0xFFFFFFFF;
-#endif
-            }
-            std::shuffle(reinterpret_cast<Word256_t*>(mem_region_base), reinterpret_cast<Word256_t*>(mem_region_base) + num_pointers, gen);
+        case CHAIN_CACHE_LINE:
+            node_size = DEFAULT_CACHE_LINE_SIZE;
             break;
-#endif
-#ifdef HAS_WORD_512
-        case CHUNK_512b:
-            for (size_t i = 0; i < num_pointers; i++) { //Initialize pointers to point at themselves (identity mapping)
-#ifdef HAS_WORD_64
-                mem_region_base[i*4] = reinterpret_cast<Word64_t>(mem_region_base+(i*4));
-                mem_region_base[(i*4)+1] = 0xFFFFFFFFFFFFFFFF; //1-fill upper 448 bits
-                mem_region_base[(i*4)+2] = 0xFFFFFFFFFFFFFFFF; 
-                mem_region_base[(i*4)+3] = 0xFFFFFFFFFFFFFFFF;
-                mem_region_base[(i*4)+4] = 0xFFFFFFFFFFFFFFFF;
-                mem_region_base[(i*4)+5] = 0xFFFFFFFFFFFFFFFF;
-                mem_region_base[(i*4)+6] = 0xFFFFFFFFFFFFFFFF;
-                mem_region_base[(i*4)+7] = 0xFFFFFFFFFFFFFFFF;
-#else //special case for 32-bit architectures
-                mem_region_base[i*8] = reinterpret_cast<Word32_t>(mem_region_base+(i*8));
-                mem_region_base[(i*8)+1] = 0xFFFFFFFF; //1-fill upper 480 bits
-                mem_region_base[(i*8)+2] = 0xFFFFFFFF;
-                mem_region_base[(i*8)+3] = 0xFFFFFFFF;
-                mem_region_base[(i*8)+4] = 0xFFFFFFFF;
-                mem_region_base[(i*8)+5] = 0xFFFFFFFF;
-                mem_region_base[(i*8)+6] = 0xFFFFFFFF;
-                mem_region_base[(i*8)+7] = 0xFFFFFFFF;
-                mem_region_base[(i*8)+8] = 0xFFFFFFFF;
-                mem_region_base[(i*8)+9] = 0xFFFFFFFF;
-                mem_region_base[(i*8)+10] = 0xFFFFFFFF;
-                mem_region_base[(i*8)+11] = 0xFFFFFFFF;
-                mem_region_base[(i*8)+12] = 0xFFFFFFFF;
-                mem_region_base[(i*8)+13] = 0xFFFFFFFF;
-                mem_region_base[(i*8)+14] = 0xFFFFFFFF;
-                mem_region_base[(i*8)+15] = 0xFFFFFFFF;
-#endif
-            }
-            std::shuffle(reinterpret_cast<Word512_t*>(mem_region_base), reinterpret_cast<Word512_t*>(mem_region_base) + num_pointers, gen);
+        case CHAIN_PAGE:
+            node_size = g_page_size;
             break;
-#endif
         default:
-            std::cerr << "ERROR: Got an invalid chunk size. This should not have happened." << std::endl;
+            std::cerr << "ERROR: Got an invalid pointer chain granularity. This should not have happened." << std::endl;
             return false;
     }
+    if (node_size < chunk_bytes)
+        node_size = chunk_bytes;
+
+    size_t num_nodes = length / node_size;
+    if (num_nodes == 0) {
+        std::cerr << "ERROR: Memory region of " << length << " B is too small for a pointer chain with " << node_size << " B nodes." << std::endl;
+        return false;
+    }
+    uint8_t* mem_region_base = reinterpret_cast<uint8_t*>(start_address);
+
+    //Split the region into blocks. Each block is made into a single cycle independently, and the cycles are then stitched into one.
+    //Blocks are much larger than any cache, so walking one block at a time does not change what is measured.
+    //The block size is fixed so that the chain only depends on the seed, not on the number of threads that built it.
+    size_t nodes_per_block = POINTER_CHAIN_BLOCK_SIZE / node_size;
+    if (nodes_per_block == 0)
+        nodes_per_block = 1;
+    uint32_t num_blocks = static_cast<uint32_t>((num_nodes + nodes_per_block - 1) / nodes_per_block);
+
+    //Use every CPU of the region's NUMA node, so construction is fast and touches memory from the node it lives on
+    std::vector<int32_t> builder_cpus;
+    if (num_blocks > 1) {
+        for (uint32_t c = 0; c < g_num_logical_cpus && builder_cpus.size() < num_blocks; c++) {
+            if (numa_node == static_cast<uint32_t>(-1)) //unknown node, do not pin
+                builder_cpus.push_back(-1);
+            else {
+                int32_t cpu = cpu_id_in_numa_node(numa_node, c);
+                if (cpu < 0)
+                    break;
+                builder_cpus.push_back(cpu);
+            }
+        }
+    }
+
+    std::vector<PointerChainBuilder*> builders;
+    if (builder_cpus.size() < 2) //Build on the calling thread
+        builders.push_back(new PointerChainBuilder(mem_region_base, num_nodes, node_size, chunk_bytes, nodes_per_block, 0, 1, random_offsets, seed, -1));
+    else {
+        for (uint32_t t = 0; t < builder_cpus.size(); t++)
+            builders.push_back(new PointerChainBuilder(mem_region_base, num_nodes, node_size, chunk_bytes, nodes_per_block, t, static_cast<uint32_t>(builder_cpus.size()), random_offsets, seed, builder_cpus[t]));
+    }
+
+    bool success = run_pointer_chain_builders(builders, CHAIN_BUILD_SHUFFLE);
+
+    //Stitch the block cycles together by rotating the successors of each block's first node. This merges all cycles into one.
+    if (success && num_blocks > 1) {
+        std::vector<uintptr_t> first_successors(num_blocks);
+        for (uint32_t b = 0; b < num_blocks; b++)
+            first_successors[b] = *reinterpret_cast<uintptr_t*>(mem_region_base + b*nodes_per_block*node_size);
+        for (uint32_t b = 0; b < num_blocks; b++)
+            *reinterpret_cast<uintptr_t*>(mem_region_base + b*nodes_per_block*node_size) = first_successors[(b+1) % num_blocks];
+    }
+
+    if (success)
+        success = run_pointer_chain_builders(builders, CHAIN_BUILD_LINK);
+
+    for (auto it = builders.begin(); it != builders.end(); it++)
+        delete *it;
+
+    if (!success) {
+        std::cerr << "ERROR: A pointer chain builder thread failed to complete correctly!" << std::endl;
+        return false;
+    }
 
     if (g_verbose) {
         std::cout << "done" << std::endl;
@@ -975,6 +692,32 @@ bool xmem::build_random_pointer_permutation(void* start_address, void* end_addre
     return true;
 }
 
+bool xmem::build_chain_lookahead(void* start_address, void* end_address, uint32_t distance) {
+    uintptr_t base = reinterpret_cast<uintptr_t>(start_address);
+    uintptr_t limit = reinterpret_cast<uintptr_t>(end_address);
+    size_t max_nodes = (limit - base) / DEFAULT_CACHE_LINE_SIZE; //Chain has at most one node per cache line
+
+    //Each node keeps its successor in the first word and gets the node that is distance hops ahead in the second word.
+    uintptr_t* lead = static_cast<uintptr_t*>(start_address);
+    for (uint32_t i = 0; i < distance; i++)
+        lead = reinterpret_cast<uintptr_t*>(*lead);
+
+    uintptr_t* node = static_cast<uintptr_t*>(start_address);
+    size_t num_nodes = 0;
+    do {
+        if (reinterpret_cast<uintptr_t>(node) < base || reinterpret_cast<uintptr_t>(node) + 2*sizeof(uintptr_t) > limit || num_nodes >= max_nodes) {
+            std::cerr << "ERROR: Pointer chain is not a single cycle of cache line-granular nodes, so lookahead pointers cannot be added to it." << std::endl;
+            return false;
+        }
+        node[1] = reinterpret_cast<uintptr_t>(lead);
+        node = reinterpret_cast<uintptr_t*>(*node);
+        lead = reinterpret_cast<uintptr_t*>(*lead);
+        num_nodes++;
+    } while (node != start_address);
+
+    return true;
+}
+
 /***********************************************************************
  ***********************************************************************
  ********************** LATENCY-RELATED BENCHMARK KERNELS **************
@@ -997,2684 +740,128 @@ int32_t xmem::chasePointers(uintptr_t* first_address, uintptr_t** last_touched_a
     return 0;
 }
 
-
-/***********************************************************************
- ***********************************************************************
- ******************* THROUGHPUT-RELATED BENCHMARK KERNELS **************
- ***********************************************************************
- ***********************************************************************/
-
-/* --------------------- DUMMY BENCHMARK ROUTINES --------------------------- */
-
-int32_t xmem::dummy_empty(void*, void*) { 
-    return 0;
-}
-        
-/* ------------ SEQUENTIAL LOOP --------------*/
-
-int32_t xmem::dummy_forwSequentialLoop_Word32(void* start_address, void* end_address) {
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address), *endptr = static_cast<Word32_t*>(end_address); wordptr < endptr;) {
-        UNROLL1024(wordptr++;) 
-        placeholder = 0;
-    }
-    return placeholder;
-}
-
-#ifdef HAS_WORD_64
-int32_t xmem::dummy_forwSequentialLoop_Word64(void* start_address, void* end_address) {
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address), *endptr = static_cast<Word64_t*>(end_address); wordptr < endptr;) {
-        UNROLL512(wordptr++;) 
-        placeholder = 0;
-    }
-    return placeholder;
-}
-#endif
-
-#ifdef HAS_WORD_128
-int32_t xmem::dummy_forwSequentialLoop_Word128(void* start_address, void* end_address) {
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_dummy_forwSequentialLoop_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
-#else
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address), *endptr = static_cast<Word128_t*>(end_address); wordptr < endptr;) {
-        UNROLL256(wordptr++;) 
-        placeholder = 0;
-    }
-    return placeholder;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_256
-int32_t xmem::dummy_forwSequentialLoop_Word256(void* start_address, void* end_address) {
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_dummy_forwSequentialLoop_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
-#endif
-#ifdef __gnu_linux__
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
-        UNROLL128(wordptr++;) 
-        placeholder = 0;
-    }
-    return placeholder;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::dummy_forwSequentialLoop_Word512(void* start_address, void* end_address) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::dummy_forwSequentialLoop_Word512(void* start_address, void* end_address) { 
-#endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_dummy_forwSequentialLoop_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
-    #error 512-bit words on Windows are not currently supported.
-#endif
-#ifdef __gnu_linux__
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address), *endptr = static_cast<Word512_t*>(end_address); wordptr < endptr;) {
-        UNROLL64(wordptr++;) 
-        placeholder = 0;
-    }
-    return placeholder;
-#endif
-}
-#endif
-
-int32_t xmem::dummy_revSequentialLoop_Word32(void* start_address, void* end_address) { 
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address), *begptr = static_cast<Word32_t*>(start_address); wordptr > begptr;) {
-        UNROLL1024(wordptr--;)
-        placeholder = 0;
-    }
-    return placeholder;
-}
-
-#ifdef HAS_WORD_64
-int32_t xmem::dummy_revSequentialLoop_Word64(void* start_address, void* end_address) {
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address), *begptr = static_cast<Word64_t*>(start_address); wordptr > begptr;) {
-        UNROLL512(wordptr--;)
-        placeholder = 0;
-    }
-    return placeholder;
-}
-#endif
-
-#ifdef HAS_WORD_128
-int32_t xmem::dummy_revSequentialLoop_Word128(void* start_address, void* end_address) {
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_dummy_revSequentialLoop_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
-#endif
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address), *begptr = static_cast<Word128_t*>(start_address); wordptr > begptr;) {
-        UNROLL256(wordptr--;) 
-        placeholder = 0;
-    }
-    return placeholder;
-}
-#endif
-
-#ifdef HAS_WORD_256
-int32_t xmem::dummy_revSequentialLoop_Word256(void* start_address, void* end_address) {
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_dummy_revSequentialLoop_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
-#endif
-#ifdef __gnu_linux__
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address), *begptr = static_cast<Word256_t*>(start_address); wordptr > begptr;) {
-        UNROLL128(wordptr--;) 
-        placeholder = 0;
-    }
-    return placeholder;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::dummy_revSequentialLoop_Word512(void* start_address, void* end_address) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::dummy_revSequentialLoop_Word512(void* start_address, void* end_address) { 
-#endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_dummy_revSequentialLoop_Word512(static_cast<Word512_t*>(end_address), static_cast<Word512_t*>(start_address));
-    #error 512-bit words are not currently supported on Windows.
-#endif
-#ifdef __gnu_linux__
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (Word512_t* wordptr = static_cast<Word512_t*>(end_address), *begptr = static_cast<Word512_t*>(start_address); wordptr > begptr;) {
-        UNROLL64(wordptr--;) 
-        placeholder = 0;
-    }
-    return placeholder;
-#endif
-}
-#endif
-
-/* ------------ STRIDE 2 LOOP --------------*/
-
-int32_t xmem::dummy_forwStride2Loop_Word32(void* start_address, void* end_address) {
-    register Word32_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address); i < len; i += 512) {
-        UNROLL512(wordptr += 2;)
-        if (wordptr >= static_cast<Word32_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-}
-
-#ifdef HAS_WORD_64
-int32_t xmem::dummy_forwStride2Loop_Word64(void* start_address, void* end_address) {
-    register Word64_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address); i < len; i += 256) {
-        UNROLL256(wordptr += 2;)
-        if (wordptr >= static_cast<Word64_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-}
-#endif
-
-#ifdef HAS_WORD_128
-int32_t xmem::dummy_forwStride2Loop_Word128(void* start_address, void* end_address) {
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_dummy_forwStride2Loop_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
-#else
-    register Word128_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address); i < len; i += 128) {
-        UNROLL128(wordptr += 2;)
-        if (wordptr >= static_cast<Word128_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_256
-int32_t xmem::dummy_forwStride2Loop_Word256(void* start_address, void* end_address) {
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_dummy_forwStride2Loop_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
-#else
-    register Word256_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address); i < len; i += 64) {
-        UNROLL64(wordptr += 2;)
-        if (wordptr >= static_cast<Word256_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::dummy_forwStride2Loop_Word512(void* start_address, void* end_address) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::dummy_forwStride2Loop_Word512(void* start_address, void* end_address) { 
-#endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-//    return win_x86_64_asm_dummy_forwStride2Loop_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
-    #error 512-bit words are not currently supported on Windows.
-#else
-    register Word512_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 32) {
-        UNROLL32(wordptr += 2;)
-        if (wordptr >= static_cast<Word512_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-int32_t xmem::dummy_revStride2Loop_Word32(void* start_address, void* end_address) {
-    register Word32_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address); i < len; i += 512) {
-        UNROLL512(wordptr -= 2;)
-        if (wordptr <= static_cast<Word32_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-}
-
-#ifdef HAS_WORD_64
-int32_t xmem::dummy_revStride2Loop_Word64(void* start_address, void* end_address) {
-    register Word64_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address); i < len; i += 256) {
-        UNROLL256(wordptr -= 2;)
-        if (wordptr <= static_cast<Word64_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-}
-#endif
-
-#ifdef HAS_WORD_128
-int32_t xmem::dummy_revStride2Loop_Word128(void* start_address, void* end_address) {
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_dummy_revStride2Loop_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
-#else
-    register Word128_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address); i < len; i += 128) {
-        UNROLL128(wordptr -= 2;)
-        if (wordptr <= static_cast<Word128_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_256
-int32_t xmem::dummy_revStride2Loop_Word256(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_dummy_revStride2Loop_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
-#else
-    register Word256_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address); i < len; i += 64) {
-        UNROLL64(wordptr -= 2;)
-        if (wordptr <= static_cast<Word256_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::dummy_revStride2Loop_Word512(void* start_address, void* end_address) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::dummy_revStride2Loop_Word512(void* start_address, void* end_address) { 
-#endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_dummy_revStride2Loop_Word512(static_cast<Word512_t*>(end_address), static_cast<Word512_t*>(start_address));
-#error 512-bit words are not currently supported on Windows.
-#else
-    register Word512_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    for (Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 32) {
-        UNROLL32(wordptr -= 2;)
-        if (wordptr <= static_cast<Word512_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-/* ------------ STRIDE 4 LOOP --------------*/
-
-int32_t xmem::dummy_forwStride4Loop_Word32(void* start_address, void* end_address) {
-    register Word32_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address); i < len; i += 256) {
-        UNROLL256(wordptr += 4;)
-        if (wordptr >= static_cast<Word32_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-}
-
-#ifdef HAS_WORD_64
-int32_t xmem::dummy_forwStride4Loop_Word64(void* start_address, void* end_address) {
-    register Word64_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address); i < len; i += 128) {
-        UNROLL128(wordptr += 4;)
-        if (wordptr >= static_cast<Word64_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-}
-#endif
-
-#ifdef HAS_WORD_128
-int32_t xmem::dummy_forwStride4Loop_Word128(void* start_address, void* end_address) {
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_dummy_forwStride4Loop_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
-#else
-    register Word128_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address); i < len; i += 64) {
-        UNROLL64(wordptr += 4;)
-        if (wordptr >= static_cast<Word128_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_256
-int32_t xmem::dummy_forwStride4Loop_Word256(void* start_address, void* end_address) {
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_dummy_forwStride4Loop_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
-#else
-    register Word256_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address); i < len; i += 32) {
-        UNROLL32(wordptr += 4;)
-        if (wordptr >= static_cast<Word256_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::dummy_forwStride4Loop_Word512(void* start_address, void* end_address) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::dummy_forwStride4Loop_Word512(void* start_address, void* end_address) { 
-#endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_dummy_forwStride4Loop_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
-#error 512-bit words are not currently supported on Windows.
-#else
-    register Word512_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 16) {
-        UNROLL16(wordptr += 4;)
-        if (wordptr >= static_cast<Word512_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-int32_t xmem::dummy_revStride4Loop_Word32(void* start_address, void* end_address) {
-    register Word32_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address); i < len; i += 256) {
-        UNROLL256(wordptr -= 4;)
-        if (wordptr <= static_cast<Word32_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-}
-
-#ifdef HAS_WORD_64
-int32_t xmem::dummy_revStride4Loop_Word64(void* start_address, void* end_address) {
-    register Word64_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address); i < len; i += 128) {
-        UNROLL128(wordptr -= 4;)
-        if (wordptr <= static_cast<Word64_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-}
-#endif
-
-#ifdef HAS_WORD_128
-int32_t xmem::dummy_revStride4Loop_Word128(void* start_address, void* end_address) {
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_dummy_revStride4Loop_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
-#else
-    register Word128_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address); i < len; i += 64) {
-        UNROLL64(wordptr -= 4;)
-        if (wordptr <= static_cast<Word128_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_256
-int32_t xmem::dummy_revStride4Loop_Word256(void* start_address, void* end_address) {
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_dummy_revStride4Loop_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
-#else
-    register Word256_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address); i < len; i += 32) {
-        UNROLL32(wordptr -= 4;)
-        if (wordptr <= static_cast<Word256_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::dummy_revStride4Loop_Word512(void* start_address, void* end_address) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::dummy_revStride4Loop_Word512(void* start_address, void* end_address) { 
-#endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_dummy_revStride4Loop_Word512(static_cast<Word512_t*>(end_address), static_cast<Word512_t*>(start_address));
-    #error 512-bit words are not currently supported on Windows.
-#else
-    register Word512_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    for (Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 16) {
-        UNROLL16(wordptr -= 4;)
-        if (wordptr <= static_cast<Word512_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-/* ------------ STRIDE 8 LOOP --------------*/
-
-int32_t xmem::dummy_forwStride8Loop_Word32(void* start_address, void* end_address) {
-    register Word32_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address); i < len; i += 128) {
-        UNROLL128(wordptr += 8;)
-        if (wordptr >= static_cast<Word32_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-}
-
-#ifdef HAS_WORD_64
-int32_t xmem::dummy_forwStride8Loop_Word64(void* start_address, void* end_address) {
-    register Word64_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address); i < len; i += 64) {
-        UNROLL64(wordptr += 8;)
-        if (wordptr >= static_cast<Word64_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-}
-#endif
-
-#ifdef HAS_WORD_128
-int32_t xmem::dummy_forwStride8Loop_Word128(void* start_address, void* end_address) {
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_dummy_forwStride8Loop_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
-#else
-    register Word128_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address); i < len; i += 32) {
-        UNROLL32(wordptr += 8;)
-        if (wordptr >= static_cast<Word128_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_256
-int32_t xmem::dummy_forwStride8Loop_Word256(void* start_address, void* end_address) {
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_dummy_forwStride8Loop_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
-#else
-    register Word256_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address); i < len; i += 16) {
-        UNROLL16(wordptr += 8;)
-        if (wordptr >= static_cast<Word256_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::dummy_forwStride8Loop_Word512(void* start_address, void* end_address) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::dummy_forwStride8Loop_Word512(void* start_address, void* end_address) { 
-#endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_dummy_forwStride8Loop_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
-    #error 512-bit words are not currently supported on Windows.
-#else
-    register Word512_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 8) {
-        UNROLL8(wordptr += 8;)
-        if (wordptr >= static_cast<Word512_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-int32_t xmem::dummy_revStride8Loop_Word32(void* start_address, void* end_address) { 
-    register Word32_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address); i < len; i += 128) {
-        UNROLL128(wordptr -= 8;)
-        if (wordptr <= static_cast<Word32_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-}
-
-#ifdef HAS_WORD_64
-int32_t xmem::dummy_revStride8Loop_Word64(void* start_address, void* end_address) { 
-    register Word64_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address); i < len; i += 64) {
-        UNROLL64(wordptr -= 8;)
-        if (wordptr <= static_cast<Word64_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-}
-#endif
-
-#ifdef HAS_WORD_128
-int32_t xmem::dummy_revStride8Loop_Word128(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_dummy_revStride8Loop_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
-#else
-    register Word128_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address); i < len; i += 32) {
-        UNROLL32(wordptr -= 8;)
-        if (wordptr <= static_cast<Word128_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_256
-int32_t xmem::dummy_revStride8Loop_Word256(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_dummy_revStride8Loop_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
-#else
-    register Word256_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address); i < len; i += 16) {
-        UNROLL16(wordptr -= 8;)
-        if (wordptr <= static_cast<Word256_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::dummy_revStride8Loop_Word512(void* start_address, void* end_address) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::dummy_revStride8Loop_Word512(void* start_address, void* end_address) { 
-#endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_dummy_revStride8Loop_Word512(static_cast<Word512_t*>(end_address), static_cast<Word512_t*>(start_address));
-    #error 512-bit words are not currently supported on Windows.
-#else
-    register Word512_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    for (volatile Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 8) {
-        UNROLL8(wordptr -= 8;)
-        if (wordptr <= static_cast<Word512_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-/* ------------ STRIDE 16 LOOP --------------*/
-
-int32_t xmem::dummy_forwStride16Loop_Word32(void* start_address, void* end_address) { 
-    register Word32_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address); i < len; i += 64) {
-        UNROLL64(wordptr += 16;)
-        if (wordptr >= static_cast<Word32_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-}
-
-#ifdef HAS_WORD_64
-int32_t xmem::dummy_forwStride16Loop_Word64(void* start_address, void* end_address) { 
-    register Word64_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address); i < len; i += 32) {
-        UNROLL32(wordptr += 16;)
-        if (wordptr >= static_cast<Word64_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-}
-#endif
-
-#ifdef HAS_WORD_128
-int32_t xmem::dummy_forwStride16Loop_Word128(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_dummy_forwStride16Loop_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
-#else
-    register Word128_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address); i < len; i += 16) {
-        UNROLL16(wordptr += 16;)
-        if (wordptr >= static_cast<Word128_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_256
-int32_t xmem::dummy_forwStride16Loop_Word256(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_dummy_forwStride16Loop_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
-#else
-    register Word256_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address); i < len; i += 8) {
-        UNROLL8(wordptr += 16;)
-        if (wordptr >= static_cast<Word256_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::dummy_forwStride16Loop_Word512(void* start_address, void* end_address) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::dummy_forwStride16Loop_Word512(void* start_address, void* end_address) { 
-#endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_dummy_forwStride16Loop_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
-    #error 512-bit words are not currently supported on Windows.
-#else
-    register Word512_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    for (volatile Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 4) {
-        UNROLL4(wordptr += 16;)
-        if (wordptr >= static_cast<Word512_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-int32_t xmem::dummy_revStride16Loop_Word32(void* start_address, void* end_address) { 
-    register Word32_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address); i < len; i += 64) {
-        UNROLL64(wordptr -= 16;)
-        if (wordptr <= static_cast<Word32_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-}
-
-#ifdef HAS_WORD_64
-int32_t xmem::dummy_revStride16Loop_Word64(void* start_address, void* end_address) { 
-    register Word64_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address); i < len; i += 32) {
-        UNROLL32(wordptr -= 16;)
-        if (wordptr <= static_cast<Word64_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-}
-#endif
-
-#ifdef HAS_WORD_128
-int32_t xmem::dummy_revStride16Loop_Word128(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_dummy_revStride16Loop_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
-#else
-    register Word128_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address); i < len; i += 16) {
-        UNROLL16(wordptr -= 16;)
-        if (wordptr <= static_cast<Word128_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_256
-int32_t xmem::dummy_revStride16Loop_Word256(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_dummy_revStride16Loop_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
-#else
-    register Word256_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address); i < len; i += 8) {
-        UNROLL8(wordptr -= 16;)
-        if (wordptr <= static_cast<Word256_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::dummy_revStride16Loop_Word512(void* start_address, void* end_address) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::dummy_revStride16Loop_Word512(void* start_address, void* end_address) { 
-#endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_dummy_revStride16Loop_Word512(static_cast<Word512_t*>(end_address), static_cast<Word512_t*>(start_address));
-    #error 512-bit words are not supported on Windows.
-#else
-    register Word512_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    for (volatile Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 4) {
-        UNROLL4(wordptr -= 16;)
-        if (wordptr <= static_cast<Word512_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-/* ------------ RANDOM LOOP --------------*/
-
-#ifndef HAS_WORD_64 //special case: 32-bit architectures
-int32_t xmem::dummy_randomLoop_Word32(uintptr_t*, uintptr_t**, size_t len) {
-    volatile uintptr_t* placeholder = NULL; //Try to defeat compiler optimizations removing this method
-    return 0;
-}
-#endif
-
-#ifdef HAS_WORD_64
-int32_t xmem::dummy_randomLoop_Word64(uintptr_t*, uintptr_t**, size_t len) {
-    volatile uintptr_t* placeholder = NULL; //Try to defeat compiler optimizations removing this method
-    return 0;
-}
-#endif
-
-#ifdef HAS_WORD_128
-int32_t xmem::dummy_randomLoop_Word128(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return 0; //TODO: Implement for Windows.
-#else
-    //TODO: check that the compiler generates this code correctly
-    volatile Word128_t* placeholder = reinterpret_cast<Word128_t*>(first_address);
-    register Word128_t val;
-    volatile uintptr_t val_extract;
-    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
-
-#ifdef HAS_WORD_64
-    UNROLL256(val_extract = my_64b_extractLSB_128b(val);) //Extract 64 LSB.
-#else //special case: 32-bit machines
-    UNROLL256(val_extract = my_32b_extractLSB_128b(val);) //Extract 32 LSB.
-#endif
-
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_256
-int32_t xmem::dummy_randomLoop_Word256(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return 0; //TODO: Implement for Windows.
-#else
-    //TODO: check that the compiler generates this code correctly
-    volatile Word256_t* placeholder = reinterpret_cast<Word256_t*>(first_address);
-    register Word256_t val;
-    volatile uintptr_t val_extract;
-    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
-
-#ifdef HAS_WORD_64
-        UNROLL128(val_extract = my_64b_extractLSB_256b(val);) //Extract 64 LSB.
-#else //special case: 32-bit machines
-        UNROLL128(val_extract = my_32b_extractLSB_256b(val);) //Extract 32 LSB.
-#endif
-
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::dummy_randomLoop_Word512(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::dummy_randomLoop_Word512(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
-#endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return 0; //TODO: Implement for Windows.
-#else
-    //TODO: check that the compiler generates this code correctly
-    volatile Word512_t* placeholder = reinterpret_cast<Word512_t*>(first_address);
-    register Word512_t val;
-    volatile uintptr_t val_extract;
-
-    uint64_t scratchptr[8];
-    my_64b_set_512b_word(val, scratchptr, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
-    UNROLL64(my_64b_extractLSB_512b(val_extract, scratchptr, val);) //Extract 64 LSB.
-
-    return 0;
-#endif
-}
-#endif
-
-/* -------------------- CORE BENCHMARK ROUTINES -------------------------- 
- *
- * These routines access the memory in different ways for each benchmark type.
- * Optimization tricks include:
- *   - register keyword to hint to compiler values that should not be used in memory access
- *   - UNROLL macros to manual loop unrolling. This reduces the relative branch overhead of the loop.
- *     We don't want to benchmark loops, we want to benchmark memory!
- *   - volatile keyword to prevent compiler from optimizing the code and removing instructions that we need.
- *     The compiler is too smart for its own good!
- *   - Hardcoding stride and chunk sizes in each benchmark snippet, so that way they do not have to waste cycles being computed at runtime.
- *     This makes code harder to maintain and to read but ensures more accurate memory benchmarking.
- *
- * ----------------------------------------------------------------------- */
-
-/* ------------ SEQUENTIAL READ --------------*/
-
-int32_t xmem::forwSequentialRead_Word32(void* start_address, void* end_address) {
-    register Word32_t val; 
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address), *endptr = static_cast<Word32_t*>(end_address); wordptr < endptr;) {
-        UNROLL1024(val = *wordptr++;) 
-    }
-    return 0;
-}
-
-#ifdef HAS_WORD_64
-int32_t xmem::forwSequentialRead_Word64(void* start_address, void* end_address) {
-    register Word64_t val;
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address), *endptr = static_cast<Word64_t*>(end_address); wordptr < endptr;) {
-        UNROLL512(val = *wordptr++;)
-    }
-    return 0;
-}
-#endif
-
-#ifdef HAS_WORD_128
-int32_t xmem::forwSequentialRead_Word128(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_forwSequentialRead_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
-#else
-    register Word128_t val;
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address), *endptr = static_cast<Word128_t*>(end_address); wordptr < endptr;) {
-        UNROLL256(val = *wordptr++;)
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_256
-int32_t xmem::forwSequentialRead_Word256(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_forwSequentialRead_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
-#else
-    register Word256_t val;
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
-        UNROLL128(val = *wordptr++;)
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::forwSequentialRead_Word512(void* start_address, void* end_address) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::forwSequentialRead_Word512(void* start_address, void* end_address) { 
-#endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-//    return win_x86_64_asm_forwSequentialRead_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
-    #error 512-bit words are not supported on Windows.
-#else
-    register Word512_t val;
-    //for (volatile Word512_t* wordptr = static_cast<Word512_t*>(start_address), *endptr = static_cast<Word512_t*>(end_address); wordptr < endptr;) {
-    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address), *endptr = static_cast<Word512_t*>(end_address); wordptr < endptr;) {
-        //UNROLL64(val = *wordptr++;)
-        UNROLL64(val = my_512b_load(wordptr++);)
-    }
-    return 0;
-#endif
-}
-#endif
-
-int32_t xmem::revSequentialRead_Word32(void* start_address, void* end_address) { 
-    register Word32_t val;
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address), *begptr = static_cast<Word32_t*>(start_address); wordptr > begptr;) {
-        UNROLL1024(val = *wordptr--;)
-    }
-    return 0;
-}
-
-#ifdef HAS_WORD_64
-int32_t xmem::revSequentialRead_Word64(void* start_address, void* end_address) {
-    register Word64_t val;
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address), *begptr = static_cast<Word64_t*>(start_address); wordptr > begptr;) {
-        UNROLL512(val = *wordptr--;)
-    }
-    return 0;
-}
-#endif
-
-#ifdef HAS_WORD_128
-int32_t xmem::revSequentialRead_Word128(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_revSequentialRead_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
-#else
-    register Word128_t val;
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address), *begptr = static_cast<Word128_t*>(start_address); wordptr > begptr;) {
-        UNROLL256(val = *wordptr--;)
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_256
-int32_t xmem::revSequentialRead_Word256(void* start_address, void* end_address) {
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_revSequentialRead_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
-#else
-    register Word256_t val;
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address), *begptr = static_cast<Word256_t*>(start_address); wordptr > begptr;) {
-        UNROLL128(val = *wordptr--;)
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::revSequentialRead_Word512(void* start_address, void* end_address) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::revSequentialRead_Word512(void* start_address, void* end_address) { 
-#endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_revSequentialRead_Word512(static_cast<Word512_t*>(end_address), static_cast<Word512_t*>(start_address));
-    #error 512-bit words are not supported on Windows.
-#else
-    register Word512_t val;
-    //for (volatile Word512_t* wordptr = static_cast<Word512_t*>(end_address), *begptr = static_cast<Word512_t*>(start_address); wordptr > begptr;) {
-    for (Word512_t* wordptr = static_cast<Word512_t*>(end_address), *begptr = static_cast<Word512_t*>(start_address); wordptr > begptr;) {
-        //UNROLL64(val = *wordptr--;)
-        UNROLL64(val = my_512b_load(wordptr--);)
-    }
-    return 0;
-#endif
-}
-#endif
-
-/* ------------ SEQUENTIAL WRITE --------------*/
-
-int32_t xmem::forwSequentialWrite_Word32(void* start_address, void* end_address) {
-    register Word32_t val = 0xFFFFFFFF; 
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address), *endptr = static_cast<Word32_t*>(end_address); wordptr < endptr;) {
-        UNROLL1024(*wordptr++ = val;) 
-    }
-    return 0;
-}
-
-#ifdef HAS_WORD_64
-int32_t xmem::forwSequentialWrite_Word64(void* start_address, void* end_address) {
-    register Word64_t val = 0xFFFFFFFFFFFFFFFF; 
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address), *endptr = static_cast<Word64_t*>(end_address); wordptr < endptr;) {
-        UNROLL512(*wordptr++ = val;) 
-    }
-    return 0;
-}
-#endif
-
-#ifdef HAS_WORD_128
-int32_t xmem::forwSequentialWrite_Word128(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_forwSequentialWrite_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
-#else
-    register Word128_t val;
-    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address), *endptr = static_cast<Word128_t*>(end_address); wordptr < endptr;) {
-        UNROLL256(*wordptr++ = val;) 
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_256
-int32_t xmem::forwSequentialWrite_Word256(void* start_address, void* end_address) {
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_forwSequentialWrite_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
-#else
-    register Word256_t val;
-    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
-        UNROLL128(*wordptr++ = val;) 
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::forwSequentialWrite_Word512(void* start_address, void* end_address) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::forwSequentialWrite_Word512(void* start_address, void* end_address) { 
-#endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_forwSequentialWrite_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
-    #error 512-bit words are not supported on Windows.
-#else
-    register Word512_t val;
-    uint64_t scratchptr[8] __attribute__ ((aligned(512)));
-    my_64b_set_512b_word(val, scratchptr, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
-    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address), *endptr = static_cast<Word512_t*>(end_address); wordptr < endptr;) {
-        UNROLL64(*wordptr++ = val;) 
-    }
-    return 0;
-#endif
-}
-#endif
-
-int32_t xmem::revSequentialWrite_Word32(void* start_address, void* end_address) {
-    register Word32_t val = 0xFFFFFFFF;
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address), *begptr = static_cast<Word32_t*>(start_address); wordptr > begptr;) {
-        UNROLL1024(*wordptr-- = val;)
-    }
-    return 0;
-}
-
-#ifdef HAS_WORD_64
-int32_t xmem::revSequentialWrite_Word64(void* start_address, void* end_address) {
-    register Word64_t val = 0xFFFFFFFFFFFFFFFF;
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address), *begptr = static_cast<Word64_t*>(start_address); wordptr > begptr;) {
-        UNROLL512(*wordptr-- = val;)
-    }
-    return 0;
-}
-#endif
-
-#ifdef HAS_WORD_128
-int32_t xmem::revSequentialWrite_Word128(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_revSequentialWrite_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
-#else
-    register Word128_t val;
-    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address), *begptr = static_cast<Word128_t*>(start_address); wordptr > begptr;) {
-        UNROLL256(*wordptr-- = val;)
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_256
-int32_t xmem::revSequentialWrite_Word256(void* start_address, void* end_address) {
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_revSequentialWrite_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
-#else
-    register Word256_t val;
-    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address), *begptr = static_cast<Word256_t*>(start_address); wordptr > begptr;) {
-        UNROLL128(*wordptr-- = val;)
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::revSequentialWrite_Word512(void* start_address, void* end_address) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::revSequentialWrite_Word512(void* start_address, void* end_address) { 
-#endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_revSequentialWrite_Word512(static_cast<Word512_t*>(end_address), static_cast<Word512_t*>(start_address));
-    #error 512-bit words are not supported on Windows.
-#else
-    register Word512_t val;
-    uint64_t scratchptr[8] __attribute__ ((aligned(512)));
-    my_64b_set_512b_word(val, scratchptr, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
-    for (Word512_t* wordptr = static_cast<Word512_t*>(end_address), *begptr = static_cast<Word512_t*>(start_address); wordptr > begptr;) {
-        UNROLL64(*wordptr-- = val;)
-    }
-    return 0;
-#endif
-}
-#endif
-
-/* ------------ STRIDE 2 READ --------------*/
-
-int32_t xmem::forwStride2Read_Word32(void* start_address, void* end_address) {
-    register Word32_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address); i < len; i += 512) {
-        UNROLL512(val = *wordptr; wordptr += 2;) 
-        if (wordptr >= static_cast<Word32_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-}
-
-#ifdef HAS_WORD_64
-int32_t xmem::forwStride2Read_Word64(void* start_address, void* end_address) { 
-    register Word64_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address); i < len; i += 256) {
-        UNROLL256(val = *wordptr; wordptr += 2;) 
-        if (wordptr >= static_cast<Word64_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-}
-#endif
-
-#ifdef HAS_WORD_128
-int32_t xmem::forwStride2Read_Word128(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_forwStride2Read_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
-#else
-    register Word128_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address); i < len; i += 128) {
-        UNROLL128(val = *wordptr; wordptr += 2;) 
-        if (wordptr >= static_cast<Word128_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_256
-int32_t xmem::forwStride2Read_Word256(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_forwStride2Read_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
-#else
-    register Word256_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address); i < len; i += 64) {
-        UNROLL64(val = *wordptr; wordptr += 2;) 
-        if (wordptr >= static_cast<Word256_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::forwStride2Read_Word512(void* start_address, void* end_address) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::forwStride2Read_Word512(void* start_address, void* end_address) { 
-#endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_forwStride2Read_Word512(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
-    #error 512-bit words are not supported on Windows.
-#else
-    register Word512_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    //for (volatile Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 32) {
-    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 32) {
-        //UNROLL32(val = *wordptr; wordptr += 2;) 
-        UNROLL32(val = my_512b_load(wordptr); wordptr += 2;) 
-        if (wordptr >= static_cast<Word512_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-int32_t xmem::revStride2Read_Word32(void* start_address, void* end_address) {
-    register Word32_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address); i < len; i += 512) {
-        UNROLL512(val = *wordptr; wordptr -= 2;) 
-        if (wordptr <= static_cast<Word32_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-}
-
-#ifdef HAS_WORD_64
-int32_t xmem::revStride2Read_Word64(void* start_address, void* end_address) { 
-    register Word64_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address); i < len; i += 256) {
-        UNROLL256(val = *wordptr; wordptr -= 2;)
-        if (wordptr <= static_cast<Word64_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-}
-#endif
-
-#ifdef HAS_WORD_128
-int32_t xmem::revStride2Read_Word128(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_revStride2Read_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
-#else
-    register Word128_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address); i < len; i += 128) {
-        UNROLL128(val = *wordptr; wordptr -= 2;)
-        if (wordptr <= static_cast<Word128_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_256
-int32_t xmem::revStride2Read_Word256(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_revStride2Read_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
-#else
-    register Word256_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address); i < len; i += 64) {
-        UNROLL64(val = *wordptr; wordptr -= 2;)
-        if (wordptr <= static_cast<Word256_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::revStride2Read_Word512(void* start_address, void* end_address) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::revStride2Read_Word512(void* start_address, void* end_address) { 
-#endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_revStride2Read_Word512(static_cast<Word512_t*>(end_address), static_cast<Word512_t*>(start_address));
-    #error 512-bit words are not supported on Windows.
-#else
-    register Word512_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    //for (volatile Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 32) {
-    for (Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 32) {
-        //UNROLL32(val = *wordptr; wordptr -= 2;)
-        UNROLL32(val = my_512b_load(wordptr); wordptr -= 2;)
-        if (wordptr <= static_cast<Word512_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-/* ------------ STRIDE 2 WRITE --------------*/
-
-int32_t xmem::forwStride2Write_Word32(void* start_address, void* end_address) {
-    register Word32_t val = 0xFFFFFFFF; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address); i < len; i += 512) {
-        UNROLL512(*wordptr = val; wordptr += 2;)
-        if (wordptr >= static_cast<Word32_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-}
-
-#ifdef HAS_WORD_64
-int32_t xmem::forwStride2Write_Word64(void* start_address, void* end_address) {
-    register Word64_t val = 0xFFFFFFFFFFFFFFFF; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address); i < len; i += 256) {
-        UNROLL256(*wordptr = val; wordptr += 2;)
-        if (wordptr >= static_cast<Word64_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-}
-#endif
-
-#ifdef HAS_WORD_128
-int32_t xmem::forwStride2Write_Word128(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_forwStride2Write_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
-#else
-    register Word128_t val;
-    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address); i < len; i += 128) {
-        UNROLL128(*wordptr = val; wordptr += 2;)
-        if (wordptr >= static_cast<Word128_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_256
-int32_t xmem::forwStride2Write_Word256(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_forwStride2Write_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
-#else
-    register Word256_t val;
-    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address); i < len; i += 64) {
-        UNROLL64(*wordptr = val; wordptr += 2;)
-        if (wordptr >= static_cast<Word256_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::forwStride2Write_Word512(void* start_address, void* end_address) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::forwStride2Write_Word512(void* start_address, void* end_address) { 
-#endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_forwStride2Write_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
-    #error 512-bit words are not supported on Windows.
-#else
-    register Word512_t val;
-    uint64_t scratchptr[8] __attribute__ ((aligned(512)));
-    my_64b_set_512b_word(val, scratchptr, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 32) {
-        UNROLL32(*wordptr = val; wordptr += 2;)
-        if (wordptr >= static_cast<Word512_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-int32_t xmem::revStride2Write_Word32(void* start_address, void* end_address) { 
-    register Word32_t val = 0xFFFFFFFF; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address); i < len; i += 512) {
-        UNROLL512(*wordptr = val; wordptr -= 2;)
-        if (wordptr <= static_cast<Word32_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-}
-
-#ifdef HAS_WORD_64
-int32_t xmem::revStride2Write_Word64(void* start_address, void* end_address) { 
-    register Word64_t val = 0xFFFFFFFFFFFFFFFF; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address); i < len; i += 256) {
-        UNROLL256(*wordptr = val; wordptr -= 2;)
-        if (wordptr <= static_cast<Word64_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-}
-#endif
-
-#ifdef HAS_WORD_128
-int32_t xmem::revStride2Write_Word128(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_revStride2Write_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
-#else
-    register Word128_t val;
-    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address); i < len; i += 128) {
-        UNROLL128(*wordptr = val; wordptr -= 2;)
-        if (wordptr <= static_cast<Word128_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_256
-int32_t xmem::revStride2Write_Word256(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_revStride2Write_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
-#else
-    register Word256_t val;
-    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address); i < len; i += 64) {
-        UNROLL64(*wordptr = val; wordptr -= 2;)
-        if (wordptr <= static_cast<Word256_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::revStride2Write_Word512(void* start_address, void* end_address) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::revStride2Write_Word512(void* start_address, void* end_address) { 
-#endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_forwStride2Write_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
-    #error 512-bit words are not supported on Windows.
-#else
-    register Word512_t val;
-    uint64_t scratchptr[8] __attribute__ ((aligned(512)));
-    my_64b_set_512b_word(val, scratchptr, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 32) {
-        UNROLL32(*wordptr = val; wordptr += 2;)
-        if (wordptr >= static_cast<Word512_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-/* ------------ STRIDE 4 READ --------------*/
-
-int32_t xmem::forwStride4Read_Word32(void* start_address, void* end_address) {
-    register Word32_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address); i < len; i += 256) {
-        UNROLL256(val = *wordptr; wordptr += 4;) 
-        if (wordptr >= static_cast<Word32_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-}
-
-#ifdef HAS_WORD_64
-int32_t xmem::forwStride4Read_Word64(void* start_address, void* end_address) { 
-    register Word64_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address); i < len; i += 128) {
-        UNROLL128(val = *wordptr; wordptr += 4;) 
-        if (wordptr >= static_cast<Word64_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-}
-#endif
-
-#ifdef HAS_WORD_128
-int32_t xmem::forwStride4Read_Word128(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_forwStride4Read_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
-#else
-    register Word128_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address); i < len; i += 64) {
-        UNROLL64(val = *wordptr; wordptr += 4;) 
-        if (wordptr >= static_cast<Word128_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_256
-int32_t xmem::forwStride4Read_Word256(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_forwStride4Read_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
-#else
-    register Word256_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address); i < len; i += 32) {
-        UNROLL32(val = *wordptr; wordptr += 4;) 
-        if (wordptr >= static_cast<Word256_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::forwStride4Read_Word512(void* start_address, void* end_address) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::forwStride4Read_Word512(void* start_address, void* end_address) { 
-#endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_forwStride4Read_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
-    #error 512-bit words are not supported on Windows.
-#else
-    register Word512_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    //for (volatile Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 16) {
-    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 16) {
-        //UNROLL16(val = *wordptr; wordptr += 4;) 
-        UNROLL16(val = my_512b_load(wordptr); wordptr += 4;) 
-        if (wordptr >= static_cast<Word512_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-int32_t xmem::revStride4Read_Word32(void* start_address, void* end_address) {
-    register Word32_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address); i < len; i += 256) {
-        UNROLL256(val = *wordptr; wordptr -= 4;) 
-        if (wordptr <= static_cast<Word32_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-}
-
-#ifdef HAS_WORD_64
-int32_t xmem::revStride4Read_Word64(void* start_address, void* end_address) { 
-    register Word64_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address); i < len; i += 128) {
-        UNROLL128(val = *wordptr; wordptr -= 4;)
-        if (wordptr <= static_cast<Word64_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-}
-#endif
-
-#ifdef HAS_WORD_128
-int32_t xmem::revStride4Read_Word128(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_revStride4Read_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
-#else
-    register Word128_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address); i < len; i += 64) {
-        UNROLL64(val = *wordptr; wordptr -= 4;)
-        if (wordptr <= static_cast<Word128_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_256
-int32_t xmem::revStride4Read_Word256(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_revStride4Read_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
-#else
-    register Word256_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address); i < len; i += 32) {
-        UNROLL32(val = *wordptr; wordptr -= 4;)
-        if (wordptr <= static_cast<Word256_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::revStride4Read_Word512(void* start_address, void* end_address) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::revStride4Read_Word512(void* start_address, void* end_address) { 
-#endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_revStride4Read_Word512(static_cast<Word512_t*>(end_address), static_cast<Word512_t*>(start_address));
-    #error 512-bit words are not supported on Windows.
-#else
-    register Word512_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    //for (volatile Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 16) {
-    for (Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 16) {
-        //UNROLL16(val = *wordptr; wordptr -= 4;)
-        UNROLL16(val = my_512b_load(wordptr); wordptr -= 4;)
-        if (wordptr <= static_cast<Word512_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-/* ------------ STRIDE 4 WRITE --------------*/
-
-int32_t xmem::forwStride4Write_Word32(void* start_address, void* end_address) {
-    register Word32_t val = 0xFFFFFFFF; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address); i < len; i += 256) {
-        UNROLL256(*wordptr = val; wordptr += 4;)
-        if (wordptr >= static_cast<Word32_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-}
-
-#ifdef HAS_WORD_64
-int32_t xmem::forwStride4Write_Word64(void* start_address, void* end_address) {
-    register Word64_t val = 0xFFFFFFFFFFFFFFFF; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address); i < len; i += 128) {
-        UNROLL128(*wordptr = val; wordptr += 4;)
-        if (wordptr >= static_cast<Word64_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-}
-#endif
-
-#ifdef HAS_WORD_128
-int32_t xmem::forwStride4Write_Word128(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_forwStride4Write_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
-#else
-    register Word128_t val;
-    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address); i < len; i += 64) {
-        UNROLL64(*wordptr = val; wordptr += 4;)
-        if (wordptr >= static_cast<Word128_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_256
-int32_t xmem::forwStride4Write_Word256(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_forwStride4Write_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
-#else
-    register Word256_t val;
-    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address); i < len; i += 32) {
-        UNROLL32(*wordptr = val; wordptr += 4;)
-        if (wordptr >= static_cast<Word256_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::forwStride4Write_Word512(void* start_address, void* end_address) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::forwStride4Write_Word512(void* start_address, void* end_address) { 
-#endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_forwStride4Write_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
-    #error 512-bit words are not supported on Windows.
-#else
-    register Word512_t val;
-    uint64_t scratchptr[8] __attribute__ ((aligned(512)));
-    my_64b_set_512b_word(val, scratchptr, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 16) {
-        UNROLL16(*wordptr = val; wordptr += 4;)
-        if (wordptr >= static_cast<Word512_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-int32_t xmem::revStride4Write_Word32(void* start_address, void* end_address) { 
-    register Word32_t val = 0xFFFFFFFF; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address); i < len; i += 256) {
-        UNROLL256(*wordptr = val; wordptr -= 4;)
-        if (wordptr <= static_cast<Word32_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-}
-
-#ifdef HAS_WORD_64
-int32_t xmem::revStride4Write_Word64(void* start_address, void* end_address) { 
-    register Word64_t val = 0xFFFFFFFFFFFFFFFF; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address); i < len; i += 128) {
-        UNROLL128(*wordptr = val; wordptr -= 4;)
-        if (wordptr <= static_cast<Word64_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-}
-#endif
-
-#ifdef HAS_WORD_128
-int32_t xmem::revStride4Write_Word128(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_revStride4Write_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
-#else
-    register Word128_t val;
-    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address); i < len; i += 64) {
-        UNROLL64(*wordptr = val; wordptr -= 4;)
-        if (wordptr <= static_cast<Word128_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_256
-int32_t xmem::revStride4Write_Word256(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_revStride4Write_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
-#else
-    register Word256_t val;
-    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address); i < len; i += 32) {
-        UNROLL32(*wordptr = val; wordptr -= 4;)
-        if (wordptr <= static_cast<Word256_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::revStride4Write_Word512(void* start_address, void* end_address) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::revStride4Write_Word512(void* start_address, void* end_address) { 
-#endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_revStride4Write_Word512(static_cast<Word512_t*>(end_address), static_cast<Word512_t*>(start_address));
-    #error 512-bit words are not supported on Windows.
-#else
-    register Word512_t val;
-    uint64_t scratchptr[8] __attribute__ ((aligned(512)));
-    my_64b_set_512b_word(val, scratchptr, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    for (Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 16) {
-        UNROLL16(*wordptr = val; wordptr -= 4;)
-        if (wordptr <= static_cast<Word512_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-/* ------------ STRIDE 8 READ --------------*/
-
-int32_t xmem::forwStride8Read_Word32(void* start_address, void* end_address) {
-    register Word32_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address); i < len; i += 128) {
-        UNROLL128(val = *wordptr; wordptr += 8;) 
-        if (wordptr >= static_cast<Word32_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-}
-
-#ifdef HAS_WORD_64
-int32_t xmem::forwStride8Read_Word64(void* start_address, void* end_address) { 
-    register Word64_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address); i < len; i += 64) {
-        UNROLL64(val = *wordptr; wordptr += 8;) 
-        if (wordptr >= static_cast<Word64_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-}
-#endif
-
-#ifdef HAS_WORD_128
-int32_t xmem::forwStride8Read_Word128(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_forwStride8Read_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
-#else
-    register Word128_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address); i < len; i += 32) {
-        UNROLL32(val = *wordptr; wordptr += 8;) 
-        if (wordptr >= static_cast<Word128_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_256
-int32_t xmem::forwStride8Read_Word256(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_forwStride8Read_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
-#else
-    register Word256_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address); i < len; i += 16) {
-        UNROLL16(val = *wordptr; wordptr += 8;) 
-        if (wordptr >= static_cast<Word256_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::forwStride8Read_Word512(void* start_address, void* end_address) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::forwStride8Read_Word512(void* start_address, void* end_address) { 
-#endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_forwStride8Read_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
-    #error 512-bit words are not supported on Windows.
-#else
-    register Word512_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    //for (volatile Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 8) {
-    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 8) {
-        //UNROLL8(val = *wordptr; wordptr += 8;) 
-        UNROLL8(val = my_512b_load(wordptr); wordptr += 8;) 
-        if (wordptr >= static_cast<Word512_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-int32_t xmem::revStride8Read_Word32(void* start_address, void* end_address) {
-    register Word32_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address); i < len; i += 128) {
-        UNROLL128(val = *wordptr; wordptr -= 8;) 
-        if (wordptr <= static_cast<Word32_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-}
-
-#ifdef HAS_WORD_64
-int32_t xmem::revStride8Read_Word64(void* start_address, void* end_address) { 
-    register Word64_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address); i < len; i += 64) {
-        UNROLL64(val = *wordptr; wordptr -= 8;)
-        if (wordptr <= static_cast<Word64_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-}
-#endif
-
-#ifdef HAS_WORD_128
-int32_t xmem::revStride8Read_Word128(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_revStride8Read_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
-#else
-    register Word128_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address); i < len; i += 32) {
-        UNROLL32(val = *wordptr; wordptr -= 8;)
-        if (wordptr <= static_cast<Word128_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_256
-int32_t xmem::revStride8Read_Word256(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_revStride8Read_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
-#else
-    register Word256_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address); i < len; i += 16) {
-        UNROLL16(val = *wordptr; wordptr -= 8;)
-        if (wordptr <= static_cast<Word256_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::revStride8Read_Word512(void* start_address, void* end_address) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::revStride8Read_Word512(void* start_address, void* end_address) { 
-#endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_revStride8Read_Word512(static_cast<Word512_t*>(end_address), static_cast<Word512_t*>(start_address));
-    #error 512-bit words are not supported on Windows.
-#else
-    register Word512_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    //for (volatile Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 8) {
-    for (Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 8) {
-        //UNROLL8(val = *wordptr; wordptr -= 8;)
-        UNROLL8(val = my_512b_load(wordptr); wordptr -= 8;)
-        if (wordptr <= static_cast<Word512_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-/* ------------ STRIDE 8 WRITE --------------*/
-
-int32_t xmem::forwStride8Write_Word32(void* start_address, void* end_address) {
-    register Word32_t val = 0xFFFFFFFF; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address); i < len; i += 128) {
-        UNROLL128(*wordptr = val; wordptr += 8;)
-        if (wordptr >= static_cast<Word32_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-}
-
-#ifdef HAS_WORD_64
-int32_t xmem::forwStride8Write_Word64(void* start_address, void* end_address) {
-    register Word64_t val = 0xFFFFFFFFFFFFFFFF; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address); i < len; i += 64) {
-        UNROLL64(*wordptr = val; wordptr += 8;)
-        if (wordptr >= static_cast<Word64_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-}
-#endif
-
-#ifdef HAS_WORD_128
-int32_t xmem::forwStride8Write_Word128(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_forwStride8Write_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
-#else
-    register Word128_t val;
-    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address); i < len; i += 32) {
-        UNROLL32(*wordptr = val; wordptr += 8;)
-        if (wordptr >= static_cast<Word128_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_256
-int32_t xmem::forwStride8Write_Word256(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_forwStride8Write_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
-#else
-    register Word256_t val;
-    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address); i < len; i += 16) {
-        UNROLL16(*wordptr = val; wordptr += 8;)
-        if (wordptr >= static_cast<Word256_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::forwStride8Write_Word512(void* start_address, void* end_address) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::forwStride8Write_Word512(void* start_address, void* end_address) { 
-#endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_forwStride8Write_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
-    #error 512-bit words are not supported on Windows.
-#else
-    register Word512_t val;
-    uint64_t scratchptr[8] __attribute__ ((aligned(512)));
-    my_64b_set_512b_word(val, scratchptr, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 8) {
-        UNROLL8(*wordptr = val; wordptr += 8;)
-        if (wordptr >= static_cast<Word512_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-int32_t xmem::revStride8Write_Word32(void* start_address, void* end_address) { 
-    register Word32_t val = 0xFFFFFFFF; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address); i < len; i += 128) {
-        UNROLL128(*wordptr = val; wordptr -= 8;)
-        if (wordptr <= static_cast<Word32_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-}
-
-#ifdef HAS_WORD_64
-int32_t xmem::revStride8Write_Word64(void* start_address, void* end_address) { 
-    register Word64_t val = 0xFFFFFFFFFFFFFFFF; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address); i < len; i += 64) {
-        UNROLL64(*wordptr = val; wordptr -= 8;)
-        if (wordptr <= static_cast<Word64_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-}
-#endif
-
-#ifdef HAS_WORD_128
-int32_t xmem::revStride8Write_Word128(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_revStride8Write_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
-#else
-    register Word128_t val;
-    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address); i < len; i += 32) {
-        UNROLL32(*wordptr = val; wordptr -= 8;)
-        if (wordptr <= static_cast<Word128_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_256
-int32_t xmem::revStride8Write_Word256(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_revStride8Write_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
-#else
-    register Word256_t val;
-    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address); i < len; i += 16) {
-        UNROLL16(*wordptr = val; wordptr -= 8;)
-        if (wordptr <= static_cast<Word256_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::revStride8Write_Word512(void* start_address, void* end_address) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::revStride8Write_Word512(void* start_address, void* end_address) { 
-#endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_revStride8Write_Word512(static_cast<Word512_t*>(end_address), static_cast<Word512_t*>(start_address));
-    #error 512-bit words are not supported on Windows.
-#else
-    register Word512_t val;
-    uint64_t scratchptr[8] __attribute__ ((aligned(512)));
-    my_64b_set_512b_word(val, scratchptr, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    for (Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 8) {
-        UNROLL8(*wordptr = val; wordptr -= 8;)
-        if (wordptr <= static_cast<Word512_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-#endif
-}
-#endif
-
-/* ------------ STRIDE 16 READ --------------*/
-
-int32_t xmem::forwStride16Read_Word32(void* start_address, void* end_address) {
-    register Word32_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address); i < len; i += 64) {
-        UNROLL64(val = *wordptr; wordptr += 16;) 
-        if (wordptr >= static_cast<Word32_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-}
-
-#ifdef HAS_WORD_64
-int32_t xmem::forwStride16Read_Word64(void* start_address, void* end_address) { 
-    register Word64_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address); i < len; i += 32) {
-        UNROLL32(val = *wordptr; wordptr += 16;) 
-        if (wordptr >= static_cast<Word64_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
+#ifdef HAS_SW_PREFETCH
+int32_t xmem::chasePointersPrefetch(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
+    volatile uintptr_t* p = first_address;
+    register prefetch_hint_t hint = g_prefetch_hint;
+    UNROLL512(my_prefetch(reinterpret_cast<uintptr_t*>(p[1]), hint); p = reinterpret_cast<uintptr_t*>(*p);)
+    *last_touched_address = const_cast<uintptr_t*>(p);
     return 0;
 }
 #endif
 
-#ifdef HAS_WORD_128
-int32_t xmem::forwStride16Read_Word128(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_forwStride16Read_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
-#else
-    register Word128_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address); i < len; i += 16) {
-        UNROLL16(val = *wordptr; wordptr += 16;) 
-        if (wordptr >= static_cast<Word128_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-#endif
-}
-#endif
 
-#ifdef HAS_WORD_256
-int32_t xmem::forwStride16Read_Word256(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_forwStride16Read_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
-#else
-    register Word256_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address); i < len; i += 8) {
-        UNROLL8(val = *wordptr; wordptr += 16;) 
-        if (wordptr >= static_cast<Word256_t*>(end_address)) //end, modulo
-            wordptr -= len;
+/**
+ * @brief One hop of every chain. The chain indices are compile-time constants, so each chain can live in its own register.
+ */
+template <uint32_t Chains, uint32_t Chain = 0>
+struct InterleavedHop {
+    static KERNEL_INLINE void run(uintptr_t** p) {
+        p[Chain] = reinterpret_cast<uintptr_t*>(*const_cast<volatile uintptr_t*>(p[Chain]));
+        InterleavedHop<Chains, Chain + 1>::run(p);
     }
-    return 0;
-#endif
-}
-#endif
+};
 
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::forwStride16Read_Word512(void* start_address, void* end_address) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::forwStride16Read_Word512(void* start_address, void* end_address) { 
-#endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_forwStride16Read_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
-    #error 512-bit words are not supported on Windows.
-#else
-    register Word512_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    //for (volatile Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 4) {
-    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 4) {
-        //UNROLL4(val = *wordptr; wordptr += 16;) 
-        UNROLL4(val = my_512b_load(wordptr); wordptr += 16;) 
-        if (wordptr >= static_cast<Word512_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-#endif
-}
-#endif
+template <uint32_t Chains>
+struct InterleavedHop<Chains, Chains> {
+    static KERNEL_INLINE void run(uintptr_t**) { }
+};
 
-int32_t xmem::revStride16Read_Word32(void* start_address, void* end_address) {
-    register Word32_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address); i < len; i += 64) {
-        UNROLL64(val = *wordptr; wordptr -= 16;) 
-        if (wordptr <= static_cast<Word32_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-}
+template <uint32_t Chains>
+struct InterleavedRound {
+    uintptr_t** p;
 
-#ifdef HAS_WORD_64
-int32_t xmem::revStride16Read_Word64(void* start_address, void* end_address) { 
-    register Word64_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address); i < len; i += 32) {
-        UNROLL32(val = *wordptr; wordptr -= 16;)
-        if (wordptr <= static_cast<Word64_t*>(start_address)) //end, modulo
-            wordptr += len;
+    KERNEL_INLINE void operator()() {
+        InterleavedHop<Chains>::run(p);
     }
-    return 0;
-}
-#endif
+};
 
-#ifdef HAS_WORD_128
-int32_t xmem::revStride16Read_Word128(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_revStride16Read_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
-#else
-    register Word128_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address); i < len; i += 16) {
-        UNROLL16(val = *wordptr; wordptr -= 16;)
-        if (wordptr <= static_cast<Word128_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-#endif
-}
-#endif
+template <uint32_t Chains>
+int32_t xmem::chaseInterleavedPointers(uintptr_t* heads, uintptr_t** last_touched_address, size_t len) {
+    static_assert(LATENCY_BENCHMARK_UNROLL_LENGTH % Chains == 0, "Every chain must make the same number of hops");
+    uintptr_t* p[Chains];
+    for (uint32_t c = 0; c < Chains; c++)
+        p[c] = reinterpret_cast<uintptr_t*>(heads[c]);
 
-#ifdef HAS_WORD_256
-int32_t xmem::revStride16Read_Word256(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_revStride16Read_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
-#else
-    register Word256_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address); i < len; i += 8) {
-        UNROLL8(val = *wordptr; wordptr -= 16;)
-        if (wordptr <= static_cast<Word256_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-    return 0;
-#endif
-}
-#endif
+    InterleavedRound<Chains> round = { p };
+    KernelUnroll<LATENCY_BENCHMARK_UNROLL_LENGTH / Chains>::run(round);
 
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::revStride16Read_Word512(void* start_address, void* end_address) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::revStride16Read_Word512(void* start_address, void* end_address) { 
-#endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_revStride16Read_Word512(static_cast<Word512_t*>(end_address), static_cast<Word512_t*>(start_address));
-    #error 512-bit words are not supported on Windows.
-#else
-    register Word512_t val; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    //for (volatile Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 4) {
-    for (Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 4) {
-        //UNROLL4(val = *wordptr; wordptr -= 16;)
-        UNROLL4(val = my_512b_load(wordptr); wordptr -= 16;)
-        if (wordptr <= static_cast<Word512_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
+    for (uint32_t c = 0; c < Chains; c++)
+        heads[c] = reinterpret_cast<uintptr_t>(p[c]);
+    *last_touched_address = heads;
     return 0;
-#endif
 }
-#endif
 
-/* ------------ STRIDE 16 WRITE --------------*/
+template int32_t xmem::chaseInterleavedPointers<2>(uintptr_t*, uintptr_t**, size_t);
+template int32_t xmem::chaseInterleavedPointers<4>(uintptr_t*, uintptr_t**, size_t);
+template int32_t xmem::chaseInterleavedPointers<8>(uintptr_t*, uintptr_t**, size_t);
+template int32_t xmem::chaseInterleavedPointers<16>(uintptr_t*, uintptr_t**, size_t);
+template int32_t xmem::chaseInterleavedPointers<32>(uintptr_t*, uintptr_t**, size_t);
 
-int32_t xmem::forwStride16Write_Word32(void* start_address, void* end_address) {
-    register Word32_t val = 0xFFFFFFFF; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(start_address); i < len; i += 64) {
-        UNROLL64(*wordptr = val; wordptr += 16;)
-        if (wordptr >= static_cast<Word32_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-}
 
-#ifdef HAS_WORD_64
-int32_t xmem::forwStride16Write_Word64(void* start_address, void* end_address) {
-    register Word64_t val = 0xFFFFFFFFFFFFFFFF; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(start_address); i < len; i += 32) {
-        UNROLL32(*wordptr = val; wordptr += 16;)
-        if (wordptr >= static_cast<Word64_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-}
-#endif
+/***********************************************************************
+ ***********************************************************************
+ ******************* THROUGHPUT-RELATED BENCHMARK KERNELS **************
+ ***********************************************************************
+ ***********************************************************************/
 
-#ifdef HAS_WORD_128
-int32_t xmem::forwStride16Write_Word128(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_forwStride16Write_Word128(static_cast<Word128_t*>(start_address), static_cast<Word128_t*>(end_address));
-#else
-    register Word128_t val;
-    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(start_address); i < len; i += 16) {
-        UNROLL16(*wordptr = val; wordptr += 16;)
-        if (wordptr >= static_cast<Word128_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
-    return 0;
-#endif
-}
-#endif
+/* --------------------- DUMMY BENCHMARK ROUTINES --------------------------- */
 
-#ifdef HAS_WORD_256
-int32_t xmem::forwStride16Write_Word256(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_forwStride16Write_Word256(static_cast<Word256_t*>(start_address), static_cast<Word256_t*>(end_address));
-#else
-    register Word256_t val;
-    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address); i < len; i += 8) {
-        UNROLL8(*wordptr = val; wordptr += 16;)
-        if (wordptr >= static_cast<Word256_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
+int32_t xmem::dummy_empty(void*, void*) { 
     return 0;
-#endif
 }
-#endif
+        
+/* ------------ RANDOM LOOP --------------*/
 
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::forwStride16Write_Word512(void* start_address, void* end_address) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::forwStride16Write_Word512(void* start_address, void* end_address) { 
-#endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_forwStride16Write_Word512(static_cast<Word512_t*>(start_address), static_cast<Word512_t*>(end_address));
-    #error 512-bit words are not supported on Windows.
-#else
-    register Word512_t val;
-    uint64_t scratchptr[8] __attribute__ ((aligned(512)));
-    my_64b_set_512b_word(val, scratchptr, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    for (Word512_t* wordptr = static_cast<Word512_t*>(start_address); i < len; i += 4) {
-        UNROLL4(*wordptr = val; wordptr += 16;)
-        if (wordptr >= static_cast<Word512_t*>(end_address)) //end, modulo
-            wordptr -= len;
-    }
+#ifndef HAS_WORD_64 //special case: 32-bit architectures
+int32_t xmem::dummy_randomLoop_Word32(uintptr_t*, uintptr_t**, size_t len) {
+    volatile uintptr_t* placeholder = NULL; //Try to defeat compiler optimizations removing this method
     return 0;
-#endif
 }
 #endif
 
-int32_t xmem::revStride16Write_Word32(void* start_address, void* end_address) { 
-    register Word32_t val = 0xFFFFFFFF; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word32_t);
-    for (volatile Word32_t* wordptr = static_cast<Word32_t*>(end_address); i < len; i += 64) {
-        UNROLL64(*wordptr = val; wordptr -= 16;)
-        if (wordptr <= static_cast<Word32_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-
-    return 0;
-}
-
 #ifdef HAS_WORD_64
-int32_t xmem::revStride16Write_Word64(void* start_address, void* end_address) { 
-    register Word64_t val = 0xFFFFFFFFFFFFFFFF; 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word64_t);
-    for (volatile Word64_t* wordptr = static_cast<Word64_t*>(end_address); i < len; i += 32) {
-        UNROLL32(*wordptr = val; wordptr -= 16;)
-        if (wordptr <= static_cast<Word64_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-
+int32_t xmem::dummy_randomLoop_Word64(uintptr_t*, uintptr_t**, size_t len) {
+    volatile uintptr_t* placeholder = NULL; //Try to defeat compiler optimizations removing this method
     return 0;
 }
 #endif
 
 #ifdef HAS_WORD_128
-int32_t xmem::revStride16Write_Word128(void* start_address, void* end_address) { 
+int32_t xmem::dummy_randomLoop_Word128(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
 #if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_revStride16Write_Word128(static_cast<Word128_t*>(end_address), static_cast<Word128_t*>(start_address));
+    return 0; //TODO: Implement for Windows.
 #else
+    //TODO: check that the compiler generates this code correctly
+    volatile Word128_t* placeholder = reinterpret_cast<Word128_t*>(first_address);
     register Word128_t val;
-    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word128_t);
-    for (volatile Word128_t* wordptr = static_cast<Word128_t*>(end_address); i < len; i += 16) {
-        UNROLL16(*wordptr = val; wordptr -= 16;)
-        if (wordptr <= static_cast<Word128_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
+    volatile uintptr_t val_extract;
+    val = my_64b_set_128b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
 
-    return 0;
-#endif
-}
+#ifdef HAS_WORD_64
+    UNROLL256(val_extract = my_64b_extractLSB_128b(val);) //Extract 64 LSB.
+#else //special case: 32-bit machines
+    UNROLL256(val_extract = my_32b_extractLSB_128b(val);) //Extract 32 LSB.
 #endif
 
-#ifdef HAS_WORD_256
-int32_t xmem::revStride16Write_Word256(void* start_address, void* end_address) { 
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return win_x86_64_asm_revStride16Write_Word256(static_cast<Word256_t*>(end_address), static_cast<Word256_t*>(start_address));
-#else
-    register Word256_t val;
-    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word256_t);
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(end_address); i < len; i += 8) {
-        UNROLL8(*wordptr = val; wordptr -= 16;)
-        if (wordptr <= static_cast<Word256_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-
     return 0;
 #endif
 }
 #endif
 
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::revStride16Write_Word512(void* start_address, void* end_address) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::revStride16Write_Word512(void* start_address, void* end_address) { 
-#endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    //return win_x86_64_asm_revStride16Write_Word512(static_cast<Word512_t*>(end_address), static_cast<Word512_t*>(start_address));
-    #error 512-bit words are not supported on Windows.
-#else
-    register Word512_t val;
-    uint64_t scratchptr[8] __attribute__ ((aligned(512)));
-    my_64b_set_512b_word(val, scratchptr, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF); 
-    register uint32_t i = 0;
-    register uint32_t len = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(end_address)-reinterpret_cast<uintptr_t>(start_address)) / sizeof(Word512_t);
-    for (Word512_t* wordptr = static_cast<Word512_t*>(end_address); i < len; i += 4) {
-        UNROLL4(*wordptr = val; wordptr -= 16;)
-        if (wordptr <= static_cast<Word512_t*>(start_address)) //end, modulo
-            wordptr += len;
-    }
-
-    return 0;
-#endif
-}
-#endif
+/* -------------------- CORE BENCHMARK ROUTINES -------------------------- 
+ *
+ * These routines access the memory in different ways for each benchmark type.
+ * Optimization tricks include:
+ *   - register keyword to hint to compiler values that should not be used in memory access
+ *   - UNROLL macros to manual loop unrolling. This reduces the relative branch overhead of the loop.
+ *     We don't want to benchmark loops, we want to benchmark memory!
+ *   - volatile keyword to prevent compiler from optimizing the code and removing instructions that we need.
+ *     The compiler is too smart for its own good!
+ *   - Hardcoding chunk sizes in each benchmark snippet, so that way they do not have to waste cycles being computed at runtime.
+ *     The sequential and strided kernels get the same effect from the templates in kernel_templates.h, where stride and chunk size are template parameters.
+ *
+ * ----------------------------------------------------------------------- */
 
 /* ------------ RANDOM READ --------------*/
 
@@ -3718,51 +905,6 @@ int32_t xmem::randomRead_Word128(uintptr_t* first_address, uintptr_t** last_touc
 }
 #endif
 
-#ifdef HAS_WORD_256
-int32_t xmem::randomRead_Word256(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return 0; //TODO: Implement for Windows.
-#else
-    volatile Word256_t* p = reinterpret_cast<Word256_t*>(first_address);
-    register Word256_t val;
-
-#ifdef HAS_WORD_64
-    UNROLL128(val = *p; p = reinterpret_cast<Word256_t*>(my_64b_extractLSB_256b(val));) //Do 256-bit load. Then extract 64 LSB to use as next load address.
-#else //special case: 32-bit machine
-    UNROLL128(val = *p; p = reinterpret_cast<Word256_t*>(my_32b_extractLSB_256b(val));) //Do 256-bit load. Then extract 32 LSB to use as next load address.
-#endif
-
-    *last_touched_address = reinterpret_cast<uintptr_t*>(const_cast<Word256_t*>(p)); //Trick compiler. First get rid of volatile qualifier, and then reinterpret pointer
-    return 0;
-#endif
-}
-#endif
-
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::randomRead_Word512(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::randomRead_Word512(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
-#endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    #error 512-bit words are not supported on Windows.
-#else
-    //volatile Word512_t* p = reinterpret_cast<Word512_t*>(first_address);
-    Word512_t* p = reinterpret_cast<Word512_t*>(first_address);
-    register Word512_t val;
-
-    //UNROLL64(val = *p; p = reinterpret_cast<Word512_t*>(my_64b_extractLSB_512b(val));) //Do 512-bit load. Then extract 64 LSB to use as next load address.
-    uint64_t scratchptr[8] __attribute__ ((aligned(512)));
-    uint64_t tmp;
-    UNROLL64(val = my_512b_load(p); my_64b_extractLSB_512b(tmp, scratchptr, val); p = reinterpret_cast<Word512_t*>(tmp);) //Do 512-bit load. Then extract 64 LSB to use as next load address.
-
-    *last_touched_address = reinterpret_cast<uintptr_t*>(const_cast<Word512_t*>(p)); //Trick compiler. First get rid of volatile qualifier, and then reinterpret pointer
-    return 0;
-#endif
-}
-#endif
-
 /* ------------ RANDOM WRITE --------------*/
 
 #ifndef HAS_WORD_64 //special case: 32-bit machine
@@ -3807,47 +949,189 @@ int32_t xmem::randomWrite_Word128(uintptr_t* first_address, uintptr_t** last_tou
 }
 #endif
 
-#ifdef HAS_WORD_256
-int32_t xmem::randomWrite_Word256(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-    return 0; //TODO: Implement for Windows.
-#else
-    volatile Word256_t* p = reinterpret_cast<Word256_t*>(first_address);
-    register Word256_t val;
+/* ------------ INDEPENDENT RANDOM ACCESS --------------*/
 
-#ifdef HAS_WORD_64
-    UNROLL128(val = *p; *p = val; p = reinterpret_cast<Word256_t*>(my_64b_extractLSB_256b(val));) //Do 256-bit load. Then do 256-bit store. Then extract 64 LSB to use as next load address.
-#else //special case: 32-bit machine
-    UNROLL128(val = *p; *p = val; p = reinterpret_cast<Word256_t*>(my_32b_extractLSB_256b(val));) //Do 256-bit load. Then do 256-bit store. Then extract 32 LSB to use as next load address.
+/**
+ * @brief Advances an xorshift64 generator (Marsaglia, 2003). Three shifts and XORs per number keep address generation much cheaper than a miss.
+ * @param x Current state. Must not be zero.
+ * @returns The next state, which is also the random number.
+ */
+static inline uint64_t xorshift64(uint64_t x) {
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    return x;
+}
+
+/**
+ * @brief Body shared by the scalar independent random-access kernels. Four streams are interleaved so that address generation stays off the critical path and several misses can be in flight.
+ * @tparam WordT The chunk type.
+ * @tparam Access Functor that touches a location, given the random number that picked it.
+ */
+template <typename WordT, typename Access>
+static KERNEL_INLINE void independent_random_loop(void* table, size_t table_len, uint64_t* streams, size_t len, Access& access) {
+    WordT* words = static_cast<WordT*>(table);
+    size_t mask = table_len / sizeof(WordT) - 1;
+    uint64_t s0 = streams[0];
+    uint64_t s1 = streams[1];
+    uint64_t s2 = streams[2];
+    uint64_t s3 = streams[3];
+
+    for (size_t i = 0; i < len / sizeof(WordT); i += 4) {
+        s0 = xorshift64(s0);
+        s1 = xorshift64(s1);
+        s2 = xorshift64(s2);
+        s3 = xorshift64(s3);
+        access(words + (s0 & mask), s0);
+        access(words + (s1 & mask), s1);
+        access(words + (s2 & mask), s2);
+        access(words + (s3 & mask), s3);
+    }
+
+    streams[0] = s0;
+    streams[1] = s1;
+    streams[2] = s2;
+    streams[3] = s3;
+}
+
+int32_t xmem::dummy_independentLoop(void*, size_t, uint64_t*, size_t) {
+    volatile uint64_t* placeholder = NULL; //Try to defeat compiler optimizations removing this method
+    return 0;
+}
+
+template <typename WordT>
+struct IndependentReadAccess {
+    KERNEL_INLINE void operator()(WordT* p, uint64_t) { WordT val = *const_cast<volatile WordT*>(p); (void)val; }
+};
+
+template <typename WordT>
+struct IndependentUpdateAccess {
+    KERNEL_INLINE void operator()(WordT* p, uint64_t r) { volatile WordT* v = p; *v = *v ^ static_cast<WordT>(r); }
+};
+
+#ifdef HAS_NT_STORES
+template <typename WordT>
+struct IndependentWriteNTAccess {
+    KERNEL_INLINE void operator()(WordT* p, uint64_t r) { my_stream(p, static_cast<WordT>(r)); }
+};
 #endif
 
-    *last_touched_address = reinterpret_cast<uintptr_t*>(const_cast<Word256_t*>(p)); //Trick compiler. First get rid of volatile qualifier, and then reinterpret pointer
+int32_t xmem::independentRead_Word32(void* table, size_t table_len, uint64_t* streams, size_t len) {
+    IndependentReadAccess<Word32_t> access;
+    independent_random_loop<Word32_t>(table, table_len, streams, len, access);
+    return 0;
+}
+
+int32_t xmem::independentUpdate_Word32(void* table, size_t table_len, uint64_t* streams, size_t len) {
+    IndependentUpdateAccess<Word32_t> access;
+    independent_random_loop<Word32_t>(table, table_len, streams, len, access);
+    return 0;
+}
+
+#ifdef HAS_WORD_64
+int32_t xmem::independentRead_Word64(void* table, size_t table_len, uint64_t* streams, size_t len) {
+    IndependentReadAccess<Word64_t> access;
+    independent_random_loop<Word64_t>(table, table_len, streams, len, access);
+    return 0;
+}
+
+int32_t xmem::independentUpdate_Word64(void* table, size_t table_len, uint64_t* streams, size_t len) {
+    IndependentUpdateAccess<Word64_t> access;
+    independent_random_loop<Word64_t>(table, table_len, streams, len, access);
     return 0;
+}
 #endif
+
+#ifdef HAS_NT_STORES
+int32_t xmem::independentWriteNT_Word32(void* table, size_t table_len, uint64_t* streams, size_t len) {
+    IndependentWriteNTAccess<Word32_t> access;
+    independent_random_loop<Word32_t>(table, table_len, streams, len, access);
+    _mm_sfence(); //Streaming stores are weakly ordered, so drain them before the pass ends
+    return 0;
+}
+
+#ifdef HAS_WORD_64
+int32_t xmem::independentWriteNT_Word64(void* table, size_t table_len, uint64_t* streams, size_t len) {
+    IndependentWriteNTAccess<Word64_t> access;
+    independent_random_loop<Word64_t>(table, table_len, streams, len, access);
+    _mm_sfence(); //Streaming stores are weakly ordered, so drain them before the pass ends
+    return 0;
 }
 #endif
+#endif
 
-#ifdef HAS_WORD_512
-#ifdef _WIN32
-int32_t xmem::randomWrite_Word512(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
-#else
-//FIXME: We flag GCC/ICC not to optimize this function. The problem is that my_512b_load() -- which maps to _mm512_load_epi64 Intel AVX-512/KNC intrinsic -- cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly or allow eventual support for assignment of __m512i variables, e.g., val = *wordptr++; which is how the code for the other word sizes is written.
-int32_t __attribute__((optimize("O0"))) xmem::randomWrite_Word512(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
+/***********************************************************************
+ ***********************************************************************
+ ******************* CONTENTION-RELATED BENCHMARK KERNELS **************
+ ***********************************************************************
+ ***********************************************************************/
+
+//The operations are unrolled 16 times per loop iteration. The loop overhead is charged to the dummy, and is small next to any contended operation.
+#if CONTENTION_BENCHMARK_OPS_PER_PASS % 16 != 0
+#error CONTENTION_BENCHMARK_OPS_PER_PASS must be a multiple of 16!
 #endif
-#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
-#error 512-bit words are not supported on Windows.
-#else
-    //volatile Word512_t* p = reinterpret_cast<Word512_t*>(first_address);
-    Word512_t* p = reinterpret_cast<Word512_t*>(first_address);
-    register Word512_t val;
 
-    //UNROLL64(val = *p; *p = val; p = reinterpret_cast<Word512_t*>(my_64b_extractLSB_512b(val));) //Do 512-bit load. Then do 512-bit store. Then extract 64 LSB to use as next load address.
-    uint64_t scratchptr[8] __attribute__ ((aligned(512)));
-    uint64_t tmp;
-    UNROLL64(val = my_512b_load(p); *p = val; my_64b_extractLSB_512b(tmp, scratchptr, val); p = reinterpret_cast<Word512_t*>(tmp);) //Do 512-bit load. Then do 512-bit store. Then extract 64 LSB to use as next load address.
+/* --------------------- DUMMY BENCHMARK ROUTINES --------------------------- */
+
+int32_t xmem::dummy_contentionLoop(void* target, uintptr_t* value) {
+    volatile uintptr_t placeholder = 0; //Try to defeat compiler optimizations removing this method
+    for (uint32_t i = 0; i < CONTENTION_BENCHMARK_OPS_PER_PASS / 16; i++)
+        placeholder = i;
+    return 0;
+}
+
+/* -------------------- CORE BENCHMARK ROUTINES -------------------------- */
 
-    *last_touched_address = reinterpret_cast<uintptr_t*>(const_cast<Word512_t*>(p)); //Trick compiler. First get rid of volatile qualifier, and then reinterpret pointer
+int32_t xmem::contentionXadd(void* target, uintptr_t* value) {
+    std::atomic<uintptr_t>* t = static_cast<std::atomic<uintptr_t>*>(target);
+    uintptr_t v = *value;
+    for (uint32_t i = 0; i < CONTENTION_BENCHMARK_OPS_PER_PASS / 16; i++) {
+        UNROLL16(v += t->fetch_add(1);)
+    }
+    *value = v;
+    return 0;
+}
+
+int32_t xmem::contentionCmpxchg(void* target, uintptr_t* value) {
+    std::atomic<uintptr_t>* t = static_cast<std::atomic<uintptr_t>*>(target);
+    uintptr_t expected = t->load(std::memory_order_relaxed);
+    uintptr_t failures = *value;
+    for (uint32_t i = 0; i < CONTENTION_BENCHMARK_OPS_PER_PASS / 16; i++) {
+        UNROLL16(
+            if (t->compare_exchange_strong(expected, expected + 1))
+                expected++;
+            else
+                failures++;
+        )
+    }
+    *value = failures;
+    return 0;
+}
+
+int32_t xmem::contentionXchg(void* target, uintptr_t* value) {
+    std::atomic<uintptr_t>* t = static_cast<std::atomic<uintptr_t>*>(target);
+    uintptr_t v = *value;
+    for (uint32_t i = 0; i < CONTENTION_BENCHMARK_OPS_PER_PASS / 16; i++) {
+        UNROLL16(v = t->exchange(v + 1);)
+    }
+    *value = v;
+    return 0;
+}
+
+int32_t xmem::contentionStore(void* target, uintptr_t* value) {
+    std::atomic<uintptr_t>* t = static_cast<std::atomic<uintptr_t>*>(target);
+    uintptr_t v = *value;
+    for (uint32_t i = 0; i < CONTENTION_BENCHMARK_OPS_PER_PASS / 16; i++) {
+        UNROLL16(t->store(v++, std::memory_order_relaxed);)
+    }
+    *value = v;
+    return 0;
+}
+
+int32_t xmem::contentionIncrement(void* target, uintptr_t* value) {
+    std::atomic<uintptr_t>* t = static_cast<std::atomic<uintptr_t>*>(target);
+    for (uint32_t i = 0; i < CONTENTION_BENCHMARK_OPS_PER_PASS / 16; i++) {
+        UNROLL16(t->store(t->load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);)
+    }
     return 0;
-#endif
 }
-#endif
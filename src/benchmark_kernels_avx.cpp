@@ -0,0 +1,134 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ * 
+ * @brief Implementation file for the 256-bit benchmark kernels.
+ * On x86-64 Linux this translation unit is built with -mavx while the rest of X-Mem stays runnable on CPUs without AVX.
+ * The kernels here are only ever selected by determine_sequential_kernel() and friends after detect_isa_extensions() has confirmed support at run time.
+ */
+
+//Headers
+#include <benchmark_kernels.h>
+#include <common.h>
+#include <kernel_intrinsics.h>
+#include <kernel_templates.h>
+
+using namespace xmem;
+
+/***********************************************************************
+ ***********************************************************************
+ ******************* THROUGHPUT-RELATED BENCHMARK KERNELS **************
+ ***********************************************************************
+ ***********************************************************************/
+
+/* ------------ SEQUENTIAL AND STRIDED --------------*/
+
+#ifdef HAS_WORD_256
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+WIN_X86_64_ASM_STRIDED_KERNELS(Word256, Sequential, 1)
+WIN_X86_64_ASM_STRIDED_KERNELS(Word256, Stride2, 2)
+WIN_X86_64_ASM_STRIDED_KERNELS(Word256, Stride4, 4)
+WIN_X86_64_ASM_STRIDED_KERNELS(Word256, Stride8, 8)
+WIN_X86_64_ASM_STRIDED_KERNELS(Word256, Stride16, 16)
+#endif
+
+template const SequentialKernelEntry* xmem::sequential_kernel_table<Word256_t>(size_t*);
+
+#if !(defined(_WIN32) && defined(ARCH_INTEL_X86_64)) //Like the other random kernels, these are not implemented for Windows yet
+template int32_t xmem::randomMixed<Word256_t, 1>(uintptr_t*, uintptr_t**, size_t);
+template int32_t xmem::randomMixed<Word256_t, 2>(uintptr_t*, uintptr_t**, size_t);
+template int32_t xmem::randomMixed<Word256_t, 3>(uintptr_t*, uintptr_t**, size_t);
+#endif
+#endif
+
+/* ------------ RANDOM LOOP --------------*/
+
+#ifdef HAS_WORD_256
+int32_t xmem::dummy_randomLoop_Word256(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return 0; //TODO: Implement for Windows.
+#else
+    //TODO: check that the compiler generates this code correctly
+    volatile Word256_t* placeholder = reinterpret_cast<Word256_t*>(first_address);
+    register Word256_t val;
+    volatile uintptr_t val_extract;
+    val = my_64b_set_256b_word(0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF);
+
+#ifdef HAS_WORD_64
+        UNROLL128(val_extract = my_64b_extractLSB_256b(val);) //Extract 64 LSB.
+#else //special case: 32-bit machines
+        UNROLL128(val_extract = my_32b_extractLSB_256b(val);) //Extract 32 LSB.
+#endif
+
+    return 0;
+#endif
+}
+#endif
+
+/* ------------ RANDOM READ --------------*/
+
+#ifdef HAS_WORD_256
+int32_t xmem::randomRead_Word256(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return 0; //TODO: Implement for Windows.
+#else
+    volatile Word256_t* p = reinterpret_cast<Word256_t*>(first_address);
+    register Word256_t val;
+
+#ifdef HAS_WORD_64
+    UNROLL128(val = *p; p = reinterpret_cast<Word256_t*>(my_64b_extractLSB_256b(val));) //Do 256-bit load. Then extract 64 LSB to use as next load address.
+#else //special case: 32-bit machine
+    UNROLL128(val = *p; p = reinterpret_cast<Word256_t*>(my_32b_extractLSB_256b(val));) //Do 256-bit load. Then extract 32 LSB to use as next load address.
+#endif
+
+    *last_touched_address = reinterpret_cast<uintptr_t*>(const_cast<Word256_t*>(p)); //Trick compiler. First get rid of volatile qualifier, and then reinterpret pointer
+    return 0;
+#endif
+}
+#endif
+
+/* ------------ RANDOM WRITE --------------*/
+
+#ifdef HAS_WORD_256
+int32_t xmem::randomWrite_Word256(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return 0; //TODO: Implement for Windows.
+#else
+    volatile Word256_t* p = reinterpret_cast<Word256_t*>(first_address);
+    register Word256_t val;
+
+#ifdef HAS_WORD_64
+    UNROLL128(val = *p; *p = val; p = reinterpret_cast<Word256_t*>(my_64b_extractLSB_256b(val));) //Do 256-bit load. Then do 256-bit store. Then extract 64 LSB to use as next load address.
+#else //special case: 32-bit machine
+    UNROLL128(val = *p; *p = val; p = reinterpret_cast<Word256_t*>(my_32b_extractLSB_256b(val));) //Do 256-bit load. Then do 256-bit store. Then extract 32 LSB to use as next load address.
+#endif
+
+    *last_touched_address = reinterpret_cast<uintptr_t*>(const_cast<Word256_t*>(p)); //Trick compiler. First get rid of volatile qualifier, and then reinterpret pointer
+    return 0;
+#endif
+}
+#endif
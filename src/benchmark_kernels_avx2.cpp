@@ -0,0 +1,98 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ * 
+ * @brief Implementation file for the AVX2 gather kernels used by independent random-access throughput benchmarks.
+ * On x86-64 Linux this translation unit is built with -mavx2. The kernels here are only ever selected by determine_independent_random_kernel() after detect_isa_extensions() has confirmed AVX2 support at run time.
+ */
+
+//Headers
+#include <benchmark_kernels.h>
+#include <common.h>
+#include <kernel_intrinsics.h>
+
+using namespace xmem;
+
+#ifdef HAS_GATHER_KERNELS
+/**
+ * @brief Advances four xorshift64 generators at once, one per 64-bit lane.
+ * @param x Current states.
+ * @returns The next states, which are also the random numbers.
+ */
+static inline __m256i xorshift64_256(__m256i x) {
+    x = _mm256_xor_si256(x, _mm256_slli_epi64(x, 13));
+    x = _mm256_xor_si256(x, _mm256_srli_epi64(x, 7));
+    x = _mm256_xor_si256(x, _mm256_slli_epi64(x, 17));
+    return x;
+}
+
+/* ------------ INDEPENDENT RANDOM READ --------------*/
+
+int32_t xmem::independentRead_Word128(void* table, size_t table_len, uint64_t* streams, size_t len) {
+    const long long* base = static_cast<const long long*>(table);
+    __m256i s0 = _mm256_loadu_si256(reinterpret_cast<__m256i*>(streams));
+    __m256i s1 = _mm256_loadu_si256(reinterpret_cast<__m256i*>(streams + 4));
+    const __m256i mask = _mm256_set1_epi64x(static_cast<long long>(table_len - sizeof(uint64_t))); //Byte offsets of 64-bit words within the table
+    __m128i acc = _mm_setzero_si128();
+
+    for (size_t i = 0; i < len; i += 4 * sizeof(Word128_t)) {
+        s0 = xorshift64_256(s0);
+        s1 = xorshift64_256(s1);
+        __m256i off0 = _mm256_and_si256(s0, mask);
+        __m256i off1 = _mm256_and_si256(s1, mask);
+        acc = _mm_xor_si128(acc, _mm_i64gather_epi64(base, _mm256_castsi256_si128(off0), 1)); //Gather two 64-bit words from independent addresses. Corresponds to "vpgatherqq" instruction.
+        acc = _mm_xor_si128(acc, _mm_i64gather_epi64(base, _mm256_extracti128_si256(off0, 1), 1));
+        acc = _mm_xor_si128(acc, _mm_i64gather_epi64(base, _mm256_castsi256_si128(off1), 1));
+        acc = _mm_xor_si128(acc, _mm_i64gather_epi64(base, _mm256_extracti128_si256(off1, 1), 1));
+    }
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(streams), s0);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(streams + 4), s1);
+    volatile Word128_t placeholder = acc; //Consume the gathered data so the compiler keeps the loads
+    return 0;
+}
+
+int32_t xmem::independentRead_Word256(void* table, size_t table_len, uint64_t* streams, size_t len) {
+    const long long* base = static_cast<const long long*>(table);
+    __m256i s0 = _mm256_loadu_si256(reinterpret_cast<__m256i*>(streams));
+    __m256i s1 = _mm256_loadu_si256(reinterpret_cast<__m256i*>(streams + 4));
+    const __m256i mask = _mm256_set1_epi64x(static_cast<long long>(table_len - sizeof(uint64_t)));
+    __m256i acc = _mm256_setzero_si256();
+
+    for (size_t i = 0; i < len; i += 2 * sizeof(Word256_t)) {
+        s0 = xorshift64_256(s0);
+        s1 = xorshift64_256(s1);
+        acc = _mm256_xor_si256(acc, _mm256_i64gather_epi64(base, _mm256_and_si256(s0, mask), 1)); //Gather four 64-bit words from independent addresses. Corresponds to "vpgatherqq" instruction.
+        acc = _mm256_xor_si256(acc, _mm256_i64gather_epi64(base, _mm256_and_si256(s1, mask), 1));
+    }
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(streams), s0);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(streams + 4), s1);
+    volatile Word256_t placeholder = acc;
+    return 0;
+}
+#endif
@@ -0,0 +1,174 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ * 
+ * @brief Implementation file for the 512-bit benchmark kernels.
+ * On x86-64 Linux this translation unit is built with -mavx512f while the rest of X-Mem stays runnable on CPUs without AVX-512F.
+ * The kernels here are only ever selected by determine_sequential_kernel() and friends after detect_isa_extensions() has confirmed support at run time.
+ * This includes the gather and scatter kernels for independent random accesses.
+ */
+
+//Headers
+#include <benchmark_kernels.h>
+#include <common.h>
+#include <kernel_intrinsics.h>
+#include <kernel_templates.h>
+
+using namespace xmem;
+
+/***********************************************************************
+ ***********************************************************************
+ ******************* THROUGHPUT-RELATED BENCHMARK KERNELS **************
+ ***********************************************************************
+ ***********************************************************************/
+
+/* ------------ SEQUENTIAL AND STRIDED --------------*/
+
+#ifdef HAS_WORD_512
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+#error 512-bit words are not supported on Windows.
+#endif
+
+template const SequentialKernelEntry* xmem::sequential_kernel_table<Word512_t>(size_t*);
+
+template int32_t xmem::randomMixed<Word512_t, 1>(uintptr_t*, uintptr_t**, size_t);
+template int32_t xmem::randomMixed<Word512_t, 2>(uintptr_t*, uintptr_t**, size_t);
+template int32_t xmem::randomMixed<Word512_t, 3>(uintptr_t*, uintptr_t**, size_t);
+#endif
+
+/* ------------ RANDOM LOOP --------------*/
+
+#ifdef HAS_WORD_512
+int32_t MIC_NO_OPTIMIZE xmem::dummy_randomLoop_Word512(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    return 0; //TODO: Implement for Windows.
+#else
+    volatile Word512_t* placeholder = reinterpret_cast<Word512_t*>(first_address);
+    Word512_t val = _mm512_set1_epi64(-1);
+    volatile uintptr_t val_extract;
+
+    UNROLL64(val_extract = my_64b_extractLSB_512b_reg(val);) //Extract 64 LSB.
+
+    return 0;
+#endif
+}
+#endif
+
+/* ------------ RANDOM READ --------------*/
+
+#ifdef HAS_WORD_512
+int32_t MIC_NO_OPTIMIZE xmem::randomRead_Word512(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+    #error 512-bit words are not supported on Windows.
+#else
+    Word512_access_t* p = reinterpret_cast<Word512_t*>(first_address);
+    Word512_t val;
+
+    UNROLL64(val = my_512b_load(p); p = reinterpret_cast<Word512_t*>(my_64b_extractLSB_512b_reg(val));) //Do 512-bit load. Then extract 64 LSB to use as next load address.
+
+    *last_touched_address = reinterpret_cast<uintptr_t*>(const_cast<Word512_t*>(p)); //Trick compiler. First get rid of volatile qualifier, and then reinterpret pointer
+    return 0;
+#endif
+}
+#endif
+
+/* ------------ RANDOM WRITE --------------*/
+
+#ifdef HAS_WORD_512
+int32_t MIC_NO_OPTIMIZE xmem::randomWrite_Word512(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len) {
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+#error 512-bit words are not supported on Windows.
+#else
+    Word512_access_t* p = reinterpret_cast<Word512_t*>(first_address);
+    Word512_t val;
+
+    UNROLL64(val = my_512b_load(p); *p = val; p = reinterpret_cast<Word512_t*>(my_64b_extractLSB_512b_reg(val));) //Do 512-bit load. Then do 512-bit store. Then extract 64 LSB to use as next load address.
+
+    *last_touched_address = reinterpret_cast<uintptr_t*>(const_cast<Word512_t*>(p)); //Trick compiler. First get rid of volatile qualifier, and then reinterpret pointer
+    return 0;
+#endif
+}
+#endif
+
+#ifdef HAS_GATHER_KERNELS
+/**
+ * @brief Advances eight xorshift64 generators at once, one per 64-bit lane.
+ * @param x Current states.
+ * @returns The next states, which are also the random numbers.
+ */
+static inline __m512i xorshift64_512(__m512i x) {
+    //The zero-masked shifts compile to the same instructions as the plain ones, whose GCC versions pass an uninitialized placeholder vector that -Wall reports
+    x = _mm512_xor_si512(x, _mm512_maskz_slli_epi64(0xFF, x, 13));
+    x = _mm512_xor_si512(x, _mm512_maskz_srli_epi64(0xFF, x, 7));
+    x = _mm512_xor_si512(x, _mm512_maskz_slli_epi64(0xFF, x, 17));
+    return x;
+}
+
+/**
+ * @brief Gathers eight 64-bit words with all lanes enabled. This is the same "vpgatherqq" as _mm512_i64gather_epi64(), but with a defined pass-through vector, which keeps -Wall quiet on GCC.
+ * @param index Byte offsets of the words.
+ * @param base Base address of the table.
+ * @returns The gathered words.
+ */
+static inline __m512i gather64_512(__m512i index, const void* base) {
+    return _mm512_mask_i64gather_epi64(_mm512_setzero_si512(), 0xFF, index, base, 1);
+}
+
+/* ------------ INDEPENDENT RANDOM READ --------------*/
+
+int32_t xmem::independentRead_Word512(void* table, size_t table_len, uint64_t* streams, size_t len) {
+    __m512i s = _mm512_loadu_si512(streams);
+    const __m512i mask = _mm512_set1_epi64(static_cast<long long>(table_len - sizeof(uint64_t))); //Byte offsets of 64-bit words within the table
+    __m512i acc = _mm512_setzero_si512();
+
+    for (size_t i = 0; i < len; i += sizeof(Word512_t)) {
+        s = xorshift64_512(s);
+        acc = _mm512_xor_si512(acc, gather64_512(_mm512_and_si512(s, mask), table)); //Gather eight 64-bit words from independent addresses. Corresponds to "vpgatherqq" instruction.
+    }
+
+    _mm512_storeu_si512(streams, s);
+    volatile Word512_t placeholder = acc; //Consume the gathered data so the compiler keeps the loads
+    return 0;
+}
+
+/* ------------ INDEPENDENT RANDOM UPDATE --------------*/
+
+int32_t xmem::independentUpdate_Word512(void* table, size_t table_len, uint64_t* streams, size_t len) {
+    __m512i s = _mm512_loadu_si512(streams);
+    const __m512i mask = _mm512_set1_epi64(static_cast<long long>(table_len - sizeof(uint64_t)));
+
+    for (size_t i = 0; i < len; i += sizeof(Word512_t)) {
+        s = xorshift64_512(s);
+        __m512i off = _mm512_and_si512(s, mask);
+        __m512i val = gather64_512(off, table);
+        _mm512_i64scatter_epi64(table, off, _mm512_xor_si512(val, s), 1); //Scatter the updated words back. Corresponds to "vpscatterqq" instruction.
+    }
+
+    _mm512_storeu_si512(streams, s);
+    return 0;
+}
+#endif
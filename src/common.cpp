@@ -49,7 +49,9 @@
 #include <numa.h>
 #endif
 #include <fstream> //for std::ifstream
+#include <sstream> //for std::ostringstream
 #include <algorithm> //for std::find
+#include <cstdio> //for std::sscanf
 
 #ifdef ARCH_INTEL
 #include <immintrin.h> //for timer
@@ -61,11 +63,6 @@
 #include <time.h>
 #endif
 
-#ifdef HAS_LARGE_PAGES
-extern "C" {
-#include <hugetlbfs.h> //for getting huge page size
-}
-#endif
 #endif
 
 namespace xmem {
@@ -78,6 +75,8 @@ namespace xmem {
     uint32_t g_num_physical_cpus; /**< Number of physical CPU cores in the system. */
     uint32_t g_num_physical_packages; /**< Number of physical CPU packages in the system. Generally this is the same as number of NUMA nodes, unless UMA emulation is done in hardware. */
     std::vector<uint32_t> g_physical_package_of_cpu; /**< Mapping of logical CPU cores in the system to the according physical package that they belong. */
+    std::vector<uint32_t> g_physical_core_of_cpu; /**< Mapping of logical CPU cores in the system to the lowest-numbered logical CPU of the same physical core. SMT siblings have the same entry. */
+    std::vector<uint32_t> g_l3_cache_of_cpu; /**< Mapping of logical CPU cores in the system to the lowest-numbered logical CPU that shares their L3 cache. */
     uint32_t g_total_l1_caches; /**< Total number of L1 caches in the system. */
     uint32_t g_total_l2_caches; /**< Total number of L2 caches in the system. */
     uint32_t g_total_l3_caches; /**< Total number of L3 caches in the system. */
@@ -86,6 +85,20 @@ namespace xmem {
     uint32_t g_test_index; /**< Numeric identifier for the current benchmark test. */
     tick_t g_ticks_per_ms; /**< Timer ticks per ms. */
     float g_ns_per_tick; /**< Nanoseconds per timer tick. */
+    timer_backend_t g_timer_backend = DEFAULT_TIMER_BACKEND; /**< Timer backend used by start_timer() and stop_timer(). */
+    float g_timer_overhead_ns; /**< Minimum cost of a back-to-back start_timer()/stop_timer() pair, in nanoseconds. */
+    float g_timer_resolution_ns; /**< Smallest nonzero difference observed between two timer reads, in nanoseconds. */
+    uint64_t g_random_seed = DEFAULT_RANDOM_SEED; /**< Seed for all random pointer chains. */
+    chain_granularity_t g_chain_granularity = DEFAULT_CHAIN_GRANULARITY; /**< Node spacing of the pointer chains walked by latency measurement threads. */
+    bool g_chain_random_offsets = DEFAULT_CHAIN_GRANULARITY == CHAIN_PAGE; /**< If true, each node of the latency measurement chains is placed at a random chunk-aligned offset within its node spacing. */
+    uint32_t g_sample_duration_ms = DEFAULT_SAMPLE_DURATION_MS; /**< Duration of each short sample within a benchmark iteration. */
+    double g_ci_width = DEFAULT_CI_WIDTH; /**< Maximum relative distance of the 95% CI bounds of the median from the median at which sampling stops. */
+    prefetch_hint_t g_prefetch_hint = DEFAULT_PREFETCH_HINT; /**< Locality hint of the software prefetches issued by the prefetching kernels. */
+    uint32_t g_prefetch_distance = 0; /**< Distance in cache lines at which the prefetching kernels prefetch. Set by the benchmark that is currently running. */
+    bool g_cpu_has_avx = false; /**< If true, the CPU and OS support AVX, so the 256-bit kernels may run. */
+    bool g_cpu_has_avx2 = false; /**< If true, the CPU and OS support AVX2, so the gather kernels for independent random accesses may run. */
+    bool g_cpu_has_avx512f = false; /**< If true, the CPU and OS support AVX-512F, so the 512-bit kernels may run. */
+    bool g_use_jit_kernels = false; /**< If true, sequential, strided and random-access kernels are generated at run time instead of using the compiled ones. */
 };
 
 using namespace xmem;
@@ -221,6 +234,9 @@ void xmem::print_compile_time_options() {
 #endif
 #ifdef HAS_WORD_512
     std::cout << "HAS_WORD_512" << std::endl;
+#endif
+#ifdef HAS_ISA_DISPATCH
+    std::cout << "HAS_ISA_DISPATCH" << std::endl;
 #endif
     std::cout << std::endl;
     std::cout << "This binary was built with the following compile-time options:" << std::endl;
@@ -241,6 +257,9 @@ void xmem::print_compile_time_options() {
 #endif
 #ifdef USE_TSC_TIMER
     std::cout << "USE_TSC_TIMER" << std::endl;
+#endif
+#ifdef HAS_TSC_TIMER
+    std::cout << "HAS_TSC_TIMER" << std::endl;
 #endif
     //TODO: ARM timer
 #ifdef BENCHMARK_DURATION_SEC
@@ -268,17 +287,253 @@ void xmem::setup_timer() {
     Timer timer;
     g_ticks_per_ms = timer.getTicksPerMs();
     g_ns_per_tick = timer.getNsPerTick();
+    g_timer_overhead_ns = timer.getOverheadTicks() * g_ns_per_tick;
+    g_timer_resolution_ns = timer.getResolutionTicks() * g_ns_per_tick;
 
     if (g_verbose)
         std::cout << "done" << std::endl;
 }
 
 void xmem::report_timer() {
+    std::cout << "Timer backend: " << timer_backend_name(g_timer_backend);
+    if (g_timer_backend != TIMER_OS)
+        std::cout << " (invariant TSC " << (has_invariant_tsc() ? "present" : "NOT present") << ")";
+    std::cout << std::endl;
     std::cout << "Calculated timer frequency: " << g_ticks_per_ms * 1000 << " Hz == " << (double)(g_ticks_per_ms*1000) / (1e6) << " MHz" << std::endl;
     std::cout << "Derived timer ns per tick: " << g_ns_per_tick << std::endl;
+    std::cout << "Measured timer overhead: " << g_timer_overhead_ns << " ns" << std::endl;
+    std::cout << "Measured timer resolution: " << g_timer_resolution_ns << " ns" << std::endl;
     std::cout << std::endl;
 }
 
+const char* xmem::timer_backend_name(timer_backend_t backend) {
+    switch (backend) {
+        case TIMER_OS:
+            return "os";
+        case TIMER_TSC:
+            return "tsc";
+        case TIMER_INVARIANT_TSC:
+            return "invariant_tsc";
+        default:
+            return "unknown";
+    }
+}
+
+const char* xmem::chain_granularity_name(chain_granularity_t granularity) {
+    switch (granularity) {
+        case CHAIN_CHUNK:
+            return "chunk";
+        case CHAIN_CACHE_LINE:
+            return "line";
+        case CHAIN_PAGE:
+            return "page";
+        default:
+            return "unknown";
+    }
+}
+
+const char* xmem::prefetch_hint_name(prefetch_hint_t hint) {
+    switch (hint) {
+        case PREFETCH_T0:
+            return "t0";
+        case PREFETCH_T1:
+            return "t1";
+        case PREFETCH_T2:
+            return "t2";
+        case PREFETCH_NTA:
+            return "nta";
+        default:
+            return "unknown";
+    }
+}
+
+const char* xmem::rw_ratio_name(rw_mode_t rw_mode) {
+    switch (rw_mode) {
+        case READ_WRITE_1_1:
+            return "1:1";
+        case READ_WRITE_2_1:
+            return "2:1";
+        case READ_WRITE_3_1:
+            return "3:1";
+        case READ_MODIFY_WRITE:
+            return "rmw";
+        default:
+            return "unknown";
+    }
+}
+
+uint32_t xmem::rw_mode_reads_per_write(rw_mode_t rw_mode) {
+    switch (rw_mode) {
+        case READ_WRITE_1_1:
+            return 1;
+        case READ_WRITE_2_1:
+            return 2;
+        case READ_WRITE_3_1:
+            return 3;
+        default:
+            return 0;
+    }
+}
+
+const char* xmem::contention_op_name(contention_op_t op) {
+    switch (op) {
+        case CONTENTION_XADD:
+            return "xadd";
+        case CONTENTION_CMPXCHG:
+            return "cmpxchg";
+        case CONTENTION_XCHG:
+            return "xchg";
+        case CONTENTION_STORE:
+            return "store";
+        case CONTENTION_INCREMENT:
+            return "increment";
+        default:
+            return "unknown";
+    }
+}
+
+cpu_pair_relation_t xmem::cpu_pair_relation(uint32_t cpu_a, uint32_t cpu_b) {
+    if (cpu_a >= g_physical_package_of_cpu.size() || cpu_b >= g_physical_package_of_cpu.size())
+        return CPU_PAIR_CROSS_PACKAGE;
+    if (g_physical_package_of_cpu[cpu_a] != g_physical_package_of_cpu[cpu_b])
+        return CPU_PAIR_CROSS_PACKAGE;
+    if (cpu_a < g_physical_core_of_cpu.size() && cpu_b < g_physical_core_of_cpu.size() && g_physical_core_of_cpu[cpu_a] == g_physical_core_of_cpu[cpu_b])
+        return CPU_PAIR_SMT_SIBLINGS;
+    if (cpu_a < g_l3_cache_of_cpu.size() && cpu_b < g_l3_cache_of_cpu.size() && g_l3_cache_of_cpu[cpu_a] == g_l3_cache_of_cpu[cpu_b])
+        return CPU_PAIR_SHARED_L3;
+    return CPU_PAIR_SAME_PACKAGE;
+}
+
+const char* xmem::cpu_pair_relation_name(cpu_pair_relation_t relation) {
+    switch (relation) {
+        case CPU_PAIR_SMT_SIBLINGS:
+            return "SMT siblings";
+        case CPU_PAIR_SHARED_L3:
+            return "shared L3";
+        case CPU_PAIR_SAME_PACKAGE:
+            return "same package";
+        case CPU_PAIR_CROSS_PACKAGE:
+            return "cross package";
+        default:
+            return "unknown";
+    }
+}
+
+const char* xmem::page_mode_name(page_mode_t mode) {
+    switch (mode) {
+        case PAGE_MODE_DEFAULT:
+            return "default";
+        case PAGE_MODE_4KB:
+            return "4k";
+        case PAGE_MODE_THP:
+            return "thp";
+        case PAGE_MODE_2MB:
+            return "2m";
+        case PAGE_MODE_1GB:
+            return "1g";
+        default:
+            return "unknown";
+    }
+}
+
+size_t xmem::page_mode_size(page_mode_t mode) {
+    switch (mode) {
+        case PAGE_MODE_THP:
+            return g_large_page_size;
+        case PAGE_MODE_2MB:
+            return 2*MB;
+        case PAGE_MODE_1GB:
+            return GB;
+        default:
+            return g_page_size;
+    }
+}
+
+const char* xmem::prefault_mode_name(prefault_mode_t mode) {
+    switch (mode) {
+        case PREFAULT_NONE:
+            return "none";
+        case PREFAULT_POPULATE:
+            return "populate";
+        case PREFAULT_THREADS:
+            return "threads";
+        default:
+            return "unknown";
+    }
+}
+
+bool xmem::has_invariant_tsc() {
+#ifdef HAS_TSC_TIMER
+    //CPUID leaf 0x80000007 (advanced power management), EDX bit 8 is the invariant TSC flag on both Intel and AMD.
+#ifdef _WIN32
+    int32_t regs[4];
+    __cpuid(regs, 0x80000000);
+    if (static_cast<uint32_t>(regs[0]) < 0x80000007)
+        return false;
+    __cpuid(regs, 0x80000007);
+    return (regs[3] & (1 << 8)) != 0;
+#endif
+#ifdef __gnu_linux__
+    uint32_t eax, ebx, ecx, edx;
+    if (__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) == 0) //leaf not supported
+        return false;
+    return (edx & (1 << 8)) != 0;
+#endif
+#else
+    return false;
+#endif
+}
+
+void xmem::detect_isa_extensions() {
+#ifdef HAS_ISA_DISPATCH
+    //CPUID leaf 1, ECX bit 27 is OSXSAVE and bit 28 is AVX. The OS must also have enabled the register state through XCR0, or the instructions fault.
+    uint32_t eax, ebx, ecx, edx;
+    g_cpu_has_avx = false;
+    g_cpu_has_avx2 = false;
+    g_cpu_has_avx512f = false;
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) == 0)
+        return;
+    if ((ecx & (1 << 27)) == 0 || (ecx & (1 << 28)) == 0)
+        return;
+    uint32_t xcr0_lo, xcr0_hi;
+    __asm__ __volatile__ ("xgetbv" : "=a" (xcr0_lo), "=d" (xcr0_hi) : "c" (0)); //Not all supported compilers have the _xgetbv() intrinsic without -mxsave
+    if ((xcr0_lo & 0x6) != 0x6) //XMM and YMM state
+        return;
+    g_cpu_has_avx = true;
+
+    //CPUID leaf 7 subleaf 0, EBX bit 5 is AVX2 and bit 16 is AVX512F. XCR0 bits 5-7 cover the opmask and upper ZMM state.
+    if (__get_cpuid_max(0, NULL) < 7)
+        return;
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    g_cpu_has_avx2 = (ebx & (1 << 5)) != 0;
+    g_cpu_has_avx512f = (ebx & (1 << 16)) != 0 && (xcr0_lo & 0xE6) == 0xE6;
+#else
+#ifdef ARCH_INTEL_AVX
+    g_cpu_has_avx = true;
+#endif
+#if defined(ARCH_INTEL_AVX512) || defined(ARCH_INTEL_MIC)
+    g_cpu_has_avx512f = true;
+#endif
+#endif
+}
+
+bool xmem::chunk_size_supported(chunk_size_t chunk_size) {
+    switch (chunk_size) {
+#ifdef HAS_WORD_256
+        case CHUNK_256b:
+            return g_cpu_has_avx;
+#endif
+#ifdef HAS_WORD_512
+        case CHUNK_512b:
+            return g_cpu_has_avx512f;
+#endif
+        case NUM_CHUNK_SIZES:
+            return false;
+        default:
+            return true;
+    }
+}
+
 void xmem::test_thread_affinities() {
     std::cout << std::endl << "Testing thread affinities..." << std::endl;
     bool success = false;
@@ -456,6 +711,8 @@ void xmem::init_globals() {
     g_num_numa_nodes = DEFAULT_NUM_NODES;
     g_num_physical_packages = DEFAULT_NUM_PHYSICAL_PACKAGES;
     g_physical_package_of_cpu = DEFAULT_PHYSICAL_PACKAGE_OF_CPU;
+    g_physical_core_of_cpu.clear();
+    g_l3_cache_of_cpu.clear();
     g_num_physical_cpus = DEFAULT_NUM_PHYSICAL_CPUS;
     g_num_logical_cpus = DEFAULT_NUM_LOGICAL_CPUS;
     g_total_l1_caches = DEFAULT_NUM_L1_CACHES;
@@ -467,6 +724,8 @@ void xmem::init_globals() {
 
     g_ticks_per_ms = 0;
     g_ns_per_tick = 0;
+
+    detect_isa_extensions();
 }
 
 int32_t xmem::query_sys_info() {
@@ -635,6 +894,36 @@ int32_t xmem::query_sys_info() {
     }
 #endif
 
+    //Get mapping of logical CPUs to physical cores and L3 caches. Without better information, every logical CPU is its own core, and each package has one L3 cache.
+    g_physical_core_of_cpu.resize(g_physical_package_of_cpu.size());
+    g_l3_cache_of_cpu.resize(g_physical_package_of_cpu.size());
+    for (uint32_t cpu = 0; cpu < g_physical_package_of_cpu.size(); cpu++) {
+        g_physical_core_of_cpu[cpu] = cpu;
+        g_l3_cache_of_cpu[cpu] = cpu;
+        for (uint32_t other = 0; other < cpu; other++) {
+            if (g_physical_package_of_cpu[other] == g_physical_package_of_cpu[cpu]) {
+                g_l3_cache_of_cpu[cpu] = other;
+                break;
+            }
+        }
+    }
+#ifdef __gnu_linux__
+    for (uint32_t cpu = 0; cpu < g_physical_package_of_cpu.size(); cpu++) {
+        //Both sysfs lists start with their lowest-numbered logical CPU, e.g. "0-1" or "0,32"
+        std::ostringstream sysfs_cpu;
+        sysfs_cpu << "/sys/devices/system/cpu/cpu" << cpu;
+        uint32_t first_cpu = 0;
+
+        std::ifstream siblings((sysfs_cpu.str() + "/topology/thread_siblings_list").c_str());
+        if (siblings >> first_cpu)
+            g_physical_core_of_cpu[cpu] = first_cpu;
+
+        std::ifstream l3((sysfs_cpu.str() + "/cache/index3/shared_cpu_list").c_str());
+        if (l3 >> first_cpu)
+            g_l3_cache_of_cpu[cpu] = first_cpu;
+    }
+#endif
+
     //Get number of caches
 #ifdef _WIN32
     curr = buffer;
@@ -684,7 +973,17 @@ int32_t xmem::query_sys_info() {
 #ifdef __gnu_linux__
     g_page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
 #ifdef HAS_LARGE_PAGES
-    g_large_page_size = gethugepagesize();
+    //Default huge page size as reported by the kernel, which is also the size of transparent huge pages on x86-64
+    g_large_page_size = DEFAULT_LARGE_PAGE_SIZE;
+    std::ifstream meminfo("/proc/meminfo");
+    std::string meminfo_line;
+    while (std::getline(meminfo, meminfo_line)) {
+        size_t huge_page_kb = 0;
+        if (std::sscanf(meminfo_line.c_str(), "Hugepagesize: %zu kB", &huge_page_kb) == 1) {
+            g_large_page_size = huge_page_kb * KB;
+            break;
+        }
+    }
 #endif
     in.close();
 #endif
@@ -742,34 +1041,44 @@ void xmem::report_sys_info() {
 #ifdef HAS_LARGE_PAGES
     std::cout << "Large page size: " << g_large_page_size << " B" << std::endl;
 #endif
+    std::cout << "Vector extensions for 256-bit/512-bit chunks: " << (g_cpu_has_avx ? "AVX" : "none") << "/" << (g_cpu_has_avx512f ? "AVX-512F" : "none") << std::endl;
 }
 
 tick_t xmem::start_timer() {
-#ifdef USE_TSC_TIMER
+#ifdef HAS_TSC_TIMER
+    if (g_timer_backend == TIMER_INVARIANT_TSC) {
+        _mm_lfence(); //Wait for all previous instructions to complete locally. This is much cheaper than cpuid, and sufficient when the TSC is invariant.
+        tick_t tick = __rdtsc(); //Get clock tick
+        _mm_lfence(); //Prevent later instructions from starting before the clock tick is read
+        return tick;
+    }
+
+    if (g_timer_backend == TIMER_TSC) {
 #ifdef _WIN32
-    int32_t dontcare[4];
-    __cpuid(dontcare, 0); //Serializing instruction. This forces all previous instructions to finish
-    return __rdtsc(); //Get clock tick
+        int32_t dontcare[4];
+        __cpuid(dontcare, 0); //Serializing instruction. This forces all previous instructions to finish
+        return __rdtsc(); //Get clock tick
 #endif
 #ifdef __gnu_linux__
-    volatile int32_t dc0 = 0;
-    volatile int32_t dc1, dc2, dc3, dc4;
-    __cpuid(dc0, dc1, dc2, dc3, dc4); //Serializing instruction. This forces all previous instructions to finish
-    return __rdtsc(); //Get clock tick
-
-    /*
-    uint32_t low, high;
-    __asm__ __volatile__ (
-        "cpuid\n\t"
-        "rdtsc\n\t"
-        "mov %%eax, %0\n\t"
-        "mov %%edx, %1\n\n"
-        : "=r" (low), "=r" (high)
-        : : "%rax", "%rbx", "%rcx", "%rdx");
-
-    return ((static_cast<uint64_t>(high) << 32) | low);
-    */
+        volatile int32_t dc0 = 0;
+        volatile int32_t dc1, dc2, dc3, dc4;
+        __cpuid(dc0, dc1, dc2, dc3, dc4); //Serializing instruction. This forces all previous instructions to finish
+        return __rdtsc(); //Get clock tick
+
+        /*
+        uint32_t low, high;
+        __asm__ __volatile__ (
+            "cpuid\n\t"
+            "rdtsc\n\t"
+            "mov %%eax, %0\n\t"
+            "mov %%edx, %1\n\n"
+            : "=r" (low), "=r" (high)
+            : : "%rax", "%rbx", "%rcx", "%rdx");
+
+        return ((static_cast<uint64_t>(high) << 32) | low);
+        */
 #endif
+    }
 #endif
 
     //TODO: ARM hardware timer
@@ -789,36 +1098,45 @@ tick_t xmem::start_timer() {
 
 tick_t xmem::stop_timer() {
     //TODO: ARM hardware timer
-#ifdef USE_TSC_TIMER
+#ifdef HAS_TSC_TIMER
+    if (g_timer_backend == TIMER_INVARIANT_TSC) {
+        uint32_t filler;
+        tick_t tick = __rdtscp(&filler); //Get clock tick. All previous instructions must finish first
+        _mm_lfence(); //Prevent later instructions from being moved inside the timed section
+        return tick;
+    }
+
+    if (g_timer_backend == TIMER_TSC) {
 #ifdef _WIN32
-    tick_t tick;
-    uint32_t filler;
-    int32_t dontcare[4];
-    tick = __rdtscp(&filler); //Get clock tick. This is a partially serializing instruction. All previous instructions must finish
-    __cpuid(dontcare, 0); //Fully serializing instruction. We do this to prevent later instructions from being moved inside the timed section
-    return tick;
+        tick_t tick;
+        uint32_t filler;
+        int32_t dontcare[4];
+        tick = __rdtscp(&filler); //Get clock tick. This is a partially serializing instruction. All previous instructions must finish
+        __cpuid(dontcare, 0); //Fully serializing instruction. We do this to prevent later instructions from being moved inside the timed section
+        return tick;
 #endif
 #ifdef __gnu_linux__
-    tick_t tick;
-    uint32_t filler;
-    volatile int32_t dc0 = 0;
-    volatile int32_t dc1, dc2, dc3, dc4;
-    tick = __rdtscp(&filler); //Get clock tick. This is a partially serializing instruction. All previous instructions must finish
-    __cpuid(dc0, dc1, dc2, dc3, dc4); //Serializing instruction. This forces all previous instructions to finish
-    return tick;
-
-    /*
-    uint32_t low, high;
-    __asm__ __volatile__ (
-        "rdtscp\n\t"
-        "mov %%eax, %0\n\t"
-        "mov %%edx, %1\n\t"
-        "cpuid\n\t"
-        : "=r" (low), "=r" (high)
-        : : "%rax", "%rbx", "%rcx", "%rdx");
-    return ((static_cast<uint64_t>(high) << 32) | low);
-    */
+        tick_t tick;
+        uint32_t filler;
+        volatile int32_t dc0 = 0;
+        volatile int32_t dc1, dc2, dc3, dc4;
+        tick = __rdtscp(&filler); //Get clock tick. This is a partially serializing instruction. All previous instructions must finish
+        __cpuid(dc0, dc1, dc2, dc3, dc4); //Serializing instruction. This forces all previous instructions to finish
+        return tick;
+
+        /*
+        uint32_t low, high;
+        __asm__ __volatile__ (
+            "rdtscp\n\t"
+            "mov %%eax, %0\n\t"
+            "mov %%edx, %1\n\t"
+            "cpuid\n\t"
+            : "=r" (low), "=r" (high)
+            : : "%rax", "%rbx", "%rcx", "%rdx");
+        return ((static_cast<uint64_t>(high) << 32) | low);
+        */
 #endif
+    }
 #endif
 
     //TODO: ARM hardware timer
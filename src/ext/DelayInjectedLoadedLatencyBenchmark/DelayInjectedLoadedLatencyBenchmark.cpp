@@ -37,6 +37,7 @@
 
 #include <DelayInjectedLoadedLatencyBenchmark.h>
 #include <delay_injected_benchmark_kernels.h>
+#include <jit_kernels.h>
 #include <MemoryWorker.h>
 #include <LatencyWorker.h>
 #include <LoadWorker.h>
@@ -101,18 +102,21 @@ bool DelayInjectedLoadedLatencyBenchmark::runCore() {
     RandomFunction lat_kernel_dummy_fptr = &dummy_chasePointers;
 
     //Initialize memory regions for all threads by writing to them, causing the memory to be physically resident.
-    forwSequentialWrite_Word32(mem_array_,
-                               reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_)+len_)); //static casts to silence compiler warnings
+    touchRegion(mem_array_,
+                reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_)+len_)); //static casts to silence compiler warnings
 
     //Build pointer indices for random-access latency thread. We assume that latency thread is the first one, so we use beginning of memory region.
-    if (!build_random_pointer_permutation(mem_array_,
-                                       reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_)+len_per_thread), //static casts to silence compiler warnings
+    if (!prepareChain(mem_array_,
+                   reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(mem_array_)+len_per_thread), //static casts to silence compiler warnings
 #ifndef HAS_WORD_64 //special case: 32-bit architectures
-                                       CHUNK_32b)) {
+                   CHUNK_32b,
 #endif
 #ifdef HAS_WORD_64
-                                       CHUNK_64b)) {
+                   CHUNK_64b,
 #endif
+                   g_chain_granularity,
+                   g_chain_granularity == CHAIN_PAGE, //spread page-granular nodes across cache sets
+                   g_random_seed)) {
         std::cerr << "ERROR: Failed to build a random pointer permutation for the latency measurement thread!" << std::endl;
         return false;
     }
@@ -120,13 +124,25 @@ bool DelayInjectedLoadedLatencyBenchmark::runCore() {
     //Set up load generation kernel function pointers
     SequentialFunction load_kernel_fptr = NULL;
     SequentialFunction load_kernel_dummy_fptr = NULL;
-    if (num_worker_threads_ > 1) { //If we only have one worker thread, it is used for latency measurement only, and no load threads will be used.
+    bool load_kernel_generated = false;
+#ifdef HAS_JIT_KERNELS
+    if (num_worker_threads_ > 1 && g_use_jit_kernels) { //Any delay and chunk size can be generated at run time
+        if (!jit_sequential_kernel(READ, chunk_size_, 1, delay_, false, &load_kernel_fptr, &load_kernel_dummy_fptr)) {
+            std::cerr << "ERROR: Failed to generate the delay-injected benchmark kernel." << std::endl;
+            return false;
+        }
+        load_kernel_generated = true;
+    }
+#endif
+    if (num_worker_threads_ > 1 && !load_kernel_generated) { //If we only have one worker thread, it is used for latency measurement only, and no load threads will be used.
         switch (chunk_size_) {
             case CHUNK_32b:
                 switch (delay_) {
                     case 0:
-                        load_kernel_fptr = &forwSequentialRead_Word32; //not an extended kernel
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word32; //not an extended kernel
+                        if (!determine_sequential_kernel(READ, chunk_size_, 1, &load_kernel_fptr, &load_kernel_dummy_fptr)) { //not an extended kernel
+                            std::cerr << "ERROR: Failed to find appropriate benchmark kernel." << std::endl;
+                            return false;
+                        }
                         break;
                     case 1:
                         load_kernel_fptr = &forwSequentialRead_Word32_Delay1;
@@ -181,8 +197,10 @@ bool DelayInjectedLoadedLatencyBenchmark::runCore() {
             case CHUNK_64b:
                 switch (delay_) {
                     case 0:
-                        load_kernel_fptr = &forwSequentialRead_Word64; //not an extended kernel
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word64; //not an extended kernel
+                        if (!determine_sequential_kernel(READ, chunk_size_, 1, &load_kernel_fptr, &load_kernel_dummy_fptr)) { //not an extended kernel
+                            std::cerr << "ERROR: Failed to find appropriate benchmark kernel." << std::endl;
+                            return false;
+                        }
                         break;
                     case 1:
                         load_kernel_fptr = &forwSequentialRead_Word64_Delay1;
@@ -238,8 +256,10 @@ bool DelayInjectedLoadedLatencyBenchmark::runCore() {
             case CHUNK_128b:
                 switch (delay_) {
                     case 0:
-                        load_kernel_fptr = &forwSequentialRead_Word128; //not an extended kernel
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word128; //not an extended kernel
+                        if (!determine_sequential_kernel(READ, chunk_size_, 1, &load_kernel_fptr, &load_kernel_dummy_fptr)) { //not an extended kernel
+                            std::cerr << "ERROR: Failed to find appropriate benchmark kernel." << std::endl;
+                            return false;
+                        }
                         break;
                     case 1:
                         load_kernel_fptr = &forwSequentialRead_Word128_Delay1;
@@ -295,8 +315,10 @@ bool DelayInjectedLoadedLatencyBenchmark::runCore() {
             case CHUNK_256b:
                 switch (delay_) {
                     case 0:
-                        load_kernel_fptr = &forwSequentialRead_Word256; //not an extended kernel
-                        load_kernel_dummy_fptr = &dummy_forwSequentialLoop_Word256; //not an extended kernel
+                        if (!determine_sequential_kernel(READ, chunk_size_, 1, &load_kernel_fptr, &load_kernel_dummy_fptr)) { //not an extended kernel
+                            std::cerr << "ERROR: Failed to find appropriate benchmark kernel." << std::endl;
+                            return false;
+                        }
                         break;
                     case 1:
                         load_kernel_fptr = &forwSequentialRead_Word256_Delay1;
@@ -393,6 +415,7 @@ bool DelayInjectedLoadedLatencyBenchmark::runCore() {
                                                  len_per_thread,
                                                  load_kernel_fptr,
                                                  load_kernel_dummy_fptr,
+                                                 1,
                                                  cpu_id));
             }
             worker_threads.push_back(new Thread(workers[t]));
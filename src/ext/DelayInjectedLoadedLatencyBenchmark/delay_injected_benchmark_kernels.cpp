@@ -301,71 +301,6 @@ int32_t xmem::dummy_forwSequentialLoop_Word128_Delay128plus(void* start_address,
 }
 #endif
 
-#ifdef HAS_WORD_256
-int32_t xmem::dummy_forwSequentialLoop_Word256_Delay1(void* start_address, void* end_address) {
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
-        UNROLL64(wordptr++;) 
-        placeholder = 0;
-    }
-    return placeholder;
-}
-
-int32_t xmem::dummy_forwSequentialLoop_Word256_Delay2(void* start_address, void* end_address) {
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
-        UNROLL32(wordptr++;) 
-        placeholder = 0;
-    }
-    return placeholder;
-}
-
-int32_t xmem::dummy_forwSequentialLoop_Word256_Delay4(void* start_address, void* end_address) {
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
-        UNROLL16(wordptr++;) 
-        placeholder = 0;
-    }
-    return placeholder;
-}
-
-int32_t xmem::dummy_forwSequentialLoop_Word256_Delay8(void* start_address, void* end_address) {
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
-        UNROLL8(wordptr++;) 
-        placeholder = 0;
-    }
-    return placeholder;
-}
-
-int32_t xmem::dummy_forwSequentialLoop_Word256_Delay16(void* start_address, void* end_address) {
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
-        UNROLL4(wordptr++;) 
-        placeholder = 0;
-    }
-    return placeholder;
-}
-
-int32_t xmem::dummy_forwSequentialLoop_Word256_Delay32(void* start_address, void* end_address) {
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
-        UNROLL2(wordptr++;) 
-        placeholder = 0;
-    }
-    return placeholder;
-}
-
-int32_t xmem::dummy_forwSequentialLoop_Word256_Delay64plus(void* start_address, void* end_address) {
-    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
-        wordptr++;
-        placeholder = 0;
-    }
-    return placeholder;
-}
-#endif
-
 /* -------------------- CORE BENCHMARK ROUTINES -------------------------- */
 
 int32_t xmem::forwSequentialRead_Word32_Delay1(void* start_address, void* end_address) {
@@ -690,148 +625,3 @@ int32_t xmem::forwSequentialRead_Word128_Delay1024(void* start_address, void* en
 #endif
 }
 #endif
-
-#ifdef HAS_WORD_256
-int32_t xmem::forwSequentialRead_Word256_Delay1(void* start_address, void* end_address) {
-#ifdef _WIN32
-    return 0; //TODO: Not yet implemented for Windows.
-#endif
-#ifdef __gnu_linux__
-    register Word256_t val;
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
-        UNROLL64(val = *wordptr++; my_nop();)
-    }
-    return 0;
-#endif
-}
-
-int32_t xmem::forwSequentialRead_Word256_Delay2(void* start_address, void* end_address) {
-#ifdef _WIN32
-    return 0; //TODO: Not yet implemented for Windows.
-#endif
-#ifdef __gnu_linux__
-    register Word256_t val;
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
-        UNROLL32(val = *wordptr++; my_nop2();)
-    }
-    return 0;
-#endif
-}
-
-int32_t xmem::forwSequentialRead_Word256_Delay4(void* start_address, void* end_address) {
-#ifdef _WIN32
-    return 0; //TODO: Not yet implemented for Windows.
-#endif
-#ifdef __gnu_linux__
-    register Word256_t val;
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
-        UNROLL16(val = *wordptr++; my_nop4();)
-    }
-    return 0;
-#endif
-}
-
-int32_t xmem::forwSequentialRead_Word256_Delay8(void* start_address, void* end_address) {
-#ifdef _WIN32
-    return 0; //TODO: Not yet implemented for Windows.
-#endif
-#ifdef __gnu_linux__
-    register Word256_t val;
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
-        UNROLL8(val = *wordptr++; my_nop8();)
-    }
-    return 0;
-#endif
-}
-
-int32_t xmem::forwSequentialRead_Word256_Delay16(void* start_address, void* end_address) {
-#ifdef _WIN32
-    return 0; //TODO: Not yet implemented for Windows.
-#endif
-#ifdef __gnu_linux__
-    register Word256_t val;
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
-        UNROLL4(val = *wordptr++; my_nop16();)
-    }
-    return 0;
-#endif
-}
-
-int32_t xmem::forwSequentialRead_Word256_Delay32(void* start_address, void* end_address) {
-#ifdef _WIN32
-    return 0; //TODO: Not yet implemented for Windows.
-#endif
-#ifdef __gnu_linux__
-    register Word256_t val;
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
-        UNROLL2(val = *wordptr++; my_nop32();)
-    }
-    return 0;
-#endif
-}
-
-int32_t xmem::forwSequentialRead_Word256_Delay64(void* start_address, void* end_address) {
-#ifdef _WIN32
-    return 0; //TODO: Not yet implemented for Windows.
-#endif
-#ifdef __gnu_linux__
-    register Word256_t val;
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
-        val = *wordptr++; my_nop64();
-    }
-    return 0;
-#endif
-}
-
-int32_t xmem::forwSequentialRead_Word256_Delay128(void* start_address, void* end_address) {
-#ifdef _WIN32
-    return 0; //TODO: Not yet implemented for Windows.
-#endif
-#ifdef __gnu_linux__
-    register Word256_t val;
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
-        val = *wordptr++; my_nop128();
-    }
-    return 0;
-#endif
-}
-
-int32_t xmem::forwSequentialRead_Word256_Delay256(void* start_address, void* end_address) {
-#ifdef _WIN32
-    return 0; //TODO: Not yet implemented for Windows.
-#endif
-#ifdef __gnu_linux__
-    register Word256_t val;
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
-        val = *wordptr++; my_nop256();
-    }
-    return 0;
-#endif
-}
-
-int32_t xmem::forwSequentialRead_Word256_Delay512(void* start_address, void* end_address) {
-#ifdef _WIN32
-    return 0; //TODO: Not yet implemented for Windows.
-#endif
-#ifdef __gnu_linux__
-    register Word256_t val;
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
-        val = *wordptr++; my_nop512();
-    }
-    return 0;
-#endif
-}
-
-int32_t xmem::forwSequentialRead_Word256_Delay1024(void* start_address, void* end_address) {
-#ifdef _WIN32
-    return 0; //TODO: Not yet implemented for Windows.
-#endif
-#ifdef __gnu_linux__
-    register Word256_t val;
-    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
-        val = *wordptr++; my_nop1024();
-    }
-    return 0;
-#endif
-}
-#endif
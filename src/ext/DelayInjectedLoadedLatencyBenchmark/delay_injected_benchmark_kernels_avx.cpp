@@ -0,0 +1,257 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ * 
+ * @brief Implementation file for the 256-bit benchmark kernel functions for the delay-injected loaded latency benchmark.
+ * On x86-64 Linux this translation unit is built with -mavx like benchmark_kernels_avx.cpp.
+ */
+
+//Headers
+#include <delay_injected_benchmark_kernels.h>
+#include <common.h>
+
+using namespace xmem;
+
+/***********************************************************************
+ ***********************************************************************
+ ******************* THROUGHPUT-RELATED BENCHMARK KERNELS **************
+ ***********************************************************************
+ ***********************************************************************/
+
+/* -------------------- DUMMY BENCHMARK ROUTINES ------------------------- */
+
+#ifdef HAS_WORD_256
+int32_t xmem::dummy_forwSequentialLoop_Word256_Delay1(void* start_address, void* end_address) {
+    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
+        UNROLL64(wordptr++;) 
+        placeholder = 0;
+    }
+    return placeholder;
+}
+
+int32_t xmem::dummy_forwSequentialLoop_Word256_Delay2(void* start_address, void* end_address) {
+    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
+        UNROLL32(wordptr++;) 
+        placeholder = 0;
+    }
+    return placeholder;
+}
+
+int32_t xmem::dummy_forwSequentialLoop_Word256_Delay4(void* start_address, void* end_address) {
+    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
+        UNROLL16(wordptr++;) 
+        placeholder = 0;
+    }
+    return placeholder;
+}
+
+int32_t xmem::dummy_forwSequentialLoop_Word256_Delay8(void* start_address, void* end_address) {
+    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
+        UNROLL8(wordptr++;) 
+        placeholder = 0;
+    }
+    return placeholder;
+}
+
+int32_t xmem::dummy_forwSequentialLoop_Word256_Delay16(void* start_address, void* end_address) {
+    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
+        UNROLL4(wordptr++;) 
+        placeholder = 0;
+    }
+    return placeholder;
+}
+
+int32_t xmem::dummy_forwSequentialLoop_Word256_Delay32(void* start_address, void* end_address) {
+    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
+        UNROLL2(wordptr++;) 
+        placeholder = 0;
+    }
+    return placeholder;
+}
+
+int32_t xmem::dummy_forwSequentialLoop_Word256_Delay64plus(void* start_address, void* end_address) {
+    volatile int32_t placeholder = 0; //Try our best to defeat compiler optimizations
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
+        wordptr++;
+        placeholder = 0;
+    }
+    return placeholder;
+}
+#endif
+
+/* -------------------- CORE BENCHMARK ROUTINES -------------------------- */
+
+#ifdef HAS_WORD_256
+int32_t xmem::forwSequentialRead_Word256_Delay1(void* start_address, void* end_address) {
+#ifdef _WIN32
+    return 0; //TODO: Not yet implemented for Windows.
+#endif
+#ifdef __gnu_linux__
+    register Word256_t val;
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
+        UNROLL64(val = *wordptr++; my_nop();)
+    }
+    return 0;
+#endif
+}
+
+int32_t xmem::forwSequentialRead_Word256_Delay2(void* start_address, void* end_address) {
+#ifdef _WIN32
+    return 0; //TODO: Not yet implemented for Windows.
+#endif
+#ifdef __gnu_linux__
+    register Word256_t val;
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
+        UNROLL32(val = *wordptr++; my_nop2();)
+    }
+    return 0;
+#endif
+}
+
+int32_t xmem::forwSequentialRead_Word256_Delay4(void* start_address, void* end_address) {
+#ifdef _WIN32
+    return 0; //TODO: Not yet implemented for Windows.
+#endif
+#ifdef __gnu_linux__
+    register Word256_t val;
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
+        UNROLL16(val = *wordptr++; my_nop4();)
+    }
+    return 0;
+#endif
+}
+
+int32_t xmem::forwSequentialRead_Word256_Delay8(void* start_address, void* end_address) {
+#ifdef _WIN32
+    return 0; //TODO: Not yet implemented for Windows.
+#endif
+#ifdef __gnu_linux__
+    register Word256_t val;
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
+        UNROLL8(val = *wordptr++; my_nop8();)
+    }
+    return 0;
+#endif
+}
+
+int32_t xmem::forwSequentialRead_Word256_Delay16(void* start_address, void* end_address) {
+#ifdef _WIN32
+    return 0; //TODO: Not yet implemented for Windows.
+#endif
+#ifdef __gnu_linux__
+    register Word256_t val;
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
+        UNROLL4(val = *wordptr++; my_nop16();)
+    }
+    return 0;
+#endif
+}
+
+int32_t xmem::forwSequentialRead_Word256_Delay32(void* start_address, void* end_address) {
+#ifdef _WIN32
+    return 0; //TODO: Not yet implemented for Windows.
+#endif
+#ifdef __gnu_linux__
+    register Word256_t val;
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
+        UNROLL2(val = *wordptr++; my_nop32();)
+    }
+    return 0;
+#endif
+}
+
+int32_t xmem::forwSequentialRead_Word256_Delay64(void* start_address, void* end_address) {
+#ifdef _WIN32
+    return 0; //TODO: Not yet implemented for Windows.
+#endif
+#ifdef __gnu_linux__
+    register Word256_t val;
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
+        val = *wordptr++; my_nop64();
+    }
+    return 0;
+#endif
+}
+
+int32_t xmem::forwSequentialRead_Word256_Delay128(void* start_address, void* end_address) {
+#ifdef _WIN32
+    return 0; //TODO: Not yet implemented for Windows.
+#endif
+#ifdef __gnu_linux__
+    register Word256_t val;
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
+        val = *wordptr++; my_nop128();
+    }
+    return 0;
+#endif
+}
+
+int32_t xmem::forwSequentialRead_Word256_Delay256(void* start_address, void* end_address) {
+#ifdef _WIN32
+    return 0; //TODO: Not yet implemented for Windows.
+#endif
+#ifdef __gnu_linux__
+    register Word256_t val;
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
+        val = *wordptr++; my_nop256();
+    }
+    return 0;
+#endif
+}
+
+int32_t xmem::forwSequentialRead_Word256_Delay512(void* start_address, void* end_address) {
+#ifdef _WIN32
+    return 0; //TODO: Not yet implemented for Windows.
+#endif
+#ifdef __gnu_linux__
+    register Word256_t val;
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
+        val = *wordptr++; my_nop512();
+    }
+    return 0;
+#endif
+}
+
+int32_t xmem::forwSequentialRead_Word256_Delay1024(void* start_address, void* end_address) {
+#ifdef _WIN32
+    return 0; //TODO: Not yet implemented for Windows.
+#endif
+#ifdef __gnu_linux__
+    register Word256_t val;
+    for (volatile Word256_t* wordptr = static_cast<Word256_t*>(start_address), *endptr = static_cast<Word256_t*>(end_address); wordptr < endptr;) {
+        val = *wordptr++; my_nop1024();
+    }
+    return 0;
+#endif
+}
+#endif
@@ -0,0 +1,320 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ *
+ * @brief Implementation file for the StreamBenchmark class.
+ */
+
+//Headers
+#include <common.h>
+
+#ifdef EXT_STREAM_BENCHMARK
+
+#include <StreamBenchmark.h>
+#include <StreamWorker.h>
+#include <stream_benchmark_kernels.h>
+#include <MemoryWorker.h>
+
+//Libraries
+#include <iostream>
+
+using namespace xmem;
+
+/**
+ * @brief Picks whichever of arrays a, b and c a STREAM kernel writes to.
+ * @param kernel The STREAM kernel.
+ * @param a Property of array a.
+ * @param b Property of array b.
+ * @param c Property of array c.
+ * @returns The property of the destination array.
+ */
+template <typename T>
+static T stream_destination(stream_kernel_t kernel, T a, T b, T c) {
+    switch (kernel) {
+        case STREAM_SCALE:
+            return b;
+        case STREAM_TRIAD:
+            return a;
+        default: //copy and add
+            return c;
+    }
+}
+
+StreamBenchmark::StreamBenchmark(
+        void* array_a,
+        void* array_b,
+        void* array_c,
+        size_t len,
+        uint32_t iterations,
+        uint32_t num_worker_threads,
+        uint32_t node_a,
+        uint32_t node_b,
+        uint32_t node_c,
+        uint32_t cpu_node,
+        stream_kernel_t kernel,
+        chunk_size_t chunk_size,
+        std::vector<PowerReader*> dram_power_readers,
+        std::string name
+    ) :
+        Benchmark(
+            stream_destination(kernel, array_a, array_b, array_c),
+            len,
+            iterations,
+            num_worker_threads,
+            stream_destination(kernel, node_a, node_b, node_c),
+            0,
+            cpu_node,
+            SEQUENTIAL,
+            WRITE,
+            chunk_size,
+            1,
+            dram_power_readers,
+            "MB/s",
+            name
+        ),
+        array_a_(array_a),
+        array_b_(array_b),
+        array_c_(array_c),
+        node_a_(node_a),
+        node_b_(node_b),
+        node_c_(node_c),
+        kernel_(kernel)
+    {
+}
+
+void StreamBenchmark::reportBenchmarkInfo() const {
+    Benchmark::reportBenchmarkInfo();
+    std::cout << "STREAM kernel: ";
+    switch (kernel_) {
+        case STREAM_COPY:
+            std::cout << "copy (c = a)";
+            break;
+        case STREAM_SCALE:
+            std::cout << "scale (b = q*c)";
+            break;
+        case STREAM_ADD:
+            std::cout << "add (c = a + b)";
+            break;
+        case STREAM_TRIAD:
+            std::cout << "triad (a = b + q*c)";
+            break;
+        default:
+            std::cout << "UNKNOWN";
+            break;
+    }
+    std::cout << std::endl;
+    std::cout << "Array NUMA nodes: a: " << node_a_ << ", b: " << node_b_ << ", c: " << node_c_ << std::endl;
+}
+
+stream_kernel_t StreamBenchmark::getStreamKernel() const {
+    return kernel_;
+}
+
+uint32_t StreamBenchmark::getNodeA() const {
+    return node_a_;
+}
+
+uint32_t StreamBenchmark::getNodeB() const {
+    return node_b_;
+}
+
+uint32_t StreamBenchmark::getNodeC() const {
+    return node_c_;
+}
+
+void StreamBenchmark::getKernelArrays(void** dst, void** src1, void** src2) const {
+    switch (kernel_) {
+        case STREAM_COPY:
+            *dst = array_c_;
+            *src1 = array_a_;
+            *src2 = array_b_;
+            break;
+        case STREAM_SCALE:
+            *dst = array_b_;
+            *src1 = array_c_;
+            *src2 = array_a_;
+            break;
+        case STREAM_ADD:
+            *dst = array_c_;
+            *src1 = array_a_;
+            *src2 = array_b_;
+            break;
+        case STREAM_TRIAD:
+        default:
+            *dst = array_a_;
+            *src1 = array_b_;
+            *src2 = array_c_;
+            break;
+    }
+}
+
+bool StreamBenchmark::runCore() {
+    //Carve up each array so each worker has its own area to play in. Workers process one pass worth of each array at a time, so their areas must be whole passes.
+    size_t len_per_thread = len_ / num_worker_threads_;
+    len_per_thread -= len_per_thread % THROUGHPUT_BENCHMARK_BYTES_PER_PASS;
+    if (len_per_thread == 0) {
+        std::cerr << "ERROR: Each worker thread needs at least " << THROUGHPUT_BENCHMARK_BYTES_PER_PASS << " bytes of each STREAM array." << std::endl;
+        return false;
+    }
+
+    //Set up kernel function pointers
+    StreamFunction kernel_fptr = NULL;
+    StreamFunction kernel_dummy_fptr = NULL;
+    if (!determine_stream_kernel(kernel_, chunk_size_, &kernel_fptr, &kernel_dummy_fptr)) {
+        std::cerr << "ERROR: Failed to find appropriate benchmark kernel." << std::endl;
+        return false;
+    }
+
+    void* dst = NULL;
+    void* src1 = NULL;
+    void* src2 = NULL;
+    getKernelArrays(&dst, &src1, &src2);
+    uint32_t num_arrays = stream_kernel_arrays(kernel_);
+
+    //Initialize the arrays as STREAM does. This overwrites any pointer chains that were in them.
+    if (region_cache_ != NULL) {
+        region_cache_->invalidate(array_a_, reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(array_a_) + len_));
+        region_cache_->invalidate(array_b_, reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(array_b_) + len_));
+        region_cache_->invalidate(array_c_, reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(array_c_) + len_));
+    }
+    stream_init_array(array_a_, len_, chunk_size_, 1.0);
+    stream_init_array(array_b_, len_, chunk_size_, 2.0);
+    stream_init_array(array_c_, len_, chunk_size_, 0.0);
+
+    //Set up some stuff for worker threads
+    std::vector<MemoryWorker*> workers;
+
+    //Start power measurement
+    if (g_verbose)
+        std::cout << "Starting power measurement threads...";
+    if (!startPowerThreads()) {
+        if (g_verbose)
+            std::cout << "FAIL" << std::endl;
+        std::cerr << "WARNING: Failed to start power measurement threads." << std::endl;
+    } else if (g_verbose)
+        std::cout << "done" << std::endl;
+
+    //Run benchmark
+    if (g_verbose)
+        std::cout << "Running benchmark." << std::endl << std::endl;
+
+    //Do a bunch of iterations of the core benchmark routines
+    for (uint32_t i = 0; i < iterations_; i++) {
+        //Create workers and worker threads
+        for (uint32_t t = 0; t < num_worker_threads_; t++) {
+            int32_t cpu_id = cpu_id_in_numa_node(cpu_node_, t);
+            if (cpu_id < 0)
+                std::cerr << "WARNING: Failed to find logical CPU " << t << " in NUMA node " << cpu_node_ << std::endl;
+            workers.push_back(new StreamWorker(reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(dst) + t * len_per_thread),
+                                               reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(src1) + t * len_per_thread),
+                                               reinterpret_cast<void*>(reinterpret_cast<uint8_t*>(src2) + t * len_per_thread),
+                                               len_per_thread,
+                                               num_arrays,
+                                               kernel_fptr,
+                                               kernel_dummy_fptr,
+                                               cpu_id));
+        }
+
+        //All workers stop together once the first one has converged
+        SampleControl sample_control;
+        for (uint32_t t = 0; t < workers.size(); t++)
+            workers[t]->setSampleControl(&sample_control, t == 0);
+
+        //Run the workers. Memory only needs to be primed before the first iteration since the pooled threads stay put.
+        if (!runWorkers(workers, i == 0))
+            std::cerr << "WARNING: A worker thread failed to complete correctly!" << std::endl;
+
+        //Compute throughput achieved with all workers
+        uint32_t total_passes = 0;
+        tick_t total_adjusted_ticks = 0;
+        tick_t avg_adjusted_ticks = 0;
+        tick_t total_elapsed_dummy_ticks = 0;
+        uint32_t bytes_per_pass = workers[0]->getBytesPerPass(); //all should be the same.
+        bool iter_warning = false;
+        for (uint32_t t = 0; t < num_worker_threads_; t++) {
+            total_passes += workers[t]->getPasses();
+            total_adjusted_ticks += workers[t]->getAdjustedTicks();
+            total_elapsed_dummy_ticks += workers[t]->getElapsedDummyTicks();
+            iter_warning |= workers[t]->hadWarning();
+        }
+
+        avg_adjusted_ticks = total_adjusted_ticks / num_worker_threads_;
+
+        if (iter_warning)
+            warning_ = true;
+
+        if (g_verbose) { //Report duration for this iteration
+            std::cout << "Iter " << i+1 << " had " << total_passes << " passes in total across " << num_worker_threads_ << " threads, with " << bytes_per_pass << " bytes touched per pass:";
+            if (iter_warning) std::cout << " -- WARNING";
+            std::cout << std::endl;
+
+            std::cout << "...clock ticks in total across " << num_worker_threads_ << " threads == " << total_adjusted_ticks << " (adjusted by -" << total_elapsed_dummy_ticks << ")";
+            if (iter_warning) std::cout << " -- WARNING";
+            std::cout << std::endl;
+
+            std::cout << "...ns in total across " << num_worker_threads_ << " threads == " << total_adjusted_ticks * g_ns_per_tick << " (adjusted by -" << total_elapsed_dummy_ticks * g_ns_per_tick << ")";
+            if (iter_warning) std::cout << " -- WARNING";
+            std::cout << std::endl;
+
+            std::cout << "...sec in total across " << num_worker_threads_ << " threads == " << total_adjusted_ticks * g_ns_per_tick / 1e9 << " (adjusted by -" << total_elapsed_dummy_ticks * g_ns_per_tick / 1e9 << ")";
+            if (iter_warning) std::cout << " -- WARNING";
+            std::cout << std::endl;
+        }
+
+        //Compute metric for this iteration
+        metric_on_iter_[i] = ((static_cast<double>(total_passes) * static_cast<double>(bytes_per_pass)) / static_cast<double>(MB))   /   ((static_cast<double>(avg_adjusted_ticks) * g_ns_per_tick) / 1e9);
+
+        std::vector<double> samples = computeThroughputSamples(workers, 0, num_worker_threads_);
+
+        //Clean up workers for this iteration
+        for (uint32_t t = 0; t < num_worker_threads_; t++) {
+            delete workers[t];
+        }
+        workers.clear();
+
+        if (recordIterationSamples(i, samples))
+            break;
+    }
+
+    //Stopping power measurement
+    if (g_verbose)
+        std::cout << "Stopping power measurement threads...";
+    if (!stopPowerThreads()) {
+        if (g_verbose)
+            std::cout << "FAIL" << std::endl;
+        std::cerr << "WARNING: Failed to stop power measurement threads." << std::endl;
+    } else if (g_verbose)
+        std::cout << "done" << std::endl;
+
+    //Run metadata
+    has_run_ = true;
+    computeMetrics();
+
+    return true;
+}
+
+#endif
@@ -0,0 +1,172 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ * 
+ * @brief Implementation file for the StreamWorker class.
+ */
+
+//Headers
+#include <common.h>
+
+#ifdef EXT_STREAM_BENCHMARK
+
+#include <StreamWorker.h>
+#include <stream_benchmark_kernels.h>
+
+//Libraries
+#include <iostream>
+
+using namespace xmem;
+
+StreamWorker::StreamWorker(
+        void* dst,
+        void* src1,
+        void* src2,
+        size_t len,
+        uint32_t num_arrays,
+        StreamFunction kernel_fptr,
+        StreamFunction kernel_dummy_fptr,
+        int32_t cpu_affinity
+    ) :
+        MemoryWorker(
+            dst,
+            len,
+            cpu_affinity
+        ),
+        src1_(src1),
+        src2_(src2),
+        num_arrays_(num_arrays),
+        kernel_fptr_(kernel_fptr),
+        kernel_dummy_fptr_(kernel_dummy_fptr)
+    {
+}
+
+StreamWorker::~StreamWorker() {
+}
+
+void StreamWorker::runKernels() {
+    //Set up relevant state -- localized to this thread's stack
+    StreamFunction kernel_fptr = NULL;
+    StreamFunction kernel_dummy_fptr = NULL;
+    void* dst = NULL;
+    void* src1 = NULL;
+    void* src2 = NULL;
+    size_t len = 0;
+    size_t window = THROUGHPUT_BENCHMARK_BYTES_PER_PASS; //Bytes of each array processed per pass
+    size_t offset = 0;
+    uint32_t bytes_per_pass = 0;
+    uint32_t passes = 0;
+    tick_t start_tick = 0;
+    tick_t stop_tick = 0;
+    tick_t elapsed_ticks = 0;
+    tick_t elapsed_dummy_ticks = 0;
+    tick_t adjusted_ticks = 0;
+    bool warning = false;
+    tick_t target_ticks = g_ticks_per_ms * BENCHMARK_DURATION_MS; //Rough target run duration in ticks
+    SampleControl* sample_control = NULL;
+    bool sample_leader = false;
+    tick_t window_start_tick = 0;
+    tick_t window_stop_tick = 0;
+    uint32_t p = 0;
+    
+    //Grab relevant setup state thread-safely and keep it local
+    if (acquireLock(-1)) {
+        dst = mem_array_;
+        src1 = src1_;
+        src2 = src2_;
+        len = len_;
+        kernel_fptr = kernel_fptr_;
+        kernel_dummy_fptr = kernel_dummy_fptr_;
+        bytes_per_pass = static_cast<uint32_t>(window * num_arrays_);
+        sample_control = sample_control_;
+        sample_leader = sample_leader_;
+        releaseLock();
+    }
+
+    //Priming only covers the destination array, so warm up the source arrays with one untimed sweep of the kernel
+    (*kernel_fptr)(dst, src1, src2, len);
+
+    SampleRecorder recorder(sample_control, sample_leader);
+
+    //Run the benchmark!
+    window_start_tick = start_timer();
+
+    //Run actual version of function and loop overhead
+    while (elapsed_ticks < target_ticks) {
+        start_tick = start_timer();
+        UNROLL1024(
+            (*kernel_fptr)(reinterpret_cast<uint8_t*>(dst) + offset, reinterpret_cast<uint8_t*>(src1) + offset, reinterpret_cast<uint8_t*>(src2) + offset, window);
+            offset = (offset + window) % len;
+        )
+        stop_tick = stop_timer();
+        passes+=1024;
+
+        elapsed_ticks += (stop_tick - start_tick);
+        if (recorder.addBlock(1024, stop_tick - start_tick))
+            break;
+    }
+    window_stop_tick = stop_timer();
+
+    //Run dummy version of function and loop overhead
+    p = 0;
+    offset = 0;
+    while (p < passes) {
+        start_tick = start_timer();
+        UNROLL1024(
+            (*kernel_dummy_fptr)(reinterpret_cast<uint8_t*>(dst) + offset, reinterpret_cast<uint8_t*>(src1) + offset, reinterpret_cast<uint8_t*>(src2) + offset, window);
+            offset = (offset + window) % len;
+        )
+        stop_tick = stop_timer();
+        p+=1024;
+
+        elapsed_dummy_ticks += (stop_tick - start_tick);
+    }
+
+    adjusted_ticks = elapsed_ticks - elapsed_dummy_ticks;
+    recorder.finish(passes, elapsed_dummy_ticks);
+
+    //Warn if something looks fishy
+    if (elapsed_dummy_ticks >= elapsed_ticks || elapsed_ticks < MIN_ELAPSED_TICKS || adjusted_ticks < 0.5 * elapsed_ticks)
+        warning = true;
+
+    //Update the object state thread-safely
+    if (acquireLock(-1)) {
+        adjusted_ticks_ = adjusted_ticks;
+        elapsed_ticks_ = elapsed_ticks;
+        elapsed_dummy_ticks_ = elapsed_dummy_ticks;
+        warning_ = warning;
+        bytes_per_pass_ = bytes_per_pass;
+        completed_ = true;
+        passes_ = passes;
+        window_start_tick_ = window_start_tick;
+        window_stop_tick_ = window_stop_tick;
+        storeSamples(recorder);
+        releaseLock();
+    }
+}
+
+#endif
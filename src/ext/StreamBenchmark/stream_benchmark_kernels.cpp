@@ -0,0 +1,166 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ * 
+ * @brief Implementation file for the STREAM-like benchmark kernels up to 128 bits wide, and for choosing among all of them.
+ */
+
+//Headers
+#include <stream_benchmark_kernels.h>
+#include <stream_kernel_templates.h>
+#include <common.h>
+
+using namespace xmem;
+
+bool xmem::determine_stream_kernel(stream_kernel_t kernel, chunk_size_t chunk_size, StreamFunction* kernel_function, StreamFunction* dummy_kernel_function) {
+    if (kernel_function == NULL || dummy_kernel_function == NULL)
+        return false;
+
+    if (!chunk_size_supported(chunk_size)) //The wide kernels live in their own translation units and need the CPU to support them
+        return false;
+
+    //One row per chunk size: dummy, copy, scale, add, triad
+    StreamFunction table[NUM_STREAM_KERNELS+1];
+    switch (chunk_size) {
+        case CHUNK_32b:
+            table[0] = &dummy_streamLoop_Word32;
+            table[1+STREAM_COPY] = &streamCopy_Word32;
+            table[1+STREAM_SCALE] = &streamScale_Word32;
+            table[1+STREAM_ADD] = &streamAdd_Word32;
+            table[1+STREAM_TRIAD] = &streamTriad_Word32;
+            break;
+#ifdef HAS_WORD_64
+        case CHUNK_64b:
+            table[0] = &dummy_streamLoop_Word64;
+            table[1+STREAM_COPY] = &streamCopy_Word64;
+            table[1+STREAM_SCALE] = &streamScale_Word64;
+            table[1+STREAM_ADD] = &streamAdd_Word64;
+            table[1+STREAM_TRIAD] = &streamTriad_Word64;
+            break;
+#endif
+#if defined(HAS_WORD_128) && defined(ARCH_INTEL)
+        case CHUNK_128b:
+            table[0] = &dummy_streamLoop_Word128;
+            table[1+STREAM_COPY] = &streamCopy_Word128;
+            table[1+STREAM_SCALE] = &streamScale_Word128;
+            table[1+STREAM_ADD] = &streamAdd_Word128;
+            table[1+STREAM_TRIAD] = &streamTriad_Word128;
+            break;
+#endif
+#ifdef HAS_WORD_256
+        case CHUNK_256b:
+            table[0] = &dummy_streamLoop_Word256;
+            table[1+STREAM_COPY] = &streamCopy_Word256;
+            table[1+STREAM_SCALE] = &streamScale_Word256;
+            table[1+STREAM_ADD] = &streamAdd_Word256;
+            table[1+STREAM_TRIAD] = &streamTriad_Word256;
+            break;
+#endif
+#ifdef HAS_WORD_512
+        case CHUNK_512b:
+            table[0] = &dummy_streamLoop_Word512;
+            table[1+STREAM_COPY] = &streamCopy_Word512;
+            table[1+STREAM_SCALE] = &streamScale_Word512;
+            table[1+STREAM_ADD] = &streamAdd_Word512;
+            table[1+STREAM_TRIAD] = &streamTriad_Word512;
+            break;
+#endif
+        default: //e.g., 128-bit chunks on ARM NEON, which has no double-precision vectors on 32-bit ARM
+            return false;
+    }
+
+    if (kernel >= NUM_STREAM_KERNELS)
+        return false;
+
+    *dummy_kernel_function = table[0];
+    *kernel_function = table[1+kernel];
+    return true;
+}
+
+uint32_t xmem::stream_kernel_arrays(stream_kernel_t kernel) {
+    switch (kernel) {
+        case STREAM_COPY:
+        case STREAM_SCALE:
+            return 2;
+        case STREAM_ADD:
+        case STREAM_TRIAD:
+            return 3;
+        default:
+            return 0;
+    }
+}
+
+const char* xmem::stream_kernel_name(stream_kernel_t kernel) {
+    switch (kernel) {
+        case STREAM_COPY:
+            return "COPY";
+        case STREAM_SCALE:
+            return "SCALE";
+        case STREAM_ADD:
+            return "ADD";
+        case STREAM_TRIAD:
+            return "TRIAD";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+void xmem::stream_init_array(void* array, size_t len, chunk_size_t chunk_size, double value) {
+    if (chunk_size == CHUNK_32b) {
+        float* arr = static_cast<float*>(array);
+        for (size_t i = 0; i < len / sizeof(float); i++)
+            arr[i] = static_cast<float>(value);
+    } else {
+        double* arr = static_cast<double*>(array);
+        for (size_t i = 0; i < len / sizeof(double); i++)
+            arr[i] = value;
+    }
+}
+
+#if defined(HAS_WORD_128) && defined(ARCH_INTEL)
+/**
+ * @brief Arithmetic policy for the 128-bit kernels. SSE2 is part of the x86-64 baseline, so these need no special ISA flags.
+ */
+struct StreamSSE2Ops {
+    typedef __m128d vec_t;
+    static KERNEL_INLINE vec_t load(const vec_t* p) { return _mm_load_pd(reinterpret_cast<const double*>(p)); }
+    static KERNEL_INLINE void store(vec_t* p, vec_t v) { _mm_store_pd(reinterpret_cast<double*>(p), v); }
+    static KERNEL_INLINE vec_t add(vec_t x, vec_t y) { return _mm_add_pd(x, y); }
+    static KERNEL_INLINE vec_t mul(vec_t x, vec_t y) { return _mm_mul_pd(x, y); }
+    static KERNEL_INLINE vec_t set1(double x) { return _mm_set1_pd(x); }
+};
+#endif
+
+DEFINE_STREAM_KERNELS(32, StreamScalarOps<float>)
+
+#ifdef HAS_WORD_64
+DEFINE_STREAM_KERNELS(64, StreamScalarOps<double>)
+#endif
+
+#if defined(HAS_WORD_128) && defined(ARCH_INTEL)
+DEFINE_STREAM_KERNELS(128, StreamSSE2Ops)
+#endif
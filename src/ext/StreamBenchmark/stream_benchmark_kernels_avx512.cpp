@@ -0,0 +1,58 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ * 
+ * @brief Implementation file for the 512-bit STREAM-like benchmark kernels.
+ * On x86-64 Linux this translation unit is built with -mavx512f like benchmark_kernels_avx512.cpp, and its kernels are only selected after detect_isa_extensions() has confirmed AVX-512F support.
+ */
+
+//Headers
+#include <stream_benchmark_kernels.h>
+#include <stream_kernel_templates.h>
+#include <common.h>
+
+using namespace xmem;
+
+#ifdef HAS_WORD_512
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+#error 512-bit words are not supported on Windows.
+#endif
+
+/**
+ * @brief Arithmetic policy for the 512-bit kernels.
+ */
+struct StreamAVX512Ops {
+    typedef __m512d vec_t;
+    static KERNEL_INLINE vec_t load(const vec_t* p) { return _mm512_load_pd(reinterpret_cast<const double*>(p)); }
+    static KERNEL_INLINE void store(vec_t* p, vec_t v) { _mm512_store_pd(reinterpret_cast<double*>(p), v); }
+    static KERNEL_INLINE vec_t add(vec_t x, vec_t y) { return _mm512_add_pd(x, y); }
+    static KERNEL_INLINE vec_t mul(vec_t x, vec_t y) { return _mm512_mul_pd(x, y); }
+    static KERNEL_INLINE vec_t set1(double x) { return _mm512_set1_pd(x); }
+};
+
+DEFINE_STREAM_KERNELS(512, StreamAVX512Ops)
+#endif
@@ -38,6 +38,9 @@
 #include <PowerReader.h>
 #include <Thread.h>
 #include <Runnable.h>
+#include <MemoryWorker.h>
+#include <WorkerPool.h>
+#include <RegionCache.h>
 
 //Libraries
 #include <cstdint>
@@ -274,6 +277,30 @@ namespace xmem {
          */
         rw_mode_t getRWMode() const;
 
+        /**
+         * @brief Sets a persistent worker pool to run the worker threads of each iteration. If unset, threads are created and destroyed per iteration.
+         * @param worker_pool The pool to use, or NULL.
+         */
+        void setWorkerPool(WorkerPool* worker_pool);
+
+        /**
+         * @brief Sets a cache of prepared memory regions shared with other benchmarks, so that regions that are already resident or already hold the needed pointer chains are not prepared again.
+         * @param region_cache The cache to use, or NULL to always prepare regions from scratch.
+         */
+        void setRegionCache(RegionCache* region_cache);
+
+        /**
+         * @brief Sets how far ahead the benchmark kernels issue software prefetches. Only sequential read and latency benchmarks support software prefetching.
+         * @param lines Prefetch distance in cache lines for sequential kernels, or in pointer hops for pointer chasing. If 0, no software prefetches are issued.
+         */
+        void setPrefetchDistance(uint32_t lines);
+
+        /**
+         * @brief Gets the software prefetch distance of this benchmark.
+         * @returns The prefetch distance. 0 means no software prefetching.
+         */
+        uint32_t getPrefetchDistance() const;
+
     protected:
 
         /**
@@ -288,7 +315,7 @@ namespace xmem {
         void computeMedian(std::vector<double> metrics, uint32_t n);
 
         /**
-         * @brief Computes the metrics across iterations.
+         * @brief Computes the metrics across the short samples if there are enough of them for a CI of the median, otherwise across iterations. All statistics come from the same data.
          */
         virtual void computeMetrics();
 
@@ -305,6 +332,67 @@ namespace xmem {
          */
         bool stopPowerThreads();
 
+        /**
+         * @brief Runs one iteration's workers to completion, on the worker pool if one is set and large enough, otherwise on freshly created threads.
+         * @param workers The workers to run.
+         * @param prime_memory If true, pooled threads prime their memory before starting. Freshly created threads always prime.
+         * @returns True on success.
+         */
+        bool runWorkers(std::vector<MemoryWorker*>& workers, bool prime_memory);
+
+        /**
+         * @brief Computes how much of the latency measurement window was covered by load. The first worker is assumed to be the latency worker and all others load workers.
+         * @param workers The workers of one completed loaded latency iteration.
+         * @returns The smallest fraction of the latency window covered by any single load worker, from 0 to 1. Returns 1 if there are no load workers.
+         */
+        double computeLoadOverlap(std::vector<MemoryWorker*>& workers);
+
+        /**
+         * @brief Writes to a memory range so that its pages are resident in physical memory and not shared. Skipped if the region cache knows the range is already resident.
+         * @param start_address Beginning of the range.
+         * @param end_address End of the range.
+         */
+        void touchRegion(void* start_address, void* end_address);
+
+        /**
+         * @brief Builds a random pointer chain in a memory range, unless the region cache knows an identical chain is already there.
+         * See build_random_pointer_permutation() for the parameters.
+         * @returns True on success.
+         */
+        bool prepareChain(void* start_address, void* end_address, chunk_size_t chunk_size, chain_granularity_t granularity, bool random_offsets, uint64_t seed);
+
+        /**
+         * @brief Checks that one pass of the sequential load kernels at this benchmark's stride fits in each worker's memory, so that no chunk is accessed twice per pass.
+         * @param len_per_thread Bytes of memory given to each load worker.
+         * @returns True if the pass fits. Otherwise an error is printed.
+         */
+        bool checkPassSpan(size_t len_per_thread) const;
+
+        /**
+         * @brief Computes the aggregate throughput of a group of workers for each of their short samples. Sample k of every worker is taken to cover the same slice of the iteration.
+         * @param workers The workers of one completed iteration.
+         * @param first Index of the first worker of the group.
+         * @param last Index one past the last worker of the group.
+         * @returns Throughput in MB/s for each sample that all workers of the group have recorded.
+         */
+        std::vector<double> computeThroughputSamples(std::vector<MemoryWorker*>& workers, uint32_t first, uint32_t last);
+
+        /**
+         * @brief Computes the average latency of a worker for each of its short samples.
+         * @param worker The latency worker of one completed iteration.
+         * @param accesses_per_pass Number of memory accesses in each pass of the kernel.
+         * @returns Latency in ns per access for each sample.
+         */
+        std::vector<double> computeLatencySamples(MemoryWorker* worker, uint32_t accesses_per_pass);
+
+        /**
+         * @brief Adds the short samples of an iteration to the pool and checks whether the 95% CI of their median is within g_ci_width of the median. If so, and unless extended logging is on, iterations_ and the per-iteration result vectors are truncated to the iterations run so far.
+         * @param iter Index of the completed iteration.
+         * @param samples Metric of each short sample of the iteration.
+         * @returns True if no further iterations are needed.
+         */
+        bool recordIterationSamples(uint32_t iter, const std::vector<double>& samples);
+
 
         //Memory region under test
         void* mem_array_; /**< Pointer to the memory region to use in this benchmark. */
@@ -318,12 +406,15 @@ namespace xmem {
         uint32_t mem_node_; /**< The memory NUMA node used in this benchmark. */
         uint32_t mem_region_; /**< The region of memory NUMA node used in this benchmark. */
         uint32_t cpu_node_; /**< The CPU NUMA node used in this benchmark. */
+        WorkerPool* worker_pool_; /**< Persistent worker threads, or NULL to spawn threads per iteration. Not owned. */
+        RegionCache* region_cache_; /**< Preparation state of memory regions shared across benchmarks, or NULL. Not owned. */
 
         //Benchmarking settings
         pattern_mode_t pattern_mode_; /**< Access pattern mode. */
         rw_mode_t rw_mode_; /**< Read/write mode. */
         chunk_size_t chunk_size_; /**< Chunk size of memory accesses in this benchmark. */
         int32_t stride_size_; /**< Stride size in chunks for sequential pattern mode only. */
+        uint32_t prefetch_distance_; /**< Software prefetch distance in cache lines or pointer hops. 0 disables software prefetching. */
 
         //Power measurement
         std::vector<PowerReader*> dram_power_readers_; /**< The power reading objects for measuring DRAM power on a per-socket basis during the benchmark. */
@@ -333,6 +424,7 @@ namespace xmem {
         std::vector<double> metric_on_iter_; /**< Metrics for each iteration of the benchmark. Unit-less because any benchmark can set this metric as needed. It is up to the descendant class to interpret units. */
         std::vector<double> enumerator_metric_on_iter_; /**< Metrics for each iteration of the benchmark. Unit-less because any benchmark can set this metric as needed. It is up to the descendant class to interpret units. */
         std::vector<double> denominator_metric_on_iter_; /**< Denominator metric for ratio metrics for each iteration of the benchmark. */
+        std::vector<double> metric_samples_; /**< Metric of every short sample over all iterations. The reported statistics, including the median and its 95% CI, are computed from these when there are enough of them. */
         double mean_metric_; /**< Average metric over all iterations. Unit-less because any benchmark can set this metric as needed. It is up to the descendant class to interpret units. */
         double min_metric_; /**< Minimum metric over all iterations. Unit-less because any benchmark can set this metric as needed. It is up to the descendant class to interpret units. */
         double percentile_25_metric_; /**< 25th percentile metric over all iterations. Unit-less because any benchmark can set this metric as needed. It is up to the descendant class to interpret units. */
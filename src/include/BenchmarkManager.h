@@ -42,7 +42,13 @@
 #include <LatencyBenchmark.h>
 #include <LatencyMatrixBenchmark.h>
 #include <ThroughputMatrixBenchmark.h>
+#include <ContentionBenchmark.h>
+#include <CoreToCoreBenchmark.h>
+#include <DRAMMappingBenchmark.h>
+#include <ProducerConsumerBenchmark.h>
 #include <Configurator.h>
+#include <WorkerPool.h>
+#include <RegionCache.h>
 
 //Libraries
 #include <cstdint>
@@ -96,6 +102,60 @@ namespace xmem {
          */
         bool runThroughputMatrixBenchmarks();
 
+        /**
+         * @brief Runs the software prefetch distance sweep. For every CPU and memory NUMA node pair, sequential read throughput and unloaded latency are measured at each prefetch distance, and a summary table is printed.
+         * @returns True on benchmarking success.
+         */
+        bool runPrefetchSweep();
+
+        /**
+         * @brief Runs the memory-level parallelism sweep. For every CPU and memory NUMA node pair, unloaded latency is measured while chasing 1, 2, 4, ... MLP_SWEEP_MAX_CHAINS independent pointer chains at once, and a summary table is printed.
+         * @returns True on benchmarking success.
+         */
+        bool runMlpSweep();
+
+        /**
+         * @brief Runs the cache line contention benchmarks. For every memory NUMA node and thread placement, each contention operation is measured with 1, 2, 4, ... threads up to the number of worker threads at several target spacings, and a summary table is printed per operation.
+         * @returns True on benchmarking success.
+         */
+        bool runContentionBenchmarks();
+
+        /**
+         * @brief Runs the core-to-core latency matrix. For every selected memory NUMA node, one cache line is bounced between every ordered pair of logical CPUs in the selected CPU NUMA nodes, and the median and tail one-way latencies are printed as matrices.
+         * @returns True on benchmarking success.
+         */
+        bool runCoreToCoreMatrix();
+
+        /**
+         * @brief Runs the producer/consumer benchmarks. For every selected memory NUMA node, a ring buffer of the working set size per thread streams cache line messages between one pair of logical CPUs of each CPU pair relation found in the selected CPU NUMA nodes.
+         * @returns True on benchmarking success.
+         */
+        bool runProducerConsumerBenchmarks();
+
+        /**
+         * @brief Runs the false sharing benchmarks. For every selected memory NUMA node and thread placement, each worker thread updates its own word, and the words are spaced by each of the selected distances.
+         * @returns True on benchmarking success.
+         */
+        bool runFalseSharingBenchmarks();
+
+        /**
+         * @brief Runs the DRAM address mapping discovery. For every selected memory NUMA node, the bank, rank and channel functions, row bits and channel interleave bits of the first memory region are derived from row buffer conflicts, timed on the first logical CPU of the nearest selected CPU NUMA node.
+         * @returns True on benchmarking success.
+         */
+        bool runDRAMMappingBenchmarks();
+
+        /**
+         * @brief Reallocates all working sets with a different page size. Benchmarks built for the old working sets are discarded and rebuilt on demand.
+         * @param mode The page mode to use from now on.
+         */
+        void setPageMode(page_mode_t mode);
+
+        /**
+         * @brief Gets the page size that currently backs the working sets.
+         * @returns The page mode.
+         */
+        page_mode_t getPageMode() const { return page_mode_; }
+
 #ifdef EXT_DELAY_INJECTED_LOADED_LATENCY_BENCHMARK
         /**
          * @brief Runs the delay-injected loaded latency benchmark extension.
@@ -119,6 +179,46 @@ namespace xmem {
          */
         void setupWorkingSets(size_t working_set_size);
 
+        /**
+         * @brief Frees all working sets and the benchmarks built on them.
+         */
+        void freeWorkingSets();
+
+#ifdef __gnu_linux__
+        /**
+         * @brief Maps anonymous memory backed by the current page size and binds it to a NUMA node before it is first touched.
+         * @param len Length of the region in bytes.
+         * @param numa_node The memory NUMA node.
+         * @param mapped_len Set to the length actually mapped, which is len rounded up to a whole page, as needed to unmap the region.
+         * @returns The page aligned start of the region, or nullptr on failure.
+         */
+        void* allocateRegion(size_t len, uint32_t numa_node, size_t* mapped_len);
+#endif
+
+        /**
+         * @brief Faults in a memory region by touching disjoint slices of it from threads pinned to every logical CPU of its NUMA node.
+         * @param region_id The memory region.
+         * @returns True if every prefault thread completed.
+         */
+        bool prefaultRegion(uint32_t region_id);
+
+        /**
+         * @brief Checks that every page of a prefaulted memory region is resident on its NUMA node, and warns about any that are not.
+         * Placement can only be queried on GNU/Linux. Elsewhere, the region is assumed to be in place.
+         * @param region_id The memory region.
+         * @returns True if the whole region is resident on its node.
+         */
+        bool verifyRegion(uint32_t region_id);
+
+#ifdef __gnu_linux__
+        /**
+         * @brief Resolves the physical address and NUMA node of every page of a prefaulted memory region through /proc/self/pagemap, writes them to the pagemap file if one is used, and narrows the region to the longest run of pages that satisfies the physical contiguity and address range selections.
+         * @param region_id The memory region.
+         * @returns True on success. Fails if the physical frames cannot be read or no pages satisfy the selections.
+         */
+        bool resolveRegion(uint32_t region_id);
+#endif
+
         /**
          * @brief Constructs and initializes all configured benchmarks.
          * @returns True on success.
@@ -130,26 +230,45 @@ namespace xmem {
          */
         void printMatrix(std::vector<MatrixBenchmark *> mat_benchmarks_, std::string what);
 
+        /**
+         * @brief Prints a CPU-by-CPU matrix in the same form as printMatrix(). Rows are the initiating CPUs and columns the responding CPUs.
+         * @param cpus Logical CPU of each row and column.
+         * @param matrix Value for each pair of CPUs, indexed by row, then column.
+         * @param units Units of the values.
+         * @param what Description of the values.
+         */
+        void printCoreToCoreMatrix(const std::vector<uint32_t>& cpus, const std::vector< std::vector<double> >& matrix, std::string units, std::string what);
+
+        /**
+         * @brief Writes one row of a contention or false sharing benchmark to the results file.
+         * @param benchmark The benchmark, which must have run.
+         */
+        void writeContentionResult(const ContentionBenchmark& benchmark);
+
         Configurator config_;
 
         std::list<uint32_t> cpu_numa_node_affinities_; /**< List of CPU nodes to affinitize for benchmark experiments. */
         std::list<uint32_t> memory_numa_node_affinities_; /**< List of memory nodes to affinitize for benchmark experiments. */
         std::vector<void*> mem_arrays_; /**< Memory regions to use in benchmarks. One for each benchmarked NUMA node. */
-#ifndef HAS_NUMA
-        void* orig_malloc_addr_; /**< Points to the original address returned by the malloc() for __mem_arrays on non-NUMA machines. Special case. FIXME: do we need this? seems awkward */
-#endif
+        std::vector<void*> mem_array_mappings_; /**< Start of the mapping behind each memory region. A region can be a subrange of its mapping when physical addresses are used to select pages. */
         std::vector<size_t> mem_array_lens_; /**< Length of each memory region to use in benchmarks. */
+        std::vector<size_t> mem_array_mapped_lens_; /**< Length of the mapping behind each memory region, which can be larger than the region when it is backed by huge pages. */
         std::vector<size_t> mem_array_node_; /**< NUMA node of each memory region to use in benchmarks. */
+        std::vector<uint64_t> mem_array_phys_addrs_; /**< Physical address of the start of each memory region, if known. Empty when physical addresses are not used. */
         std::vector<ThroughputBenchmark*> tp_benchmarks_; /**< Set of throughput benchmarks. */
         std::vector<LatencyBenchmark*> lat_benchmarks_; /**< Set of latency benchmarks. */
         std::vector<LatencyMatrixBenchmark*> lat_mat_benchmarks_; /**< Set of latency matrix benchmarks. */
         std::vector<ThroughputMatrixBenchmark*> thr_mat_benchmarks_; /**< Set of throughput matrix benchmarks. */
         std::vector<PowerReader*> dram_power_readers_; /**< Set of power measurement objects for DRAM on each NUMA node. */
+        WorkerPool* worker_pool_; /**< Persistent pinned worker threads shared by all benchmarks, or NULL if it could not be started. */
+        RegionCache region_cache_; /**< Preparation state of the memory regions, shared by all benchmarks so that matrix cells on the same region skip re-initializing it. */
         std::fstream results_file_; /**< The results CSV file. */
         std::fstream dec_net_results_file_; /**< The results file for use by a decoding network. */
+        std::ofstream pagemap_file_; /**< The per-page physical address report of the memory regions. */
         std::ofstream lat_mat_logfile_; /**< Logfile for latency matrix measurements. */
         std::ofstream thr_mat_logfile_; /**< Logfile for throughput matrix measurements. */
         bool built_benchmarks_; /**< If true, finished building all benchmarks. */
+        page_mode_t page_mode_; /**< Page size that backs the memory regions. */
     };
 };
 
@@ -62,6 +62,7 @@ namespace xmem {
         MEM_REGIONS,
         ITERATIONS,
         RANDOM_ACCESS_PATTERN,
+        INDEPENDENT_RANDOM_ACCESS_PATTERN,
         SEQUENTIAL_ACCESS_PATTERN,
         MEAS_THROUGHPUT,
         MEAS_THROUGHPUT_MATRIX,
@@ -76,7 +77,31 @@ namespace xmem {
         MEM_REGIONS_PHYS,
         USE_READS,
         USE_WRITES,
-        STRIDE_SIZE
+        STRIDE_SIZE,
+        TIMER,
+        RANDOM_SEED,
+        CHAIN_GRANULARITY,
+        CHAIN_OFFSETS,
+        SAMPLE_DURATION,
+        CI_WIDTH,
+        USE_NT_WRITES,
+        MEAS_PREFETCH_SWEEP,
+        PREFETCH_HINT,
+        JIT_KERNELS,
+        MEAS_MLP_SWEEP,
+        RW_RATIO,
+        MEAS_CONTENTION,
+        MEAS_CORE_TO_CORE_MATRIX,
+        MEAS_PRODUCER_CONSUMER,
+        MEAS_FALSE_SHARING,
+        SPACING,
+        PAGE_SIZE,
+        PREFAULT,
+        PAGEMAP,
+        PAGEMAP_FILE,
+        PHYS_CONTIGUOUS,
+        PHYS_RANGE,
+        MEAS_DRAM_MAPPING
     };
 
     /**
@@ -96,6 +121,7 @@ namespace xmem {
         { MEM_REGIONS, 0, "m", "mem_regions", MyArg::PositiveInteger, "    -m, --mem_regions    \tMemory regions to be used for the matrix benchmarks. DEFAULT: 1" },
         { ITERATIONS, 0, "n", "iterations", MyArg::PositiveInteger, "    -n, --iterations    \tIterations per benchmark. Multiple independent iterations may be performed on each benchmark setting to ensure consistent results. DEFAULT: 1" },
         { RANDOM_ACCESS_PATTERN, 0, "r", "random_access", Arg::None, "    -r, --random_access    \tUse a random access pattern for load traffic-generating threads used in throughput and loaded latency benchmarks." },
+        { INDEPENDENT_RANDOM_ACCESS_PATTERN, 0, "g", "gups", Arg::None, "    -g, --gups    \tUse an independent random access pattern for load traffic-generating threads used in throughput, loaded latency, and throughput matrix benchmarks. Unlike -r, addresses come from an in-register random number generator instead of the previous load, so many accesses are in flight and the result is random-access bandwidth, as in GUPS. Reads load each chunk, writes update it in place (read-modify-write), and non-temporal writes overwrite it without reading. 128-bit and 256-bit chunks use AVX2 gathers and only support reads; 512-bit chunks use AVX-512F gathers and scatters." },
         { SEQUENTIAL_ACCESS_PATTERN, 0, "s", "sequential_access", Arg::None, "    -s, --sequential_access    \tUse a sequential and/or strided access pattern for load traffic generating-threads used in throughput and loaded latency benchmarks." },
         { MEAS_THROUGHPUT, 0, "t", "throughput", Arg::None, "    -t, --throughput    \tThroughput benchmarking mode. Aggregate throughput is measured across all worker threads. Each load traffic-generating worker in a particular benchmark runs an identical kernel. Multiple distinct benchmarks may be run depending on the specified benchmark settings (e.g., aggregated 64-bit and 256-bit sequential read throughput using strides of 1 and -8 chunks)." },
         { NUMA_DISABLE, 0, "u", "ignore_numa", Arg::None, "    -u, --ignore_numa    \tForce uniform memory access (UMA) mode. This only has an effect in non-uniform memory access (NUMA) systems. Limits benchmarking to CPU and memory NUMA node 0 instead of all intra-node and inter-node combinations. This mode can be useful in situations where the user is not interested in cross-node effects or node asymmetry. This option is the same as independently setting CPU and memory node affinities to 0 using the \"-C\" and \"-M\" options, but this cannot be used in tandem with those options. This option may also be required if large pages are desired on GNU/Linux systems due to lack of NUMA support in current versions of hugetlbfs. See the large_pages option." },
@@ -103,17 +129,41 @@ namespace xmem {
         { WORKING_SET_SIZE_PER_THREAD, 0, "w", "working_set_size", MyArg::PositiveInteger, "    -w, --working_set_size    \tWorking set size per worker thread in KB. This must be a multiple of 4KB. In all benchmarks, each worker thread works on its own \"private\" region of memory. For example, 4-thread throughput benchmarking with a working set size of 4 KB might result in measuring the aggregate throughput of four L1 caches corresponding to four physical cores, with no data sharing between threads. Similarly, an 8-thread loaded latency benchmark with a working set size of 64 MB would use 512 MB of memory in total for benchmarking, with no data sharing between threads. This would result in performance measurement of the shared DRAM physical interface, the shared L3 cache, etc." },
         { LOG_EXTENDED, 0, "x", "extended", Arg::None, "    -x, --extended    \tRun the given iterations and log measured values to enable statistical processing of the experiments." },
         { CPU_NUMA_NODE_AFFINITY, 0, "C", "cpu_numa_node_affinity", MyArg::NonnegativeInteger, "    -C, --cpu_numa_node_affinity    \tInclude the specified NUMA node in all selected benchmark experiments. This does not specify logical/physical CPU core affinity, just the NUMA node (socket). Setting core affinities is not supported at this time. This option may be specified multiple times with multiple nodes. Note that all possible combinations of selected CPU and memory NUMA node affinities will be used. If left unspecified, then all available nodes will be used." },
-        { USE_LARGE_PAGES, 1, "L", "large_pages", Arg::None, "    -L, --large_pages    \tUse large pages. This might enable better memory performance by reducing the translation-lookaside buffer (TLB) bottleneck. However, this is not supported on all systems. On GNU/Linux, you need hugetlbfs support with pre-reserved huge pages prior to running X-Mem. On GNU/Linux, you also must use the ignore_numa option, as hugetlbfs is not NUMA-aware at this time." },
+        { USE_LARGE_PAGES, 1, "L", "large_pages", Arg::None, "    -L, --large_pages    \tUse large pages. This might enable better memory performance by reducing the translation-lookaside buffer (TLB) bottleneck. However, this is not supported on all systems. This option is the same as \"--page_size=2m\". On GNU/Linux, you need 2 MB huge pages reserved on every benchmarked memory NUMA node prior to running X-Mem." },
         { MEMORY_NUMA_NODE_AFFINITY, 0, "M", "memory_numa_node_affinity", MyArg::NonnegativeInteger, "    -M, --memory_numa_node_affinity    \tInclude the specified NUMA node in all selected benchmark experiments for placement of memory regions under test. This does not specify thread placement for the experiments (CPU affinity). This option may be specified multiple times with multiple nodes. Note that all possible combinations of selected CPU and memory NUMA node affinities will be used. If left unspecified, then all available nodes will be used." },
         { USE_READS, 0, "R", "reads", Arg::None, "    -R, --reads    \tUse memory read-based patterns in load traffic-generating threads." },
         { USE_WRITES, 0, "W", "writes", Arg::None, "    -W, --writes    \tUse memory write-based patterns in load traffic-generating threads." },
-        { STRIDE_SIZE, 0, "S", "stride_size", MyArg::Integer, "    -S, --stride_size    \tA stride size to use for load traffic-generating threads, specified in powers-of-two multiples of the chunk size(s). Allowed values: 1, -1, 2, -2, 4, -4, 8, -8, 16, -16. Positive indicates the forward direction (increasing addresses), while negative indicates the reverse direction." },
+        { STRIDE_SIZE, 0, "S", "stride_size", MyArg::Integer, "    -S, --stride_size    \tA stride size to use for load traffic-generating threads, specified in multiples of the chunk size(s). Allowed values: 1, 2, 3, 4, 5, 6, 8, 12, 16, 32, 64, 128, 256, 512, and 1024, or their negatives, as long as the stride is at most one 4 KB page for every selected chunk size. Each pass of a load thread makes one access per stride over 4 KB times the stride of memory, so no chunk is accessed twice, and this must fit in the working set size per thread. Positive indicates the forward direction (increasing addresses), while negative indicates the reverse direction. This option may be specified multiple times." },
+        { USE_NT_WRITES, 0, "", "nt_writes", Arg::None, "    --nt_writes    \tUse non-temporal (streaming) memory write-based patterns in load traffic-generating threads. These stores bypass the caches and do not read the target lines for ownership first. Only sequential and strided patterns are supported; random-access combinations are skipped. Not supported on all platforms." },
+        { RW_RATIO, 0, "", "rw_ratio", MyArg::Required, "    --rw_ratio    \tUse a mixed read/write pattern in load traffic-generating threads. Allowed values: 1:1, 2:1, 3:1, rmw. \"N:1\" loads N cache lines for every cache line it stores (one access per line when the stride skips whole lines), and random-access patterns store back every (N+1)th chunk of the chain. \"rmw\" loads every chunk and stores it back in place; random-access rmw is the same as random writes. Independent random-access patterns are not supported. This option may be specified multiple times, and it replaces the default reads and writes like the reads and writes options do." },
         { ALL_CORES, 0, "", "all_cores", Arg::None, "    --all_cores    \tRun matrix benchmarks for every core of the system." },
         { DEC_NET_FILE, 0, "", "dec_net_file", MyArg::Required, "    --dec_net_file    \tDefine the output file for the matrix benchmarks that follow a format suitable for decoding networks." },
         { MEAS_LATENCY_MATRIX, 0, "", "latency_matrix", Arg::None, "    --latency_matrix    \tUnloaded latency for all CPU NUMA nodes of the system benchmarking mode."},
         { SYNC_MEM, 0, "", "sync", Arg::None, "    --sync    \tRun matrix benchmarks with physical addresses by using synchronous operations (O_SYNC enabled)." },
         { MEM_REGIONS_PHYS, 0, "", "regions", MyArg::HexAddresses, "    --regions    \tPhysical addresses of memory regions to be tested. (only for matrix benchmarks)" },
         { MEAS_THROUGHPUT_MATRIX, 0, "", "throughput_matrix", Arg::None, "    --throughput_matrix    \tRun throughput benchmark for every core of the system." },
+        { MEAS_CORE_TO_CORE_MATRIX, 0, "", "core_to_core_matrix", Arg::None, "    --core_to_core_matrix    \tCore-to-core latency matrix benchmarking mode. For every ordered pair of logical CPUs in the selected CPU NUMA nodes, two threads bounce one cache line back and forth, so that each transfer reads a line last written by the other CPU. The median and 99th percentile one-way latencies are printed as matrices for every selected memory NUMA node holding the line, and are written to the decoding net file if one is given." },
+        { MEAS_PRODUCER_CONSUMER, 0, "", "producer_consumer", Arg::None, "    --producer_consumer    \tProducer/consumer benchmarking mode. Two threads stream cache line messages through a single-producer/single-consumer ring buffer, for one pair of logical CPUs in the selected CPU NUMA nodes of each kind: SMT siblings, different cores sharing an L3 cache, different L3 caches in the same package, and different packages. The ring buffer is the working set size per thread, and is placed in each selected memory NUMA node in turn. The transfer bandwidth and the median, 95th and 99th percentile latency of messages from the producer to the consumer are reported." },
+        { MEAS_PREFETCH_SWEEP, 0, "", "prefetch_sweep", Arg::None, "    --prefetch_sweep    \tSoftware prefetch distance sweep benchmarking mode. For every CPU and memory NUMA node pair, sequential read throughput and unloaded pointer-chasing latency are measured with software prefetches issued 0, 1, 2, 4, ... 64 cache lines (or chain hops) ahead, and the best distance is reported. Throughput uses the selected chunk sizes and strides. Not supported on all platforms." },
+        { MEAS_MLP_SWEEP, 0, "", "mlp_sweep", Arg::None, "    --mlp_sweep    \tMemory-level parallelism sweep benchmarking mode. For every CPU and memory NUMA node pair, a single thread chases 1, 2, 4, ... 32 independent random pointer chains at once, and the latency of each access, the resulting throughput, and the number of outstanding misses implied by Little's law are reported." },
+        { MEAS_CONTENTION, 0, "", "contention", Arg::None, "    --contention    \tCache line contention benchmarking mode. For every memory NUMA node, 1, 2, 4, ... threads, up to the number of worker threads, each pinned to its own logical CPU, hammer pointer-sized targets with atomic exchange-and-add, compare-and-swap, exchange, plain stores, and plain increments. The targets of consecutive threads are 0 (one shared word), 8, 64, 128 and 4096 bytes apart, unless other distances are given with the spacing option. Threads fill the selected CPU NUMA nodes one after the other (compact), and if more than one CPU NUMA node is selected, they are also dealt round-robin across the nodes (scatter). The aggregate rate of operations and the average time per operation on each thread are reported." },
+        { MEAS_FALSE_SHARING, 0, "", "false_sharing", Arg::None, "    --false_sharing    \tFalse sharing benchmarking mode. For every memory NUMA node, as many threads as worker threads, each pinned to its own logical CPU, update their own pointer-sized word with plain increments and plain stores. The words of consecutive threads are 8 (same cache line), 64 (adjacent lines), 128 (separate pairs of lines fetched together by adjacent-line prefetchers) and 4096 (separate pages) bytes apart, unless other distances are given with the spacing option. Threads are placed compactly and, if more than one CPU NUMA node is selected, scattered across the nodes like in the contention mode. The aggregate and per-thread update rates are reported, along with the smallest spacing that performs within 5% of the widest one. Needs at least two worker threads." },
+        { SPACING, 0, "", "spacing", MyArg::NonnegativeInteger, "    --spacing    \tDistance in bytes between the words updated by consecutive threads in the contention and false sharing modes. This must be a multiple of the pointer size, or 0 to have all threads update the same word. This option may be specified multiple times." },
+        { PAGE_SIZE, 0, "", "page_size", MyArg::Required, "    --page_size    \tPage size that backs the memory regions under test. Allowed values: default, 4k, thp, 2m, 1g. \"default\" is a normal allocation, \"4k\" disables transparent huge pages for the regions, \"thp\" requests transparent huge pages, and \"2m\" and \"1g\" use explicit huge pages, which must be reserved on every benchmarked memory NUMA node beforehand (e.g. in /sys/devices/system/node/node*/hugepages). On Windows, only default and 2m are supported. This option may be specified multiple times, in which case all selected benchmarks are repeated for each page size. DEFAULT: default" },
+        { PREFAULT, 0, "", "prefault", MyArg::Required, "    --prefault    \tHow the memory regions under test are faulted in when they are allocated, so that benchmarks only need to warm the caches. Allowed values: none, populate, threads. \"none\" leaves it to the first benchmark that touches each region, \"populate\" has the kernel fault in each region while mapping it (MAP_POPULATE, GNU/Linux only), and \"threads\" touches disjoint slices of each region in parallel from all logical CPUs of its NUMA node. Except with \"none\", the residency and NUMA node of every page are verified afterwards on GNU/Linux. DEFAULT: threads" },
+        { PAGEMAP, 0, "", "pagemap", Arg::None, "    --pagemap    \tResolve the physical address of every page of the memory regions under test through /proc/self/pagemap instead of mapping /dev/mem. The physical address of each region is written to the decoding network file. This needs the CAP_SYS_ADMIN capability, which is usually only held by root, and cannot be used with the regions option or without prefaulting. Only supported on GNU/Linux." },
+        { PAGEMAP_FILE, 0, "", "pagemap_file", MyArg::Required, "    --pagemap_file    \tWrite the virtual address, physical address and NUMA node of every page of the memory regions under test to this CSV file. Implies the pagemap option." },
+        { PHYS_CONTIGUOUS, 0, "", "phys_contiguous", Arg::None, "    --phys_contiguous    \tBenchmark only the longest physically contiguous run of pages in each memory region. Implies the pagemap option." },
+        { PHYS_RANGE, 0, "", "phys_range", MyArg::HexAddresses, "    --phys_range    \tBenchmark only the longest virtually contiguous run of pages in each memory region whose physical addresses lie within the given range. The range is given as two hexadecimal physical addresses, START,END, and END is exclusive. Implies the pagemap option." },
+        { MEAS_DRAM_MAPPING, 0, "", "dram_mapping", Arg::None, "    --dram_mapping    \tDRAM address mapping discovery mode. For every selected memory NUMA node, a pool of random cache lines is sorted into same-bank sets by timing alternating reads of pairs of lines that are flushed from the caches after every read, which are slow when the lines are in the same bank but in different rows. The XOR functions of physical address bits that select the bank, rank and channel, the row and column bits, and the channel interleave bits are then derived and written to the decoding net file if one is given. Physical addresses are resolved through /proc/self/pagemap unless the regions option is given. Large working sets backed by huge pages reveal more address bits. Only supported on x86 GNU/Linux." },
+        { PREFETCH_HINT, 0, "", "prefetch_hint", MyArg::Required, "    --prefetch_hint    \tLocality hint of the software prefetches issued in the prefetch sweep mode. Allowed values: t0, t1, t2, nta. \"t0\" prefetches into all cache levels, \"t1\" and \"t2\" into the second and third levels and beyond, and \"nta\" close to the core while minimizing cache pollution. DEFAULT: t0" },
+        { CHAIN_GRANULARITY, 0, "", "chain_granularity", MyArg::Required, "    --chain_granularity    \tSpacing of the nodes in the random pointer chain walked by latency measurement threads. Allowed values: chunk, line, page. \"chunk\" places a node in every 64-bit word, so several nodes share each cache line. \"line\" places exactly one node per cache line. \"page\" places exactly one node per page at a random cache line within it, which exposes TLB miss latency. The chain always visits every node once before repeating. DEFAULT: line" },
+        { CHAIN_OFFSETS, 0, "", "chain_offsets", MyArg::Required, "    --chain_offsets    \tPlacement of each node of the random pointer chain walked by latency measurement threads within its node spacing. Allowed values: aligned, random. \"aligned\" puts every node at the start of its cache line or page. \"random\" puts it at a random 64-bit word instead, which spreads page-granular nodes across cache sets, and varies the word used in each line for line-granular chains. It has no effect on chunk-granular chains or with software prefetching, which needs line-aligned nodes. DEFAULT: random for page granularity, aligned otherwise" },
+        { RANDOM_SEED, 0, "", "seed", MyArg::NonnegativeInteger64, "    --seed    \tNon-negative 64-bit seed for the random pointer chains used by latency measurement threads and random-access load threads. Runs with the same seed use the same chains. DEFAULT: 24301" },
+        { SAMPLE_DURATION, 0, "", "sample_ms", MyArg::PositiveInteger, "    --sample_ms    \tDuration in milliseconds of each short sample taken within a benchmark iteration. Each iteration runs for at most 1000 ms and ends as soon as the 95% confidence interval of the median of its samples is within the CI width. Iterations end once the samples pooled over all iterations converge. Use 1000 to get one sample per iteration. DEFAULT: 20" },
+        { CI_WIDTH, 0, "", "ci_width", MyArg::Required, "    --ci_width    \tMaximum distance of the 95% confidence interval bounds from the median, in percent of the median, at which sampling stops. Ignored with the extended option. DEFAULT: 5" },
+        { JIT_KERNELS, 0, "", "jit", Arg::None, "    --jit    \tGenerate the sequential, strided and 64-bit random-access kernels as machine code at run time instead of using the compiled ones. This makes the memory instructions independent of the compiler, and allows any stride of at most one 4 KB page. Only supported on x86-64 GNU/Linux." },
+        { TIMER, 0, "", "timer", MyArg::Required, "    --timer    \tTimer backend to use for all measurements. Allowed values: os, tsc, invariant_tsc. \"os\" uses QPC on Windows and clock_gettime() on GNU/Linux. \"tsc\" reads the time-stamp counter between serializing cpuid instructions. \"invariant_tsc\" reads the time-stamp counter ordered with lfence/rdtscp instead of cpuid, which has much lower overhead, and requires a CPU with an invariant TSC. Hardware timers are calibrated against the raw monotonic OS clock at startup. DEFAULT: os, unless X-Mem was built with USE_HW_TIMER." },
         { UNKNOWN, 0, "", "", Arg::None,
         "\n"
         "If a given option is not specified, X-Mem defaults will be used where appropriate.\n"
@@ -227,6 +277,48 @@ namespace xmem {
          */
         bool throughputMatrixTestSelected() const { return run_throughput_matrix_; }
 
+        /**
+         * @brief Indicates if the software prefetch distance sweep has been selected.
+         * @returns True if the prefetch sweep has been selected to run.
+         */
+        bool prefetchSweepSelected() const { return run_prefetch_sweep_; }
+
+        /**
+         * @brief Indicates if the memory-level parallelism sweep has been selected.
+         * @returns True if the MLP sweep has been selected to run.
+         */
+        bool mlpSweepSelected() const { return run_mlp_sweep_; }
+
+        /**
+         * @brief Indicates if the cache line contention benchmarks have been selected.
+         * @returns True if the contention benchmarks have been selected to run.
+         */
+        bool contentionSelected() const { return run_contention_; }
+
+        /**
+         * @brief Indicates if the core-to-core latency matrix has been selected.
+         * @returns True if the core-to-core latency matrix has been selected to run.
+         */
+        bool coreToCoreMatrixSelected() const { return run_core_to_core_matrix_; }
+
+        /**
+         * @brief Indicates if the producer/consumer benchmarks have been selected.
+         * @returns True if the producer/consumer benchmarks have been selected to run.
+         */
+        bool producerConsumerSelected() const { return run_producer_consumer_; }
+
+        /**
+         * @brief Indicates if the false sharing benchmarks have been selected.
+         * @returns True if the false sharing benchmarks have been selected to run.
+         */
+        bool falseSharingSelected() const { return run_false_sharing_; }
+
+        /**
+         * @brief Indicates if the DRAM address mapping discovery has been selected.
+         * @returns True if the DRAM address mapping discovery has been selected to run.
+         */
+        bool dramMappingSelected() const { return run_dram_mapping_; }
+
         /**
          * @brief Indicates if the accesses to memory for matrix tests will be processed synchronously.
          * @returns True if the accesses to memory for matrix tests will be processed synchronously.
@@ -313,6 +405,48 @@ namespace xmem {
          */
         std::vector<uint64_t> getMemoryRegionsPhysAddresses() const { return mem_regions_phys_addr_; }
 
+        /**
+         * @brief Determines whether the physical addresses of the memory regions should be resolved through /proc/self/pagemap.
+         * @returns True if pagemap resolution is enabled.
+         */
+        bool pagemapSelected() const { return pagemap_; }
+
+        /**
+         * @brief Gets the file that the per-page physical address report is written to.
+         * @returns The filename if usePagemapFile() returns true. Otherwise return value is "".
+         */
+        std::string getPagemapFilename() const { return pagemap_filename_; }
+
+        /**
+         * @brief Determines whether the per-page physical address report should be written.
+         * @returns True if a pagemap file should be used.
+         */
+        bool usePagemapFile() const { return use_pagemap_file_; }
+
+        /**
+         * @brief Determines whether only the longest physically contiguous run of pages of each region should be benchmarked.
+         * @returns True if physically contiguous subregions were requested.
+         */
+        bool physContiguousSelected() const { return phys_contiguous_; }
+
+        /**
+         * @brief Determines whether only pages within a physical address range should be benchmarked.
+         * @returns True if a physical address range was given.
+         */
+        bool physRangeSelected() const { return phys_range_; }
+
+        /**
+         * @brief Gets the start of the physical address range of the pages to benchmark.
+         * @returns The first physical address in the range.
+         */
+        uint64_t getPhysRangeStart() const { return phys_range_start_; }
+
+        /**
+         * @brief Gets the end of the physical address range of the pages to benchmark.
+         * @returns The first physical address past the range.
+         */
+        uint64_t getPhysRangeEnd() const { return phys_range_end_; }
+
         /**
          * @brief Gets the number of iterations that should be run of each benchmark.
          * @returns The iterations for each test.
@@ -325,6 +459,12 @@ namespace xmem {
          */
         bool useRandomAccessPattern() const { return use_random_access_pattern_; }
 
+        /**
+         * @brief Determines if throughput benchmarks should use an independent (GUPS-style) random access pattern.
+         * @returns True if independent random access should be used.
+         */
+        bool useIndependentRandomAccessPattern() const { return use_independent_random_access_pattern_; }
+
         /**
          * @brief Determines if throughput benchmarks should use a sequential access pattern.
          * @returns True if sequential access should be used.
@@ -386,10 +526,16 @@ namespace xmem {
         bool verboseMode() const { return verbose_; }
 
         /**
-         * @brief Determines whether X-Mem should use large pages.
-         * @param True if large pages should be used.
+         * @brief Gets the page sizes that should back the memory regions under test, in the order they were given.
+         * @returns The page modes. Never empty.
+         */
+        std::vector<page_mode_t> getPageModes() const { return page_modes_; }
+
+        /**
+         * @brief Gets how the memory regions under test are faulted in when they are allocated.
+         * @returns The prefault mode.
          */
-        bool useLargePages() const { return use_large_pages_; }
+        prefault_mode_t getPrefaultMode() const { return prefault_mode_; }
 
         /**
          * @brief Determines whether reads should be used in throughput benchmarks.
@@ -404,64 +550,28 @@ namespace xmem {
         bool useWrites() const { return use_writes_; }
 
         /**
-         * @brief Determines if a stride of +1 should be used in relevant benchmarks.
-         * @returns True if a stride of +1 should be used.
-         */
-        bool useStrideP1() const { return use_stride_p1_; }
-
-        /**
-         * @brief Determines if a stride of -1 should be used in relevant benchmarks.
-         * @returns True if a stride of -1 should be used.
-         */
-        bool useStrideN1() const { return use_stride_n1_; }
-
-        /**
-         * @brief Determines if a stride of +2 should be used in relevant benchmarks.
-         * @returns True if a stride of +2 should be used.
-         */
-        bool useStrideP2() const { return use_stride_p2_; }
-
-        /**
-         * @brief Determines if a stride of -2 should be used in relevant benchmarks.
-         * @returns True if a stride of -2 should be used.
+         * @brief Determines whether non-temporal writes should be used in throughput benchmarks.
+         * @returns True if non-temporal writes should be used.
          */
-        bool useStrideN2() const { return use_stride_n2_; }
+        bool useNTWrites() const { return use_nt_writes_; }
 
         /**
-         * @brief Determines if a stride of +4 should be used in relevant benchmarks.
-         * @returns True if a stride of +4 should be used.
+         * @brief Gets the mixed read/write modes to use in throughput benchmarks, in the order they were given.
+         * @returns The modes. Each is one of READ_WRITE_1_1, READ_WRITE_2_1, READ_WRITE_3_1 or READ_MODIFY_WRITE.
          */
-        bool useStrideP4() const { return use_stride_p4_; }
+        std::vector<rw_mode_t> getMixedRWModes() const { return mixed_rw_modes_; }
 
         /**
-         * @brief Determines if a stride of -4 should be used in relevant benchmarks.
-         * @returns True if a stride of -4 should be used.
+         * @brief Gets the stride sizes to use in relevant benchmarks, in the order they were given.
+         * @returns The stride sizes in chunks. Negative strides walk memory backwards.
          */
-        bool useStrideN4() const { return use_stride_n4_; }
+        std::vector<int32_t> getStrideSizes() const { return stride_sizes_; }
 
         /**
-         * @brief Determines if a stride of +8 should be used in relevant benchmarks.
-         * @returns True if a stride of +8 should be used.
+         * @brief Gets the distances between the words of consecutive threads to use in the contention and false sharing benchmarks, in the order they were given.
+         * @returns The spacings in bytes. Empty if the user did not give any, in which case each mode uses its own defaults.
          */
-        bool useStrideP8() const { return use_stride_p8_; }
-
-        /**
-         * @brief Determines if a stride of -8 should be used in relevant benchmarks.
-         * @returns True if a stride of -8 should be used.
-         */
-        bool useStrideN8() const { return use_stride_n8_; }
-
-        /**
-         * @brief Determines if a stride of +16 should be used in relevant benchmarks.
-         * @returns True if a stride of +16 should be used.
-         */
-        bool useStrideP16() const { return use_stride_p16_; }
-
-        /**
-         * @brief Determines if a stride of -16 should be used in relevant benchmarks.
-         * @returns True if a stride of -16 should be used.
-         */
-        bool useStrideN16() const { return use_stride_n16_; }
+        std::vector<uint32_t> getSpacings() const { return spacings_; }
 
     private:
         /**
@@ -471,6 +581,15 @@ namespace xmem {
          */
         bool check_single_option_occurrence(Option* opt) const;
 
+        /**
+         * @brief Checks that sequential and strided kernels were generated for a stride and chunk size, and lists the allowed strides if not.
+         * @param stride_size The stride in chunks.
+         * @param chunk_size The chunk size.
+         * @param chunk_bits The chunk size in bits, for the error message.
+         * @returns True if the stride can be used with the chunk size.
+         */
+        bool check_stride_size(int32_t stride_size, chunk_size_t chunk_size, uint32_t chunk_bits) const;
+
         bool configured_; /**< If true, this object has been configured. configureFromInput() will only work if this is false. */
 
         bool run_extensions_; /**< If true, run extensions. */
@@ -486,6 +605,13 @@ namespace xmem {
         bool run_all_cores_; /**< True if matrix benchmarks should run for all cores. */
         bool run_latency_matrix_; /**< True if latency matrix tests should be run. */
         bool run_throughput_matrix_; /**< True if throughput matrix tests should be run. */
+        bool run_prefetch_sweep_; /**< True if the software prefetch distance sweep should be run. */
+        bool run_mlp_sweep_; /**< True if the memory-level parallelism sweep should be run. */
+        bool run_contention_; /**< True if the cache line contention benchmarks should be run. */
+        bool run_core_to_core_matrix_; /**< True if the core-to-core latency matrix should be run. */
+        bool run_producer_consumer_; /**< True if the producer/consumer benchmarks should be run. */
+        bool run_false_sharing_; /**< True if the false sharing benchmarks should be run. */
+        bool run_dram_mapping_; /**< True if the DRAM address mapping discovery should be run. */
         bool sync_mem_; /**< True if accesses to memory should happen synchronously. If true every access will be uncached. */
         size_t working_set_size_per_thread_; /**< Working set size in bytes for each thread, if applicable. */
         uint32_t num_worker_threads_; /**< Number of load threads to use for throughput benchmarks, loaded latency benchmarks, and stress tests. */
@@ -510,26 +636,29 @@ namespace xmem {
         std::vector<uint64_t> mem_regions_phys_addr_; /**< Vector of physical addresses of memory regions to be used for matrix benchmark experiments. */
         uint32_t iterations_; /**< Number of iterations to run for each benchmark test. */
         bool use_random_access_pattern_; /**< If true, run throughput benchmarks with random access pattern. */
+        bool use_independent_random_access_pattern_; /**< If true, run throughput benchmarks with independent random access pattern. */
         bool use_sequential_access_pattern_; /**< If true, run throughput benchmarks with sequential access pattern. */
         uint32_t starting_test_index_; /**< Numerical index to use for the first test. This is an aid for end-user interpreting and post-processing of result CSV file, if relevant. */
         std::string filename_; /**< The output filename if applicable. */
         bool use_output_file_; /**< If true, generate a CSV output file for results. */
         bool verbose_; /**< If true, then console reporting should be more detailed. */
-        bool use_large_pages_; /**< If true, then large pages should be used. */
+        std::vector<page_mode_t> page_modes_; /**< Page sizes that back the memory regions, in the order they were given. All selected benchmarks are repeated for each one. */
+        prefault_mode_t prefault_mode_; /**< How the memory regions are faulted in when they are allocated. */
+        bool pagemap_; /**< If true, resolve the physical addresses of the memory regions through /proc/self/pagemap. */
+        std::string pagemap_filename_; /**< The per-page physical address report filename if applicable. */
+        bool use_pagemap_file_; /**< If true, write the per-page physical address report. */
+        bool phys_contiguous_; /**< If true, benchmark only the longest physically contiguous run of pages of each region. */
+        bool phys_range_; /**< If true, benchmark only pages within the physical address range. */
+        uint64_t phys_range_start_; /**< First physical address of the range of pages to benchmark. */
+        uint64_t phys_range_end_; /**< First physical address past the range of pages to benchmark. */
         bool use_reads_; /**< If true, throughput benchmarks should use reads. */
         bool use_writes_; /**< If true, throughput benchmarks should use writes. */
+        bool use_nt_writes_; /**< If true, throughput benchmarks should use non-temporal writes. */
+        std::vector<rw_mode_t> mixed_rw_modes_; /**< Mixed read/write modes to use in throughput benchmarks. */
         std::string dec_net_filename_; /**< The decoding network friendly output filename if applicable. */
         bool use_dec_net_file_; /**< If true, generate a decoding net friendly output file for results. */
-        bool use_stride_p1_; /**< If true, use a stride of +1 in relevant benchmarks. */
-        bool use_stride_n1_; /**< If true, use a stride of -1 in relevant benchmarks. */
-        bool use_stride_p2_; /**< If true, use a stride of +2 in relevant benchmarks. */
-        bool use_stride_n2_; /**< If true, use a stride of -2 in relevant benchmarks. */
-        bool use_stride_p4_; /**< If true, use a stride of +4 in relevant benchmarks. */
-        bool use_stride_n4_; /**< If true, use a stride of -4 in relevant benchmarks. */
-        bool use_stride_p8_; /**< If true, use a stride of +8 in relevant benchmarks. */
-        bool use_stride_n8_; /**< If true, use a stride of -8 in relevant benchmarks. */
-        bool use_stride_p16_; /**< If true, use a stride of +16 in relevant benchmarks. */
-        bool use_stride_n16_; /**< If true, use a stride of -16 in relevant benchmarks. */
+        std::vector<int32_t> stride_sizes_; /**< Stride sizes in chunks to use in relevant benchmarks. */
+        std::vector<uint32_t> spacings_; /**< Distances in bytes between the words of consecutive threads in the contention and false sharing benchmarks. */
     };
 };
 
@@ -0,0 +1,144 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ *
+ * @brief Header file for the ContentionBenchmark class.
+ */
+
+#ifndef CONTENTION_BENCHMARK_H
+#define CONTENTION_BENCHMARK_H
+
+//Headers
+#include <Benchmark.h>
+#include <common.h>
+
+//Libraries
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace xmem {
+
+    /**
+     * @brief A type of benchmark that measures how fast a group of threads can operate on the same or nearby cache lines.
+     * Each worker thread is pinned to its own logical CPU and hammers one pointer-sized target word with atomic read-modify-writes or plain stores. The target of thread t is at t times the spacing from the start of the memory region, so a spacing of 0 has all threads share one word, a spacing below the cache line size has them share one line, and larger spacings pad the targets onto separate lines or pages.
+     * The metric is the aggregate rate of operations across all threads in Mops/s. The average time per operation seen by each thread and the rate of each thread on its own are reported alongside it.
+     */
+    class ContentionBenchmark : public Benchmark {
+    public:
+        /**
+         * @brief Constructor. The access pattern is reported as SEQUENTIAL with a stride of 1, and the read/write mode as READ_MODIFY_WRITE for atomic operations or WRITE for plain stores.
+         * @param mem_array Memory region holding the targets. It must be cache line aligned.
+         * @param len Length of the memory region in bytes.
+         * @param iterations Number of iterations.
+         * @param mem_node NUMA node of the memory region.
+         * @param cpu_node CPU NUMA node of the first worker thread.
+         * @param cpus Logical CPU of each worker thread. The number of worker threads is the size of this list.
+         * @param placement Printable name of the policy that chose the CPUs, e.g., "compact".
+         * @param op The operation performed on the targets.
+         * @param spacing Distance in bytes between the targets of consecutive threads. 0, or a multiple of the pointer size.
+         * @param dram_power_readers Power measurement objects for DRAM.
+         * @param name Name of the benchmark.
+         */
+        ContentionBenchmark(
+            void* mem_array,
+            size_t len,
+            uint32_t iterations,
+            uint32_t mem_node,
+            uint32_t cpu_node,
+            std::vector<int32_t> cpus,
+            std::string placement,
+            contention_op_t op,
+            uint32_t spacing,
+            std::vector<PowerReader*> dram_power_readers,
+            std::string name
+        );
+
+        /**
+         * @brief Destructor.
+         */
+        virtual ~ContentionBenchmark() {}
+
+        /**
+         * @brief Reports benchmark configuration details to the console.
+         */
+        virtual void reportBenchmarkInfo() const;
+
+        /**
+         * @brief Reports results to the console.
+         */
+        virtual void reportResults() const;
+
+        /**
+         * @brief Gets the operation this benchmark performs.
+         * @returns The operation.
+         */
+        contention_op_t getOp() const;
+
+        /**
+         * @brief Gets the distance between the targets of consecutive threads.
+         * @returns The spacing in bytes.
+         */
+        uint32_t getSpacing() const;
+
+        /**
+         * @brief Gets the name of the policy that placed the threads.
+         * @returns The placement name.
+         */
+        std::string getPlacement() const;
+
+        /**
+         * @brief Gets the number of physical packages spanned by the worker threads.
+         * @returns The number of distinct packages, or 0 if the package of some CPU is unknown.
+         */
+        uint32_t getPackagesSpanned() const;
+
+        /**
+         * @brief Gets the average time per operation seen by each thread, derived from the median aggregate rate.
+         * @returns The time per operation in ns, or 0 if the benchmark has not run.
+         */
+        double getMedianLatency() const;
+
+        /**
+         * @brief Gets the update rate of each worker thread on its own, averaged over iterations.
+         * @returns The rate of each thread in Mops/s, in the order of the CPUs given to the constructor. Empty if the benchmark has not run.
+         */
+        std::vector<double> getThreadRates() const;
+
+    protected:
+        virtual bool runCore();
+
+    private:
+        std::vector<int32_t> cpus_; /**< Logical CPU of each worker thread. */
+        std::string placement_; /**< Name of the policy that chose the CPUs. */
+        contention_op_t op_; /**< The operation performed on the targets. */
+        uint32_t spacing_; /**< Distance in bytes between the targets of consecutive threads. */
+        std::vector<double> thread_rates_; /**< Mean rate of each thread over iterations in Mops/s. */
+    };
+};
+
+#endif
@@ -0,0 +1,87 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ * 
+ * @brief Header file for the ContentionWorker class.
+ */
+
+#ifndef CONTENTION_WORKER_H
+#define CONTENTION_WORKER_H
+
+//Headers
+#include <MemoryWorker.h>
+#include <WorkerPool.h>
+#include <benchmark_kernels.h>
+
+namespace xmem {
+    /** 
+     * @brief Multithreading-friendly class to hammer a word that other workers may be operating on at the same time.
+     */
+    class ContentionWorker : public MemoryWorker {
+        public:
+            
+            /** 
+             * @brief Constructor.
+             * @param target Pointer to the word operated on by this worker. It may be shared with, or lie near, the targets of other workers.
+             * @param kernel_fptr Pointer to the contention kernel to use.
+             * @param kernel_dummy_fptr Pointer to the dummy version of the contention kernel to use.
+             * @param start_barrier Barrier shared by all workers of the iteration, so that their timed loops start together. If NULL, the worker starts on its own.
+             * @param cpu_affinity Logical CPU identifier to lock this worker's thread to.
+             */
+            ContentionWorker(
+                void* target,
+                ContentionFunction kernel_fptr,
+                ContentionFunction kernel_dummy_fptr,
+                SpinBarrier* start_barrier,
+                int32_t cpu_affinity
+            );
+            
+            /**
+             * @brief Destructor.
+             */
+            virtual ~ContentionWorker();
+
+            /**
+             * @brief Runs the kernel and its dummy version on the calling thread. Affinity, priority and priming are handled by the caller.
+             */
+            virtual void runKernels();
+
+            /**
+             * @brief Gets the number of operations on the target in each pass.
+             * @returns The number of operations per pass.
+             */
+            uint32_t getOpsPerPass();
+        
+        private:
+            // ONLY ACCESS OBJECT VARIABLES UNDER THE RUNNABLE OBJECT LOCK!!!!
+            ContentionFunction kernel_fptr_; /**< Points to the contention kernel. */
+            ContentionFunction kernel_dummy_fptr_; /**< Points to a dummy version of the contention kernel. */
+            SpinBarrier* start_barrier_; /**< Barrier released when all workers of the iteration are ready, or NULL. */
+    };
+};
+
+#endif
@@ -0,0 +1,119 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ *
+ * @brief Header file for the CoreToCoreBenchmark class.
+ */
+
+#ifndef CORE_TO_CORE_BENCHMARK_H
+#define CORE_TO_CORE_BENCHMARK_H
+
+//Headers
+#include <Benchmark.h>
+#include <common.h>
+
+//Libraries
+#include <cstdint>
+#include <string>
+
+namespace xmem {
+
+    /**
+     * @brief A type of benchmark that measures the latency of moving a cache line from one logical CPU to another.
+     * Two worker threads play ping-pong on one line, so every transfer reads a line that was last written by the other CPU, wherever it is held. The metric is the one-way latency, i.e., half a round trip, in ns.
+     * Besides the usual statistics over iterations and samples, a tail latency is computed over all passes of CORE_TO_CORE_ROUND_TRIPS_PER_PASS round trips.
+     */
+    class CoreToCoreBenchmark : public Benchmark {
+    public:
+        /**
+         * @brief Constructor. The access pattern is reported as SEQUENTIAL with a stride of 1, and the read/write mode as WRITE.
+         * @param mem_array Memory region whose first cache line is bounced. It must be cache line aligned.
+         * @param len Length of the memory region in bytes.
+         * @param iterations Number of iterations.
+         * @param mem_node NUMA node of the memory region.
+         * @param cpu_node CPU NUMA node of the initiating CPU.
+         * @param initiator_cpu Logical CPU that sends the pings and is timed.
+         * @param responder_cpu Logical CPU that answers them.
+         * @param dram_power_readers Power measurement objects for DRAM.
+         * @param name Name of the benchmark.
+         */
+        CoreToCoreBenchmark(
+            void* mem_array,
+            size_t len,
+            uint32_t iterations,
+            uint32_t mem_node,
+            uint32_t cpu_node,
+            uint32_t initiator_cpu,
+            uint32_t responder_cpu,
+            std::vector<PowerReader*> dram_power_readers,
+            std::string name
+        );
+
+        /**
+         * @brief Destructor.
+         */
+        virtual ~CoreToCoreBenchmark() {}
+
+        /**
+         * @brief Reports benchmark configuration details to the console.
+         */
+        virtual void reportBenchmarkInfo() const;
+
+        /**
+         * @brief Reports results to the console.
+         */
+        virtual void reportResults() const;
+
+        /**
+         * @brief Gets the logical CPU that sends the pings.
+         * @returns The initiating CPU.
+         */
+        uint32_t getInitiatorCPU() const;
+
+        /**
+         * @brief Gets the logical CPU that answers the pings.
+         * @returns The responding CPU.
+         */
+        uint32_t getResponderCPU() const;
+
+        /**
+         * @brief Gets the tail one-way latency, i.e., the 99th percentile of the per-pass latencies over all iterations.
+         * @returns The tail latency in ns, or 0 if the benchmark has not run.
+         */
+        double getTailLatency() const;
+
+    protected:
+        virtual bool runCore();
+
+    private:
+        uint32_t initiator_cpu_; /**< Logical CPU that sends the pings. */
+        uint32_t responder_cpu_; /**< Logical CPU that answers them. */
+        double tail_latency_; /**< Tail one-way latency over all passes in ns. */
+    };
+};
+
+#endif
@@ -0,0 +1,86 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ * 
+ * @brief Header file for the CoreToCoreWorker class.
+ */
+
+#ifndef CORE_TO_CORE_WORKER_H
+#define CORE_TO_CORE_WORKER_H
+
+//Headers
+#include <MemoryWorker.h>
+
+//Libraries
+#include <cstdint>
+#include <vector>
+
+namespace xmem {
+    /** 
+     * @brief Multithreading-friendly class that bounces one cache line back and forth with a partner worker on another logical CPU.
+     *
+     * The initiating worker stores an odd sequence number to the line and spins until the responder has stored the next even number, which makes one round trip, i.e., two transfers of the line. The responder spins on the line and answers every odd number until the initiator stores the stop value. Only the initiator is timed.
+     */
+    class CoreToCoreWorker : public MemoryWorker {
+        public:
+            
+            /** 
+             * @brief Constructor.
+             * @param line Pointer to the pointer-sized word the two workers bounce. It must be zero before the workers start, and nothing else should share its cache line.
+             * @param initiator If true, this worker sends the pings and is timed. Otherwise it answers them.
+             * @param cpu_affinity Logical CPU identifier to lock this worker's thread to.
+             */
+            CoreToCoreWorker(
+                void* line,
+                bool initiator,
+                int32_t cpu_affinity
+            );
+            
+            /**
+             * @brief Destructor.
+             */
+            virtual ~CoreToCoreWorker();
+
+            /**
+             * @brief Runs the ping-pong on the calling thread. Affinity, priority and priming are handled by the caller.
+             */
+            virtual void runKernels();
+
+            /**
+             * @brief Gets the elapsed ticks of every pass of the initiator. Each pass is CORE_TO_CORE_ROUND_TRIPS_PER_PASS round trips.
+             * @returns The ticks of each pass, in order. Empty for the responder.
+             */
+            std::vector<tick_t> getPassTicks();
+        
+        private:
+            // ONLY ACCESS OBJECT VARIABLES UNDER THE RUNNABLE OBJECT LOCK!!!!
+            bool initiator_; /**< If true, this worker sends the pings. */
+            std::vector<tick_t> pass_ticks_; /**< Elapsed ticks of each pass of the last run. */
+    };
+};
+
+#endif
@@ -0,0 +1,209 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ *
+ * @brief Header file for the DRAMMappingBenchmark class.
+ */
+
+#ifndef DRAM_MAPPING_BENCHMARK_H
+#define DRAM_MAPPING_BENCHMARK_H
+
+//Headers
+#include <Benchmark.h>
+#include <common.h>
+
+//Libraries
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace xmem {
+
+    /**
+     * @brief A type of benchmark that reverse engineers how physical addresses are mapped onto DRAM banks.
+     * Two cache lines in the same bank but in different rows cannot both be held in the row buffer, so alternately reading them, with both flushed from the caches after every access, is measurably slower than for any other pair. Such row buffer conflicts are used to sort a pool of random lines into same-bank sets.
+     * The XOR functions of physical address bits that are constant within every set but not across sets select the bank, rank and channel. Bits outside these functions that cause a conflict when flipped alone select the row, and the others the column. Function bits below the lowest row bit are reported as channel interleave bits.
+     * The metric is the median latency per access of same-bank/different-row pairs, in ns.
+     */
+    class DRAMMappingBenchmark : public Benchmark {
+    public:
+        /**
+         * @brief Constructor. The access pattern is reported as RANDOM and the read/write mode as READ.
+         * @param mem_array Memory region to sample. Its pages must be resident.
+         * @param len Length of the memory region in bytes.
+         * @param iterations Number of iterations.
+         * @param mem_node NUMA node of the memory region.
+         * @param cpu_node CPU NUMA node of the timing CPU.
+         * @param cpu Logical CPU that times the accesses.
+         * @param use_pagemap If true, the physical address of every page is read from /proc/self/pagemap. Otherwise the region is taken to be physically contiguous from phys_base, e.g., when mapped from /dev/mem.
+         * @param phys_base Physical address of the start of the memory region if use_pagemap is false.
+         * @param dram_power_readers Power measurement objects for DRAM.
+         * @param name Name of the benchmark.
+         */
+        DRAMMappingBenchmark(
+            void* mem_array,
+            size_t len,
+            uint32_t iterations,
+            uint32_t mem_node,
+            uint32_t cpu_node,
+            uint32_t cpu,
+            bool use_pagemap,
+            uint64_t phys_base,
+            std::vector<PowerReader*> dram_power_readers,
+            std::string name
+        );
+
+        /**
+         * @brief Destructor.
+         */
+        virtual ~DRAMMappingBenchmark() {}
+
+        /**
+         * @brief Reports benchmark configuration details to the console.
+         */
+        virtual void reportBenchmarkInfo() const;
+
+        /**
+         * @brief Reports results to the console.
+         */
+        virtual void reportResults() const;
+
+        /**
+         * @brief Gets the logical CPU that times the accesses.
+         * @returns The CPU.
+         */
+        uint32_t getCPU() const;
+
+        /**
+         * @brief Gets the latency per access above which a pair of lines is classified as a row buffer conflict.
+         * @returns The threshold in ns, or 0 if the benchmark has not run.
+         */
+        double getConflictThreshold() const;
+
+        /**
+         * @brief Gets the median latency per access of pairs that do not conflict.
+         * @returns The latency in ns, or 0 if the benchmark has not run.
+         */
+        double getNoConflictLatency() const;
+
+        /**
+         * @brief Gets the number of same-bank sets found.
+         * @returns The number of sets.
+         */
+        uint32_t getNumSets() const;
+
+        /**
+         * @brief Gets the XOR functions that select the bank, rank and channel. They are linearly independent, and functions with fewer bits are preferred.
+         * @returns One mask of physical address bits per function.
+         */
+        std::vector<uint64_t> getBankFunctions() const;
+
+        /**
+         * @brief Gets the physical address bits that select the row.
+         * @returns The row bits in increasing order.
+         */
+        std::vector<uint32_t> getRowBits() const;
+
+        /**
+         * @brief Gets the physical address bits that select the column.
+         * @returns The column bits in increasing order.
+         */
+        std::vector<uint32_t> getColumnBits() const;
+
+        /**
+         * @brief Gets the bank function bits below the highest column bit, which interleave consecutive blocks of memory across channels.
+         * @returns The interleave bits in increasing order.
+         */
+        std::vector<uint32_t> getInterleaveBits() const;
+
+    protected:
+        virtual bool runCore();
+
+    private:
+        /**
+         * @brief Builds the physical address of every page of the memory region and the reverse mapping.
+         * @returns True on success.
+         */
+        bool resolvePages();
+
+        /**
+         * @brief Translates a virtual address in the memory region.
+         * @param addr The virtual address.
+         * @returns The physical address, or 0 if it is unknown.
+         */
+        uint64_t virtToPhys(const uint8_t* addr) const;
+
+        /**
+         * @brief Translates a physical address to the memory region.
+         * @param phys The physical address.
+         * @returns The virtual address, or NULL if the physical address is not in the memory region.
+         */
+        uint8_t* physToVirt(uint64_t phys) const;
+
+        /**
+         * @brief Times alternating reads of two cache lines that are flushed after every read.
+         * @param a First line.
+         * @param b Second line.
+         * @returns Median over DRAM_MAPPING_REPEATS measurements of the latency per access, in ns.
+         */
+        double timePair(uint8_t* a, uint8_t* b) const;
+
+        /**
+         * @brief Sorts the pool of lines into same-bank sets.
+         * @returns True if at least two sets were found.
+         */
+        bool findSets();
+
+        /**
+         * @brief Derives the XOR functions from the same-bank sets.
+         */
+        void findFunctions();
+
+        /**
+         * @brief Sorts the remaining physical address bits into row and column bits by flipping them one at a time.
+         */
+        void findRowBits();
+
+        uint32_t cpu_; /**< Logical CPU that times the accesses. */
+        bool use_pagemap_; /**< If true, physical addresses come from /proc/self/pagemap. */
+        uint64_t phys_base_; /**< Physical address of the start of the memory region if it is physically contiguous. */
+        std::vector<uint64_t> page_phys_; /**< Physical address of each page of the memory region in virtual order, or 0 if unknown. */
+        std::vector< std::pair<uint64_t, size_t> > phys_pages_; /**< Physical address and index of each known page, sorted by physical address. */
+        std::vector<uint8_t*> pool_; /**< Randomly chosen cache lines. */
+        std::vector< std::vector<uint8_t*> > sets_; /**< Same-bank sets of lines. The first line of each set is the one the others conflict with. */
+        uint32_t top_bit_; /**< Highest physical address bit set in any line of the pool. */
+        double threshold_; /**< Latency per access above which a pair conflicts, in ns. */
+        double no_conflict_latency_; /**< Median latency per access of pairs that do not conflict, in ns. */
+        std::vector<uint64_t> functions_; /**< XOR functions of the bank, rank and channel. */
+        std::vector<uint32_t> row_bits_; /**< Row bits. */
+        std::vector<uint32_t> column_bits_; /**< Column bits. */
+        std::vector<uint32_t> interleave_bits_; /**< Channel interleave bits. */
+    };
+};
+
+#endif
@@ -84,6 +84,32 @@ namespace xmem {
          */
         double getMeanLoadMetric() const;
 
+        /**
+         * @brief Gets the fraction of the latency measurement window that was covered by all load threads during the given iteration.
+         * @param iter The iteration of interest, counting from 1.
+         * @returns The overlap fraction from 0 to 1, 1 if no load was applied, or -1 if the benchmark has not run or the iteration does not exist.
+         */
+        double getLoadOverlapOnIter(uint32_t iter) const;
+
+        /**
+         * @brief Gets the number of iterations that were rejected and run again because the load did not cover enough of the latency measurement window.
+         * @returns The number of rejected iterations.
+         */
+        uint32_t getRejectedIterations() const;
+
+        /**
+         * @brief Sets how many independent pointer chains the latency measurement thread chases at once. Each chain is a separate random cycle through its own part of the thread's region.
+         * With more than one chain, the reported latency is the time between consecutive hops of the same chain, and software prefetching is not supported.
+         * @param chains Number of chains. Must be a power of two of at most 32.
+         */
+        void setChains(uint32_t chains);
+
+        /**
+         * @brief Gets the number of independent pointer chains chased at once by the latency measurement thread.
+         * @returns The number of chains.
+         */
+        uint32_t getChains() const;
+
         /**
          * @brief Reports benchmark configuration details to the console.
          */
@@ -99,6 +125,9 @@ namespace xmem {
 
         std::vector<double> load_metric_on_iter_; /**< Load metrics for each iteration of the benchmark. This is in MB/s. */
         double mean_load_metric_; /**< The average load throughput in MB/sec that was imposed on the latency measurement. */
+        std::vector<double> load_overlap_on_iter_; /**< Fraction of the latency window covered by all load threads, for each iteration. */
+        uint32_t rejected_iterations_; /**< Number of iterations rejected for poor load overlap. */
+        uint32_t chains_; /**< Number of independent pointer chains chased at once by the latency measurement thread. */
     };
 };
 
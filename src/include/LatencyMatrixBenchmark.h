@@ -51,9 +51,25 @@ namespace xmem {
          */
         virtual ~LatencyMatrixBenchmark() {}
 
+        /**
+         * @brief Gets the fraction of the latency measurement window that was covered by all load threads during the given iteration.
+         * @param iter The iteration of interest, counting from 1.
+         * @returns The overlap fraction from 0 to 1, 1 if no load was applied, or -1 if the benchmark has not run or the iteration does not exist.
+         */
+        double getLoadOverlapOnIter(uint32_t iter) const;
+
+        /**
+         * @brief Gets the number of iterations that were rejected and run again because the load did not cover enough of the latency measurement window.
+         * @returns The number of rejected iterations.
+         */
+        uint32_t getRejectedIterations() const;
+
     protected:
         virtual bool runCore();
 
+        std::vector<double> load_overlap_on_iter_; /**< Fraction of the latency window covered by all load threads, for each iteration. */
+        uint32_t rejected_iterations_; /**< Number of iterations rejected for poor load overlap. */
+
         // std::vector<double> load_metric_on_iter_; /**< Load metrics for each iteration of the benchmark. This is in MB/s. */
         // double mean_load_metric_; /**< The average load throughput in MB/sec that was imposed on the latency measurement. */
     };
@@ -66,9 +66,9 @@ namespace xmem {
             virtual ~LatencyWorker();
 
             /**
-             * @brief Thread-safe worker method.
+             * @brief Runs the kernel and its dummy version on the calling thread. Affinity, priority and priming are handled by the caller.
              */
-            virtual void run();
+            virtual void runKernels();
 
         private:
             // ONLY ACCESS OBJECT VARIABLES UNDER THE RUNNABLE OBJECT LOCK!!!!
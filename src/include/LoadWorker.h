@@ -49,6 +49,7 @@ namespace xmem {
              * @param len Length of the memory region to use by this worker.
              * @param kernel_fptr Pointer to the sequential core benchmark kernel to use.
              * @param kernel_dummy_fptr Pointer to the sequential dummy version of the core benchmark kernel to use.
+             * @param stride_size Stride of the kernels in chunks. Each pass walks sequential_pass_span(stride_size) bytes, which must not exceed len.
              * @param cpu_affinity Logical CPU identifier to lock this worker's thread to.
              */
             LoadWorker(
@@ -56,6 +57,7 @@ namespace xmem {
                 size_t len,
                 SequentialFunction kernel_fptr,
                 SequentialFunction kernel_dummy_fptr,
+                int32_t stride_size,
                 int32_t cpu_affinity
             );
             
@@ -74,6 +76,24 @@ namespace xmem {
                 RandomFunction kernel_dummy_fptr,
                 int32_t cpu_affinity
             );
+
+            /** 
+             * @brief Constructor for independent random-access patterns.
+             * @param mem_array Pointer to the memory region to use by this worker.
+             * @param len Length of the memory region to use by this worker. Only the largest power-of-two prefix is accessed.
+             * @param kernel_fptr Pointer to the independent random-access core benchmark kernel to use.
+             * @param kernel_dummy_fptr Pointer to the independent random-access dummy version of the core benchmark kernel to use.
+             * @param seed Seed for this worker's random number streams.
+             * @param cpu_affinity Logical CPU identifier to lock this worker's thread to.
+             */
+            LoadWorker(
+                void* mem_array,
+                size_t len,
+                IndependentRandomFunction kernel_fptr,
+                IndependentRandomFunction kernel_dummy_fptr,
+                uint64_t seed,
+                int32_t cpu_affinity
+            );
             
             /**
              * @brief Destructor.
@@ -81,17 +101,21 @@ namespace xmem {
             virtual ~LoadWorker();
 
             /**
-             * @brief Thread-safe worker method.
+             * @brief Runs the kernel and its dummy version on the calling thread. Affinity, priority and priming are handled by the caller.
              */
-            virtual void run();
+            virtual void runKernels();
         
         private:
             // ONLY ACCESS OBJECT VARIABLES UNDER THE RUNNABLE OBJECT LOCK!!!!
-            bool use_sequential_kernel_fptr_; /**< If true, use the SequentialFunction, otherwise use the RandomFunction. */
+            pattern_mode_t pattern_mode_; /**< Selects which of the kernel function pointer types below is used. */
             SequentialFunction kernel_fptr_seq_; /**< Points to the memory test core routine to use of the "sequential" type. */
             SequentialFunction kernel_dummy_fptr_seq_; /**< Points to a dummy version of the memory test core routine to use of the "sequential" type. */
             RandomFunction kernel_fptr_ran_; /**< Points to the memory test core routine to use of the "random" type. */
             RandomFunction kernel_dummy_fptr_ran_; /**< Points to a dummy version of the memory test core routine to use of the "random" type. */
+            IndependentRandomFunction kernel_fptr_ind_; /**< Points to the memory test core routine to use of the "independent random" type. */
+            IndependentRandomFunction kernel_dummy_fptr_ind_; /**< Points to a dummy version of the memory test core routine to use of the "independent random" type. */
+            uint64_t seed_; /**< Seed for the random number streams of the "independent random" type. */
+            size_t pass_span_; /**< Bytes of memory walked by each pass of the "sequential" type. */
     };
 };
 
@@ -87,7 +87,7 @@ namespace xmem {
         virtual void reportResults() const;
 
         /**
-         * @brief Computes the metrics across iterations.
+         * @brief Computes the metrics across the short samples if there are enough of them for a CI of the median, otherwise across iterations. All statistics come from the same data.
          */
         virtual void computeMetrics();
 
@@ -37,9 +37,120 @@
 #include <Runnable.h>
 
 //Libraries
+#include <atomic>
 #include <cstdint>
+#include <vector>
 
 namespace xmem {
+    /**
+     * @brief Phase state shared by the latency worker and the load workers of one loaded latency iteration.
+     *
+     * Load workers announce when their load is running and keep generating traffic until the latency worker signals that its measurement window has closed. The latency worker waits for all loads, lets them warm up for LOADED_LATENCY_WARMUP_MS, and only then opens its window.
+     */
+    class LoadedLatencyPhase {
+        public:
+            /**
+             * @brief Constructor.
+             * @param num_load_workers Number of load workers that must be running before the latency window opens.
+             */
+            LoadedLatencyPhase(uint32_t num_load_workers);
+
+            /**
+             * @brief Called by a load worker once its timed load loop has started.
+             */
+            void loadStarted();
+
+            /**
+             * @brief Spins until all load workers have started.
+             * @param timeout_ticks Give up after this many timer ticks.
+             * @returns True if all load workers started in time.
+             */
+            bool waitForLoads(tick_t timeout_ticks) const;
+
+            /**
+             * @brief Called by the latency worker once its measurement window has closed.
+             */
+            void signalLatencyDone();
+
+            /**
+             * @brief Indicates whether the latency worker's measurement window has closed.
+             * @returns True if load workers may stop.
+             */
+            bool latencyDone() const { return latency_done_.load(std::memory_order_relaxed); }
+
+        private:
+            uint32_t num_load_workers_; /**< Number of load workers participating. */
+            std::atomic<uint32_t> loads_running_; /**< Number of load workers that have started. */
+            std::atomic<bool> latency_done_; /**< Set when the latency window has closed. */
+    };
+
+    /**
+     * @brief Stop flag shared by the workers of one benchmark iteration.
+     *
+     * The leading worker raises it as soon as its own samples have converged, and every worker polls it between sample blocks so that the whole iteration ends together.
+     */
+    class SampleControl {
+        public:
+            /**
+             * @brief Constructor.
+             */
+            SampleControl();
+
+            /**
+             * @brief Asks all workers sharing this control to end their timed loops.
+             */
+            void requestStop() { stop_.store(true, std::memory_order_relaxed); }
+
+            /**
+             * @brief Indicates whether a stop has been requested.
+             * @returns True if workers should end their timed loops.
+             */
+            bool stopRequested() const { return stop_.load(std::memory_order_relaxed); }
+
+        private:
+            std::atomic<bool> stop_; /**< Set once the leading worker has converged. */
+    };
+
+    /**
+     * @brief Splits a worker's timed loop into short samples of roughly g_sample_duration_ms each.
+     *
+     * Lives on the worker thread's stack. The worker reports each unrolled block of passes, and the recorder closes a sample whenever enough ticks have accumulated.
+     */
+    class SampleRecorder {
+        public:
+            /**
+             * @brief Constructor.
+             * @param control Shared stop flag, or NULL to always run for the full target duration.
+             * @param leader If true, this recorder requests a stop once the CI of its samples is within g_ci_width of the median.
+             */
+            SampleRecorder(SampleControl* control, bool leader);
+
+            /**
+             * @brief Accounts for one timed block of kernel passes.
+             * @param passes Number of passes in the block.
+             * @param ticks Elapsed ticks of the block.
+             * @returns True if the worker should end its timed loop.
+             */
+            bool addBlock(uint32_t passes, tick_t ticks);
+
+            /**
+             * @brief Closes the last partial sample and subtracts the dummy kernel cost from every sample, prorated by passes.
+             * @param total_passes Passes of the whole timed loop.
+             * @param elapsed_dummy_ticks Ticks of the dummy kernel for the same number of passes.
+             */
+            void finish(uint32_t total_passes, tick_t elapsed_dummy_ticks);
+
+            std::vector<uint32_t> passes_; /**< Passes in each sample. */
+            std::vector<tick_t> adjusted_ticks_; /**< Elapsed ticks of each sample. After finish(), minus the dummy ticks. */
+
+        private:
+            SampleControl* control_; /**< Shared stop flag. */
+            bool leader_; /**< Whether this recorder may request a stop. */
+            tick_t sample_ticks_; /**< Target duration of one sample in ticks. */
+            uint32_t open_passes_; /**< Passes in the sample currently being recorded. */
+            tick_t open_ticks_; /**< Ticks in the sample currently being recorded. */
+    };
+
     /** 
      * @brief Multithreading-friendly class to run memory access kernels.
      */
@@ -64,10 +175,32 @@ namespace xmem {
             virtual ~MemoryWorker();
 
             /**
-             * @brief Thread-safe worker method.
+             * @brief Thread-safe worker method. Locks the calling thread to the worker's CPU, boosts its scheduling priority, primes memory, runs the kernels, and then reverts the thread state.
+             */
+            virtual void run();
+
+            /**
+             * @brief Runs the benchmark kernel and its dummy version on the calling thread and records the results. The caller is responsible for CPU affinity, scheduling priority and priming.
+             */
+            virtual void runKernels() = 0;
+
+            /**
+             * @brief Primes the worker's memory region from the calling thread so that caches, TLBs and coherence state are warmed up.
              */
-            virtual void run() = 0;
+            void primeMemory();
+
+            /**
+             * @brief Gets the logical CPU this worker should run on.
+             * @returns The logical CPU affinity.
+             */
+            int32_t getCPUAffinity();
         
+            /**
+             * @brief Gets the start of the memory region used by this worker.
+             * @returns Pointer to the memory region.
+             */
+            void* getMemArray();
+
             /**
              * @brief Gets the length of the memory region used by this worker.
              * @returns Length of memory region in bytes.
@@ -110,7 +243,59 @@ namespace xmem {
              */
             bool hadWarning();
 
+            /**
+             * @brief Ties this worker to a loaded latency phase protocol. Must be set before the worker runs.
+             * @param phase The shared phase state, or NULL to run on its own clock.
+             */
+            void setPhase(LoadedLatencyPhase* phase);
+
+            /**
+             * @brief Gets the timer value when this worker's timed window opened.
+             * @returns The start tick of the timed window.
+             */
+            tick_t getWindowStartTick();
+
+            /**
+             * @brief Gets the timer value when this worker's timed window closed.
+             * @returns The stop tick of the timed window.
+             */
+            tick_t getWindowStopTick();
+
+            /**
+             * @brief Ties this worker to the stop flag of its iteration. Must be set before the worker runs.
+             * @param control The shared stop flag, or NULL to run for the full target duration.
+             * @param leader If true, this worker requests the stop once its own samples have converged.
+             */
+            void setSampleControl(SampleControl* control, bool leader);
+
+            /**
+             * @brief Gets the number of short samples recorded in the timed window.
+             * @returns The number of samples.
+             */
+            uint32_t getNumSamples();
+
+            /**
+             * @brief Gets the number of passes in one sample.
+             * @param i Index of the sample.
+             * @returns The number of passes.
+             */
+            uint32_t getSamplePasses(uint32_t i);
+
+            /**
+             * @brief Gets the adjusted ticks of one sample, i.e., its elapsed ticks minus its share of the dummy ticks.
+             * @param i Index of the sample.
+             * @returns The adjusted ticks.
+             */
+            tick_t getSampleAdjustedTicks(uint32_t i);
+
         protected:
+            /**
+             * @brief Stores the samples of the last run. Caller must hold the object lock.
+             * @param recorder The finished recorder of the last run.
+             */
+            void storeSamples(const SampleRecorder& recorder);
+
+
             // ONLY ACCESS OBJECT VARIABLES UNDER THE RUNNABLE OBJECT LOCK!!!!
             void* mem_array_; /**< The memory region for this worker. */
             size_t len_; /**< The length of the memory region for this worker. */
@@ -122,6 +307,13 @@ namespace xmem {
             tick_t adjusted_ticks_; /**< Elapsed ticks minus dummy elapsed ticks. */
             bool warning_; /**< If true, results may be suspect. */
             bool completed_; /**< If true, worker completed. */
+            LoadedLatencyPhase* phase_; /**< Loaded latency phase protocol, or NULL if the worker runs on its own clock. */
+            tick_t window_start_tick_; /**< Timer value when the timed window opened. */
+            tick_t window_stop_tick_; /**< Timer value when the timed window closed. */
+            SampleControl* sample_control_; /**< Stop flag shared with the other workers of the iteration, or NULL. */
+            bool sample_leader_; /**< If true, this worker raises the stop flag. */
+            std::vector<uint32_t> sample_passes_; /**< Passes in each sample. */
+            std::vector<tick_t> sample_adjusted_ticks_; /**< Adjusted ticks of each sample. */
     };
 };
 
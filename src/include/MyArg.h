@@ -15,6 +15,7 @@
 #include <ExampleArg.h>
 
 //Libraries
+#include <cerrno>
 #include <climits>
 #include <cstdint>
 #include <cstdlib>
@@ -56,6 +57,23 @@ namespace xmem {
             return ARG_ILLEGAL;
         }
 
+        /**
+         * @brief Checks an option that it is a nonnegative integer that fits in 64 bits.
+         */
+        static ArgStatus NonnegativeInteger64(const Option& option, bool msg) {
+            char* endptr = 0;
+            if (option.arg != 0 && option.arg[0] >= '0' && option.arg[0] <= '9') { //strtoull() would silently negate a leading minus sign
+                errno = 0;
+                strtoull(option.arg, &endptr, 10);
+                if (errno == 0 && *endptr == 0)
+                    return ARG_OK;
+            }
+
+            if (msg)
+                printError("Option '", option, "' requires a non-negative 64-bit integer argument\n");
+            return ARG_ILLEGAL;
+        }
+
         /**
          * @brief Checks an option that it is a positive integer.
          */
@@ -0,0 +1,136 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ *
+ * @brief Header file for the PointerChainBuilder class.
+ */
+
+#ifndef POINTER_CHAIN_BUILDER_H
+#define POINTER_CHAIN_BUILDER_H
+
+//Headers
+#include <common.h>
+#include <Runnable.h>
+
+//Libraries
+#include <cstdint>
+#include <cstddef>
+
+namespace xmem {
+
+    /**
+     * @brief Steps of building a random pointer chain. All blocks must finish a step before any block starts the next one.
+     */
+    typedef enum {
+        CHAIN_BUILD_SHUFFLE, /**< Turn each block into a single cycle of successor indices. */
+        CHAIN_BUILD_LINK, /**< Replace successor indices with pointers. */
+        NUM_CHAIN_BUILD_PHASES
+    } chain_build_phase_t;
+
+    /**
+     * @brief Builds part of a random pointer chain. A region is split into blocks of POINTER_CHAIN_BLOCK_SIZE bytes, and each builder handles every block_stride-th block starting at first_block.
+     * Several builders can run in parallel threads, each pinned to a CPU in the NUMA node of the region.
+     */
+    class PointerChainBuilder : public Runnable {
+    public:
+        /**
+         * @brief Constructor.
+         * @param mem_region_base Start of the memory region holding the chain.
+         * @param num_nodes Total number of nodes in the region.
+         * @param node_size Distance between consecutive nodes in bytes.
+         * @param chunk_bytes Size of the word at each node in bytes.
+         * @param nodes_per_block Number of nodes in each block.
+         * @param first_block The first block handled by this builder.
+         * @param block_stride Distance between consecutive blocks handled by this builder.
+         * @param random_offsets If true, each node other than the first is placed at a random chunk-aligned offset within its node.
+         * @param seed Random seed for the whole chain.
+         * @param cpu_affinity Logical CPU to run on. If negative, the builder does not change the affinity of its thread.
+         */
+        PointerChainBuilder(
+            uint8_t* mem_region_base,
+            size_t num_nodes,
+            size_t node_size,
+            size_t chunk_bytes,
+            size_t nodes_per_block,
+            uint32_t first_block,
+            uint32_t block_stride,
+            bool random_offsets,
+            uint64_t seed,
+            int32_t cpu_affinity
+        );
+
+        /**
+         * @brief Destructor.
+         */
+        virtual ~PointerChainBuilder();
+
+        /**
+         * @brief Selects the step that the next call to run() performs.
+         * @param phase The step.
+         */
+        void setPhase(chain_build_phase_t phase);
+
+        /**
+         * @brief Performs the current step on all blocks handled by this builder.
+         */
+        virtual void run();
+
+    private:
+        /**
+         * @brief Uses Sattolo's algorithm to make the nodes of a block form a single cycle. The successor index of each node is stored in its first word.
+         * @param block The block index.
+         */
+        void shuffleBlock(uint32_t block);
+
+        /**
+         * @brief Replaces the successor index of each node of a block with a pointer to its successor.
+         * @param block The block index.
+         */
+        void linkBlock(uint32_t block);
+
+        /**
+         * @brief Computes where the pointer of a node is stored within the node.
+         * @param node The node index.
+         * @returns The offset in bytes from the start of the node.
+         */
+        size_t nodeOffset(size_t node);
+
+        uint8_t* mem_region_base_; /**< Start of the memory region holding the chain. */
+        size_t num_nodes_; /**< Total number of nodes in the region. */
+        size_t node_size_; /**< Distance between consecutive nodes in bytes. */
+        size_t chunk_bytes_; /**< Size of the word at each node in bytes. */
+        size_t nodes_per_block_; /**< Number of nodes in each block. */
+        uint32_t first_block_; /**< The first block handled by this builder. */
+        uint32_t block_stride_; /**< Distance between consecutive blocks handled by this builder. */
+        bool random_offsets_; /**< If true, nodes are placed at random chunk-aligned offsets. */
+        uint64_t seed_; /**< Random seed for the whole chain. */
+        int32_t cpu_affinity_; /**< Logical CPU to run on, or negative to leave the affinity alone. */
+        chain_build_phase_t phase_; /**< The step that run() performs. */
+    };
+};
+
+#endif
@@ -0,0 +1,148 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ *
+ * @brief Header file for the ProducerConsumerBenchmark class.
+ */
+
+#ifndef PRODUCER_CONSUMER_BENCHMARK_H
+#define PRODUCER_CONSUMER_BENCHMARK_H
+
+//Headers
+#include <Benchmark.h>
+#include <common.h>
+
+//Libraries
+#include <cstdint>
+#include <string>
+
+namespace xmem {
+
+    /**
+     * @brief A type of benchmark that measures the sustained bandwidth and the message latency of a single-producer/single-consumer ring buffer between two logical CPUs.
+     * Every message is one cache line that the producer writes and the consumer reads, so each message moves a line from one CPU to the other and back. The metric is the rate at which the consumer receives messages, in MB/s.
+     * The delivery latency of every PRODUCER_CONSUMER_LATENCY_STRIDE-th message is also measured. The producer usually keeps the ring full, so this includes the time spent queued behind earlier messages, as in a real pipeline. The producer's and consumer's timer values are compared directly, which assumes the timer is synchronized across CPUs.
+     */
+    class ProducerConsumerBenchmark : public Benchmark {
+    public:
+        /**
+         * @brief Constructor. The access pattern is reported as SEQUENTIAL with a stride of 1, and the read/write mode as WRITE.
+         * @param mem_array Memory region that holds the ring buffer at its start. It must be cache line aligned.
+         * @param len Length of the memory region in bytes.
+         * @param iterations Number of iterations.
+         * @param ring_size Size of the ring buffer in bytes. It must be a multiple of the cache line size and fit in the memory region.
+         * @param mem_node NUMA node of the memory region.
+         * @param cpu_node CPU NUMA node of the producing CPU.
+         * @param producer_cpu Logical CPU that writes the messages.
+         * @param consumer_cpu Logical CPU that reads them and is timed.
+         * @param dram_power_readers Power measurement objects for DRAM.
+         * @param name Name of the benchmark.
+         */
+        ProducerConsumerBenchmark(
+            void* mem_array,
+            size_t len,
+            uint32_t iterations,
+            size_t ring_size,
+            uint32_t mem_node,
+            uint32_t cpu_node,
+            uint32_t producer_cpu,
+            uint32_t consumer_cpu,
+            std::vector<PowerReader*> dram_power_readers,
+            std::string name
+        );
+
+        /**
+         * @brief Destructor.
+         */
+        virtual ~ProducerConsumerBenchmark() {}
+
+        /**
+         * @brief Reports benchmark configuration details to the console.
+         */
+        virtual void reportBenchmarkInfo() const;
+
+        /**
+         * @brief Reports results to the console.
+         */
+        virtual void reportResults() const;
+
+        /**
+         * @brief Gets the logical CPU that writes the messages.
+         * @returns The producing CPU.
+         */
+        uint32_t getProducerCPU() const;
+
+        /**
+         * @brief Gets the logical CPU that reads the messages.
+         * @returns The consuming CPU.
+         */
+        uint32_t getConsumerCPU() const;
+
+        /**
+         * @brief Gets how close the producing and consuming CPUs are.
+         * @returns The relation of the two CPUs.
+         */
+        cpu_pair_relation_t getRelation() const;
+
+        /**
+         * @brief Gets the size of the ring buffer.
+         * @returns The ring buffer size in bytes.
+         */
+        size_t getRingSize() const;
+
+        /**
+         * @brief Gets the median delivery latency over all stamped messages of all iterations.
+         * @returns The latency in ns, or 0 if the benchmark has not run.
+         */
+        double getMedianMessageLatency() const;
+
+        /**
+         * @brief Gets the 95th percentile delivery latency over all stamped messages of all iterations.
+         * @returns The latency in ns, or 0 if the benchmark has not run.
+         */
+        double get95PercentileMessageLatency() const;
+
+        /**
+         * @brief Gets the 99th percentile delivery latency over all stamped messages of all iterations.
+         * @returns The latency in ns, or 0 if the benchmark has not run.
+         */
+        double get99PercentileMessageLatency() const;
+
+    protected:
+        virtual bool runCore();
+
+    private:
+        size_t ring_size_; /**< Size of the ring buffer in bytes. */
+        uint32_t producer_cpu_; /**< Logical CPU that writes the messages. */
+        uint32_t consumer_cpu_; /**< Logical CPU that reads them. */
+        double median_message_latency_; /**< Median delivery latency in ns. */
+        double p95_message_latency_; /**< 95th percentile delivery latency in ns. */
+        double p99_message_latency_; /**< 99th percentile delivery latency in ns. */
+    };
+};
+
+#endif
@@ -0,0 +1,89 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ * 
+ * @brief Header file for the ProducerConsumerWorker class.
+ */
+
+#ifndef PRODUCER_CONSUMER_WORKER_H
+#define PRODUCER_CONSUMER_WORKER_H
+
+//Headers
+#include <MemoryWorker.h>
+
+//Libraries
+#include <cstdint>
+#include <vector>
+
+namespace xmem {
+    /** 
+     * @brief Multithreading-friendly class that streams cache line messages through a single-producer/single-consumer ring buffer shared with a partner worker on another logical CPU.
+     *
+     * Each slot of the ring is one cache line holding a sequence number, a send timestamp and payload. The producer waits until a slot is free (sequence number 0), fills it and publishes its sequence number. The consumer waits for the next sequence number, reads the payload and frees the slot. When the consumer is done, it stores a stop value into the next slot instead of freeing it, which ends the producer once it has wrapped around to it. Only the consumer is timed.
+     */
+    class ProducerConsumerWorker : public MemoryWorker {
+        public:
+            
+            /** 
+             * @brief Constructor.
+             * @param ring Pointer to the ring buffer. It must be cache line aligned and zero before the workers start.
+             * @param ring_size Size of the ring buffer in bytes. It is rounded down to whole cache lines, which are the slots.
+             * @param producer If true, this worker sends the messages. Otherwise it receives them and is timed.
+             * @param cpu_affinity Logical CPU identifier to lock this worker's thread to.
+             */
+            ProducerConsumerWorker(
+                void* ring,
+                size_t ring_size,
+                bool producer,
+                int32_t cpu_affinity
+            );
+            
+            /**
+             * @brief Destructor.
+             */
+            virtual ~ProducerConsumerWorker();
+
+            /**
+             * @brief Streams messages on the calling thread. Affinity, priority and priming are handled by the caller.
+             */
+            virtual void runKernels();
+
+            /**
+             * @brief Gets the delivery latency of every stamped message received by the consumer, i.e., the time from just before the producer filled its slot until the consumer found it.
+             * @returns The latencies in timer ticks, in order of arrival. Empty for the producer.
+             */
+            std::vector<tick_t> getMessageTicks();
+        
+        private:
+            // ONLY ACCESS OBJECT VARIABLES UNDER THE RUNNABLE OBJECT LOCK!!!!
+            bool producer_; /**< If true, this worker sends the messages. */
+            std::vector<tick_t> message_ticks_; /**< Delivery latencies of the stamped messages of the last run. */
+            uint64_t checksum_; /**< Sum of the received payload, so that the consumer's reads cannot be optimized away. */
+    };
+};
+
+#endif
@@ -0,0 +1,149 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ *
+ * @brief Header file for the RegionCache class.
+ */
+
+#ifndef REGION_CACHE_H
+#define REGION_CACHE_H
+
+//Headers
+#include <common.h>
+
+//Libraries
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace xmem {
+
+    /**
+     * @brief Remembers how memory regions under test have been prepared, so that benchmarks sharing a region can skip re-initializing it.
+     * A region is resident once it has been written in full. A pointer chain stays valid until something overwrites part of its range.
+     * This is only used from the thread that runs the benchmarks, so it is not thread-safe.
+     */
+    class RegionCache {
+    public:
+        /**
+         * @brief Constructor.
+         */
+        RegionCache();
+
+        /**
+         * @brief Checks whether a range has already been written in full.
+         * @param start_address Beginning of the range.
+         * @param end_address End of the range.
+         * @returns True if every byte in the range is known to be resident.
+         */
+        bool isResident(void* start_address, void* end_address);
+
+        /**
+         * @brief Records that a range has been written in full. Any pointer chains overlapping it are dropped.
+         * @param start_address Beginning of the range.
+         * @param end_address End of the range.
+         */
+        void markResident(void* start_address, void* end_address);
+
+        /**
+         * @brief Looks up a pointer chain.
+         * @param start_address Beginning of the chain's range.
+         * @param end_address End of the chain's range.
+         * @param chunk_size Chunk size of the chain.
+         * @param granularity Node spacing of the chain.
+         * @param random_offsets Whether nodes were placed at random offsets.
+         * @param seed Random seed of the chain.
+         * @returns True if an identical chain is already in memory.
+         */
+        bool hasChain(void* start_address, void* end_address, chunk_size_t chunk_size, chain_granularity_t granularity, bool random_offsets, uint64_t seed);
+
+        /**
+         * @brief Records a newly built pointer chain. Chains overlapping its range are dropped.
+         * @param start_address Beginning of the chain's range.
+         * @param end_address End of the chain's range.
+         * @param chunk_size Chunk size of the chain.
+         * @param granularity Node spacing of the chain.
+         * @param random_offsets Whether nodes were placed at random offsets.
+         * @param seed Random seed of the chain.
+         */
+        void addChain(void* start_address, void* end_address, chunk_size_t chunk_size, chain_granularity_t granularity, bool random_offsets, uint64_t seed);
+
+        /**
+         * @brief Drops all pointer chains overlapping a range whose contents were overwritten. The range stays resident.
+         * @param start_address Beginning of the range.
+         * @param end_address End of the range.
+         */
+        void invalidate(void* start_address, void* end_address);
+
+        /**
+         * @brief Forgets everything about a range whose memory was freed. Resident ranges overlapping it are dropped along with its pointer chains.
+         * @param start_address Beginning of the range.
+         * @param end_address End of the range.
+         */
+        void release(void* start_address, void* end_address);
+
+        /**
+         * @brief Gets the number of preparation steps that were skipped.
+         * @returns The number of cache hits.
+         */
+        uint64_t getHits() const;
+
+        /**
+         * @brief Gets the number of preparation steps that had to be performed.
+         * @returns The number of cache misses.
+         */
+        uint64_t getMisses() const;
+
+    private:
+        /**
+         * @brief A pointer chain that is currently in memory.
+         */
+        typedef struct {
+            uintptr_t start; /**< Beginning of the chain's range. */
+            uintptr_t end; /**< End of the chain's range. */
+            chunk_size_t chunk_size; /**< Chunk size of the chain. */
+            chain_granularity_t granularity; /**< Node spacing of the chain. */
+            bool random_offsets; /**< Whether nodes were placed at random offsets. */
+            uint64_t seed; /**< Random seed of the chain. */
+        } chain_entry_t;
+
+        /**
+         * @brief A range of memory that has been written in full.
+         */
+        typedef struct {
+            uintptr_t start; /**< Beginning of the range. */
+            uintptr_t end; /**< End of the range. */
+        } resident_range_t;
+
+        std::vector<chain_entry_t> chains_; /**< Chains currently in memory. Their ranges never overlap. */
+        std::vector<resident_range_t> resident_; /**< Ranges that have been written in full. */
+        uint64_t hits_; /**< Number of preparation steps skipped. */
+        uint64_t misses_; /**< Number of preparation steps performed. */
+    };
+};
+
+#endif
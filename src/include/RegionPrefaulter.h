@@ -0,0 +1,83 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ *
+ * @brief Header file for the RegionPrefaulter class.
+ */
+
+#ifndef REGION_PREFAULTER_H
+#define REGION_PREFAULTER_H
+
+//Headers
+#include <common.h>
+#include <Runnable.h>
+
+//Libraries
+#include <cstdint>
+#include <cstddef>
+
+namespace xmem {
+
+    /**
+     * @brief Faults in a slice of a memory region under test by writing one word of every page.
+     * Several prefaulters can run in parallel threads on disjoint slices, each pinned to a CPU in the NUMA node of the region.
+     */
+    class RegionPrefaulter : public Runnable {
+    public:
+        /**
+         * @brief Constructor.
+         * @param start_address Beginning of the slice. This must be page aligned.
+         * @param end_address End of the slice.
+         * @param page_size Distance between the written words in bytes. This should be the size of the pages backing the region, or smaller.
+         * @param cpu_affinity Logical CPU to run on. If negative, the prefaulter does not change the affinity of its thread.
+         */
+        RegionPrefaulter(
+            void* start_address,
+            void* end_address,
+            size_t page_size,
+            int32_t cpu_affinity
+        );
+
+        /**
+         * @brief Destructor.
+         */
+        virtual ~RegionPrefaulter();
+
+        /**
+         * @brief Touches every page of the slice.
+         */
+        virtual void run();
+
+    private:
+        uint8_t* start_address_; /**< Beginning of the slice. */
+        uint8_t* end_address_; /**< End of the slice. */
+        size_t page_size_; /**< Distance between the written words in bytes. */
+        int32_t cpu_affinity_; /**< Logical CPU to run on, or negative to leave the affinity alone. */
+    };
+};
+
+#endif
@@ -47,7 +47,8 @@ namespace xmem {
     class Timer {
     public:
         /**
-         * @brief Constructor. This may take a noticeable amount of time.
+         * @brief Constructor. Calibrates the currently selected timer backend and measures its overhead and resolution.
+         * Hardware timers are calibrated against the raw monotonic OS clock over TIMER_CALIBRATION_MS.
          */
         Timer();
 
@@ -63,9 +64,34 @@ namespace xmem {
          */
         float getNsPerTick();
 
+        /**
+         * @brief Gets the overhead of reading this timer.
+         * @returns The minimum number of ticks measured by a back-to-back start_timer()/stop_timer() pair.
+         */
+        tick_t getOverheadTicks();
+
+        /**
+         * @brief Gets the resolution of this timer.
+         * @returns The smallest nonzero number of ticks observed between two successive timer reads.
+         */
+        tick_t getResolutionTicks();
+
+    private:
+        /**
+         * @brief Calibrates a hardware timer against the raw monotonic OS clock by busy-waiting for TIMER_CALIBRATION_MS.
+         */
+        void calibrateAgainstOsClock();
+
+        /**
+         * @brief Measures the overhead and resolution of the timer.
+         */
+        void measureOverheadAndResolution();
+
     protected:
         tick_t ticks_per_ms_; /**< Ticks per ms for this timer. */
         float ns_per_tick_; /**< Nanoseconds per tick for this timer. */
+        tick_t overhead_ticks_; /**< Minimum cost of a back-to-back start/stop pair in ticks. */
+        tick_t resolution_ticks_; /**< Smallest nonzero observed difference between two timer reads in ticks. */
     };
 };
 
@@ -0,0 +1,199 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ *
+ * @brief Header file for the WorkerPool class.
+ */
+
+#ifndef WORKER_POOL_H
+#define WORKER_POOL_H
+
+//Headers
+#include <common.h>
+#include <Runnable.h>
+#include <Thread.h>
+#include <MemoryWorker.h>
+
+//Libraries
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace xmem {
+
+    /**
+     * @brief Commands that can be posted to a pooled thread.
+     */
+    typedef enum {
+        POOL_CMD_IDLE, /**< Nothing to do. */
+        POOL_CMD_RUN, /**< Run the posted MemoryWorker's kernels. */
+        POOL_CMD_RUN_PRIMED, /**< Prime the posted MemoryWorker's memory, then run its kernels. */
+        POOL_CMD_EXIT /**< Leave the dispatch loop so the thread can be joined. */
+    } pool_command_t;
+
+    /**
+     * @brief Reusable generation-counting spin barrier. All participants are released in the same instant, which keeps thread start skew out of the measured windows.
+     */
+    class SpinBarrier {
+    public:
+        /**
+         * @brief Constructor.
+         */
+        SpinBarrier();
+
+        /**
+         * @brief Sets the number of threads that must arrive before the barrier opens. Only call this while no thread is waiting.
+         * @param num_participants Number of participating threads.
+         */
+        void reset(uint32_t num_participants);
+
+        /**
+         * @brief Blocks the calling thread by spinning until all participants have arrived.
+         */
+        void wait();
+
+    private:
+        uint32_t num_participants_; /**< Number of threads that must arrive. */
+        std::atomic<uint32_t> arrived_; /**< Number of threads that have arrived in the current round. */
+        std::atomic<uint32_t> generation_; /**< Incremented each time the barrier opens. */
+    };
+
+    /**
+     * @brief A persistent thread body that waits on a lock-free command slot for MemoryWorker jobs.
+     *
+     * The slot is polled with a short spin so that back-to-back iterations never touch a lock. A thread that stays idle past the spin limit parks on a condition variable until the next post.
+     */
+    class PoolWorker : public Runnable {
+    public:
+        /**
+         * @brief Constructor.
+         * @param barrier The barrier shared by all threads in the pool.
+         * @param done_mutex Mutex guarding done_cv.
+         * @param done_cv Signaled whenever this thread completes a command.
+         */
+        PoolWorker(SpinBarrier* barrier, std::mutex* done_mutex, std::condition_variable* done_cv);
+
+        /**
+         * @brief Destructor.
+         */
+        virtual ~PoolWorker();
+
+        /**
+         * @brief Dispatch loop. Boosts scheduling priority once, then serves commands until POOL_CMD_EXIT is posted.
+         */
+        virtual void run();
+
+        /**
+         * @brief Posts a command into this thread's command slot. Must only be called by the pool owner, and only when isDone() is true.
+         * @param command The command to post.
+         * @param job The worker to run, if applicable.
+         */
+        void post(pool_command_t command, MemoryWorker* job);
+
+        /**
+         * @brief Indicates whether the most recently posted command has completed.
+         * @returns True if the thread is idle.
+         */
+        bool isDone() const;
+
+    private:
+        SpinBarrier* barrier_; /**< Barrier shared by the pool. */
+        std::mutex* done_mutex_; /**< Pool-wide mutex for completion signaling. */
+        std::condition_variable* done_cv_; /**< Pool-wide completion condition. */
+        std::mutex park_mutex_; /**< Guards park_cv_. */
+        std::condition_variable park_cv_; /**< An idle thread parks here once it has spun for too long. */
+        MemoryWorker* job_; /**< The posted job. Published by seq_posted_. */
+        pool_command_t command_; /**< The posted command. Published by seq_posted_. */
+        std::atomic<uint32_t> seq_posted_; /**< Sequence number of the last posted command. */
+        std::atomic<uint32_t> seq_done_; /**< Sequence number of the last completed command. */
+        int32_t pinned_cpu_; /**< Logical CPU this thread is currently locked to, or -1 if none. Only touched by the pooled thread. */
+    };
+
+    /**
+     * @brief A set of persistent, pinned threads that run MemoryWorker jobs for all iterations of all benchmarks.
+     *
+     * Threads are created once. Each call to runWorkers() hands one job to each of the first N threads through their command slots, releases them together on a spin barrier, and waits for them to finish. A pooled thread only re-pins itself when the requested CPU changes.
+     */
+    class WorkerPool {
+    public:
+        /**
+         * @brief Constructor. Threads are not started until start() is called.
+         * @param num_threads Number of pooled threads.
+         */
+        WorkerPool(uint32_t num_threads);
+
+        /**
+         * @brief Destructor. Stops and joins all pooled threads.
+         */
+        ~WorkerPool();
+
+        /**
+         * @brief Creates and starts all pooled threads.
+         * @returns True on success.
+         */
+        bool start();
+
+        /**
+         * @brief Stops and joins all pooled threads.
+         * @returns True on success.
+         */
+        bool stop();
+
+        /**
+         * @brief Runs one MemoryWorker per pooled thread and blocks until all complete.
+         * @param workers The jobs to run. There must be no more jobs than pooled threads.
+         * @param prime_memory If true, each thread primes its job's memory before the barrier.
+         * @returns True on success.
+         */
+        bool runWorkers(std::vector<MemoryWorker*>& workers, bool prime_memory);
+
+        /**
+         * @brief Gets the number of pooled threads.
+         * @returns The number of pooled threads.
+         */
+        uint32_t getNumThreads() const { return num_threads_; }
+
+        /**
+         * @brief Indicates whether the pool threads are running.
+         * @returns True if start() succeeded and stop() has not been called.
+         */
+        bool isRunning() const { return running_; }
+
+    private:
+        uint32_t num_threads_; /**< Number of pooled threads. */
+        bool running_; /**< True while pooled threads are alive. */
+        SpinBarrier barrier_; /**< Phase start barrier shared by all pooled threads. */
+        std::mutex done_mutex_; /**< Guards done_cv_. */
+        std::condition_variable done_cv_; /**< Signaled by pooled threads when they complete a command. */
+        std::vector<PoolWorker*> pool_workers_; /**< Dispatch loop objects, one per thread. */
+        std::vector<Thread*> pool_threads_; /**< The pooled threads. */
+    };
+};
+
+#endif
@@ -38,12 +38,17 @@
 //Libraries
 #include <cstdint>
 #include <cstddef>
+#include <vector>
 
 namespace xmem {
 
     
     typedef int32_t(*SequentialFunction)(void*, void*);
     typedef int32_t(*RandomFunction)(uintptr_t*, uintptr_t**, size_t); 
+    typedef int32_t(*IndependentRandomFunction)(void*, size_t, uint64_t*, size_t);
+    typedef int32_t(*ContentionFunction)(void*, uintptr_t*);
+
+#define RANDOM_STREAMS 8 /**< Number of xorshift64 random number streams each independent random-access load worker keeps. Scalar kernels interleave four of them, and the 512-bit gather kernels use one per lane. */
     
     /**
      * @brief Determines which sequential memory access kernel to use based on the read/write mode, chunk size, and stride size.
@@ -56,6 +61,30 @@ namespace xmem {
      */
     bool determine_sequential_kernel(rw_mode_t rw_mode, chunk_size_t chunk_size, int32_t stride_size, SequentialFunction* kernel_function, SequentialFunction* dummy_kernel_function);
     
+    /**
+     * @brief Determines which software-prefetching sequential read kernel to use based on the chunk size and stride size. The kernels prefetch g_prefetch_distance cache lines ahead using hint g_prefetch_hint.
+     * @param chunk_size Access granularity.
+     * @param stride_size Distance between successive accesses.
+     * @param kernel_function Function pointer that will be set to the matching kernel function.
+     * @param dummy_kernel_function Function pointer that will be set to the matching dummy kernel function.
+     * @returns True on success. False if software prefetching is not supported on this architecture.
+     */
+    bool determine_sequential_prefetch_kernel(chunk_size_t chunk_size, int32_t stride_size, SequentialFunction* kernel_function, SequentialFunction* dummy_kernel_function);
+
+    /**
+     * @brief Lists the strides for which sequential and strided kernels were generated for a chunk size. These are the values that -S accepts.
+     * @param chunk_size Access granularity.
+     * @returns The strides in chunks, in table order.
+     */
+    std::vector<int32_t> sequential_kernel_strides(chunk_size_t chunk_size);
+
+    /**
+     * @brief Computes how many bytes of memory one pass of a sequential or strided load kernel walks. Each pass makes THROUGHPUT_BENCHMARK_BYTES_PER_PASS bytes of accesses that are one stride apart, so that no chunk is accessed twice.
+     * @param stride_size Distance between successive accesses in chunks.
+     * @returns The bytes of memory spanned by one pass.
+     */
+    size_t sequential_pass_span(int32_t stride_size);
+
     /**
      * @brief Determines which random memory access kernel to use based on the read/write mode, chunk size, and stride size.
      * @param rw_mode Read/write mode.
@@ -67,13 +96,70 @@ namespace xmem {
     bool determine_random_kernel(rw_mode_t rw_mode, chunk_size_t chunk_size, RandomFunction* kernel_function, RandomFunction* dummy_kernel_function);
 
     /**
-     * @brief Builds a random chain of pointers within the specified memory region.
+     * @brief Determines which pointer-chasing kernel to use for a number of independent chains.
+     * @param chains Number of chains chased at once. Must be a power of two of at most 32.
+     * @param kernel_function Function pointer that will be set to chasePointers() for one chain, or to the matching chaseInterleavedPointers() otherwise.
+     * @param dummy_kernel_function Function pointer that will be set to the matching dummy kernel function.
+     * @returns True on success.
+     */
+    bool determine_interleaved_chase_kernel(uint32_t chains, RandomFunction* kernel_function, RandomFunction* dummy_kernel_function);
+
+    /**
+     * @brief Determines which independent random-access (GUPS-style) kernel to use based on the read/write mode and chunk size.
+     * READ loads each chunk, WRITE updates it in place with a read-modify-write, and WRITE_NT overwrites it with a non-temporal store without reading it first.
+     * The 32-bit and 64-bit chunks use scalar accesses. The 128-bit and 256-bit chunks are AVX2 gathers of 64-bit elements at independent addresses, and the 512-bit chunks are AVX-512F gathers and scatters.
+     * @param rw_mode Read/write mode.
+     * @param chunk_size Access granularity.
+     * @param kernel_function Function pointer that will be set to the matching kernel function.
+     * @param dummy_kernel_function Function pointer that will be set to the matching dummy kernel function.
+     * @returns True on success. False if the combination is not implemented or the CPU lacks the required instructions.
+     */
+    bool determine_independent_random_kernel(rw_mode_t rw_mode, chunk_size_t chunk_size, IndependentRandomFunction* kernel_function, IndependentRandomFunction* dummy_kernel_function);
+
+    /**
+     * @brief Determines which contention kernel to use for an operation on a shared target.
+     * @param op The operation.
+     * @param kernel_function Function pointer that will be set to the matching kernel function.
+     * @param dummy_kernel_function Function pointer that will be set to the matching dummy kernel function.
+     * @returns True on success.
+     */
+    bool determine_contention_kernel(contention_op_t op, ContentionFunction* kernel_function, ContentionFunction* dummy_kernel_function);
+
+    /**
+     * @brief Seeds the random number streams of an independent random-access load worker.
+     * @param seed Random seed. Different workers should use different seeds.
+     * @param streams Array of RANDOM_STREAMS states to fill. None of them is zero.
+     */
+    void seed_random_streams(uint64_t seed, uint64_t* streams);
+
+    /**
+     * @brief Computes the size of the table that the independent random-access kernels index into. As in GUPS, the table is a power of two so that random numbers map to addresses with a mask.
+     * @param len Length of the memory region available.
+     * @returns The largest power of two that is at most len.
+     */
+    size_t independent_random_table_length(size_t len);
+
+    /**
+     * @brief Builds a random chain of pointers within the specified memory region. The chain is a single cycle through all of its nodes, starting at start_address.
      * @param start_address Beginning address of the memory region.
      * @param end_address End address of the memory region.
      * @param chunk_size Granularity of words to read, dereference, and jump by. This must be at least the minimum pointer size on the system (typically 32 or 64-bit). If the chunk size is more than 64 bits, when chasing pointers, only the first pointer-sized bits of the referenced word are used to make the next hop.
+     * @param granularity Spacing of the nodes. Exactly one node is placed in each chunk, cache line, or page of the region.
+     * @param random_offsets If true, each node other than the first is placed at a random chunk-aligned offset within its cache line or page.
+     * @param seed Random seed. The same seed always produces the same chain.
+     * @param numa_node NUMA node holding the region. Regions larger than POINTER_CHAIN_BLOCK_SIZE are built in parallel by threads pinned to this node. If -1, the builder threads are not pinned.
+     * @returns True on success.
+     */
+    bool build_random_pointer_permutation(void* start_address, void* end_address, chunk_size_t chunk_size, chain_granularity_t granularity, bool random_offsets, uint64_t seed, uint32_t numa_node);
+
+    /**
+     * @brief Adds lookahead pointers to an existing pointer chain. The second word of every node is set to the node that is distance hops further along the chain, so that a chase can prefetch ahead of itself. The chain must be a single cycle with cache line or page granularity starting at start_address.
+     * @param start_address Beginning address of the memory region, which is also the first node of the chain.
+     * @param end_address End address of the memory region.
+     * @param distance Number of hops to look ahead.
      * @returns True on success.
      */
-    bool build_random_pointer_permutation(void* start_address, void* end_address, chunk_size_t chunk_size);
+    bool build_chain_lookahead(void* start_address, void* end_address, uint32_t distance);
 
     /***********************************************************************
      ***********************************************************************
@@ -102,6 +188,29 @@ namespace xmem {
      * @returns Undefined.
      */
     int32_t chasePointers(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
+
+#ifdef HAS_SW_PREFETCH
+    /**
+     * @brief Like chasePointers(), but prefetches the lookahead pointer stored in the second word of each node with hint g_prefetch_hint. The chain must have been prepared with build_chain_lookahead().
+     * @param first_address Starting address to deference.
+     * @param last_touched_address The last visited address.
+     * @param len The number of pointers to deference in a chain-like fashion.
+     * @returns Undefined.
+     */
+    int32_t chasePointersPrefetch(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
+#endif
+
+    /**
+     * @brief Chases several independent pointer chains at once, interleaving one hop of each chain, so that up to Chains cache misses can be outstanding.
+     * Each chain is kept in its own variable, so hops of different chains do not depend on each other. LATENCY_BENCHMARK_UNROLL_LENGTH hops are made in total, i.e., LATENCY_BENCHMARK_UNROLL_LENGTH / Chains per chain.
+     * The current node of every chain is read from and written back to the heads array. The array is returned as the last touched address, so the kernel can be called repeatedly just like chasePointers().
+     * @tparam Chains Number of chains. Must divide LATENCY_BENCHMARK_UNROLL_LENGTH.
+     * @param heads Array holding the current node of every chain.
+     * @param last_touched_address Set to heads.
+     * @param len Unused.
+     * @returns Undefined.
+     */
+    template <uint32_t Chains> int32_t chaseInterleavedPointers(uintptr_t* heads, uintptr_t** last_touched_address, size_t len);
     
     
     
@@ -119,1641 +228,368 @@ namespace xmem {
      */
     int32_t dummy_empty(void*, void*);
 
-    /* ------------ SEQUENTIAL LOOP --------------*/
+    /* ------------ SEQUENTIAL AND STRIDED LOOP --------------*/
 
     /**
-     * @brief Used for measuring the time spent doing everything in forward sequential Word 32 loops except for the memory access itself.
+     * @brief Used for measuring the time spent doing everything in a strided loop of the given word type except for the memory access itself.
+     * @tparam WordT The chunk type, e.g., Word64_t.
+     * @tparam Stride Distance between successive accesses in chunks. 1 is forward sequential, -1 is reverse sequential. Only the values in the kernel table are instantiated.
      * @param start_address The beginning of the memory region of interest.
      * @param end_address The end of the memory region of interest.
      * @returns Undefined.
      */
-    int32_t dummy_forwSequentialLoop_Word32(void* start_address, void* end_address);
+    template <typename WordT, int32_t Stride> int32_t dummy_stridedLoop(void* start_address, void* end_address);
+
+    /* ------------ RANDOM LOOP --------------*/
+
+    //SPECIAL CASE: on 32-bit architectures, 64-bit pointers cannot be used, and vice versa.
+#ifndef HAS_WORD_64
+    /**
+     * @brief Mimics the randomRead_Word32 and randomWrite_Word32 functions except for the memory accesses.
+     * @param len The number of pointers to deference in a chain-like fashion.
+     * @returns Undefined.
+     */
+    int32_t dummy_randomLoop_Word32(uintptr_t*, uintptr_t**, size_t len);
+#endif
 
 #ifdef HAS_WORD_64
     /**
-     * @brief Used for measuring the time spent doing everything in forward sequential Word 64 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
+     * @brief Mimics the randomRead_Word64 and randomWrite_Word64 functions except for the memory accesses.
+     * @param len The number of pointers to deference in a chain-like fashion.
      * @returns Undefined.
      */
-    int32_t dummy_forwSequentialLoop_Word64(void* start_address, void* end_address);
+    int32_t dummy_randomLoop_Word64(uintptr_t*, uintptr_t**, size_t len);
 #endif
 
 #ifdef HAS_WORD_128
     /**
-     * @brief Used for measuring the time spent doing everything in forward sequential Word 128 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
+     * @brief Mimics the randomRead_Word128 and randomWrite_Word128 functions except for the memory accesses.
+     * @param len The number of pointers to deference in a chain-like fashion.
      * @returns Undefined.
      */
-    int32_t dummy_forwSequentialLoop_Word128(void* start_address, void* end_address);
+    int32_t dummy_randomLoop_Word128(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
 #endif
 
 #ifdef HAS_WORD_256
     /**
-     * @brief Used for measuring the time spent doing everything in forward sequential Word 256 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
+     * @brief Mimics the randomRead_Word256 and randomWrite_Word256 functions except for the memory accesses.
+     * @param len The number of pointers to deference in a chain-like fashion.
      * @returns Undefined.
      */
-    int32_t dummy_forwSequentialLoop_Word256(void* start_address, void* end_address);
+    int32_t dummy_randomLoop_Word256(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
 #endif
 
 #ifdef HAS_WORD_512
     /**
-     * @brief Used for measuring the time spent doing everything in forward sequential Word 512 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
+     * @brief Mimics the randomRead_Word512 and randomWrite_Word512 functions except for the memory accesses.
+     * @param len The number of pointers to deference in a chain-like fashion.
      * @returns Undefined.
      */
-    int32_t dummy_forwSequentialLoop_Word512(void* start_address, void* end_address);
+    int32_t dummy_randomLoop_Word512(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
 #endif
 
-    /**
-     * @brief Used for measuring the time spent doing everything in reverse sequential Word 32 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t dummy_revSequentialLoop_Word32(void* start_address, void* end_address);
+    /* ------------------------------------------------------------------------- */
+    /* --------------------- CORE BENCHMARK ROUTINES --------------------------- */
+    /* ------------------------------------------------------------------------- */
+
+    /* ------------ SEQUENTIAL AND STRIDED READ --------------*/
 
-#ifdef HAS_WORD_64
     /**
-     * @brief Used for measuring the time spent doing everything in reverse sequential Word 64 loops except for the memory access itself.
+     * @brief Walks over the allocated memory in strides, reading one chunk at a time. The region is walked once, so one chunk is read per stride that fits in it and no chunk is read twice. Callers size the region with sequential_pass_span().
+     * @tparam WordT The chunk type, e.g., Word64_t.
+     * @tparam Stride Distance between successive accesses in chunks. Negative strides walk in the reverse direction.
      * @param start_address The beginning of the memory region of interest.
      * @param end_address The end of the memory region of interest.
      * @returns Undefined.
      */
-    int32_t dummy_revSequentialLoop_Word64(void* start_address, void* end_address);
-#endif
+    template <typename WordT, int32_t Stride> int32_t stridedRead(void* start_address, void* end_address);
+
+    /* ------------ SEQUENTIAL AND STRIDED WRITE --------------*/
 
-#ifdef HAS_WORD_128
     /**
-     * @brief Used for measuring the time spent doing everything in reverse sequential Word 128 loops except for the memory access itself.
+     * @brief Walks over the allocated memory in strides, writing one chunk at a time.
+     * @tparam WordT The chunk type, e.g., Word64_t.
+     * @tparam Stride Distance between successive accesses in chunks. Negative strides walk in the reverse direction.
      * @param start_address The beginning of the memory region of interest.
      * @param end_address The end of the memory region of interest.
      * @returns Undefined.
      */
-    int32_t dummy_revSequentialLoop_Word128(void* start_address, void* end_address);
-#endif
+    template <typename WordT, int32_t Stride> int32_t stridedWrite(void* start_address, void* end_address);
+
+#ifdef HAS_NT_STORES
+    /* ------------ NON-TEMPORAL SEQUENTIAL AND STRIDED WRITE --------------*/
 
-#ifdef HAS_WORD_256
     /**
-     * @brief Used for measuring the time spent doing everything in reverse sequential Word 256 loops except for the memory access itself.
+     * @brief Walks over the allocated memory in strides, writing one chunk at a time with non-temporal stores that bypass the caches.
+     * @tparam WordT The chunk type, e.g., Word64_t.
+     * @tparam Stride Distance between successive accesses in chunks. Negative strides walk in the reverse direction.
      * @param start_address The beginning of the memory region of interest.
      * @param end_address The end of the memory region of interest.
      * @returns Undefined.
      */
-    int32_t dummy_revSequentialLoop_Word256(void* start_address, void* end_address);
+    template <typename WordT, int32_t Stride> int32_t stridedWriteNT(void* start_address, void* end_address);
 #endif
 
-#ifdef HAS_WORD_512
+#ifdef HAS_SW_PREFETCH
+    /* ------------ PREFETCHING SEQUENTIAL AND STRIDED READ --------------*/
+
     /**
-     * @brief Used for measuring the time spent doing everything in reverse sequential Word 512 loops except for the memory access itself.
+     * @brief Walks over the allocated memory in strides, reading one chunk at a time and prefetching g_prefetch_distance lines (or strides, if larger) ahead with hint g_prefetch_hint. One prefetch is issued per cache line touched.
+     * @tparam WordT The chunk type, e.g., Word64_t.
+     * @tparam Stride Distance between successive accesses in chunks. Negative strides walk in the reverse direction.
      * @param start_address The beginning of the memory region of interest.
      * @param end_address The end of the memory region of interest.
      * @returns Undefined.
      */
-    int32_t dummy_revSequentialLoop_Word512(void* start_address, void* end_address);
+    template <typename WordT, int32_t Stride> int32_t stridedReadPrefetch(void* start_address, void* end_address);
 #endif
 
-    /* ------------ STRIDE 2 LOOP --------------*/
 
+    /* ------------ RANDOM READ --------------*/
+
+#ifndef HAS_WORD_64
     /**
-     * @brief Used for measuring the time spent doing everything in forward 2-strided Word 32 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
+     * @brief Walks over the allocated memory in random order by chasing 64-bit pointers.
+     * @param first_address Starting address to deference.
+     * @param last_touched_address The last visited address.
+     * @param len The number of pointers to deference in a chain-like fashion.
      * @returns Undefined.
      */
-    int32_t dummy_forwStride2Loop_Word32(void* start_address, void* end_address);
+    int32_t randomRead_Word32(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
+#endif
 
+    //32-bit systems only.
 #ifdef HAS_WORD_64
     /**
-     * @brief Used for measuring the time spent doing everything in forward 2-strided Word 64 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
+     * @brief Walks over the allocated memory in random order by chasing 32-bit pointers.
+     * @param first_address Starting address to deference.
+     * @param last_touched_address The last visited address.
+     * @param len The number of pointers to deference in a chain-like fashion.
      * @returns Undefined.
      */
-    int32_t dummy_forwStride2Loop_Word64(void* start_address, void* end_address);
+    int32_t randomRead_Word64(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
 #endif
 
 #ifdef HAS_WORD_128
     /**
-     * @brief Used for measuring the time spent doing everything in forward 2-strided Word 128 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
+     * @brief Walks over the allocated memory in random order by chasing 64-bit pointers embedded in 128-bit memory words.
+     * @param first_address Starting address to deference.
+     * @param last_touched_address The last visited address.
+     * @param len The number of pointers to deference in a chain-like fashion.
      * @returns Undefined.
      */
-    int32_t dummy_forwStride2Loop_Word128(void* start_address, void* end_address);
+    int32_t randomRead_Word128(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
 #endif
 
 #ifdef HAS_WORD_256
     /**
-     * @brief Used for measuring the time spent doing everything in forward 2-strided Word 256 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
+     * @brief Walks over the allocated memory in random order by chasing 64-bit pointers embedded in 256-bit memory words.
+     * @param first_address Starting address to deference.
+     * @param last_touched_address The last visited address.
+     * @param len The number of pointers to deference in a chain-like fashion.
      * @returns Undefined.
      */
-    int32_t dummy_forwStride2Loop_Word256(void* start_address, void* end_address);
+    int32_t randomRead_Word256(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
 #endif
 
 #ifdef HAS_WORD_512
     /**
-     * @brief Used for measuring the time spent doing everything in forward 2-strided Word 512 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
+     * @brief Walks over the allocated memory in random order by chasing 64-bit pointers embedded in 512-bit memory words.
+     * @param first_address Starting address to deference.
+     * @param last_touched_address The last visited address.
+     * @param len The number of pointers to deference in a chain-like fashion.
      * @returns Undefined.
      */
-    int32_t dummy_forwStride2Loop_Word512(void* start_address, void* end_address);
+    int32_t randomRead_Word512(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
 #endif
 
+    /* ------------ RANDOM WRITE --------------*/
+
+    //32-bit machines only
+#ifndef HAS_WORD_64
     /**
-     * @brief Used for measuring the time spent doing everything in reverse 2-strided Word 32 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
+     * @brief Walks over the allocated memory in random order by chasing 32-bit pointers. A pointer is read and written back with the same value before chasing to the next pointer. Thus, each memory address is a read followed by immediate write operation. 
+     * @param first_address Starting address to deference.
+     * @param last_touched_address The last visited address.
+     * @param len The number of pointers to deference in a chain-like fashion.
      * @returns Undefined.
      */
-    int32_t dummy_revStride2Loop_Word32(void* start_address, void* end_address);
+    int32_t randomWrite_Word32(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
+#endif
 
 #ifdef HAS_WORD_64
     /**
-     * @brief Used for measuring the time spent doing everything in reverse 2-strided Word 64 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
+     * @brief Walks over the allocated memory in random order by chasing 64-bit pointers. A pointer is read and written back with the same value before chasing to the next pointer. Thus, each memory address is a read followed by immediate write operation. 
+     * @param first_address Starting address to deference.
+     * @param last_touched_address The last visited address.
+     * @param len The number of pointers to deference in a chain-like fashion.
      * @returns Undefined.
      */
-    int32_t dummy_revStride2Loop_Word64(void* start_address, void* end_address);
+    int32_t randomWrite_Word64(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
 #endif
 
 #ifdef HAS_WORD_128
     /**
-     * @brief Used for measuring the time spent doing everything in reverse 2-strided Word 128 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
+     * @brief Walks over the allocated memory in random order by chasing 64-bit pointers embedded within 128-bit words. A 128-bit word is read and written back with the same value before chasing to the next location extracted as a 64-bit address in the 128-bit word. Thus, each memory address is a read followed by immediate write operation as well as a vector word extraction. 
+     * @param first_address Starting address to deference.
+     * @param last_touched_address The last visited address.
+     * @param len The number of pointers to deference in a chain-like fashion.
      * @returns Undefined.
      */
-    int32_t dummy_revStride2Loop_Word128(void* start_address, void* end_address);
+    int32_t randomWrite_Word128(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
 #endif
 
 #ifdef HAS_WORD_256
     /**
-     * @brief Used for measuring the time spent doing everything in reverse 2-strided Word 256 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
+     * @brief Walks over the allocated memory in random order by chasing 64-bit pointers embedded within 256-bit words. A 256-bit word is read and written back with the same value before chasing to the next location extracted as a 64-bit address in the 256-bit word. Thus, each memory address is a read followed by immediate write operation as well as a vector word extraction. 
+     * @param first_address Starting address to deference.
+     * @param last_touched_address The last visited address.
+     * @param len The number of pointers to deference in a chain-like fashion.
      * @returns Undefined.
      */
-    int32_t dummy_revStride2Loop_Word256(void* start_address, void* end_address);
+    int32_t randomWrite_Word256(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
 #endif
 
 #ifdef HAS_WORD_512
     /**
-     * @brief Used for measuring the time spent doing everything in reverse 2-strided Word 512 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
+     * @brief Walks over the allocated memory in random order by chasing 64-bit pointers embedded within 512-bit words. A 512-bit word is read and written back with the same value before chasing to the next location extracted as a 64-bit address in the 512-bit word. Thus, each memory address is a read followed by immediate write operation as well as a vector word extraction. 
+     * @param first_address Starting address to deference.
+     * @param last_touched_address The last visited address.
+     * @param len The number of pointers to deference in a chain-like fashion.
      * @returns Undefined.
      */
-    int32_t dummy_revStride2Loop_Word512(void* start_address, void* end_address);
+    int32_t randomWrite_Word512(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
 #endif
 
-    /* ------------ STRIDE 4 LOOP --------------*/
+    /* ------------ INDEPENDENT RANDOM ACCESS --------------*/
+
+    /*
+     * All independent random-access kernels share one signature:
+     * table is the start of the region, table_len its power-of-two length in bytes, streams the RANDOM_STREAMS generator states (advanced in place),
+     * and len the number of bytes to touch in this call. Each access picks a chunk-aligned location in the table from the next random number, so successive accesses do not depend on each other.
+     */
 
     /**
-     * @brief Used for measuring the time spent doing everything in forward 4-strided Word 32 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
+     * @brief Mimics the independent random-access kernels except for the memory accesses. Like the random-access dummies, it is only the call: as in GUPS, generating the random addresses counts as part of each access.
      * @returns Undefined.
      */
-    int32_t dummy_forwStride4Loop_Word32(void* start_address, void* end_address);
+    int32_t dummy_independentLoop(void* table, size_t table_len, uint64_t* streams, size_t len);
 
-#ifdef HAS_WORD_64
     /**
-     * @brief Used for measuring the time spent doing everything in forward 4-strided Word 64 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
+     * @brief Reads 32-bit words at independent random locations.
      * @returns Undefined.
      */
-    int32_t dummy_forwStride4Loop_Word64(void* start_address, void* end_address);
-#endif
+    int32_t independentRead_Word32(void* table, size_t table_len, uint64_t* streams, size_t len);
 
-#ifdef HAS_WORD_128
     /**
-     * @brief Used for measuring the time spent doing everything in forward 4-strided Word 128 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
+     * @brief Updates 32-bit words at independent random locations by XORing in the random number, as in GUPS.
      * @returns Undefined.
      */
-    int32_t dummy_forwStride4Loop_Word128(void* start_address, void* end_address);
-#endif
+    int32_t independentUpdate_Word32(void* table, size_t table_len, uint64_t* streams, size_t len);
 
-#ifdef HAS_WORD_256
+#ifdef HAS_WORD_64
     /**
-     * @brief Used for measuring the time spent doing everything in forward 4-strided Word 256 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
+     * @brief Reads 64-bit words at independent random locations.
      * @returns Undefined.
      */
-    int32_t dummy_forwStride4Loop_Word256(void* start_address, void* end_address);
-#endif
+    int32_t independentRead_Word64(void* table, size_t table_len, uint64_t* streams, size_t len);
 
-#ifdef HAS_WORD_512
     /**
-     * @brief Used for measuring the time spent doing everything in forward 4-strided Word 512 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
+     * @brief Updates 64-bit words at independent random locations by XORing in the random number, as in GUPS.
      * @returns Undefined.
      */
-    int32_t dummy_forwStride4Loop_Word512(void* start_address, void* end_address);
+    int32_t independentUpdate_Word64(void* table, size_t table_len, uint64_t* streams, size_t len);
 #endif
 
+#ifdef HAS_NT_STORES
     /**
-     * @brief Used for measuring the time spent doing everything in reverse 4-strided Word 32 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
+     * @brief Overwrites 32-bit words at independent random locations with non-temporal stores, so the lines are never read.
      * @returns Undefined.
      */
-    int32_t dummy_revStride4Loop_Word32(void* start_address, void* end_address);
+    int32_t independentWriteNT_Word32(void* table, size_t table_len, uint64_t* streams, size_t len);
 
 #ifdef HAS_WORD_64
     /**
-     * @brief Used for measuring the time spent doing everything in reverse 4-strided Word 64 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
+     * @brief Overwrites 64-bit words at independent random locations with non-temporal stores, so the lines are never read.
      * @returns Undefined.
      */
-    int32_t dummy_revStride4Loop_Word64(void* start_address, void* end_address);
+    int32_t independentWriteNT_Word64(void* table, size_t table_len, uint64_t* streams, size_t len);
+#endif
 #endif
 
-#ifdef HAS_WORD_128
+#ifdef HAS_GATHER_KERNELS
     /**
-     * @brief Used for measuring the time spent doing everything in reverse 4-strided Word 128 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
+     * @brief Reads pairs of 64-bit words at independent random locations with AVX2 128-bit gathers.
      * @returns Undefined.
      */
-    int32_t dummy_revStride4Loop_Word128(void* start_address, void* end_address);
-#endif
+    int32_t independentRead_Word128(void* table, size_t table_len, uint64_t* streams, size_t len);
 
-#ifdef HAS_WORD_256
     /**
-     * @brief Used for measuring the time spent doing everything in reverse 4-strided Word 256 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
+     * @brief Reads four 64-bit words at a time from independent random locations with AVX2 256-bit gathers.
      * @returns Undefined.
      */
-    int32_t dummy_revStride4Loop_Word256(void* start_address, void* end_address);
-#endif
+    int32_t independentRead_Word256(void* table, size_t table_len, uint64_t* streams, size_t len);
 
-#ifdef HAS_WORD_512
     /**
-     * @brief Used for measuring the time spent doing everything in reverse 4-strided Word 512 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
+     * @brief Reads eight 64-bit words at a time from independent random locations with AVX-512F gathers.
      * @returns Undefined.
      */
-    int32_t dummy_revStride4Loop_Word512(void* start_address, void* end_address);
-#endif
-
-    /* ------------ STRIDE 8 LOOP --------------*/
+    int32_t independentRead_Word512(void* table, size_t table_len, uint64_t* streams, size_t len);
 
     /**
-     * @brief Used for measuring the time spent doing everything in forward 8-strided Word 32 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
+     * @brief Updates eight 64-bit words at a time at independent random locations with an AVX-512F gather, XOR and scatter, as in GUPS. Colliding lanes lose updates, which GUPS tolerates.
      * @returns Undefined.
      */
-    int32_t dummy_forwStride8Loop_Word32(void* start_address, void* end_address);
+    int32_t independentUpdate_Word512(void* table, size_t table_len, uint64_t* streams, size_t len);
+#endif
+
+    /***********************************************************************
+     ***********************************************************************
+     ******************* CONTENTION-RELATED BENCHMARK KERNELS **************
+     ***********************************************************************
+     ***********************************************************************/
+
+    /*
+     * All contention kernels share one signature:
+     * target is a pointer-sized word that other threads may be operating on at the same time, and value is thread-private state carried from one call to the next.
+     * Each call makes CONTENTION_BENCHMARK_OPS_PER_PASS operations on the target.
+     */
 
-#ifdef HAS_WORD_64
     /**
-     * @brief Used for measuring the time spent doing everything in forward 8-strided Word 64 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
+     * @brief Mimics the contention kernels except for the operations on the target.
      * @returns Undefined.
      */
-    int32_t dummy_forwStride8Loop_Word64(void* start_address, void* end_address);
-#endif
+    int32_t dummy_contentionLoop(void* target, uintptr_t* value);
 
-#ifdef HAS_WORD_128
     /**
-     * @brief Used for measuring the time spent doing everything in forward 8-strided Word 128 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
+     * @brief Atomically adds one to the target and accumulates the old values, so that a locked exchange-and-add is used rather than a plain locked add.
      * @returns Undefined.
      */
-    int32_t dummy_forwStride8Loop_Word128(void* start_address, void* end_address);
-#endif
+    int32_t contentionXadd(void* target, uintptr_t* value);
 
-#ifdef HAS_WORD_256
     /**
-     * @brief Used for measuring the time spent doing everything in forward 8-strided Word 256 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
+     * @brief Atomically increments the target with compare-and-swap. Each attempt counts as one operation, whether it succeeds or not, and a failed attempt retries with the value it observed.
      * @returns Undefined.
      */
-    int32_t dummy_forwStride8Loop_Word256(void* start_address, void* end_address);
-#endif
+    int32_t contentionCmpxchg(void* target, uintptr_t* value);
 
-#ifdef HAS_WORD_512
     /**
-     * @brief Used for measuring the time spent doing everything in forward 8-strided Word 512 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
+     * @brief Atomically exchanges the target with a new value each time.
      * @returns Undefined.
      */
-    int32_t dummy_forwStride8Loop_Word512(void* start_address, void* end_address);
-#endif
+    int32_t contentionXchg(void* target, uintptr_t* value);
 
     /**
-     * @brief Used for measuring the time spent doing everything in reverse 8-strided Word 32 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
+     * @brief Stores a new value to the target each time with plain relaxed stores, i.e., the coherence traffic of contended writes without any locking.
      * @returns Undefined.
      */
-    int32_t dummy_revStride8Loop_Word32(void* start_address, void* end_address);
+    int32_t contentionStore(void* target, uintptr_t* value);
 
-#ifdef HAS_WORD_64
     /**
-     * @brief Used for measuring the time spent doing everything in reverse 8-strided Word 64 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
+     * @brief Increments the target with a plain relaxed load and store, i.e., a per-thread counter that is not meant to be shared. Updates from other threads to the same word may be lost.
      * @returns Undefined.
      */
-    int32_t dummy_revStride8Loop_Word64(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_128
-    /**
-     * @brief Used for measuring the time spent doing everything in reverse 8-strided Word 128 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t dummy_revStride8Loop_Word128(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_256
-    /**
-     * @brief Used for measuring the time spent doing everything in reverse 8-strided Word 256 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t dummy_revStride8Loop_Word256(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_512
-    /**
-     * @brief Used for measuring the time spent doing everything in reverse 8-strided Word 512 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t dummy_revStride8Loop_Word512(void* start_address, void* end_address);
-#endif
-
-    /* ------------ STRIDE 16 LOOP --------------*/
-
-    /**
-     * @brief Used for measuring the time spent doing everything in forward 16-strided Word 32 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t dummy_forwStride16Loop_Word32(void* start_address, void* end_address);
-
-#ifdef HAS_WORD_64
-    /**
-     * @brief Used for measuring the time spent doing everything in forward 16-strided Word 64 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t dummy_forwStride16Loop_Word64(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_128
-    /**
-     * @brief Used for measuring the time spent doing everything in forward 16-strided Word 128 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t dummy_forwStride16Loop_Word128(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_256
-    /**
-     * @brief Used for measuring the time spent doing everything in forward 16-strided Word 256 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t dummy_forwStride16Loop_Word256(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_512
-    /**
-     * @brief Used for measuring the time spent doing everything in forward 16-strided Word 512 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t dummy_forwStride16Loop_Word512(void* start_address, void* end_address);
-#endif
-
-    /**
-     * @brief Used for measuring the time spent doing everything in reverse 16-strided Word 32 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t dummy_revStride16Loop_Word32(void* start_address, void* end_address);
-
-#ifdef HAS_WORD_64
-    /**
-     * @brief Used for measuring the time spent doing everything in reverse 16-strided Word 64 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t dummy_revStride16Loop_Word64(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_128
-    /**
-     * @brief Used for measuring the time spent doing everything in reverse 16-strided Word 128 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t dummy_revStride16Loop_Word128(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_256
-    /**
-     * @brief Used for measuring the time spent doing everything in reverse 16-strided Word 256 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t dummy_revStride16Loop_Word256(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_512
-    /**
-     * @brief Used for measuring the time spent doing everything in reverse 16-strided Word 512 loops except for the memory access itself.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t dummy_revStride16Loop_Word512(void* start_address, void* end_address);
-#endif
-
-    /* ------------ RANDOM LOOP --------------*/
-
-    //SPECIAL CASE: on 32-bit architectures, 64-bit pointers cannot be used, and vice versa.
-#ifndef HAS_WORD_64
-    /**
-     * @brief Mimics the randomRead_Word32 and randomWrite_Word32 functions except for the memory accesses.
-     * @param len The number of pointers to deference in a chain-like fashion.
-     * @returns Undefined.
-     */
-    int32_t dummy_randomLoop_Word32(uintptr_t*, uintptr_t**, size_t len);
-#endif
-
-#ifdef HAS_WORD_64
-    /**
-     * @brief Mimics the randomRead_Word64 and randomWrite_Word64 functions except for the memory accesses.
-     * @param len The number of pointers to deference in a chain-like fashion.
-     * @returns Undefined.
-     */
-    int32_t dummy_randomLoop_Word64(uintptr_t*, uintptr_t**, size_t len);
-#endif
-
-#ifdef HAS_WORD_128
-    /**
-     * @brief Mimics the randomRead_Word128 and randomWrite_Word128 functions except for the memory accesses.
-     * @param len The number of pointers to deference in a chain-like fashion.
-     * @returns Undefined.
-     */
-    int32_t dummy_randomLoop_Word128(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
-#endif
-
-#ifdef HAS_WORD_256
-    /**
-     * @brief Mimics the randomRead_Word256 and randomWrite_Word256 functions except for the memory accesses.
-     * @param len The number of pointers to deference in a chain-like fashion.
-     * @returns Undefined.
-     */
-    int32_t dummy_randomLoop_Word256(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
-#endif
-
-#ifdef HAS_WORD_512
-    /**
-     * @brief Mimics the randomRead_Word512 and randomWrite_Word512 functions except for the memory accesses.
-     * @param len The number of pointers to deference in a chain-like fashion.
-     * @returns Undefined.
-     */
-    int32_t dummy_randomLoop_Word512(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
-#endif
-
-    /* ------------------------------------------------------------------------- */
-    /* --------------------- CORE BENCHMARK ROUTINES --------------------------- */
-    /* ------------------------------------------------------------------------- */
-
-    /* ------------ SEQUENTIAL READ --------------*/
-
-    /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 32-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialRead_Word32(void* start_address, void* end_address);
-
-#ifdef HAS_WORD_64
-    /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 64-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialRead_Word64(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_128
-    /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 128-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialRead_Word128(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_256
-    /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 256-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialRead_Word256(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_512
-    /**
-     * @brief Walks over the allocated memory forward sequentially, reading in 512-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialRead_Word512(void* start_address, void* end_address);
-#endif
-
-    /**
-     * @brief Walks over the allocated memory reverse sequentially, reading in 32-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revSequentialRead_Word32(void* start_address, void* end_address);
-
-#ifdef HAS_WORD_64
-    /**
-     * @brief Walks over the allocated memory reverse sequentially, reading in 64-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revSequentialRead_Word64(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_128
-    /**
-     * @brief Walks over the allocated memory reverse sequentially, reading in 128-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revSequentialRead_Word128(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_256
-    /**
-     * @brief Walks over the allocated memory reverse sequentially, reading in 256-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revSequentialRead_Word256(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_512
-    /**
-     * @brief Walks over the allocated memory reverse sequentially, reading in 512-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revSequentialRead_Word512(void* start_address, void* end_address);
-#endif
-
-    /* ------------ SEQUENTIAL WRITE --------------*/
-
-    /**
-     * @brief Walks over the allocated memory forward sequentially, writing in 32-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialWrite_Word32(void* start_address, void* end_address);
-
-#ifdef HAS_WORD_64
-    /**
-     * @brief Walks over the allocated memory forward sequentially, writing in 64-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialWrite_Word64(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_128
-    /**
-     * @brief Walks over the allocated memory forward sequentially, writing in 128-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialWrite_Word128(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_256
-    /**
-     * @brief Walks over the allocated memory forward sequentially, writing in 256-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialWrite_Word256(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_512
-    /**
-     * @brief Walks over the allocated memory forward sequentially, writing in 512-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwSequentialWrite_Word512(void* start_address, void* end_address);
-#endif
-
-    /**
-     * @brief Walks over the allocated memory reverse sequentially, writing in 32-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revSequentialWrite_Word32(void* start_address, void* end_address);
-
-#ifdef HAS_WORD_64
-    /**
-     * @brief Walks over the allocated memory reverse sequentially, writing in 64-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revSequentialWrite_Word64(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_128
-    /**
-     * @brief Walks over the allocated memory reverse sequentially, writing in 128-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revSequentialWrite_Word128(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_256
-    /**
-     * @brief Walks over the allocated memory reverse sequentially, writing in 256-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revSequentialWrite_Word256(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_512
-    /**
-     * @brief Walks over the allocated memory reverse sequentially, writing in 512-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revSequentialWrite_Word512(void* start_address, void* end_address);
-#endif
-    
-    /* ------------ STRIDE 2 READ --------------*/
-
-    /**
-     * @brief Walks over the allocated memory in forward strides of size 2, reading in 32-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwStride2Read_Word32(void* start_address, void* end_address);
-
-#ifdef HAS_WORD_64
-    /**
-     * @brief Walks over the allocated memory in forward strides of size 2, reading in 64-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwStride2Read_Word64(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_128
-    /**
-     * @brief Walks over the allocated memory in forward strides of size 2, reading in 128-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwStride2Read_Word128(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_256
-    /**
-     * @brief Walks over the allocated memory in forward strides of size 2, reading in 256-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwStride2Read_Word256(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_512
-    /**
-     * @brief Walks over the allocated memory in forward strides of size 2, reading in 512-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwStride2Read_Word512(void* start_address, void* end_address);
-#endif
-
-    /**
-     * @brief Walks over the allocated memory in reverse strides of size 2, reading in 32-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revStride2Read_Word32(void* start_address, void* end_address);
-
-#ifdef HAS_WORD_64
-    /**
-     * @brief Walks over the allocated memory in reverse strides of size 2, reading in 64-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revStride2Read_Word64(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_128
-    /**
-     * @brief Walks over the allocated memory in reverse strides of size 2, reading in 128-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revStride2Read_Word128(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_256
-    /**
-     * @brief Walks over the allocated memory in reverse strides of size 2, reading in 256-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revStride2Read_Word256(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_512
-    /**
-     * @brief Walks over the allocated memory in reverse strides of size 2, reading in 512-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revStride2Read_Word512(void* start_address, void* end_address);
-#endif
-
-    /* ------------ STRIDE 2 WRITE --------------*/
-
-    /**
-     * @brief Walks over the allocated memory in forward strides of size 2, writing in 32-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwStride2Write_Word32(void* start_address, void* end_address);
-
-#ifdef HAS_WORD_64
-    /**
-     * @brief Walks over the allocated memory in forward strides of size 2, writing in 64-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwStride2Write_Word64(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_128
-    /**
-     * @brief Walks over the allocated memory in forward strides of size 2, writing in 128-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwStride2Write_Word128(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_256
-    /**
-     * @brief Walks over the allocated memory in forward strides of size 2, writing in 256-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwStride2Write_Word256(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_512
-    /**
-     * @brief Walks over the allocated memory in forward strides of size 2, writing in 512-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwStride2Write_Word512(void* start_address, void* end_address);
-#endif
-
-    /**
-     * @brief Walks over the allocated memory in reverse strides of size 2, writing in 32-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revStride2Write_Word32(void* start_address, void* end_address);
-
-#ifdef HAS_WORD_64
-    /**
-     * @brief Walks over the allocated memory in reverse strides of size 2, writing in 64-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revStride2Write_Word64(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_128
-    /**
-     * @brief Walks over the allocated memory in reverse strides of size 2, writing in 128-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revStride2Write_Word128(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_256
-    /**
-     * @brief Walks over the allocated memory in reverse strides of size 2, writing in 256-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revStride2Write_Word256(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_512
-    /**
-     * @brief Walks over the allocated memory in reverse strides of size 2, writing in 512-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revStride2Write_Word512(void* start_address, void* end_address);
-#endif
-
-    /* ------------ STRIDE 4 READ --------------*/
-
-    /**
-     * @brief Walks over the allocated memory in forward strides of size 4, reading in 32-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwStride4Read_Word32(void* start_address, void* end_address);
-
-#ifdef HAS_WORD_64
-    /**
-     * @brief Walks over the allocated memory in forward strides of size 4, reading in 64-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwStride4Read_Word64(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_128
-    /**
-     * @brief Walks over the allocated memory in forward strides of size 4, reading in 128-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwStride4Read_Word128(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_256
-    /**
-     * @brief Walks over the allocated memory in forward strides of size 4, reading in 256-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwStride4Read_Word256(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_512
-    /**
-     * @brief Walks over the allocated memory in forward strides of size 4, reading in 512-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwStride4Read_Word512(void* start_address, void* end_address);
-#endif
-
-    /**
-     * @brief Walks over the allocated memory in reverse strides of size 4, reading in 32-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revStride4Read_Word32(void* start_address, void* end_address);
-
-#ifdef HAS_WORD_64
-    /**
-     * @brief Walks over the allocated memory in reverse strides of size 4, reading in 64-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revStride4Read_Word64(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_128
-    /**
-     * @brief Walks over the allocated memory in reverse strides of size 4, reading in 128-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revStride4Read_Word128(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_256
-    /**
-     * @brief Walks over the allocated memory in reverse strides of size 4, reading in 256-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revStride4Read_Word256(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_512
-    /**
-     * @brief Walks over the allocated memory in reverse strides of size 4, reading in 512-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revStride4Read_Word512(void* start_address, void* end_address);
-#endif
-
-    /* ------------ STRIDE 4 WRITE --------------*/
-
-    /**
-     * @brief Walks over the allocated memory in forward strides of size 4, writing in 32-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwStride4Write_Word32(void* start_address, void* end_address);
-
-#ifdef HAS_WORD_64
-    /**
-     * @brief Walks over the allocated memory in forward strides of size 4, writing in 64-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwStride4Write_Word64(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_128
-    /**
-     * @brief Walks over the allocated memory in forward strides of size 4, writing in 128-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwStride4Write_Word128(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_256
-    /**
-     * @brief Walks over the allocated memory in forward strides of size 4, writing in 256-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwStride4Write_Word256(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_512
-    /**
-     * @brief Walks over the allocated memory in forward strides of size 4, writing in 512-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwStride4Write_Word512(void* start_address, void* end_address);
-#endif
-
-    /**
-     * @brief Walks over the allocated memory in reverse strides of size 4, writing in 32-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revStride4Write_Word32(void* start_address, void* end_address);
-
-#ifdef HAS_WORD_64
-    /**
-     * @brief Walks over the allocated memory in reverse strides of size 4, writing in 64-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revStride4Write_Word64(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_128
-    /**
-     * @brief Walks over the allocated memory in reverse strides of size 4, writing in 128-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revStride4Write_Word128(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_256
-    /**
-     * @brief Walks over the allocated memory in reverse strides of size 4, writing in 256-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revStride4Write_Word256(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_512
-    /**
-     * @brief Walks over the allocated memory in reverse strides of size 4, writing in 512-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revStride4Write_Word512(void* start_address, void* end_address);
-#endif
-
-    /* ------------ STRIDE 8 READ --------------*/
-
-    /**
-     * @brief Walks over the allocated memory in forward strides of size 8, reading in 32-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwStride8Read_Word32(void* start_address, void* end_address);
-
-#ifdef HAS_WORD_64
-    /**
-     * @brief Walks over the allocated memory in forward strides of size 8, reading in 64-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwStride8Read_Word64(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_128
-    /**
-     * @brief Walks over the allocated memory in forward strides of size 8, reading in 128-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwStride8Read_Word128(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_256
-    /**
-     * @brief Walks over the allocated memory in forward strides of size 8, reading in 256-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwStride8Read_Word256(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_512
-    /**
-     * @brief Walks over the allocated memory in forward strides of size 8, reading in 512-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwStride8Read_Word512(void* start_address, void* end_address);
-#endif
-
-    /**
-     * @brief Walks over the allocated memory in reverse strides of size 8, reading in 32-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revStride8Read_Word32(void* start_address, void* end_address);
-
-#ifdef HAS_WORD_64
-    /**
-     * @brief Walks over the allocated memory in reverse strides of size 8, reading in 64-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revStride8Read_Word64(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_128
-    /**
-     * @brief Walks over the allocated memory in reverse strides of size 8, reading in 128-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revStride8Read_Word128(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_256
-    /**
-     * @brief Walks over the allocated memory in reverse strides of size 8, reading in 256-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revStride8Read_Word256(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_512
-    /**
-     * @brief Walks over the allocated memory in reverse strides of size 8, reading in 512-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revStride8Read_Word512(void* start_address, void* end_address);
-#endif
-
-    /* ------------ STRIDE 8 WRITE --------------*/
-
-    /**
-     * @brief Walks over the allocated memory in forward strides of size 8, writing in 32-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     */
-    int32_t forwStride8Write_Word32(void* start_address, void* end_address);
-
-#ifdef HAS_WORD_64
-    /**
-     * @brief Walks over the allocated memory in forward strides of size 8, writing in 64-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwStride8Write_Word64(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_128
-    /**
-     * @brief Walks over the allocated memory in forward strides of size 8, writing in 128-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwStride8Write_Word128(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_256
-    /**
-     * @brief Walks over the allocated memory in forward strides of size 8, writing in 256-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwStride8Write_Word256(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_512
-    /**
-     * @brief Walks over the allocated memory in forward strides of size 8, writing in 512-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwStride8Write_Word512(void* start_address, void* end_address);
-#endif
-
-    /**
-     * @brief Walks over the allocated memory in reverse strides of size 8, writing in 32-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revStride8Write_Word32(void* start_address, void* end_address);
-
-#ifdef HAS_WORD_64
-    /**
-     * @brief Walks over the allocated memory in reverse strides of size 8, writing in 64-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revStride8Write_Word64(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_128
-    /**
-     * @brief Walks over the allocated memory in reverse strides of size 8, writing in 128-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revStride8Write_Word128(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_256
-    /**
-     * @brief Walks over the allocated memory in reverse strides of size 8, writing in 256-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revStride8Write_Word256(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_512
-    /**
-     * @brief Walks over the allocated memory in reverse strides of size 8, writing in 512-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revStride8Write_Word512(void* start_address, void* end_address);
-#endif
-
-    /* ------------ STRIDE 16 READ --------------*/
-
-    /**
-     * @brief Walks over the allocated memory in forward strides of size 16, reading in 32-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwStride16Read_Word32(void* start_address, void* end_address);
-
-#ifdef HAS_WORD_64
-    /**
-     * @brief Walks over the allocated memory in forward strides of size 16, reading in 64-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwStride16Read_Word64(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_128
-    /**
-     * @brief Walks over the allocated memory in forward strides of size 16, reading in 128-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwStride16Read_Word128(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_256
-    /**
-     * @brief Walks over the allocated memory in forward strides of size 16, reading in 256-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwStride16Read_Word256(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_512
-    /**
-     * @brief Walks over the allocated memory in forward strides of size 16, reading in 512-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwStride16Read_Word512(void* start_address, void* end_address);
-#endif
-
-    /**
-     * @brief Walks over the allocated memory in reverse strides of size 16, reading in 32-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revStride16Read_Word32(void* start_address, void* end_address);
-
-#ifdef HAS_WORD_64
-    /**
-     * @brief Walks over the allocated memory in reverse strides of size 16, reading in 64-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revStride16Read_Word64(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_128
-    /**
-     * @brief Walks over the allocated memory in reverse strides of size 16, reading in 128-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revStride16Read_Word128(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_256
-    /**
-     * @brief Walks over the allocated memory in reverse strides of size 16, reading in 256-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revStride16Read_Word256(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_512
-    /**
-     * @brief Walks over the allocated memory in reverse strides of size 16, reading in 512-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revStride16Read_Word512(void* start_address, void* end_address);
-#endif
-
-    /* ------------ STRIDE 16 WRITE --------------*/
-
-    /**
-     * @brief Walks over the allocated memory in forward strides of size 16, writing in 32-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwStride16Write_Word32(void* start_address, void* end_address);
-
-#ifdef HAS_WORD_64
-    /**
-     * @brief Walks over the allocated memory in forward strides of size 16, writing in 64-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwStride16Write_Word64(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_128
-    /**
-     * @brief Walks over the allocated memory in forward strides of size 16, writing in 128-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwStride16Write_Word128(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_256
-    /**
-     * @brief Walks over the allocated memory in forward strides of size 16, writing in 256-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwStride16Write_Word256(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_512
-    /**
-     * @brief Walks over the allocated memory in forward strides of size 16, writing in 512-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t forwStride16Write_Word512(void* start_address, void* end_address);
-#endif
-
-    /**
-     * @brief Walks over the allocated memory in reverse strides of size 16, writing in 32-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revStride16Write_Word32(void* start_address, void* end_address);
-
-#ifdef HAS_WORD_64
-    /**
-     * @brief Walks over the allocated memory in reverse strides of size 16, writing in 64-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revStride16Write_Word64(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_128
-    /**
-     * @brief Walks over the allocated memory in reverse strides of size 16, writing in 128-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     */
-    int32_t revStride16Write_Word128(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_256
-    /**
-     * @brief Walks over the allocated memory in reverse strides of size 16, writing in 256-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revStride16Write_Word256(void* start_address, void* end_address);
-#endif
-
-#ifdef HAS_WORD_512
-    /**
-     * @brief Walks over the allocated memory in reverse strides of size 16, writing in 512-bit chunks.
-     * @param start_address The beginning of the memory region of interest.
-     * @param end_address The end of the memory region of interest.
-     * @returns Undefined.
-     */
-    int32_t revStride16Write_Word512(void* start_address, void* end_address);
-#endif
-
-    /* ------------ RANDOM READ --------------*/
-
-#ifndef HAS_WORD_64
-    /**
-     * @brief Walks over the allocated memory in random order by chasing 64-bit pointers.
-     * @param first_address Starting address to deference.
-     * @param last_touched_address The last visited address.
-     * @param len The number of pointers to deference in a chain-like fashion.
-     * @returns Undefined.
-     */
-    int32_t randomRead_Word32(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
-#endif
-
-    //32-bit systems only.
-#ifdef HAS_WORD_64
-    /**
-     * @brief Walks over the allocated memory in random order by chasing 32-bit pointers.
-     * @param first_address Starting address to deference.
-     * @param last_touched_address The last visited address.
-     * @param len The number of pointers to deference in a chain-like fashion.
-     * @returns Undefined.
-     */
-    int32_t randomRead_Word64(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
-#endif
-
-#ifdef HAS_WORD_128
-    /**
-     * @brief Walks over the allocated memory in random order by chasing 64-bit pointers embedded in 128-bit memory words.
-     * @param first_address Starting address to deference.
-     * @param last_touched_address The last visited address.
-     * @param len The number of pointers to deference in a chain-like fashion.
-     * @returns Undefined.
-     */
-    int32_t randomRead_Word128(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
-#endif
-
-#ifdef HAS_WORD_256
-    /**
-     * @brief Walks over the allocated memory in random order by chasing 64-bit pointers embedded in 256-bit memory words.
-     * @param first_address Starting address to deference.
-     * @param last_touched_address The last visited address.
-     * @param len The number of pointers to deference in a chain-like fashion.
-     * @returns Undefined.
-     */
-    int32_t randomRead_Word256(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
-#endif
-
-#ifdef HAS_WORD_512
-    /**
-     * @brief Walks over the allocated memory in random order by chasing 64-bit pointers embedded in 512-bit memory words.
-     * @param first_address Starting address to deference.
-     * @param last_touched_address The last visited address.
-     * @param len The number of pointers to deference in a chain-like fashion.
-     * @returns Undefined.
-     */
-    int32_t randomRead_Word512(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
-#endif
-
-    /* ------------ RANDOM WRITE --------------*/
-
-    //32-bit machines only
-#ifndef HAS_WORD_64
-    /**
-     * @brief Walks over the allocated memory in random order by chasing 32-bit pointers. A pointer is read and written back with the same value before chasing to the next pointer. Thus, each memory address is a read followed by immediate write operation. 
-     * @param first_address Starting address to deference.
-     * @param last_touched_address The last visited address.
-     * @param len The number of pointers to deference in a chain-like fashion.
-     * @returns Undefined.
-     */
-    int32_t randomWrite_Word32(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
-#endif
-
-#ifdef HAS_WORD_64
-    /**
-     * @brief Walks over the allocated memory in random order by chasing 64-bit pointers. A pointer is read and written back with the same value before chasing to the next pointer. Thus, each memory address is a read followed by immediate write operation. 
-     * @param first_address Starting address to deference.
-     * @param last_touched_address The last visited address.
-     * @param len The number of pointers to deference in a chain-like fashion.
-     * @returns Undefined.
-     */
-    int32_t randomWrite_Word64(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
-#endif
-
-#ifdef HAS_WORD_128
-    /**
-     * @brief Walks over the allocated memory in random order by chasing 64-bit pointers embedded within 128-bit words. A 128-bit word is read and written back with the same value before chasing to the next location extracted as a 64-bit address in the 128-bit word. Thus, each memory address is a read followed by immediate write operation as well as a vector word extraction. 
-     * @param first_address Starting address to deference.
-     * @param last_touched_address The last visited address.
-     * @param len The number of pointers to deference in a chain-like fashion.
-     * @returns Undefined.
-     */
-    int32_t randomWrite_Word128(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
-#endif
-
-#ifdef HAS_WORD_256
-    /**
-     * @brief Walks over the allocated memory in random order by chasing 64-bit pointers embedded within 256-bit words. A 256-bit word is read and written back with the same value before chasing to the next location extracted as a 64-bit address in the 256-bit word. Thus, each memory address is a read followed by immediate write operation as well as a vector word extraction. 
-     * @param first_address Starting address to deference.
-     * @param last_touched_address The last visited address.
-     * @param len The number of pointers to deference in a chain-like fashion.
-     * @returns Undefined.
-     */
-    int32_t randomWrite_Word256(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
-#endif
-
-#ifdef HAS_WORD_512
-    /**
-     * @brief Walks over the allocated memory in random order by chasing 64-bit pointers embedded within 512-bit words. A 512-bit word is read and written back with the same value before chasing to the next location extracted as a 64-bit address in the 512-bit word. Thus, each memory address is a read followed by immediate write operation as well as a vector word extraction. 
-     * @param first_address Starting address to deference.
-     * @param last_touched_address The last visited address.
-     * @param len The number of pointers to deference in a chain-like fashion.
-     * @returns Undefined.
-     */
-    int32_t randomWrite_Word512(uintptr_t* first_address, uintptr_t** last_touched_address, size_t len);
-#endif
+    int32_t contentionIncrement(void* target, uintptr_t* value);
 };
 
 #endif
@@ -32,8 +32,6 @@
 #ifndef COMMON_H
 #define COMMON_H
 
-#define DEV_FROM_MEDIAN 0.05 // deviation of CI range from the median value
-
 //Libraries
 #include <cstdint>
 #include <cstddef>
@@ -176,7 +174,7 @@ namespace xmem {
 #define ARCH_INTEL_AVX2
 #endif
 
-#ifdef __AVX512__ //Intel AVX-512 extensions
+#ifdef __AVX512F__ //Intel AVX-512 Foundation extensions
 #define ARCH_INTEL
 #define ARCH_INTEL_AVX512
 #endif
@@ -250,6 +248,10 @@ namespace xmem {
 #define DEFAULT_PAGE_SIZE 4*KB /**< Default platform page size in bytes. This generally should not be relied on, but is a failsafe. */
 #define DEFAULT_LARGE_PAGE_SIZE 2*MB /**< Default platform large page size in bytes. This generally should not be relied on, but is a failsafe. */
 #define DEFAULT_WORKING_SET_SIZE_PER_THREAD DEFAULT_PAGE_SIZE /**< Default working set size in bytes. */
+#define DEFAULT_CACHE_LINE_SIZE 64 /**< Cache line size in bytes assumed when building line-granular pointer chains. */
+#define DEFAULT_RANDOM_SEED 0x5EEDULL /**< Default seed for random pointer chains, so that random-access results are reproducible across runs. */
+#define DEFAULT_CHAIN_GRANULARITY CHAIN_CACHE_LINE /**< Default node spacing of the pointer chains walked by latency measurement threads. */
+#define DEFAULT_PREFETCH_HINT PREFETCH_T0 /**< Default locality hint of software prefetches issued by the prefetching kernels. */
 #define DEFAULT_NUM_WORKER_THREADS 1 /**< Default number of worker threads to use. */
 #define DEFAULT_NUM_NODES 0 /**< Default number of NUMA nodes. */
 #define DEFAULT_NUM_PHYSICAL_PACKAGES 0 /**< Default number of physical packages. */
@@ -295,19 +297,51 @@ namespace xmem {
 *   In some cases, such as chunk size, stride size, etc. for throughput benchmarks, all combinations of the options will be used! This might dramatically increase runtime.
 */
 
-//Which timer to use in the benchmarks. Only one may be selected!
+//Which timer to use in the benchmarks by default. Only one may be selected! The timer can also be chosen at runtime with the --timer option.
 #define USE_OS_TIMER /**< RECOMMENDED ENABLED. If enabled, uses the QPC timer on Windows and the POSIX clock_gettime() on GNU/Linux for all timing purposes. */
 //#define USE_HW_TIMER /**< RECOMMENDED DISABLED. If enabled, uses the platform-specific hardware timer (e.g., TSC on Intel x86-64). This may be less portable or have other implementation-specific quirks but for most purposes should work fine. */
 
-#define BENCHMARK_DURATION_MS 1000 /**< RECOMMENDED VALUE: At least 250. Number of milliseconds to run in each benchmark. */
+#define TIMER_CALIBRATION_MS 20 /**< RECOMMENDED VALUE: 20. Number of milliseconds over which hardware timers are calibrated against the raw monotonic OS clock at startup. */
+#define TIMER_OVERHEAD_SAMPLES 1000 /**< RECOMMENDED VALUE: 1000. Number of back-to-back timer reads used to estimate the timer overhead and resolution at startup. */
+
+#define BENCHMARK_DURATION_MS 1000 /**< RECOMMENDED VALUE: At least 250. Maximum number of milliseconds to run in each benchmark iteration. Iterations end earlier once their samples have converged. */
+#define DEFAULT_SAMPLE_DURATION_MS 20 /**< RECOMMENDED VALUE: 20. Default number of milliseconds per short sample within a benchmark iteration. This must not exceed BENCHMARK_DURATION_MS. Can be changed at runtime with the --sample_ms option. */
+#define DEFAULT_CI_WIDTH 0.05 /**< RECOMMENDED VALUE: 0.05. Default maximum relative distance of the 95% confidence interval bounds from the median at which sampling stops. Can be changed at runtime with the --ci_width option. */
 #define THROUGHPUT_BENCHMARK_BYTES_PER_PASS 4096 /**< RECOMMENDED VALUE: 4096. Number of bytes read or written per pass of any ThroughputBenchmark. This must be less than or equal to the minimum working set size, which is currently 4 KB. */
+#define KERNEL_BATCH_SIZE 4096 /**< RECOMMENDED VALUE: 4096. Number of bytes spanned by one fully unrolled batch of a sequential or strided kernel. Strides are instantiated up to this many bytes per access, so the largest stride for each chunk size is one page. Larger values grow the code size of every kernel. */
+
+#define JIT_KERNEL_CODE_BUDGET 16384 /**< RECOMMENDED VALUE: 16384. Approximate number of bytes of machine code in the unrolled loop body of a kernel generated at run time. Kernels with long delays are unrolled less to stay within this budget. */
+
+#define LOADED_LATENCY_WARMUP_MS 100 /**< RECOMMENDED VALUE: 100. In loaded latency benchmarks, number of milliseconds the load threads run before the latency measurement window opens, so that the load is at steady state. */
+#define LOADED_LATENCY_MIN_OVERLAP 0.99 /**< RECOMMENDED VALUE: 0.99. Minimum fraction of the latency measurement window that every load thread must cover. Iterations with less overlap are rejected and run again, up to LOADED_LATENCY_MAX_REJECTED_ITERATIONS times per benchmark, after which they are kept and flagged with a warning. */
+#define LOADED_LATENCY_MAX_REJECTED_ITERATIONS 10 /**< RECOMMENDED VALUE: 10. Largest number of loaded latency iterations that are rejected for poor load overlap and run again in one benchmark. This bounds the run time on systems where the load threads cannot keep up. */
+
+#define PREFETCH_SWEEP_MAX_DISTANCE 64 /**< RECOMMENDED VALUE: 64. Largest software prefetch distance in cache lines tried by the prefetch sweep. Distances are swept in powers of two starting from 1, plus a baseline without software prefetch. */
+
+#define MLP_SWEEP_MAX_CHAINS 32 /**< RECOMMENDED VALUE: 32. Largest number of independent pointer chains chased at once by a single thread in the memory-level parallelism sweep. Chain counts are swept in powers of two starting from 1. */
+
+#define CONTENTION_BENCHMARK_OPS_PER_PASS 256 /**< RECOMMENDED VALUE: 256. Number of operations on the shared target made by each call of a contention kernel. */
+#define FALSE_SHARING_TOLERANCE 0.05 /**< RECOMMENDED VALUE: 0.05. In the false sharing benchmarks, the smallest spacing whose aggregate update rate is within this fraction of the rate at the widest spacing is suggested as padding. */
+#define CORE_TO_CORE_ROUND_TRIPS_PER_PASS 32 /**< RECOMMENDED VALUE: 32. Number of ping-pong round trips timed together in the core-to-core latency matrix. Each pass is one point of the per-pair latency distribution, so fewer round trips give sharper tails at the cost of more timer overhead per round trip. */
+#define PRODUCER_CONSUMER_MESSAGES_PER_PASS 256 /**< RECOMMENDED VALUE: 256. Number of cache line messages received per timed pass of the consumer in the producer/consumer benchmarks. */
+#define PRODUCER_CONSUMER_LATENCY_STRIDE 64 /**< RECOMMENDED VALUE: 64. Every this many messages, the producer stamps the message with its send time and the consumer measures its delivery latency. Stamping fewer messages keeps timer overhead out of the transfer bandwidth. This must be a power of two that divides PRODUCER_CONSUMER_MESSAGES_PER_PASS. */
+
+#define DRAM_MAPPING_POOL_SIZE 2048 /**< RECOMMENDED VALUE: 2048. Number of random cache lines sorted into same-bank sets when discovering the DRAM address mapping. The pool must be several times the number of banks in the system so that every set gets enough lines. */
+#define DRAM_MAPPING_ROUNDS 100 /**< RECOMMENDED VALUE: 100. Number of alternating reads of a pair of cache lines that are timed together in the DRAM address mapping benchmark. */
+#define DRAM_MAPPING_REPEATS 3 /**< RECOMMENDED VALUE: 3. Number of times each pair of cache lines is timed in the DRAM address mapping benchmark. The median is used, so that interrupts do not create false row buffer conflicts. */
+#define DRAM_MAPPING_MIN_SET_SIZE 8 /**< RECOMMENDED VALUE: 8. Smallest same-bank set of cache lines used to derive the DRAM bank functions. Small sets do not constrain the functions enough. */
+#define DRAM_MAPPING_MAX_PIVOTS 256 /**< RECOMMENDED VALUE: 256. Largest number of cache lines that the rest of the pool is timed against when sorting it into same-bank sets. This bounds the run time if row buffer conflicts are rare. */
+#define DRAM_MAPPING_MAX_FUNCTION_BITS 6 /**< RECOMMENDED VALUE: 6. Largest number of physical address bits XORed together in one DRAM bank function. The number of candidate functions grows quickly with this value. */
+
+#define POINTER_CHAIN_BLOCK_SIZE MB_256 /**< RECOMMENDED VALUE: 256 MB. Random pointer chains are built in parallel in blocks of this many bytes, which are then stitched into a single cycle. This must be much larger than the last-level cache so that the block structure does not affect measurements. */
+#define PAGE_QUERY_BATCH 4096 /**< RECOMMENDED VALUE: 4096. Number of pages whose placement is queried with each move_pages() call, and whose entries are read from /proc/self/pagemap at a time, when verifying prefaulted memory regions and resolving their physical addresses. */
 
 #define POWER_SAMPLING_PERIOD_MS 1000 /**< RECOMMENDED VALUE: 1000. Sampling period in milliseconds for all power measurement mechanisms. */
 
 //++++++++++++++++++ User-implemented extensions configuration here +++++++++++++++++++++
-//Only one extension may be enabled at a time.
+//Each enabled extension gets its own number for the -e option, in the order listed in ext_t.
 #define EXT_DELAY_INJECTED_LOADED_LATENCY_BENCHMARK /**< RECOMMENDED ENABLED. This allows for a custom extension to X-Mem that performs latency benchmarking with forward sequential 64-bit and 256-bit read-based load threads with variable delays injected in between memory accesses. */
-//#define EXT_STREAM_BENCHMARK /**< RECOMMENDED DISABLED. This allows for a custom extension to X-Mem that performs stream copy, add, and triad kernels similar to those of the well-known STREAM throughput benchmark. */
+#define EXT_STREAM_BENCHMARK /**< RECOMMENDED ENABLED. This allows for a custom extension to X-Mem that performs stream copy, scale, add, and triad kernels similar to those of the well-known STREAM throughput benchmark, with each of the three arrays placed on any NUMA node. */
 
 /***********************************************************************************************************/
 /***********************************************************************************************************/
@@ -316,18 +350,26 @@ namespace xmem {
 
 
 //Compile-time options checks: timers
-#ifdef USE_OS_TIMER
+//The OS timer is always built so that it can be selected at runtime.
 #ifdef _WIN32
 #define USE_QPC_TIMER
 #endif
 #ifdef __gnu_linux__
 #define USE_POSIX_TIMER
 #endif
+
+#ifdef ARCH_INTEL
+#define HAS_TSC_TIMER
+#endif
+
+#ifdef USE_OS_TIMER
+#define DEFAULT_TIMER_BACKEND TIMER_OS
 #endif
 
 #ifdef USE_HW_TIMER
 #ifdef ARCH_INTEL
 #define USE_TSC_TIMER
+#define DEFAULT_TIMER_BACKEND TIMER_TSC
 #endif
 #ifdef ARCH_ARM
 #error TODO: Implement ARM hardware timer.
@@ -342,10 +384,66 @@ namespace xmem {
 #error BENCHMARK_DURATION_MS must be positive!
 #endif
 
+#if DEFAULT_SAMPLE_DURATION_MS <= 0 || DEFAULT_SAMPLE_DURATION_MS > BENCHMARK_DURATION_MS
+#error DEFAULT_SAMPLE_DURATION_MS must be positive and at most BENCHMARK_DURATION_MS!
+#endif
+
+#if PREFETCH_SWEEP_MAX_DISTANCE <= 0
+#error PREFETCH_SWEEP_MAX_DISTANCE must be positive!
+#endif
+
+#if MLP_SWEEP_MAX_CHAINS <= 0 || MLP_SWEEP_MAX_CHAINS > 32 || (MLP_SWEEP_MAX_CHAINS & (MLP_SWEEP_MAX_CHAINS - 1)) != 0
+#error MLP_SWEEP_MAX_CHAINS must be a power of two of at most 32!
+#endif
+
+#if PRODUCER_CONSUMER_LATENCY_STRIDE <= 0 || (PRODUCER_CONSUMER_LATENCY_STRIDE & (PRODUCER_CONSUMER_LATENCY_STRIDE-1)) != 0 || PRODUCER_CONSUMER_MESSAGES_PER_PASS % PRODUCER_CONSUMER_LATENCY_STRIDE != 0
+#error PRODUCER_CONSUMER_LATENCY_STRIDE must be a power of two that divides PRODUCER_CONSUMER_MESSAGES_PER_PASS!
+#endif
+
+#if POINTER_CHAIN_BLOCK_SIZE <= 0
+#error POINTER_CHAIN_BLOCK_SIZE must be positive!
+#endif
+
+#if PAGE_QUERY_BATCH <= 0
+#error PAGE_QUERY_BATCH must be positive!
+#endif
+
+#if DRAM_MAPPING_ROUNDS <= 0 || DRAM_MAPPING_REPEATS <= 0 || DRAM_MAPPING_MAX_PIVOTS <= 0
+#error DRAM_MAPPING_ROUNDS, DRAM_MAPPING_REPEATS and DRAM_MAPPING_MAX_PIVOTS must be positive!
+#endif
+
+#if DRAM_MAPPING_MIN_SET_SIZE < 2 || DRAM_MAPPING_POOL_SIZE < 2 * DRAM_MAPPING_MIN_SET_SIZE
+#error DRAM_MAPPING_MIN_SET_SIZE must be at least 2, and DRAM_MAPPING_POOL_SIZE must hold at least two sets of that size!
+#endif
+
+#if DRAM_MAPPING_MAX_FUNCTION_BITS < 1 || DRAM_MAPPING_MAX_FUNCTION_BITS > 8
+#error DRAM_MAPPING_MAX_FUNCTION_BITS must be between 1 and 8!
+#endif
+
+#if TIMER_CALIBRATION_MS <= 0 || TIMER_OVERHEAD_SAMPLES <= 0
+#error TIMER_CALIBRATION_MS and TIMER_OVERHEAD_SAMPLES must be positive!
+#endif
+
+#if LOADED_LATENCY_WARMUP_MS < 0
+#error LOADED_LATENCY_WARMUP_MS must be non-negative!
+#endif
+
+#if LOADED_LATENCY_MAX_REJECTED_ITERATIONS < 0
+#error LOADED_LATENCY_MAX_REJECTED_ITERATIONS must be non-negative!
+#endif
+
 #if THROUGHPUT_BENCHMARK_BYTES_PER_PASS > DEFAULT_PAGE_SIZE || THROUGHPUT_BENCHMARK_BYTES_PER_PASS <= 0
 #error THROUGHPUT_BENCHMARK_BYTES_PER_PASS must be less than or equal to the minimum possible working set size. It also must be a positive integer.
 #endif
 
+#if KERNEL_BATCH_SIZE < 64 || (KERNEL_BATCH_SIZE & (KERNEL_BATCH_SIZE - 1)) != 0
+#error KERNEL_BATCH_SIZE must be a power of two of at least 64 bytes.
+#endif
+
+#if KERNEL_BATCH_SIZE > THROUGHPUT_BENCHMARK_BYTES_PER_PASS
+#error KERNEL_BATCH_SIZE must not exceed THROUGHPUT_BENCHMARK_BYTES_PER_PASS, or the largest strides would wrap around more than once per access.
+#endif
+
 //Compile-time options checks: power sampling frequency. TODO: this should probably be a runtime option
 #if !defined(POWER_SAMPLING_PERIOD_MS) || POWER_SAMPLING_PERIOD_MS <= 0
 #error POWER_SAMPLING_PERIOD_MS must be defined and greater than 0!
@@ -369,23 +467,84 @@ namespace xmem {
     extern uint32_t g_num_logical_cpus;
     extern uint32_t g_num_physical_packages;
     extern std::vector<uint32_t> g_physical_package_of_cpu;
+    extern std::vector<uint32_t> g_physical_core_of_cpu;
+    extern std::vector<uint32_t> g_l3_cache_of_cpu;
     extern uint32_t g_starting_test_index;
     extern uint32_t g_test_index;
+    /**
+     * @brief Timer backends that can be selected at runtime.
+     */
+    typedef enum {
+        TIMER_OS, /**< QPC on Windows, clock_gettime(CLOCK_MONOTONIC) on GNU/Linux. */
+        TIMER_TSC, /**< TSC read between fully serializing cpuid instructions. */
+        TIMER_INVARIANT_TSC, /**< Invariant TSC read with lfence/rdtscp ordering instead of cpuid. */
+        NUM_TIMER_BACKENDS
+    } timer_backend_t;
+
+    /**
+     * @brief Spacing of the nodes in a random pointer chain.
+     */
+    typedef enum {
+        CHAIN_CHUNK, /**< One node per chunk. Several nodes share each cache line. */
+        CHAIN_CACHE_LINE, /**< One node per cache line. */
+        CHAIN_PAGE, /**< One node per page. */
+        NUM_CHAIN_GRANULARITIES
+    } chain_granularity_t;
+
+    /**
+     * @brief Locality hints of software prefetches.
+     */
+    typedef enum {
+        PREFETCH_T0, /**< Prefetch into all cache levels. */
+        PREFETCH_T1, /**< Prefetch into L2 and below. */
+        PREFETCH_T2, /**< Prefetch into the last-level cache. */
+        PREFETCH_NTA, /**< Prefetch close to the core while minimizing cache pollution. */
+        NUM_PREFETCH_HINTS
+    } prefetch_hint_t;
+
     extern tick_t g_ticks_per_ms;
     extern float g_ns_per_tick;
+    extern timer_backend_t g_timer_backend;
+    extern float g_timer_overhead_ns;
+    extern float g_timer_resolution_ns;
+    extern uint64_t g_random_seed;
+    extern chain_granularity_t g_chain_granularity;
+    extern bool g_chain_random_offsets;
+    extern uint32_t g_sample_duration_ms;
+    extern double g_ci_width;
+    extern prefetch_hint_t g_prefetch_hint;
+    extern uint32_t g_prefetch_distance;
+
+    extern bool g_cpu_has_avx;
+    extern bool g_cpu_has_avx2;
+    extern bool g_cpu_has_avx512f;
+    extern bool g_use_jit_kernels;
+
+    //On x86-64 Linux the 256-bit and 512-bit kernels live in their own translation units built with -mavx and -mavx512f respectively, and are selected at run time by CPUID. Every translation unit must see the same chunk sizes, so they are all enabled here regardless of the global compiler flags.
+#if defined(ARCH_INTEL_X86_64) && defined(__gnu_linux__) && !defined(ARCH_INTEL_MIC)
+#define HAS_ISA_DISPATCH
+#define HAS_JIT_KERNELS //Kernels can be generated as x86-64 machine code at run time
+#define HAS_GATHER_KERNELS //AVX2 and AVX-512F gather/scatter kernels for independent random accesses
+#endif
 
     //Typedef the platform specific stuff to word sizes to match 4 different chunk options
 #if defined(ARCH_64BIT) || defined(ARCH_ARM_NEON)
 #define HAS_WORD_64
 #endif
-#if defined(ARCH_INTEL_AVX) || defined(ARCH_ARM_NEON)
+#if defined(ARCH_INTEL_AVX) || defined(ARCH_ARM_NEON) || defined(HAS_ISA_DISPATCH)
 #define HAS_WORD_128
 #endif
-#ifdef ARCH_INTEL_AVX
+#if defined(ARCH_INTEL_AVX) || defined(HAS_ISA_DISPATCH)
 #define HAS_WORD_256
 #endif
-#if defined(ARCH_INTEL_MIC) || defined(ARCH_INTEL_AVX512)
+#if defined(ARCH_INTEL_MIC) || defined(ARCH_INTEL_AVX512) || defined(HAS_ISA_DISPATCH)
 #define HAS_WORD_512
+#endif
+#if defined(ARCH_INTEL_SSE2) || defined(ARCH_INTEL_X86_64)
+#define HAS_NT_STORES //movnti/movntdq streaming stores
+#endif
+#if defined(ARCH_INTEL_SSE) || defined(ARCH_INTEL_X86_64)
+#define HAS_SW_PREFETCH //prefetcht0/t1/t2/nta
 #endif
 
     typedef uint32_t Word32_t;
@@ -422,7 +581,8 @@ namespace xmem {
      */
     typedef enum {
         SEQUENTIAL,
-        RANDOM,
+        RANDOM, /**< Dependent pointer chasing: each address comes from the previous load, so only one access is in flight per thread. */
+        RANDOM_INDEPENDENT, /**< Independent random accesses whose addresses come from an in-register generator, as in GUPS. Measures random-access bandwidth rather than latency. */
         NUM_PATTERN_MODES
     } pattern_mode_t;
 
@@ -432,9 +592,59 @@ namespace xmem {
     typedef enum {
         READ,
         WRITE,
+        WRITE_NT, /**< Writes with non-temporal (streaming) stores that bypass the caches and avoid read-for-ownership traffic. Sequential and strided patterns only. */
+        READ_WRITE_1_1, /**< Alternates one cache line loaded with one cache line stored (one access per line when the stride skips whole lines). Random patterns alternate hops. */
+        READ_WRITE_2_1, /**< Two cache lines loaded for every one stored. */
+        READ_WRITE_3_1, /**< Three cache lines loaded for every one stored. */
+        READ_MODIFY_WRITE, /**< Loads every chunk and stores it back in place. */
         NUM_RW_MODES
     } rw_mode_t;
 
+    /**
+     * @brief Operations performed on shared cache lines by the contention benchmarks.
+     */
+    typedef enum {
+        CONTENTION_XADD, /**< Atomic fetch-and-add (lock xadd on x86). */
+        CONTENTION_CMPXCHG, /**< Atomic increment by a compare-and-swap retry loop (lock cmpxchg on x86). Failed attempts count as operations too. */
+        CONTENTION_XCHG, /**< Atomic exchange (xchg on x86, which is implicitly locked). */
+        CONTENTION_STORE, /**< Plain store without atomicity or ordering. */
+        CONTENTION_INCREMENT, /**< Plain load, add and store without atomicity, as used for per-thread counters. */
+        NUM_CONTENTION_OPS
+    } contention_op_t;
+
+    /**
+     * @brief How close two logical CPUs are in the cache hierarchy, from closest to farthest.
+     */
+    typedef enum {
+        CPU_PAIR_SMT_SIBLINGS, /**< Hardware threads of the same physical core. */
+        CPU_PAIR_SHARED_L3, /**< Different cores that share an L3 cache. */
+        CPU_PAIR_SAME_PACKAGE, /**< Different L3 caches in the same physical package. */
+        CPU_PAIR_CROSS_PACKAGE, /**< Different physical packages. */
+        NUM_CPU_PAIR_RELATIONS
+    } cpu_pair_relation_t;
+
+    /**
+     * @brief Page sizes that can back the memory regions under test.
+     */
+    typedef enum {
+        PAGE_MODE_DEFAULT, /**< Whatever the OS gives a normal allocation, which may include transparent huge pages. */
+        PAGE_MODE_4KB, /**< Base pages only. Transparent huge pages are disabled for the regions. */
+        PAGE_MODE_THP, /**< Transparent huge pages requested with madvise(MADV_HUGEPAGE) on 2 MB aligned regions. */
+        PAGE_MODE_2MB, /**< Explicit 2 MB huge pages (MAP_HUGETLB | MAP_HUGE_2MB), which must be reserved beforehand. */
+        PAGE_MODE_1GB, /**< Explicit 1 GB huge pages (MAP_HUGETLB | MAP_HUGE_1GB), which must be reserved beforehand. */
+        NUM_PAGE_MODES
+    } page_mode_t;
+
+    /**
+     * @brief Ways to fault in the memory regions under test when they are allocated.
+     */
+    typedef enum {
+        PREFAULT_NONE, /**< Pages are faulted in by the first benchmark that touches them. */
+        PREFAULT_POPULATE, /**< The kernel faults in each region while mapping it (MAP_POPULATE). */
+        PREFAULT_THREADS, /**< Threads pinned to the region's NUMA node touch disjoint slices of it in parallel. */
+        NUM_PREFAULT_MODES
+    } prefault_mode_t;
+
     /**
      * @brief Legal memory read/write chunk sizes in bits.
      */
@@ -490,6 +700,103 @@ namespace xmem {
      */
     void report_timer();
 
+    /**
+     * @brief Gets a printable name for a timer backend.
+     * @param backend The timer backend.
+     * @returns The name of the backend as accepted by the --timer option.
+     */
+    const char* timer_backend_name(timer_backend_t backend);
+
+    /**
+     * @brief Gets a printable name for a pointer chain granularity.
+     * @param granularity The chain granularity.
+     * @returns The name of the granularity as accepted by the --chain_granularity option.
+     */
+    const char* chain_granularity_name(chain_granularity_t granularity);
+
+    /**
+     * @brief Gets a printable name for a software prefetch hint.
+     * @param hint The prefetch hint.
+     * @returns The name of the hint as accepted by the --prefetch_hint option.
+     */
+    const char* prefetch_hint_name(prefetch_hint_t hint);
+
+    /**
+     * @brief Gets a printable read:write ratio for one of the mixed read/write modes.
+     * @param rw_mode The read/write mode.
+     * @returns The ratio as accepted by the --rw_ratio option, or "unknown" if the mode is not a mix.
+     */
+    const char* rw_ratio_name(rw_mode_t rw_mode);
+
+    /**
+     * @brief Gets the number of loads per store of one of the mixed read/write modes.
+     * @param rw_mode The read/write mode.
+     * @returns 1, 2 or 3 for the READ_WRITE_N_1 modes, or 0 for any other mode.
+     */
+    uint32_t rw_mode_reads_per_write(rw_mode_t rw_mode);
+
+    /**
+     * @brief Gets a printable name for one of the contention benchmark operations.
+     * @param op The operation.
+     * @returns The name as printed in results and CSV files, or "unknown".
+     */
+    const char* contention_op_name(contention_op_t op);
+
+    /**
+     * @brief Classifies a pair of different logical CPUs by the closest level of the hierarchy they share, using g_physical_core_of_cpu, g_l3_cache_of_cpu and g_physical_package_of_cpu.
+     * @param cpu_a One logical CPU.
+     * @param cpu_b The other logical CPU.
+     * @returns The relation of the two CPUs. CPUs that are not in the mappings are treated as being in different packages.
+     */
+    cpu_pair_relation_t cpu_pair_relation(uint32_t cpu_a, uint32_t cpu_b);
+
+    /**
+     * @brief Gets a printable name for a CPU pair relation.
+     * @param relation The relation.
+     * @returns The name as printed in results and CSV files, or "unknown".
+     */
+    const char* cpu_pair_relation_name(cpu_pair_relation_t relation);
+
+    /**
+     * @brief Gets a printable name for a page mode.
+     * @param mode The page mode.
+     * @returns The name as accepted by the --page_size option, or "unknown".
+     */
+    const char* page_mode_name(page_mode_t mode);
+
+    /**
+     * @brief Gets the granularity in which a page mode maps memory.
+     * @param mode The page mode.
+     * @returns The page size in bytes. The default and 4 KB modes return g_page_size, and the THP mode returns g_large_page_size.
+     */
+    size_t page_mode_size(page_mode_t mode);
+
+    /**
+     * @brief Gets a printable name for a prefault mode.
+     * @param mode The prefault mode.
+     * @returns The name as accepted by the --prefault option, or "unknown".
+     */
+    const char* prefault_mode_name(prefault_mode_t mode);
+
+    /**
+     * @brief Queries CPUID and the OS-enabled register state (XGETBV) for the vector extensions used by the wide benchmark kernels, and sets g_cpu_has_avx, g_cpu_has_avx2 and g_cpu_has_avx512f.
+     * Without run-time dispatch, the flags simply mirror the compile-time architecture.
+     */
+    void detect_isa_extensions();
+
+    /**
+     * @brief Checks whether the kernels for a chunk size can run on this CPU.
+     * @param chunk_size The chunk size of interest.
+     * @returns True if the chunk size is compiled in and supported by the CPU.
+     */
+    bool chunk_size_supported(chunk_size_t chunk_size);
+
+    /**
+     * @brief Checks whether the CPU has an invariant TSC, i.e., one that ticks at a constant rate regardless of frequency scaling and idle states.
+     * @returns True if the TSC is invariant. Always false on platforms without a TSC.
+     */
+    bool has_invariant_tsc();
+
     /**
      * @brief Checks to see if the calling thread can be locked to all logical CPUs in the system, and reports to the console the progress.
      */
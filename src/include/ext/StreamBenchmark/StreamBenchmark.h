@@ -0,0 +1,148 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ *
+ * @brief Header file for the StreamBenchmark class.
+ */
+
+#ifdef EXT_STREAM_BENCHMARK
+
+#ifndef STREAM_BENCHMARK_H
+#define STREAM_BENCHMARK_H
+
+//Headers
+#include <Benchmark.h>
+#include <common.h>
+#include <stream_benchmark_kernels.h>
+
+//Libraries
+#include <cstdint>
+#include <string>
+
+namespace xmem {
+
+    /**
+     * @brief A type of benchmark that measures memory throughput with the copy, scale, add and triad kernels of the well-known STREAM benchmark.
+     * Unlike ThroughputBenchmark, each worker streams through three arrays at once, and each array may be placed on a different NUMA node.
+     * The arrays are named a, b and c as in STREAM: copy is c = a, scale is b = q*c, add is c = a + b, and triad is a = b + q*c.
+     */
+    class StreamBenchmark : public Benchmark {
+    public:
+
+        /**
+         * @brief Constructor. The access pattern is hard-coded to SEQUENTIAL, read/write pattern to WRITE, and stride to 1. The memory node reported by the base class is that of the destination array.
+         * @param array_a Array a. It is split evenly among the worker threads.
+         * @param array_b Array b.
+         * @param array_c Array c.
+         * @param len Length of each array in bytes.
+         * @param iterations Number of iterations.
+         * @param num_worker_threads Number of worker threads, each working on its own part of the arrays.
+         * @param node_a NUMA node of array a.
+         * @param node_b NUMA node of array b.
+         * @param node_c NUMA node of array c.
+         * @param cpu_node CPU NUMA node to run the worker threads on.
+         * @param kernel The STREAM kernel to run.
+         * @param chunk_size Width of each load and store.
+         * @param dram_power_readers Power measurement objects for DRAM.
+         * @param name Name of the benchmark.
+         */
+        StreamBenchmark(
+            void* array_a,
+            void* array_b,
+            void* array_c,
+            size_t len,
+            uint32_t iterations,
+            uint32_t num_worker_threads,
+            uint32_t node_a,
+            uint32_t node_b,
+            uint32_t node_c,
+            uint32_t cpu_node,
+            stream_kernel_t kernel,
+            chunk_size_t chunk_size,
+            std::vector<PowerReader*> dram_power_readers,
+            std::string name
+        );
+
+        /**
+         * @brief Destructor.
+         */
+        virtual ~StreamBenchmark() {}
+
+        /**
+         * @brief Reports benchmark configuration details to the console.
+         */
+        virtual void reportBenchmarkInfo() const;
+
+        /**
+         * @brief Gets the STREAM kernel this benchmark runs.
+         * @returns The STREAM kernel type.
+         */
+        stream_kernel_t getStreamKernel() const;
+
+        /**
+         * @brief Gets the NUMA node of array a.
+         * @returns The NUMA node.
+         */
+        uint32_t getNodeA() const;
+
+        /**
+         * @brief Gets the NUMA node of array b.
+         * @returns The NUMA node.
+         */
+        uint32_t getNodeB() const;
+
+        /**
+         * @brief Gets the NUMA node of array c.
+         * @returns The NUMA node.
+         */
+        uint32_t getNodeC() const;
+
+    protected:
+        virtual bool runCore();
+
+    private:
+        /**
+         * @brief Maps the kernel onto arrays a, b and c as STREAM does.
+         * @param dst Output. The destination array.
+         * @param src1 Output. The first source array.
+         * @param src2 Output. The second source array. Unused by copy and scale, but still set.
+         */
+        void getKernelArrays(void** dst, void** src1, void** src2) const;
+
+        void* array_a_; /**< Array a. */
+        void* array_b_; /**< Array b. */
+        void* array_c_; /**< Array c. */
+        uint32_t node_a_; /**< NUMA node of array a. */
+        uint32_t node_b_; /**< NUMA node of array b. */
+        uint32_t node_c_; /**< NUMA node of array c. */
+        stream_kernel_t kernel_; /**< The STREAM kernel to run. */
+    };
+};
+
+#endif
+
+#endif
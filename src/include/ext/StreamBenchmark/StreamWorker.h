@@ -0,0 +1,92 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ * 
+ * @brief Header file for the StreamWorker class.
+ */
+
+#ifdef EXT_STREAM_BENCHMARK
+
+#ifndef STREAM_WORKER_H
+#define STREAM_WORKER_H
+
+//Headers
+#include <MemoryWorker.h>
+#include <stream_benchmark_kernels.h>
+
+namespace xmem {
+    /** 
+     * @brief Multithreading-friendly class to run a STREAM kernel over three arrays.
+     */
+    class StreamWorker : public MemoryWorker {
+        public:
+            
+            /** 
+             * @brief Constructor.
+             * @param dst Pointer to this worker's part of the destination array.
+             * @param src1 Pointer to this worker's part of the first source array.
+             * @param src2 Pointer to this worker's part of the second source array.
+             * @param len Length of this worker's part of each array. Must be a multiple of THROUGHPUT_BENCHMARK_BYTES_PER_PASS.
+             * @param num_arrays Number of arrays the kernel touches, for counting bytes per pass.
+             * @param kernel_fptr Pointer to the STREAM kernel to use.
+             * @param kernel_dummy_fptr Pointer to the dummy version of the STREAM kernel to use.
+             * @param cpu_affinity Logical CPU identifier to lock this worker's thread to.
+             */
+            StreamWorker(
+                void* dst,
+                void* src1,
+                void* src2,
+                size_t len,
+                uint32_t num_arrays,
+                StreamFunction kernel_fptr,
+                StreamFunction kernel_dummy_fptr,
+                int32_t cpu_affinity
+            );
+            
+            /**
+             * @brief Destructor.
+             */
+            virtual ~StreamWorker();
+
+            /**
+             * @brief Runs the kernel and its dummy version on the calling thread. Affinity, priority and priming of the destination array are handled by the caller.
+             */
+            virtual void runKernels();
+        
+        private:
+            // ONLY ACCESS OBJECT VARIABLES UNDER THE RUNNABLE OBJECT LOCK!!!!
+            void* src1_; /**< This worker's part of the first source array. The destination array is the memory region of the base class. */
+            void* src2_; /**< This worker's part of the second source array. */
+            uint32_t num_arrays_; /**< Number of arrays the kernel touches. */
+            StreamFunction kernel_fptr_; /**< Points to the STREAM kernel. */
+            StreamFunction kernel_dummy_fptr_; /**< Points to a dummy version of the STREAM kernel. */
+    };
+};
+
+#endif
+
+#endif
@@ -0,0 +1,367 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ * 
+ * @brief Header file for the STREAM-like copy, scale, add and triad benchmark kernels.
+ */
+
+#ifndef __STREAM_BENCHMARK_KERNELS_H
+#define __STREAM_BENCHMARK_KERNELS_H
+
+//Headers
+#include <common.h>
+
+//Libraries
+#include <cstdint>
+#include <cstddef>
+
+#define STREAM_SCALAR 3.0 /**< The scalar q used by the scale and triad kernels, as in the original STREAM benchmark. */
+
+namespace xmem {
+
+    /**
+     * @brief The four STREAM kernels. Each one writes a destination array from one or two source arrays.
+     */
+    typedef enum {
+        STREAM_COPY, /**< dst[i] = src1[i] */
+        STREAM_SCALE, /**< dst[i] = q * src1[i] */
+        STREAM_ADD, /**< dst[i] = src1[i] + src2[i] */
+        STREAM_TRIAD, /**< dst[i] = src1[i] + q * src2[i] */
+        NUM_STREAM_KERNELS
+    } stream_kernel_t;
+
+    /**
+     * @brief A STREAM kernel. Arguments are the destination array, the first and second source arrays, and the number of bytes to process in each array. Kernels that only use one source ignore the second.
+     */
+    typedef int32_t(*StreamFunction)(void*, void*, void*, size_t);
+
+    /**
+     * @brief Determines which STREAM kernel and dummy kernel to use for a kernel type and chunk size. 32-bit chunks operate on single-precision floats and all wider chunks on double-precision floats, one chunk per instruction.
+     * @param kernel The STREAM kernel type.
+     * @param chunk_size Width of each load and store.
+     * @param kernel_function Output. The kernel.
+     * @param dummy_kernel_function Output. The matching dummy kernel for loop overhead subtraction.
+     * @returns True on success. False if the combination is not supported on this build or CPU.
+     */
+    bool determine_stream_kernel(stream_kernel_t kernel, chunk_size_t chunk_size, StreamFunction* kernel_function, StreamFunction* dummy_kernel_function);
+
+    /**
+     * @brief Gets the number of arrays a STREAM kernel touches. Following STREAM, only bytes explicitly read or written are counted, not write-allocate traffic.
+     * @param kernel The STREAM kernel type.
+     * @returns 2 for copy and scale, 3 for add and triad.
+     */
+    uint32_t stream_kernel_arrays(stream_kernel_t kernel);
+
+    /**
+     * @brief Gets the name of a STREAM kernel type.
+     * @param kernel The STREAM kernel type.
+     * @returns "COPY", "SCALE", "ADD", "TRIAD", or "UNKNOWN".
+     */
+    const char* stream_kernel_name(stream_kernel_t kernel);
+
+    /**
+     * @brief Fills an array with one value in the element type the kernels use for a chunk size. Arrays must hold proper floating-point values before the kernels run, since leftover pointer chains would read as denormals and slow the arithmetic down.
+     * @param array The array.
+     * @param len Length of the array in bytes.
+     * @param chunk_size The chunk size the kernels will use. 32-bit chunks use single-precision floats, wider chunks double-precision floats.
+     * @param value The value to fill with.
+     */
+    void stream_init_array(void* array, size_t len, chunk_size_t chunk_size, double value);
+
+    /* -------------------- DUMMY BENCHMARK ROUTINES -------------------------- */
+
+    /**
+     * @brief Used for measuring the time spent doing everything in 32-bit STREAM kernels except for the memory accesses and arithmetic themselves.
+     * @param dst The destination array.
+     * @param src1 The first source array.
+     * @param src2 The second source array.
+     * @param len Bytes to process in each array.
+     * @returns Undefined.
+     */
+    int32_t dummy_streamLoop_Word32(void* dst, void* src1, void* src2, size_t len);
+
+#ifdef HAS_WORD_64
+    /**
+     * @brief Used for measuring the time spent doing everything in 64-bit STREAM kernels except for the memory accesses and arithmetic themselves.
+     * @param dst The destination array.
+     * @param src1 The first source array.
+     * @param src2 The second source array.
+     * @param len Bytes to process in each array.
+     * @returns Undefined.
+     */
+    int32_t dummy_streamLoop_Word64(void* dst, void* src1, void* src2, size_t len);
+#endif
+
+#if defined(HAS_WORD_128) && defined(ARCH_INTEL)
+    /**
+     * @brief Used for measuring the time spent doing everything in 128-bit STREAM kernels except for the memory accesses and arithmetic themselves.
+     * @param dst The destination array.
+     * @param src1 The first source array.
+     * @param src2 The second source array.
+     * @param len Bytes to process in each array.
+     * @returns Undefined.
+     */
+    int32_t dummy_streamLoop_Word128(void* dst, void* src1, void* src2, size_t len);
+#endif
+
+#ifdef HAS_WORD_256
+    /**
+     * @brief Used for measuring the time spent doing everything in 256-bit STREAM kernels except for the memory accesses and arithmetic themselves.
+     * @param dst The destination array.
+     * @param src1 The first source array.
+     * @param src2 The second source array.
+     * @param len Bytes to process in each array.
+     * @returns Undefined.
+     */
+    int32_t dummy_streamLoop_Word256(void* dst, void* src1, void* src2, size_t len);
+#endif
+
+#ifdef HAS_WORD_512
+    /**
+     * @brief Used for measuring the time spent doing everything in 512-bit STREAM kernels except for the memory accesses and arithmetic themselves.
+     * @param dst The destination array.
+     * @param src1 The first source array.
+     * @param src2 The second source array.
+     * @param len Bytes to process in each array.
+     * @returns Undefined.
+     */
+    int32_t dummy_streamLoop_Word512(void* dst, void* src1, void* src2, size_t len);
+#endif
+
+    /* -------------------- CORE BENCHMARK ROUTINES -------------------------- */
+    
+    /**
+     * @brief Copies src1 into dst, 32 bits at a time as single-precision floats.
+     * @param dst The destination array.
+     * @param src1 The first source array.
+     * @param src2 The second source array. Unused.
+     * @param len Bytes to process in each array.
+     * @returns Undefined.
+     */
+    int32_t streamCopy_Word32(void* dst, void* src1, void* src2, size_t len);
+
+    /**
+     * @brief Stores q * src1 into dst, 32 bits at a time as single-precision floats.
+     * @param dst The destination array.
+     * @param src1 The first source array.
+     * @param src2 The second source array. Unused.
+     * @param len Bytes to process in each array.
+     * @returns Undefined.
+     */
+    int32_t streamScale_Word32(void* dst, void* src1, void* src2, size_t len);
+
+    /**
+     * @brief Stores src1 + src2 into dst, 32 bits at a time as single-precision floats.
+     * @param dst The destination array.
+     * @param src1 The first source array.
+     * @param src2 The second source array.
+     * @param len Bytes to process in each array.
+     * @returns Undefined.
+     */
+    int32_t streamAdd_Word32(void* dst, void* src1, void* src2, size_t len);
+
+    /**
+     * @brief Stores src1 + q * src2 into dst, 32 bits at a time as single-precision floats.
+     * @param dst The destination array.
+     * @param src1 The first source array.
+     * @param src2 The second source array.
+     * @param len Bytes to process in each array.
+     * @returns Undefined.
+     */
+    int32_t streamTriad_Word32(void* dst, void* src1, void* src2, size_t len);
+
+#ifdef HAS_WORD_64
+    /**
+     * @brief Copies src1 into dst, 64 bits at a time as double-precision floats.
+     * @param dst The destination array.
+     * @param src1 The first source array.
+     * @param src2 The second source array. Unused.
+     * @param len Bytes to process in each array.
+     * @returns Undefined.
+     */
+    int32_t streamCopy_Word64(void* dst, void* src1, void* src2, size_t len);
+
+    /**
+     * @brief Stores q * src1 into dst, 64 bits at a time as double-precision floats.
+     * @param dst The destination array.
+     * @param src1 The first source array.
+     * @param src2 The second source array. Unused.
+     * @param len Bytes to process in each array.
+     * @returns Undefined.
+     */
+    int32_t streamScale_Word64(void* dst, void* src1, void* src2, size_t len);
+
+    /**
+     * @brief Stores src1 + src2 into dst, 64 bits at a time as double-precision floats.
+     * @param dst The destination array.
+     * @param src1 The first source array.
+     * @param src2 The second source array.
+     * @param len Bytes to process in each array.
+     * @returns Undefined.
+     */
+    int32_t streamAdd_Word64(void* dst, void* src1, void* src2, size_t len);
+
+    /**
+     * @brief Stores src1 + q * src2 into dst, 64 bits at a time as double-precision floats.
+     * @param dst The destination array.
+     * @param src1 The first source array.
+     * @param src2 The second source array.
+     * @param len Bytes to process in each array.
+     * @returns Undefined.
+     */
+    int32_t streamTriad_Word64(void* dst, void* src1, void* src2, size_t len);
+#endif
+
+#if defined(HAS_WORD_128) && defined(ARCH_INTEL)
+    /**
+     * @brief Copies src1 into dst, 128 bits at a time as pairs of double-precision floats.
+     * @param dst The destination array.
+     * @param src1 The first source array.
+     * @param src2 The second source array. Unused.
+     * @param len Bytes to process in each array.
+     * @returns Undefined.
+     */
+    int32_t streamCopy_Word128(void* dst, void* src1, void* src2, size_t len);
+
+    /**
+     * @brief Stores q * src1 into dst, 128 bits at a time as pairs of double-precision floats.
+     * @param dst The destination array.
+     * @param src1 The first source array.
+     * @param src2 The second source array. Unused.
+     * @param len Bytes to process in each array.
+     * @returns Undefined.
+     */
+    int32_t streamScale_Word128(void* dst, void* src1, void* src2, size_t len);
+
+    /**
+     * @brief Stores src1 + src2 into dst, 128 bits at a time as pairs of double-precision floats.
+     * @param dst The destination array.
+     * @param src1 The first source array.
+     * @param src2 The second source array.
+     * @param len Bytes to process in each array.
+     * @returns Undefined.
+     */
+    int32_t streamAdd_Word128(void* dst, void* src1, void* src2, size_t len);
+
+    /**
+     * @brief Stores src1 + q * src2 into dst, 128 bits at a time as pairs of double-precision floats.
+     * @param dst The destination array.
+     * @param src1 The first source array.
+     * @param src2 The second source array.
+     * @param len Bytes to process in each array.
+     * @returns Undefined.
+     */
+    int32_t streamTriad_Word128(void* dst, void* src1, void* src2, size_t len);
+#endif
+
+#ifdef HAS_WORD_256
+    /**
+     * @brief Copies src1 into dst, 256 bits at a time as quadruples of double-precision floats.
+     * @param dst The destination array.
+     * @param src1 The first source array.
+     * @param src2 The second source array. Unused.
+     * @param len Bytes to process in each array.
+     * @returns Undefined.
+     */
+    int32_t streamCopy_Word256(void* dst, void* src1, void* src2, size_t len);
+
+    /**
+     * @brief Stores q * src1 into dst, 256 bits at a time as quadruples of double-precision floats.
+     * @param dst The destination array.
+     * @param src1 The first source array.
+     * @param src2 The second source array. Unused.
+     * @param len Bytes to process in each array.
+     * @returns Undefined.
+     */
+    int32_t streamScale_Word256(void* dst, void* src1, void* src2, size_t len);
+
+    /**
+     * @brief Stores src1 + src2 into dst, 256 bits at a time as quadruples of double-precision floats.
+     * @param dst The destination array.
+     * @param src1 The first source array.
+     * @param src2 The second source array.
+     * @param len Bytes to process in each array.
+     * @returns Undefined.
+     */
+    int32_t streamAdd_Word256(void* dst, void* src1, void* src2, size_t len);
+
+    /**
+     * @brief Stores src1 + q * src2 into dst, 256 bits at a time as quadruples of double-precision floats.
+     * @param dst The destination array.
+     * @param src1 The first source array.
+     * @param src2 The second source array.
+     * @param len Bytes to process in each array.
+     * @returns Undefined.
+     */
+    int32_t streamTriad_Word256(void* dst, void* src1, void* src2, size_t len);
+#endif
+
+#ifdef HAS_WORD_512
+    /**
+     * @brief Copies src1 into dst, 512 bits at a time as octuples of double-precision floats.
+     * @param dst The destination array.
+     * @param src1 The first source array.
+     * @param src2 The second source array. Unused.
+     * @param len Bytes to process in each array.
+     * @returns Undefined.
+     */
+    int32_t streamCopy_Word512(void* dst, void* src1, void* src2, size_t len);
+
+    /**
+     * @brief Stores q * src1 into dst, 512 bits at a time as octuples of double-precision floats.
+     * @param dst The destination array.
+     * @param src1 The first source array.
+     * @param src2 The second source array. Unused.
+     * @param len Bytes to process in each array.
+     * @returns Undefined.
+     */
+    int32_t streamScale_Word512(void* dst, void* src1, void* src2, size_t len);
+
+    /**
+     * @brief Stores src1 + src2 into dst, 512 bits at a time as octuples of double-precision floats.
+     * @param dst The destination array.
+     * @param src1 The first source array.
+     * @param src2 The second source array.
+     * @param len Bytes to process in each array.
+     * @returns Undefined.
+     */
+    int32_t streamAdd_Word512(void* dst, void* src1, void* src2, size_t len);
+
+    /**
+     * @brief Stores src1 + q * src2 into dst, 512 bits at a time as octuples of double-precision floats.
+     * @param dst The destination array.
+     * @param src1 The first source array.
+     * @param src2 The second source array.
+     * @param len Bytes to process in each array.
+     * @returns Undefined.
+     */
+    int32_t streamTriad_Word512(void* dst, void* src1, void* src2, size_t len);
+#endif
+
+};
+
+#endif
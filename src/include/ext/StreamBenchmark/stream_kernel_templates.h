@@ -0,0 +1,187 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ * 
+ * @brief Loop templates shared by the STREAM kernel translation units.
+ *
+ * All STREAM kernels are the same loop over three arrays in fully unrolled batches. Only the vector type and the operation differ, so each translation unit
+ * supplies an arithmetic policy for the vector types its ISA flags allow and instantiates StreamKernel with it. Only the kernel translation units should include this header.
+ */
+
+#ifndef STREAM_KERNEL_TEMPLATES_H
+#define STREAM_KERNEL_TEMPLATES_H
+
+//Headers
+#include <common.h>
+#include <kernel_templates.h>
+#include <stream_benchmark_kernels.h>
+
+//Libraries
+#include <cstdint>
+#include <cstddef>
+
+#define STREAM_KERNEL_UNROLL 8 /**< Chunks per array in each unrolled batch. Pass lengths must be a multiple of this many chunks. */
+
+namespace xmem {
+
+    /**
+     * @brief Arithmetic policy for the 32-bit and 64-bit kernels. Accesses go through volatile pointers so that the compiler cannot vectorize the loop, which would make every chunk size measure the same instructions.
+     * @tparam T float or double.
+     */
+    template <typename T>
+    struct StreamScalarOps {
+        typedef T vec_t;
+        static KERNEL_INLINE vec_t load(const vec_t* p) { return *const_cast<const volatile vec_t*>(p); }
+        static KERNEL_INLINE void store(vec_t* p, vec_t v) { *const_cast<volatile vec_t*>(p) = v; }
+        static KERNEL_INLINE vec_t add(vec_t x, vec_t y) { return x + y; }
+        static KERNEL_INLINE vec_t mul(vec_t x, vec_t y) { return x * y; }
+        static KERNEL_INLINE vec_t set1(double x) { return static_cast<vec_t>(x); }
+    };
+
+    /*
+     * Operations. Each applies one STREAM kernel to one chunk of each array using an arithmetic policy.
+     */
+
+    /**
+     * @brief dst = src1
+     */
+    struct StreamCopyOp {
+        template <typename Ops> static KERNEL_INLINE void apply(typename Ops::vec_t* dst, const typename Ops::vec_t* src1, const typename Ops::vec_t*, typename Ops::vec_t) {
+            Ops::store(dst, Ops::load(src1));
+        }
+    };
+
+    /**
+     * @brief dst = q * src1
+     */
+    struct StreamScaleOp {
+        template <typename Ops> static KERNEL_INLINE void apply(typename Ops::vec_t* dst, const typename Ops::vec_t* src1, const typename Ops::vec_t*, typename Ops::vec_t q) {
+            Ops::store(dst, Ops::mul(q, Ops::load(src1)));
+        }
+    };
+
+    /**
+     * @brief dst = src1 + src2
+     */
+    struct StreamAddOp {
+        template <typename Ops> static KERNEL_INLINE void apply(typename Ops::vec_t* dst, const typename Ops::vec_t* src1, const typename Ops::vec_t* src2, typename Ops::vec_t) {
+            Ops::store(dst, Ops::add(Ops::load(src1), Ops::load(src2)));
+        }
+    };
+
+    /**
+     * @brief dst = src1 + q * src2
+     */
+    struct StreamTriadOp {
+        template <typename Ops> static KERNEL_INLINE void apply(typename Ops::vec_t* dst, const typename Ops::vec_t* src1, const typename Ops::vec_t* src2, typename Ops::vec_t q) {
+            Ops::store(dst, Ops::add(Ops::load(src1), Ops::mul(q, Ops::load(src2))));
+        }
+    };
+
+    /**
+     * @brief The loop shared by all STREAM kernels. Walks the three arrays in lockstep, STREAM_KERNEL_UNROLL chunks per batch.
+     * @tparam Ops The arithmetic policy.
+     * @tparam Op The STREAM operation.
+     */
+    template <typename Ops, typename Op>
+    struct StreamKernel {
+        typedef typename Ops::vec_t vec_t;
+
+        /**
+         * @brief One chunk of each array.
+         */
+        struct Step {
+            vec_t*& dst;
+            const vec_t*& src1;
+            const vec_t*& src2;
+            vec_t q;
+
+            KERNEL_INLINE void operator()() {
+                Op::template apply<Ops>(dst++, src1++, src2++, q);
+            }
+        };
+
+        static int32_t run(void* dst, void* src1, void* src2, size_t len) {
+            vec_t* dstptr = static_cast<vec_t*>(dst);
+            vec_t* endptr = reinterpret_cast<vec_t*>(static_cast<uint8_t*>(dst) + len);
+            const vec_t* src1ptr = static_cast<const vec_t*>(src1);
+            const vec_t* src2ptr = static_cast<const vec_t*>(src2);
+            Step step = { dstptr, src1ptr, src2ptr, Ops::set1(STREAM_SCALAR) };
+
+            while (dstptr < endptr)
+                KernelUnroll<STREAM_KERNEL_UNROLL>::run(step);
+            return 0;
+        }
+    };
+
+    /**
+     * @brief Does everything but the accesses and arithmetic, for measuring loop overhead. The pointer is published once per batch so that the loop is not optimized away.
+     * @tparam ChunkBytes The chunk size in bytes. Vector types are not used as template arguments here since their alignment attributes would be dropped.
+     */
+    template <size_t ChunkBytes>
+    struct StreamDummyKernel {
+        static uint8_t* volatile placeholder;
+
+        static int32_t run(void* dst, void*, void*, size_t len) {
+            uint8_t* dstptr = static_cast<uint8_t*>(dst);
+            uint8_t* endptr = dstptr + len;
+
+            while (dstptr < endptr) {
+                dstptr += STREAM_KERNEL_UNROLL * ChunkBytes;
+                placeholder = dstptr;
+            }
+            return 0;
+        }
+    };
+
+    template <size_t ChunkBytes>
+    uint8_t* volatile StreamDummyKernel<ChunkBytes>::placeholder = NULL;
+};
+
+/**
+ * @brief Defines the dummy and the four STREAM kernels for one chunk size.
+ * @param bits The chunk size in bits, as in the kernel names.
+ * @param ops The arithmetic policy.
+ */
+#define DEFINE_STREAM_KERNELS(bits, ops) \
+    int32_t xmem::dummy_streamLoop_Word##bits(void* dst, void* src1, void* src2, size_t len) { \
+        return StreamDummyKernel<sizeof(ops::vec_t)>::run(dst, src1, src2, len); \
+    } \
+    int32_t xmem::streamCopy_Word##bits(void* dst, void* src1, void* src2, size_t len) { \
+        return StreamKernel<ops, StreamCopyOp>::run(dst, src1, src2, len); \
+    } \
+    int32_t xmem::streamScale_Word##bits(void* dst, void* src1, void* src2, size_t len) { \
+        return StreamKernel<ops, StreamScaleOp>::run(dst, src1, src2, len); \
+    } \
+    int32_t xmem::streamAdd_Word##bits(void* dst, void* src1, void* src2, size_t len) { \
+        return StreamKernel<ops, StreamAddOp>::run(dst, src1, src2, len); \
+    } \
+    int32_t xmem::streamTriad_Word##bits(void* dst, void* src1, void* src2, size_t len) { \
+        return StreamKernel<ops, StreamTriadOp>::run(dst, src1, src2, len); \
+    }
+
+#endif
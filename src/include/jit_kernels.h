@@ -0,0 +1,86 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ * 
+ * @brief Header file for the run-time code generator of x86-64 benchmark kernels.
+ */
+
+#ifndef JIT_KERNELS_H
+#define JIT_KERNELS_H
+
+//Headers
+#include <common.h>
+#include <benchmark_kernels.h>
+
+//Libraries
+#include <cstdint>
+#include <cstddef>
+
+namespace xmem {
+
+#ifdef HAS_JIT_KERNELS
+    /**
+     * @brief Checks whether the code generator can emit a sequential or strided kernel for a chunk size and stride.
+     * Any non-zero stride is supported as long as one stride spans at most KERNEL_BATCH_SIZE bytes.
+     * @param chunk_size Access granularity.
+     * @param stride_size Distance between successive accesses in chunks.
+     * @returns True if the combination is supported.
+     */
+    bool jit_supports_stride(chunk_size_t chunk_size, int32_t stride_size);
+
+    /**
+     * @brief Emits a sequential or strided kernel and its matching dummy into executable memory.
+     * The kernel has the same semantics as the compiled stridedRead(), stridedWrite(), stridedWriteNT() and stridedReadPrefetch() kernels.
+     * Power-of-two strides only check for the end of the region once per unrolled batch, so the region length must be a multiple of the batch span. This always holds for the sequential_pass_span() windows walked by load workers.
+     * The dummy repeats the same loop and pointer arithmetic without the memory accesses, prefetches and delays.
+     * Kernels are cached, so asking for the same combination again returns the same code. This is not thread-safe and should only be called while setting up a benchmark.
+     * @param rw_mode Read/write mode.
+     * @param chunk_size Access granularity.
+     * @param stride_size Distance between successive accesses in chunks.
+     * @param delay Number of nops to insert after every memory access.
+     * @param prefetch If true, the kernel reads and issues one software prefetch per cache line, g_prefetch_distance lines (or strides, if larger) ahead with hint g_prefetch_hint. Both are fixed when the code is generated.
+     * @param kernel_function Function pointer that will be set to the generated kernel.
+     * @param dummy_kernel_function Function pointer that will be set to the generated dummy kernel.
+     * @returns True on success.
+     */
+    bool jit_sequential_kernel(rw_mode_t rw_mode, chunk_size_t chunk_size, int32_t stride_size, uint32_t delay, bool prefetch, SequentialFunction* kernel_function, SequentialFunction* dummy_kernel_function);
+
+    /**
+     * @brief Emits a random-access pointer-chasing kernel and its matching dummy into executable memory.
+     * Only pointer-sized 64-bit chunks are supported. Like randomRead_Word64() and randomWrite_Word64(), the kernel follows len bytes worth of pointers and stores the last one in last_touched_address.
+     * @param rw_mode Read/write mode. Only READ and WRITE are supported.
+     * @param chunk_size Access granularity.
+     * @param delay Number of nops to insert after every memory access.
+     * @param kernel_function Function pointer that will be set to the generated kernel.
+     * @param dummy_kernel_function Function pointer that will be set to the generated dummy kernel.
+     * @returns True on success.
+     */
+    bool jit_random_kernel(rw_mode_t rw_mode, chunk_size_t chunk_size, uint32_t delay, RandomFunction* kernel_function, RandomFunction* dummy_kernel_function);
+#endif
+};
+
+#endif
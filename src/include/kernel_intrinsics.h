@@ -0,0 +1,303 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ * 
+ * @brief Header file for the intrinsic wrappers shared by the benchmark kernel translation units. The 256-bit and 512-bit kernels are compiled separately with wider ISA flags, so these helpers cannot live in any one of them.
+ */
+
+#ifndef KERNEL_INTRINSICS_H
+#define KERNEL_INTRINSICS_H
+
+//Headers
+#include <common.h>
+
+//Libraries
+#include <cstdint>
+#if defined(ARCH_INTEL) && (defined(HAS_WORD_128) || defined(HAS_WORD_256) || defined(HAS_WORD_512)) 
+//Intel intrinsics
+#include <emmintrin.h>
+#include <immintrin.h>
+#include <smmintrin.h>
+#endif
+
+#if defined(ARCH_ARM) && defined(ARCH_ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace xmem {
+
+#if defined(__gnu_linux__) && defined(ARCH_INTEL)
+
+#ifdef HAS_WORD_128
+#define my_32b_set_128b_word(a, b, c, d) _mm_set_epi32(a, b, c, d) //SSE2 intrinsic, corresponds to ??? instruction. Header: emmintrin.h
+#define my_64b_set_128b_word(a, b) _mm_set_epi64x(a, b) //SSE2 intrinsic, corresponds to ??? instruction. Header: emmintrin.h
+#define my_32b_extractLSB_128b(w) _mm_cvtsi128_si32(w) //SSE2 intrinsic, corresponds to "movd" instruction. Header: emmintrin.h
+#define my_64b_extractLSB_128b(w) _mm_cvtsi128_si64(w) //SSE2 intrinsic, corresponds to "movq" instruction. Header: emmintrin.h
+#endif
+
+#ifdef HAS_WORD_256
+#define my_32b_set_256b_word(a, b, c, d, e, f, g, h) _mm256_set_epi32(a, b, c, d, e, f, g, h) //AVX intrinsic, corresponds to ??? (pseudo?) instruction. Header: immintrin.h
+#define my_64b_set_256b_word(a, b, c, d) _mm256_set_epi64x(a, b, c, d) //AVX intrinsic, corresponds to ??? (pseudo?) instruction. Header: immintrin.h
+#define my_32b_extractLSB_256b(w) _mm256_extract_epi32(w, 0) //AVX intrinsic, corresponds to ??? (pseudo?) instruction. Header: immintrin.h
+#define my_64b_extractLSB_256b(w) _mm256_extract_epi64(w, 0) //AVX intrinsic, corresponds to ??? (pseudo?) instruction. Header: immintrin.h
+#endif
+
+
+#if defined(HAS_WORD_512) 
+
+#if !defined(ARCH_INTEL_MIC) //MIC (Knight's Corner) has partial ISA overlap with AVX-512. Neither are subsets of the other. What a headache. Knight's Corner also doesn't support legacy SSE or AVX stuff... agh!!!
+//These take the same arguments as the Knight's Corner hacks below so that the 512-bit kernels are shared. AVX-512F can build and extract words in registers, so the scratch buffer is unused.
+#define my_32b_set_512b_word(ret, scratchptr, a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p) ret = _mm512_set_epi32(a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p); //AVX-512F intrinsic, corresponds to ??? (pseudo?) instruction. Header: immintrin.h
+#define my_64b_set_512b_word(ret, scratchptr, a, b, c, d, e, f, g, h) ret = _mm512_set_epi64(a, b, c, d, e, f, g, h); //AVX-512F intrinsic, corresponds to ??? (pseudo?) instruction. Header: immintrin.h
+#define my_32b_extractLSB_512b(ret, scratchptr, w) ret = my_32b_extractLSB_512b_reg(w);
+#define my_64b_extractLSB_512b(ret, scratchptr, w) ret = my_64b_extractLSB_512b_reg(w);
+//GCC implements _mm512_castsi512_si128() with an uninitialized placeholder vector, which -Wall reports wherever it is inlined. The zero-masked extract of the lowest lane compiles to the same single "vmovq" instruction without it.
+#define my_32b_extractLSB_512b_reg(w) _mm_cvtsi128_si32(_mm512_maskz_extracti32x4_epi32(0xF, w, 0)) //AVX-512F intrinsics, correspond to "vmovd" instruction. Header: immintrin.h
+#define my_64b_extractLSB_512b_reg(w) _mm_cvtsi128_si64(_mm512_maskz_extracti32x4_epi32(0xF, w, 0)) //AVX-512F intrinsics, correspond to "vmovq" instruction. Header: immintrin.h
+#else
+//These are hacks to allow me to set a 512-bit word in Knight's Corner using 32-bit or 64-bit packed components. I store them on the stack one piece at a time, then use a 512-bit vector load to get them into a vector register. What a mess. Is there an easier way??
+#define my_32b_set_512b_word(ret, scratchptr, a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p) \
+scratchptr[0] = a;\
+scratchptr[1] = b;\
+scratchptr[2] = c;\
+scratchptr[3] = d;\
+scratchptr[4] = e;\
+scratchptr[5] = f;\
+scratchptr[6] = g;\
+scratchptr[7] = h;\
+scratchptr[8] = i;\
+scratchptr[9] = j;\
+scratchptr[10] = k;\
+scratchptr[11] = l;\
+scratchptr[12] = m;\
+scratchptr[13] = n;\
+scratchptr[14] = o;\
+scratchptr[15] = p;\
+ret = _mm512_load_epi32(scratchptr);
+
+#define my_64b_set_512b_word(ret, scratchptr, a, b, c, d, e, f, g, h) \
+scratchptr[0] = a;\
+scratchptr[1] = b;\
+scratchptr[2] = c;\
+scratchptr[3] = d;\
+scratchptr[4] = e;\
+scratchptr[5] = f;\
+scratchptr[6] = g;\
+scratchptr[7] = h;\
+ret = _mm512_load_epi64(scratchptr);
+
+#define my_32b_extractLSB_512b(ret, scratchptr, w) \
+_mm512_store_epi32(scratchptr, w);\
+ret = scratchptr[0];
+
+#define my_64b_extractLSB_512b(ret, scratchptr, w) \
+_mm512_store_epi64(scratchptr, w);\
+ret = scratchptr[0];
+
+//Knight's Corner cannot move a vector lane to a general purpose register, so these go through a scratch buffer on the stack
+#define my_32b_extractLSB_512b_reg(w) ({ uint32_t scratch_[16] __attribute__ ((aligned(64))); _mm512_store_epi32(scratch_, w); scratch_[0]; })
+#define my_64b_extractLSB_512b_reg(w) ({ uint64_t scratch_[8] __attribute__ ((aligned(64))); _mm512_store_epi64(scratch_, w); scratch_[0]; })
+
+#endif
+
+#endif
+
+#endif
+
+#if defined(ARCH_ARM) && (defined(ARCH_ARM_NEON) || defined(HAS_WORD_128))
+#define my_32b_set_128b_word(a, b) vcombine_u32(a, b)
+#define my_64b_set_128b_word(a, b) vcombine_u64(a, b)
+
+#define my_32b_extractLSB_128b(w) static_cast<uint32_t>(vget_low_u64(w)) //NEON intrinsic, corresponds to "vmov" instruction. Header: arm_neon.h
+#define my_64b_extractLSB_128b(w) vget_low_u64(w) //NEON intrinsic, corresponds to "vmov" instruction. Header: arm_neon.h
+#endif
+
+#if defined(HAS_WORD_512) && defined(ARCH_INTEL_MIC)
+#define my_512b_load(p) _mm512_load_epi64(p) //This is needed because I get the compiler error 'error: class "__m512i" has no suitable assignment operator' using icc for Knight's Corner Xeon Phi. Also, I cannot use do a load on a volatile piece of memory. So the 512-bit code may not work...
+typedef Word512_t Word512_access_t; //Knight's Corner cannot access __m512i through volatile pointers.
+//FIXME: We flag ICC not to optimize the 512-bit kernels on Knight's Corner. The problem is that my_512b_load() cannot accept volatile* arguments. The only way to prevent the entire benchmark loop from being optimized away is to force the compiler not to optimize the function at all. Unfortunately, this will cause extra unwanted code to be included. The only solution seems to be to write inline assembly.
+#define MIC_NO_OPTIMIZE __attribute__((optimize("O0")))
+#endif
+
+#if defined(HAS_WORD_512) && !defined(ARCH_INTEL_MIC)
+#define my_512b_load(p) (*(p)) //AVX-512F: full 64-byte load through a volatile pointer, corresponds to "vmovdqa64" instruction. The 512-bit kernels are then optimized like all the others.
+typedef volatile Word512_t Word512_access_t;
+#define MIC_NO_OPTIMIZE
+#endif
+
+#ifdef HAS_SW_PREFETCH
+/**
+ * @brief Issues a software prefetch for the cache line containing address. The hint is loop-invariant in every kernel, so the compiler hoists the switch out of the unrolled loops.
+ * @param address Address to prefetch. Prefetches never fault, so it may lie outside the region.
+ * @param hint Which cache level(s) to prefetch into.
+ */
+static inline void my_prefetch(const volatile void* address, prefetch_hint_t hint) {
+    const char* p = static_cast<const char*>(const_cast<const void*>(address));
+    switch (hint) {
+        case PREFETCH_T1:
+            _mm_prefetch(p, _MM_HINT_T1); //SSE intrinsic, corresponds to "prefetcht1" instruction. Header: xmmintrin.h
+            break;
+        case PREFETCH_T2:
+            _mm_prefetch(p, _MM_HINT_T2); //SSE intrinsic, corresponds to "prefetcht2" instruction. Header: xmmintrin.h
+            break;
+        case PREFETCH_NTA:
+            _mm_prefetch(p, _MM_HINT_NTA); //SSE intrinsic, corresponds to "prefetchnta" instruction. Header: xmmintrin.h
+            break;
+        default:
+            _mm_prefetch(p, _MM_HINT_T0); //SSE intrinsic, corresponds to "prefetcht0" instruction. Header: xmmintrin.h
+            break;
+    }
+}
+#endif
+
+#ifdef HAS_NT_STORES
+/**
+ * @brief Writes val to address with a non-temporal (streaming) store that bypasses the caches. Overloaded for every chunk type so that the kernel templates can pick the right instruction.
+ * @param address Address to write. Must be aligned to the chunk size.
+ * @param val Value to write.
+ */
+static inline void my_stream(Word32_t* address, Word32_t val) {
+    _mm_stream_si32(reinterpret_cast<int*>(address), static_cast<int>(val)); //SSE2 intrinsic, corresponds to "movnti" instruction. Header: emmintrin.h
+}
+
+#ifdef HAS_WORD_64
+static inline void my_stream(Word64_t* address, Word64_t val) {
+    _mm_stream_si64(reinterpret_cast<long long*>(address), static_cast<long long>(val)); //SSE2 intrinsic, corresponds to "movnti" instruction. Header: emmintrin.h
+}
+#endif
+
+#ifdef HAS_WORD_128
+static inline void my_stream(Word128_t* address, Word128_t val) {
+    _mm_stream_si128(address, val); //SSE2 intrinsic, corresponds to "movntdq" instruction. Header: emmintrin.h
+}
+#endif
+
+//The wide overloads only exist in the translation units compiled for their ISA
+#if defined(HAS_WORD_256) && (defined(__AVX__) || defined(_WIN32))
+static inline void my_stream(Word256_t* address, Word256_t val) {
+    _mm256_stream_si256(address, val); //AVX intrinsic, corresponds to "vmovntdq" instruction. Header: immintrin.h
+}
+#endif
+
+#if defined(HAS_WORD_512) && (defined(__AVX512F__) || defined(ARCH_INTEL_MIC))
+static inline void my_stream(Word512_t* address, Word512_t val) {
+    _mm512_stream_si512(address, val); //AVX-512F intrinsic, corresponds to "vmovntdq" instruction. Header: immintrin.h
+}
+#endif
+#endif
+
+
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+/* Hand-coded assembly functions for the 128-bit and 256-bit benchmark kernels on Windows x86-64 where applicable.
+ * These are needed because the VC++ compiler, like gcc, optimizes away the vector instructions unless I use the volatile keyword.
+ * But I can't use something like volatile Word256_t* because it is incompatible with _mm_load_si256() with VC++, etc.
+ * Then, an alternative is to use inline assembly for Windows. However, the VC++ compiler does not support inline assembly in x86-64!
+ * The only remaining choice for this unfortunate circumstance is to use hand-coded assembly on Windows x86-64 builds.
+ * In this special case, I implemented the routine as a wrapper around the assembler function.
+ */
+
+#ifdef HAS_WORD_128
+//128-bit
+extern "C" int32_t win_x86_64_asm_forwSequentialRead_Word128(Word128_t* first_word, Word128_t* last_word);
+extern "C" int32_t win_x86_64_asm_revSequentialRead_Word128(Word128_t* last_word, Word128_t* first_word);
+extern "C" int32_t win_x86_64_asm_forwSequentialWrite_Word128(Word128_t* first_word, Word128_t* last_word);
+extern "C" int32_t win_x86_64_asm_revSequentialWrite_Word128(Word128_t* last_word, Word128_t* first_word); 
+extern "C" int32_t win_x86_64_asm_forwStride2Read_Word128(Word128_t* first_word, Word128_t* last_word);
+extern "C" int32_t win_x86_64_asm_revStride2Read_Word128(Word128_t* first_word, Word128_t* last_word);
+extern "C" int32_t win_x86_64_asm_forwStride2Write_Word128(Word128_t* first_word, Word128_t* last_word);
+extern "C" int32_t win_x86_64_asm_revStride2Write_Word128(Word128_t* first_word, Word128_t* last_word);
+extern "C" int32_t win_x86_64_asm_forwStride4Read_Word128(Word128_t* first_word, Word128_t* last_word);
+extern "C" int32_t win_x86_64_asm_revStride4Read_Word128(Word128_t* first_word, Word128_t* last_word);
+extern "C" int32_t win_x86_64_asm_forwStride4Write_Word128(Word128_t* first_word, Word128_t* last_word);
+extern "C" int32_t win_x86_64_asm_revStride4Write_Word128(Word128_t* first_word, Word128_t* last_word);
+extern "C" int32_t win_x86_64_asm_forwStride8Read_Word128(Word128_t* first_word, Word128_t* last_word);
+extern "C" int32_t win_x86_64_asm_revStride8Read_Word128(Word128_t* first_word, Word128_t* last_word);
+extern "C" int32_t win_x86_64_asm_forwStride8Write_Word128(Word128_t* first_word, Word128_t* last_word);
+extern "C" int32_t win_x86_64_asm_revStride8Write_Word128(Word128_t* first_word, Word128_t* last_word);
+extern "C" int32_t win_x86_64_asm_forwStride16Read_Word128(Word128_t* first_word, Word128_t* last_word);
+extern "C" int32_t win_x86_64_asm_revStride16Read_Word128(Word128_t* first_word, Word128_t* last_word);
+extern "C" int32_t win_x86_64_asm_forwStride16Write_Word128(Word128_t* first_word, Word128_t* last_word);
+extern "C" int32_t win_x86_64_asm_revStride16Write_Word128(Word128_t* first_word, Word128_t* last_word);
+#endif
+
+#ifdef HAS_WORD_256
+//256-bit
+extern "C" int32_t win_x86_64_asm_forwSequentialRead_Word256(Word256_t* first_word, Word256_t* last_word);
+extern "C" int32_t win_x86_64_asm_revSequentialRead_Word256(Word256_t* last_word, Word256_t* first_word);
+extern "C" int32_t win_x86_64_asm_forwSequentialWrite_Word256(Word256_t* first_word, Word256_t* last_word);
+extern "C" int32_t win_x86_64_asm_revSequentialWrite_Word256(Word256_t* last_word, Word256_t* first_word);
+extern "C" int32_t win_x86_64_asm_forwStride2Read_Word256(Word256_t* first_word, Word256_t* last_word);
+extern "C" int32_t win_x86_64_asm_revStride2Read_Word256(Word256_t* first_word, Word256_t* last_word);
+extern "C" int32_t win_x86_64_asm_forwStride2Write_Word256(Word256_t* first_word, Word256_t* last_word);
+extern "C" int32_t win_x86_64_asm_revStride2Write_Word256(Word256_t* first_word, Word256_t* last_word);
+extern "C" int32_t win_x86_64_asm_forwStride4Read_Word256(Word256_t* first_word, Word256_t* last_word);
+extern "C" int32_t win_x86_64_asm_revStride4Read_Word256(Word256_t* first_word, Word256_t* last_word);
+extern "C" int32_t win_x86_64_asm_forwStride4Write_Word256(Word256_t* first_word, Word256_t* last_word);
+extern "C" int32_t win_x86_64_asm_revStride4Write_Word256(Word256_t* first_word, Word256_t* last_word);
+extern "C" int32_t win_x86_64_asm_forwStride8Read_Word256(Word256_t* first_word, Word256_t* last_word);
+extern "C" int32_t win_x86_64_asm_revStride8Read_Word256(Word256_t* first_word, Word256_t* last_word);
+extern "C" int32_t win_x86_64_asm_forwStride8Write_Word256(Word256_t* first_word, Word256_t* last_word);
+extern "C" int32_t win_x86_64_asm_revStride8Write_Word256(Word256_t* first_word, Word256_t* last_word);
+extern "C" int32_t win_x86_64_asm_forwStride16Read_Word256(Word256_t* first_word, Word256_t* last_word);
+extern "C" int32_t win_x86_64_asm_revStride16Read_Word256(Word256_t* first_word, Word256_t* last_word);
+extern "C" int32_t win_x86_64_asm_forwStride16Write_Word256(Word256_t* first_word, Word256_t* last_word);
+extern "C" int32_t win_x86_64_asm_revStride16Write_Word256(Word256_t* first_word, Word256_t* last_word);
+#endif
+
+//Dummies
+#ifdef HAS_WORD_128
+//128-bit
+extern "C" int32_t win_x86_64_asm_dummy_forwSequentialLoop_Word128(Word128_t* first_word, Word128_t* last_word);
+extern "C" int32_t win_x86_64_asm_dummy_revSequentialLoop_Word128(Word128_t* first_word, Word128_t* last_word); 
+extern "C" int32_t win_x86_64_asm_dummy_forwStride2Loop_Word128(Word128_t* first_word, Word128_t* last_word);
+extern "C" int32_t win_x86_64_asm_dummy_revStride2Loop_Word128(Word128_t* first_word, Word128_t* last_word);
+extern "C" int32_t win_x86_64_asm_dummy_forwStride4Loop_Word128(Word128_t* first_word, Word128_t* last_word);
+extern "C" int32_t win_x86_64_asm_dummy_revStride4Loop_Word128(Word128_t* first_word, Word128_t* last_word);
+extern "C" int32_t win_x86_64_asm_dummy_forwStride8Loop_Word128(Word128_t* first_word, Word128_t* last_word);
+extern "C" int32_t win_x86_64_asm_dummy_revStride8Loop_Word128(Word128_t* first_word, Word128_t* last_word);
+extern "C" int32_t win_x86_64_asm_dummy_forwStride16Loop_Word128(Word128_t* first_word, Word128_t* last_word);
+extern "C" int32_t win_x86_64_asm_dummy_revStride16Loop_Word128(Word128_t* first_word, Word128_t* last_word);
+#endif
+
+#ifdef HAS_WORD_256
+//256-bit
+extern "C" int32_t win_x86_64_asm_dummy_forwSequentialLoop_Word256(Word256_t* first_word, Word256_t* last_word);
+extern "C" int32_t win_x86_64_asm_dummy_revSequentialLoop_Word256(Word256_t* first_word, Word256_t* last_word);
+extern "C" int32_t win_x86_64_asm_dummy_forwStride2Loop_Word256(Word256_t* first_word, Word256_t* last_word);
+extern "C" int32_t win_x86_64_asm_dummy_revStride2Loop_Word256(Word256_t* first_word, Word256_t* last_word);
+extern "C" int32_t win_x86_64_asm_dummy_forwStride4Loop_Word256(Word256_t* first_word, Word256_t* last_word);
+extern "C" int32_t win_x86_64_asm_dummy_revStride4Loop_Word256(Word256_t* first_word, Word256_t* last_word);
+extern "C" int32_t win_x86_64_asm_dummy_forwStride8Loop_Word256(Word256_t* first_word, Word256_t* last_word);
+extern "C" int32_t win_x86_64_asm_dummy_revStride8Loop_Word256(Word256_t* first_word, Word256_t* last_word);
+extern "C" int32_t win_x86_64_asm_dummy_forwStride16Loop_Word256(Word256_t* first_word, Word256_t* last_word);
+extern "C" int32_t win_x86_64_asm_dummy_revStride16Loop_Word256(Word256_t* first_word, Word256_t* last_word);
+#endif
+#endif
+
+};
+
+#endif
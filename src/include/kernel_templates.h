@@ -0,0 +1,627 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ * 
+ * @brief Header file for the templates that generate the sequential and strided benchmark kernels.
+ *
+ * Every kernel is the same loop: walk the region in fully unrolled batches of accesses spaced by a fixed stride, wrapping around at the end.
+ * Only the word type, the stride, and what happens at each access differ, so these are template parameters and each combination compiles down to
+ * its own tight loop, like the hand-unrolled kernels it replaces. The strides that exist are listed once in SEQUENTIAL_KERNEL_STRIDES.
+ * This header is only meant to be included by the kernel translation units, which instantiate the tables for the word types their ISA flags allow.
+ */
+
+#ifndef KERNEL_TEMPLATES_H
+#define KERNEL_TEMPLATES_H
+
+//Headers
+#include <common.h>
+#include <benchmark_kernels.h>
+#include <kernel_intrinsics.h>
+
+//Libraries
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+#ifdef _WIN32
+#define KERNEL_INLINE __forceinline
+#else
+#define KERNEL_INLINE inline __attribute__((always_inline))
+#endif
+
+/**
+ * @brief Every stride in chunks for which kernels are generated. Add a stride here to make it available to -S. Strides spanning more than KERNEL_BATCH_SIZE bytes per access are skipped for that chunk size.
+ */
+#define SEQUENTIAL_KERNEL_STRIDES(X) \
+    X(1) X(-1) X(2) X(-2) X(3) X(-3) X(4) X(-4) X(5) X(-5) X(6) X(-6) X(8) X(-8) X(12) X(-12) X(16) X(-16) \
+    X(32) X(-32) X(64) X(-64) X(128) X(-128) X(256) X(-256) X(512) X(-512) X(1024) X(-1024)
+
+namespace xmem {
+
+    /**
+     * @brief One row of the sequential kernel dispatch table. The kernel flavors that the platform does not support are NULL.
+     */
+    struct SequentialKernelEntry {
+        int32_t stride; /**< Distance between successive accesses in chunks. Negative strides walk the region backwards. */
+        SequentialFunction read; /**< Read kernel, or NULL if the stride is too large for the chunk size. */
+        SequentialFunction write; /**< Write kernel. */
+        SequentialFunction write_nt; /**< Non-temporal write kernel, or NULL. */
+        SequentialFunction read_prefetch; /**< Software-prefetching read kernel, or NULL. */
+        SequentialFunction read_modify_write; /**< Kernel that loads each chunk and stores it back. */
+        SequentialFunction dummy; /**< Dummy kernel matching all of the above. */
+        SequentialFunction mixed[3]; /**< Mixed read/write kernels loading 1, 2 or 3 cache lines per line stored. */
+        SequentialFunction mixed_dummy[3]; /**< Dummy kernels matching the mixed kernels. */
+    };
+
+    /**
+     * @brief Rounds down to a power of two. Batches are powers of two so that the usual power-of-two pass sizes are a whole number of batches.
+     * @param x The value to round. Zero rounds up to one.
+     * @returns The largest power of two not greater than x, or 1.
+     */
+    constexpr uint32_t kernel_pow2_floor(uint32_t x) {
+        return x <= 1 ? 1 : 2 * kernel_pow2_floor(x / 2);
+    }
+
+    /**
+     * @brief Compile-time shape of a strided kernel.
+     * @tparam WordT The chunk type.
+     * @tparam Stride Distance between successive accesses in chunks.
+     */
+    template <typename WordT, int32_t Stride>
+    struct KernelGeometry {
+        static const ptrdiff_t step = Stride < 0 ? -Stride : Stride; /**< Words between successive accesses. */
+        static const bool fits = step * sizeof(WordT) <= KERNEL_BATCH_SIZE; /**< True if at least one access fits in a batch. */
+        static const ptrdiff_t full_batch = kernel_pow2_floor(KERNEL_BATCH_SIZE / (step * sizeof(WordT))); /**< Most accesses that fit in KERNEL_BATCH_SIZE bytes. */
+        static const bool exact = full_batch * step * sizeof(WordT) == KERNEL_BATCH_SIZE; /**< True if the stride is a power of two, so that full batches tile the region exactly. */
+        static const ptrdiff_t batch = exact || full_batch < 8 ? full_batch : full_batch / 8; /**< Accesses per unrolled batch. Other strides use shorter batches so that few of them straddle the end of the region. */
+        static const ptrdiff_t span = batch * step; /**< Words spanned by one batch. */
+        static const ptrdiff_t line_words = sizeof(WordT) < DEFAULT_CACHE_LINE_SIZE ? DEFAULT_CACHE_LINE_SIZE / sizeof(WordT) : 1; /**< Words per cache line. */
+        static const ptrdiff_t per_line = kernel_pow2_floor(static_cast<uint32_t>(line_words / step)); /**< Accesses per cache line, or 1 if the stride skips whole lines. */
+        static const ptrdiff_t prefetch_unit = line_words > step ? line_words : step; /**< Words covered by one unit of prefetch distance. */
+    };
+
+    /**
+     * @brief Calls a functor N times in straight-line code.
+     * @tparam N Number of calls.
+     */
+    template <ptrdiff_t N>
+    struct KernelUnroll {
+        template <typename F> static KERNEL_INLINE void run(F& f) {
+            KernelUnroll<N / 2>::run(f);
+            KernelUnroll<N - N / 2>::run(f);
+        }
+    };
+
+    template <>
+    struct KernelUnroll<1> {
+        template <typename F> static KERNEL_INLINE void run(F& f) {
+            f();
+        }
+    };
+
+    template <>
+    struct KernelUnroll<0> {
+        template <typename F> static KERNEL_INLINE void run(F&) { }
+    };
+
+    /**
+     * @brief The pointer type kernels access a chunk through. Volatile stops the compiler from removing the accesses.
+     */
+    template <typename WordT>
+    struct KernelWord {
+        typedef volatile WordT access_t;
+    };
+
+#if defined(HAS_WORD_512) && defined(ARCH_INTEL_MIC)
+    template <>
+    struct KernelWord<Word512_t> {
+        typedef Word512_access_t access_t;
+    };
+#endif
+
+    /**
+     * @brief Returns a chunk with every bit set, which is what all write kernels store.
+     */
+    template <typename WordT>
+    KERNEL_INLINE WordT kernel_all_ones() {
+        WordT val;
+        std::memset(&val, 0xFF, sizeof(val));
+        return val;
+    }
+
+    /*
+     * Access policies. Each provides the pointer type to walk with and four hooks that the kernel loop calls:
+     * line() once per cache line, touch() once per access, batch_done() after each batch, and finish() before returning.
+     */
+
+    /**
+     * @brief Loads every chunk visited.
+     */
+    template <typename WordT, int32_t Stride>
+    struct ReadAccess {
+        typedef typename KernelWord<WordT>::access_t* pointer_t;
+        WordT val;
+
+        KERNEL_INLINE void line(pointer_t) { }
+        KERNEL_INLINE void touch(pointer_t wordptr) { val = *wordptr; }
+        KERNEL_INLINE void batch_done(pointer_t) { }
+        KERNEL_INLINE void finish() { }
+    };
+
+    /**
+     * @brief Stores all-ones to every chunk visited.
+     */
+    template <typename WordT, int32_t Stride>
+    struct WriteAccess {
+        typedef typename KernelWord<WordT>::access_t* pointer_t;
+        WordT val;
+
+        WriteAccess() : val(kernel_all_ones<WordT>()) { }
+        KERNEL_INLINE void line(pointer_t) { }
+        KERNEL_INLINE void touch(pointer_t wordptr) { *wordptr = val; }
+        KERNEL_INLINE void batch_done(pointer_t) { }
+        KERNEL_INLINE void finish() { }
+    };
+
+    /**
+     * @brief Loads every chunk visited and stores the same value back in place.
+     */
+    template <typename WordT, int32_t Stride>
+    struct ReadModifyWriteAccess {
+        typedef typename KernelWord<WordT>::access_t* pointer_t;
+        WordT val;
+
+        KERNEL_INLINE void line(pointer_t) { }
+        KERNEL_INLINE void touch(pointer_t wordptr) { val = *wordptr; *wordptr = val; }
+        KERNEL_INLINE void batch_done(pointer_t) { }
+        KERNEL_INLINE void finish() { }
+    };
+
+#ifdef HAS_NT_STORES
+    /**
+     * @brief Stores all-ones to every chunk visited with streaming stores. These are not optimized away, so no volatile is needed.
+     */
+    template <typename WordT, int32_t Stride>
+    struct WriteNTAccess {
+        typedef WordT* pointer_t;
+        WordT val;
+
+        WriteNTAccess() : val(kernel_all_ones<WordT>()) { }
+        KERNEL_INLINE void line(pointer_t) { }
+        KERNEL_INLINE void touch(pointer_t wordptr) { my_stream(wordptr, val); }
+        KERNEL_INLINE void batch_done(pointer_t) { }
+        KERNEL_INLINE void finish() { _mm_sfence(); } //Streaming stores are weakly ordered, so drain them before the pass ends
+    };
+#endif
+
+#ifdef HAS_SW_PREFETCH
+    /**
+     * @brief Loads every chunk visited and prefetches g_prefetch_distance cache lines (or strides, if larger) ahead once per line.
+     */
+    template <typename WordT, int32_t Stride>
+    struct ReadPrefetchAccess {
+        typedef typename KernelWord<WordT>::access_t* pointer_t;
+        WordT val;
+        prefetch_hint_t hint;
+        ptrdiff_t ahead; //in words
+
+        ReadPrefetchAccess() :
+            hint(g_prefetch_hint),
+            ahead((Stride < 0 ? -1 : 1) * static_cast<ptrdiff_t>(g_prefetch_distance) * KernelGeometry<WordT, Stride>::prefetch_unit)
+        { }
+        KERNEL_INLINE void line(pointer_t wordptr) { my_prefetch(wordptr + ahead, hint); }
+        KERNEL_INLINE void touch(pointer_t wordptr) { val = *wordptr; }
+        KERNEL_INLINE void batch_done(pointer_t) { }
+        KERNEL_INLINE void finish() { }
+    };
+#endif
+
+    /**
+     * @brief Does everything but the access, for measuring loop overhead. The pointer is published once per batch so that the loop is not optimized away.
+     */
+    template <typename WordT, int32_t Stride>
+    struct DummyAccess {
+        typedef WordT* pointer_t;
+        static pointer_t volatile placeholder;
+
+        KERNEL_INLINE void line(pointer_t) { }
+        KERNEL_INLINE void touch(pointer_t) { }
+        KERNEL_INLINE void batch_done(pointer_t wordptr) { placeholder = wordptr; }
+        KERNEL_INLINE void finish() { }
+    };
+
+    template <typename WordT, int32_t Stride>
+    WordT* volatile DummyAccess<WordT, Stride>::placeholder = NULL;
+
+    /**
+     * @brief The loop shared by all sequential and strided kernels.
+     * The region is walked in fully unrolled batches of KernelGeometry::batch accesses until one access has been made per stride in the region, so that each chunk is accessed at most once per call.
+     * When a whole batch fits before the end of the region, the wrap-around is only checked once afterwards, exactly like the hand-written kernels did.
+     * This is always the case for power-of-two strides when the region is a whole number of batches. Batches that straddle the end of the region instead run a plain loop that checks after every access.
+     * Forward kernels start at start_address. Reverse kernels start at end_address and step before each access.
+     * @tparam WordT The chunk type.
+     * @tparam Stride Distance between successive accesses in chunks.
+     * @tparam Access The access policy.
+     */
+    template <typename WordT, int32_t Stride, typename Access>
+    struct StridedKernel {
+        typedef KernelGeometry<WordT, Stride> Geometry;
+        typedef typename Access::pointer_t pointer_t;
+        static_assert(Geometry::batch % Geometry::per_line == 0, "A batch must cover whole cache lines");
+
+        /**
+         * @brief One access followed by one stride.
+         */
+        struct Step {
+            pointer_t& wordptr;
+            Access& access;
+
+            KERNEL_INLINE void operator()() {
+                if (Stride > 0) {
+                    access.touch(wordptr);
+                    wordptr += Stride;
+                } else {
+                    wordptr += Stride;
+                    access.touch(wordptr);
+                }
+            }
+        };
+
+        /**
+         * @brief The accesses that fall in one cache line, preceded by the per-line hook.
+         */
+        struct Line {
+            pointer_t& wordptr;
+            Access& access;
+
+            KERNEL_INLINE void operator()() {
+                access.line(wordptr);
+                Step step = { wordptr, access };
+                KernelUnroll<Geometry::per_line>::run(step);
+            }
+        };
+
+        static int32_t run(void* start_address, void* end_address) {
+            Access access;
+            WordT* begptr = static_cast<WordT*>(start_address);
+            WordT* endptr = static_cast<WordT*>(end_address);
+            ptrdiff_t len = endptr - begptr;
+            ptrdiff_t accesses = len / Geometry::step;
+            pointer_t wordptr = Stride > 0 ? begptr : endptr;
+            Line line = { wordptr, access };
+
+            for (ptrdiff_t i = 0; i < accesses; i += Geometry::batch) {
+                if (Stride > 0 ? (endptr - wordptr >= Geometry::span) : (wordptr - begptr >= Geometry::span)) {
+                    KernelUnroll<Geometry::batch / Geometry::per_line>::run(line);
+                    if (Stride > 0 && wordptr >= endptr) //end, modulo
+                        wordptr -= len;
+                    else if (Stride < 0 && wordptr <= begptr)
+                        wordptr += len;
+                } else {
+                    for (ptrdiff_t j = 0; j < Geometry::batch; j++) {
+                        if (j % Geometry::per_line == 0)
+                            access.line(wordptr);
+                        if (Stride > 0) {
+                            access.touch(wordptr);
+                            wordptr += Stride;
+                            if (wordptr >= endptr) //end, modulo
+                                wordptr -= len;
+                        } else {
+                            wordptr += Stride;
+                            if (wordptr < begptr) //end, modulo
+                                wordptr += len;
+                            access.touch(wordptr);
+                        }
+                    }
+                }
+                access.batch_done(wordptr);
+            }
+            access.finish();
+            return 0;
+        }
+    };
+
+    /**
+     * @brief The loop shared by the mixed read/write kernels. It walks the region exactly like StridedKernel, but in groups of Reads cache lines loaded followed by one cache line stored.
+     * When the stride skips whole lines, each line is a single access. Each unrolled batch holds as many whole groups as fit in a StridedKernel batch, so that the group pattern never restarts mid-batch.
+     * Groups of three lines do not divide power-of-two regions, so the last batch is cut short to make exactly one access per stride in the region, like the other kernels.
+     * @tparam WordT The chunk type.
+     * @tparam Stride Distance between successive accesses in chunks.
+     * @tparam Reads Cache lines loaded per cache line stored.
+     * @tparam ReadPolicy The access policy of the loaded lines.
+     * @tparam WritePolicy The access policy of the stored lines. Its pointer type must match ReadPolicy's.
+     */
+    template <typename WordT, int32_t Stride, uint32_t Reads, typename ReadPolicy, typename WritePolicy>
+    struct MixedKernel {
+        typedef KernelGeometry<WordT, Stride> Geometry;
+        typedef typename ReadPolicy::pointer_t pointer_t;
+        typedef typename StridedKernel<WordT, Stride, ReadPolicy>::Line ReadLine;
+        typedef typename StridedKernel<WordT, Stride, WritePolicy>::Line WriteLine;
+        static const ptrdiff_t group = (Reads + 1) * Geometry::per_line; /**< Accesses per group. */
+        static const ptrdiff_t groups_per_batch = Geometry::batch / group > 0 ? Geometry::batch / group : 1; /**< Groups per unrolled batch. */
+        static const ptrdiff_t batch = groups_per_batch * group; /**< Accesses per unrolled batch. */
+        static const ptrdiff_t span = batch * Geometry::step; /**< Words spanned by one batch. */
+
+        /**
+         * @brief Reads loaded lines followed by one stored line.
+         */
+        struct Group {
+            ReadLine& read_line;
+            WriteLine& write_line;
+
+            KERNEL_INLINE void operator()() {
+                KernelUnroll<Reads>::run(read_line);
+                write_line();
+            }
+        };
+
+        static int32_t run(void* start_address, void* end_address) {
+            ReadPolicy reader;
+            WritePolicy writer;
+            WordT* begptr = static_cast<WordT*>(start_address);
+            WordT* endptr = static_cast<WordT*>(end_address);
+            ptrdiff_t len = endptr - begptr;
+            ptrdiff_t total = len / Geometry::step;
+            pointer_t wordptr = Stride > 0 ? begptr : endptr;
+            ReadLine read_line = { wordptr, reader };
+            WriteLine write_line = { wordptr, writer };
+            Group group_fn = { read_line, write_line };
+
+            for (ptrdiff_t i = 0; i < total; i += batch) {
+                ptrdiff_t accesses = total - i < batch ? total - i : batch;
+                if (accesses == batch && (Stride > 0 ? (endptr - wordptr >= span) : (wordptr - begptr >= span))) {
+                    KernelUnroll<groups_per_batch>::run(group_fn);
+                    if (Stride > 0 && wordptr >= endptr) //end, modulo
+                        wordptr -= len;
+                    else if (Stride < 0 && wordptr <= begptr)
+                        wordptr += len;
+                } else {
+                    for (ptrdiff_t j = 0; j < accesses; j++) {
+                        bool store = (j / Geometry::per_line) % (Reads + 1) == Reads;
+                        if (Stride < 0) {
+                            wordptr += Stride;
+                            if (wordptr < begptr) //end, modulo
+                                wordptr += len;
+                        }
+                        if (store) {
+                            if (j % Geometry::per_line == 0)
+                                writer.line(wordptr);
+                            writer.touch(wordptr);
+                        } else {
+                            if (j % Geometry::per_line == 0)
+                                reader.line(wordptr);
+                            reader.touch(wordptr);
+                        }
+                        if (Stride > 0) {
+                            wordptr += Stride;
+                            if (wordptr >= endptr) //end, modulo
+                                wordptr -= len;
+                        }
+                    }
+                }
+                reader.batch_done(wordptr);
+                writer.batch_done(wordptr);
+            }
+            reader.finish();
+            writer.finish();
+            return 0;
+        }
+    };
+
+    template <typename WordT, int32_t Stride> int32_t dummy_stridedLoop(void* start_address, void* end_address) {
+        return StridedKernel<WordT, Stride, DummyAccess<WordT, Stride> >::run(start_address, end_address);
+    }
+
+    template <typename WordT, int32_t Stride> int32_t stridedRead(void* start_address, void* end_address) {
+        return StridedKernel<WordT, Stride, ReadAccess<WordT, Stride> >::run(start_address, end_address);
+    }
+
+    template <typename WordT, int32_t Stride> int32_t stridedWrite(void* start_address, void* end_address) {
+        return StridedKernel<WordT, Stride, WriteAccess<WordT, Stride> >::run(start_address, end_address);
+    }
+
+    template <typename WordT, int32_t Stride> int32_t stridedReadModifyWrite(void* start_address, void* end_address) {
+        return StridedKernel<WordT, Stride, ReadModifyWriteAccess<WordT, Stride> >::run(start_address, end_address);
+    }
+
+    template <typename WordT, int32_t Stride, uint32_t Reads> int32_t dummy_stridedMixedLoop(void* start_address, void* end_address) {
+        return MixedKernel<WordT, Stride, Reads, DummyAccess<WordT, Stride>, DummyAccess<WordT, Stride> >::run(start_address, end_address);
+    }
+
+    template <typename WordT, int32_t Stride, uint32_t Reads> int32_t stridedMixed(void* start_address, void* end_address) {
+        return MixedKernel<WordT, Stride, Reads, ReadAccess<WordT, Stride>, WriteAccess<WordT, Stride> >::run(start_address, end_address);
+    }
+
+#ifdef HAS_NT_STORES
+    template <typename WordT, int32_t Stride> int32_t stridedWriteNT(void* start_address, void* end_address) {
+        return StridedKernel<WordT, Stride, WriteNTAccess<WordT, Stride> >::run(start_address, end_address);
+    }
+#endif
+
+#ifdef HAS_SW_PREFETCH
+    template <typename WordT, int32_t Stride> int32_t stridedReadPrefetch(void* start_address, void* end_address) {
+        return StridedKernel<WordT, Stride, ReadPrefetchAccess<WordT, Stride> >::run(start_address, end_address);
+    }
+#endif
+
+    /**
+     * @brief Builds the dispatch table row for one word type and stride. Strides that do not fit in a batch get an empty row and are never instantiated.
+     */
+    template <typename WordT, int32_t Stride, bool Fits = KernelGeometry<WordT, Stride>::fits>
+    struct SequentialKernelRow {
+        static constexpr SequentialKernelEntry entry() {
+            return SequentialKernelEntry {
+                Stride,
+                &stridedRead<WordT, Stride>,
+                &stridedWrite<WordT, Stride>,
+#ifdef HAS_NT_STORES
+                &stridedWriteNT<WordT, Stride>,
+#else
+                NULL,
+#endif
+#ifdef HAS_SW_PREFETCH
+                &stridedReadPrefetch<WordT, Stride>,
+#else
+                NULL,
+#endif
+                &stridedReadModifyWrite<WordT, Stride>,
+                &dummy_stridedLoop<WordT, Stride>,
+                { &stridedMixed<WordT, Stride, 1>, &stridedMixed<WordT, Stride, 2>, &stridedMixed<WordT, Stride, 3> },
+                { &dummy_stridedMixedLoop<WordT, Stride, 1>, &dummy_stridedMixedLoop<WordT, Stride, 2>, &dummy_stridedMixedLoop<WordT, Stride, 3> }
+            };
+        }
+    };
+
+    template <typename WordT, int32_t Stride>
+    struct SequentialKernelRow<WordT, Stride, false> {
+        static constexpr SequentialKernelEntry entry() {
+            return SequentialKernelEntry { Stride, NULL, NULL, NULL, NULL, NULL, NULL, { NULL, NULL, NULL }, { NULL, NULL, NULL } };
+        }
+    };
+
+    /**
+     * @brief Gets the dispatch table of every sequential and strided kernel for one word type. Each word type is explicitly instantiated in the translation unit built for its ISA.
+     * @param num_entries Set to the number of rows in the table.
+     * @returns The table.
+     */
+    template <typename WordT>
+    const SequentialKernelEntry* sequential_kernel_table(size_t* num_entries) {
+#define SEQUENTIAL_KERNEL_ROW(stride) SequentialKernelRow<WordT, stride>::entry(),
+        static constexpr SequentialKernelEntry table[] = { SEQUENTIAL_KERNEL_STRIDES(SEQUENTIAL_KERNEL_ROW) };
+#undef SEQUENTIAL_KERNEL_ROW
+        *num_entries = sizeof(table) / sizeof(table[0]);
+        return table;
+    }
+
+    /**
+     * @brief The loop shared by the mixed read/write random kernels. Like the hand-written random kernels, it follows the pointer chain for THROUGHPUT_BENCHMARK_BYTES_PER_PASS bytes' worth of hops.
+     * Hops come in groups of Reads loads followed by one load that stores the chunk back, so that the chain survives. Hops left over after the last whole group are loads.
+     * The next address is the low bytes of the chunk, like the extractLSB intrinsics the hand-written kernels use.
+     * @tparam WordT The chunk type.
+     * @tparam Reads Hops that only load per hop that also stores.
+     */
+    template <typename WordT, uint32_t Reads>
+    struct RandomMixedKernel {
+        typedef typename KernelWord<WordT>::access_t* pointer_t;
+        static const ptrdiff_t hops = THROUGHPUT_BENCHMARK_BYTES_PER_PASS / sizeof(WordT); /**< Hops per call. */
+
+        static KERNEL_INLINE pointer_t next(const WordT& val) {
+            uintptr_t address;
+            std::memcpy(&address, &val, sizeof(address));
+            return reinterpret_cast<pointer_t>(address);
+        }
+
+        /**
+         * @brief One hop that only loads.
+         */
+        struct ReadHop {
+            pointer_t& p;
+
+            KERNEL_INLINE void operator()() {
+                WordT val = *p;
+                p = next(val);
+            }
+        };
+
+        /**
+         * @brief One hop that loads and stores the chunk back.
+         */
+        struct WriteHop {
+            pointer_t& p;
+
+            KERNEL_INLINE void operator()() {
+                WordT val = *p;
+                *p = val;
+                p = next(val);
+            }
+        };
+
+        /**
+         * @brief Reads load hops followed by one store hop.
+         */
+        struct Group {
+            ReadHop& read_hop;
+            WriteHop& write_hop;
+
+            KERNEL_INLINE void operator()() {
+                KernelUnroll<Reads>::run(read_hop);
+                write_hop();
+            }
+        };
+
+        static int32_t run(uintptr_t* first_address, uintptr_t** last_touched_address) {
+            pointer_t p = reinterpret_cast<WordT*>(first_address);
+            ReadHop read_hop = { p };
+            WriteHop write_hop = { p };
+            Group group = { read_hop, write_hop };
+
+            KernelUnroll<hops / (Reads + 1)>::run(group);
+            KernelUnroll<hops % (Reads + 1)>::run(read_hop);
+            *last_touched_address = reinterpret_cast<uintptr_t*>(const_cast<WordT*>(p)); //Trick compiler. First get rid of volatile qualifier, and then reinterpret pointer
+            return 0;
+        }
+    };
+
+    template <typename WordT, uint32_t Reads> int32_t randomMixed(uintptr_t* first_address, uintptr_t** last_touched_address, size_t) {
+        return RandomMixedKernel<WordT, Reads>::run(first_address, last_touched_address);
+    }
+
+#if defined(_WIN32) && defined(ARCH_INTEL_X86_64)
+/**
+ * @brief Replaces the generated forward and reverse kernels of one word type and stride with the hand-coded assembly versions, which VC++ needs for 128-bit and 256-bit words. NAME is Sequential or StrideN as in the assembly function names.
+ * The strided assembly kernels count one access per word between the addresses they are given, so they are handed the first or last 1/STRIDE of the region to make one access per stride like the generated kernels.
+ */
+#define WIN_X86_64_ASM_STRIDED_KERNELS(WORD, NAME, STRIDE) \
+    template <> int32_t xmem::dummy_stridedLoop<WORD##_t, STRIDE>(void* start_address, void* end_address) { \
+        WORD##_t* first = static_cast<WORD##_t*>(start_address); \
+        return win_x86_64_asm_dummy_forw##NAME##Loop_##WORD(first, first + (static_cast<WORD##_t*>(end_address) - first) / STRIDE); \
+    } \
+    template <> int32_t xmem::dummy_stridedLoop<WORD##_t, -STRIDE>(void* start_address, void* end_address) { \
+        WORD##_t* last = static_cast<WORD##_t*>(end_address); \
+        return win_x86_64_asm_dummy_rev##NAME##Loop_##WORD(last, last - (last - static_cast<WORD##_t*>(start_address)) / STRIDE); \
+    } \
+    template <> int32_t xmem::stridedRead<WORD##_t, STRIDE>(void* start_address, void* end_address) { \
+        WORD##_t* first = static_cast<WORD##_t*>(start_address); \
+        return win_x86_64_asm_forw##NAME##Read_##WORD(first, first + (static_cast<WORD##_t*>(end_address) - first) / STRIDE); \
+    } \
+    template <> int32_t xmem::stridedRead<WORD##_t, -STRIDE>(void* start_address, void* end_address) { \
+        WORD##_t* last = static_cast<WORD##_t*>(end_address); \
+        return win_x86_64_asm_rev##NAME##Read_##WORD(last, last - (last - static_cast<WORD##_t*>(start_address)) / STRIDE); \
+    } \
+    template <> int32_t xmem::stridedWrite<WORD##_t, STRIDE>(void* start_address, void* end_address) { \
+        WORD##_t* first = static_cast<WORD##_t*>(start_address); \
+        return win_x86_64_asm_forw##NAME##Write_##WORD(first, first + (static_cast<WORD##_t*>(end_address) - first) / STRIDE); \
+    } \
+    template <> int32_t xmem::stridedWrite<WORD##_t, -STRIDE>(void* start_address, void* end_address) { \
+        WORD##_t* last = static_cast<WORD##_t*>(end_address); \
+        return win_x86_64_asm_rev##NAME##Write_##WORD(last, last - (last - static_cast<WORD##_t*>(start_address)) / STRIDE); \
+    }
+#endif
+
+};
+
+#endif
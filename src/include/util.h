@@ -16,6 +16,9 @@
 // according to https://perfeval.epfl.ch/printMe/perf.pdf, Appendix A
 #define Z_CI_95 1.96
 
+// The order-statistic CI of the median is meaningless for fewer values than this
+#define MIN_SAMPLES_FOR_CI 6
+
 /**
  * @brief Computes the median of the elements of the given vector.
  * @returns The median of the elements of the given vector.
@@ -28,5 +31,22 @@ double compute_median(std::vector<double> values);
  */
 double compute_95_CI(std::vector<double> metrics, uint32_t n);
 
+/**
+ * @brief Computes the 95% confidence interval (CI) of the median of the first `n` elements of the vector using order statistics.
+ * @param metrics The values.
+ * @param n Number of leading elements to use. Must be at least MIN_SAMPLES_FOR_CI and at most the size of the vector.
+ * @param lower Set to the lower bound of the CI.
+ * @param upper Set to the upper bound of the CI.
+ */
+void compute_median_95_CI(std::vector<double> metrics, uint32_t n, double* lower, double* upper);
+
+/**
+ * @brief Checks whether the 95% CI of the median of all elements of the vector lies within a relative distance of the median.
+ * @param values The values.
+ * @param max_deviation Maximum distance of either CI bound from the median, as a fraction of the median.
+ * @returns True if there are at least MIN_SAMPLES_FOR_CI values and the CI is tight enough.
+ */
+bool median_95_CI_within(const std::vector<double>& values, double max_deviation);
+
 
 #endif
@@ -0,0 +1,470 @@
+/* The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Microsoft
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Author: Mark Gottscho <mgottscho@ucla.edu>
+ */
+
+/**
+ * @file
+ * 
+ * @brief Implementation file for the run-time code generator of x86-64 benchmark kernels.
+ *
+ * The generator writes the machine code of each kernel loop directly, so the instructions that touch memory are exactly the ones chosen here regardless of compiler version or flags.
+ * Generated functions follow the System V AMD64 calling convention and only use caller-saved registers:
+ *   - rdi/rsi: start and end of the region (sequential), or first pointer and output address (random)
+ *   - rax: current pointer
+ *   - rcx, rdx: region length in bytes and bytes walked so far
+ *   - r8, xmm0/ymm0/zmm0: value loaded or stored
+ *   - r9: scratch for the wrap-around
+ */
+
+//Headers
+#include <jit_kernels.h>
+#include <common.h>
+
+#ifdef HAS_JIT_KERNELS
+
+//Libraries
+#include <iostream>
+#include <vector>
+#include <map>
+#include <tuple>
+#include <cstring>
+#include <sys/mman.h>
+
+using namespace xmem;
+
+/**
+ * @brief Identifies a generated kernel in the cache.
+ */
+struct JitKernelKey {
+    bool random; /**< True for random-access kernels. */
+    rw_mode_t rw_mode; /**< Read/write mode. */
+    chunk_size_t chunk_size; /**< Access granularity. */
+    int32_t stride_size; /**< Stride in chunks. Zero for random-access kernels. */
+    uint32_t delay; /**< Nops after every access. */
+    uint32_t prefetch_distance; /**< Prefetch distance in lines. Zero if the kernel does not prefetch. */
+    prefetch_hint_t prefetch_hint; /**< Prefetch hint. Only meaningful if prefetch_distance is non-zero. */
+
+    bool operator<(const JitKernelKey& other) const {
+        return std::tie(random, rw_mode, chunk_size, stride_size, delay, prefetch_distance, prefetch_hint) <
+               std::tie(other.random, other.rw_mode, other.chunk_size, other.stride_size, other.delay, other.prefetch_distance, other.prefetch_hint);
+    }
+};
+
+/**
+ * @brief A generated kernel and its dummy.
+ */
+struct JitKernelPair {
+    void* kernel; /**< Entry point of the kernel. */
+    void* dummy; /**< Entry point of the dummy kernel. */
+};
+
+static std::map<JitKernelKey, JitKernelPair> jit_kernel_cache; //Generated code is never freed, as function pointers to it may be held anywhere
+
+typedef std::vector<uint8_t> JitCode;
+
+static void emit(JitCode& code, std::initializer_list<uint8_t> bytes) {
+    code.insert(code.end(), bytes.begin(), bytes.end());
+}
+
+static void emit_imm32(JitCode& code, int32_t imm) {
+    uint8_t bytes[4];
+    memcpy(bytes, &imm, 4); //x86 is little-endian
+    code.insert(code.end(), bytes, bytes + 4);
+}
+
+/**
+ * @brief Emits a conditional jump with a 32-bit displacement whose target is filled in later by patch_jump().
+ * @returns The offset of the displacement.
+ */
+static size_t emit_jump_forward(JitCode& code, uint8_t condition) {
+    emit(code, { 0x0F, condition });
+    emit_imm32(code, 0);
+    return code.size() - 4;
+}
+
+static void patch_jump(JitCode& code, size_t displacement_offset, size_t target) {
+    int32_t rel = static_cast<int32_t>(target - (displacement_offset + 4));
+    memcpy(&code[displacement_offset], &rel, 4);
+}
+
+static void emit_jump_back(JitCode& code, uint8_t condition, size_t target) {
+    emit(code, { 0x0F, condition });
+    emit_imm32(code, static_cast<int32_t>(target) - static_cast<int32_t>(code.size() + 4));
+}
+
+static void emit_delay(JitCode& code, uint32_t delay) {
+    code.insert(code.end(), delay, 0x90); //nop
+}
+
+static void emit_return(JitCode& code, bool vzeroupper) {
+    if (vzeroupper)
+        emit(code, { 0xC5, 0xF8, 0x77 }); //vzeroupper
+    emit(code, { 0x31, 0xC0 }); //xor eax, eax
+    emit(code, { 0xC3 }); //ret
+}
+
+static uint32_t jit_chunk_bytes(chunk_size_t chunk_size) {
+    switch (chunk_size) {
+        case CHUNK_32b:
+            return 4;
+        case CHUNK_64b:
+            return 8;
+        case CHUNK_128b:
+            return 16;
+        case CHUNK_256b:
+            return 32;
+        case CHUNK_512b:
+            return 64;
+        default:
+            return 0;
+    }
+}
+
+/**
+ * @brief Fills the register that write kernels store with all ones.
+ */
+static void emit_write_value(JitCode& code, uint32_t chunk_bytes) {
+    switch (chunk_bytes) {
+        case 4:
+        case 8:
+            emit(code, { 0x49, 0xC7, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF }); //mov r8, -1
+            break;
+        case 16:
+            emit(code, { 0x66, 0x0F, 0x76, 0xC0 }); //pcmpeqd xmm0, xmm0
+            break;
+        case 32:
+            emit(code, { 0xC5, 0xF9, 0x76, 0xC0 }); //vpcmpeqd xmm0, xmm0, xmm0
+            emit(code, { 0xC4, 0xE3, 0x7D, 0x18, 0xC0, 0x01 }); //vinsertf128 ymm0, ymm0, xmm0, 1 (AVX2 is not required)
+            break;
+        case 64:
+            emit(code, { 0x62, 0xF3, 0x7D, 0x48, 0x25, 0xC0, 0xFF }); //vpternlogd zmm0, zmm0, zmm0, 0xff
+            break;
+    }
+}
+
+/**
+ * @brief Emits one memory access at [rax].
+ */
+static void emit_access(JitCode& code, rw_mode_t rw_mode, uint32_t chunk_bytes) {
+    switch (rw_mode) {
+        case READ:
+            switch (chunk_bytes) {
+                case 4: emit(code, { 0x44, 0x8B, 0x00 }); break; //mov r8d, [rax]
+                case 8: emit(code, { 0x4C, 0x8B, 0x00 }); break; //mov r8, [rax]
+                case 16: emit(code, { 0x66, 0x0F, 0x6F, 0x00 }); break; //movdqa xmm0, [rax]
+                case 32: emit(code, { 0xC5, 0xFD, 0x6F, 0x00 }); break; //vmovdqa ymm0, [rax]
+                case 64: emit(code, { 0x62, 0xF1, 0xFD, 0x48, 0x6F, 0x00 }); break; //vmovdqa64 zmm0, [rax]
+            }
+            break;
+        case WRITE:
+            switch (chunk_bytes) {
+                case 4: emit(code, { 0x44, 0x89, 0x00 }); break; //mov [rax], r8d
+                case 8: emit(code, { 0x4C, 0x89, 0x00 }); break; //mov [rax], r8
+                case 16: emit(code, { 0x66, 0x0F, 0x7F, 0x00 }); break; //movdqa [rax], xmm0
+                case 32: emit(code, { 0xC5, 0xFD, 0x7F, 0x00 }); break; //vmovdqa [rax], ymm0
+                case 64: emit(code, { 0x62, 0xF1, 0xFD, 0x48, 0x7F, 0x00 }); break; //vmovdqa64 [rax], zmm0
+            }
+            break;
+        case WRITE_NT:
+            switch (chunk_bytes) {
+                case 4: emit(code, { 0x44, 0x0F, 0xC3, 0x00 }); break; //movnti [rax], r8d
+                case 8: emit(code, { 0x4C, 0x0F, 0xC3, 0x00 }); break; //movnti [rax], r8
+                case 16: emit(code, { 0x66, 0x0F, 0xE7, 0x00 }); break; //movntdq [rax], xmm0
+                case 32: emit(code, { 0xC5, 0xFD, 0xE7, 0x00 }); break; //vmovntdq [rax], ymm0
+                case 64: emit(code, { 0x62, 0xF1, 0x7D, 0x48, 0xE7, 0x00 }); break; //vmovntdq [rax], zmm0
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+static void emit_prefetch(JitCode& code, prefetch_hint_t hint, int32_t ahead) {
+    uint8_t modrm = 0;
+    switch (hint) {
+        case PREFETCH_T0: modrm = 0x88; break; //prefetcht0 [rax+disp32]
+        case PREFETCH_T1: modrm = 0x90; break; //prefetcht1 [rax+disp32]
+        case PREFETCH_T2: modrm = 0x98; break; //prefetcht2 [rax+disp32]
+        default: modrm = 0x80; break; //prefetchnta [rax+disp32]
+    }
+    emit(code, { 0x0F, 0x18, modrm });
+    emit_imm32(code, ahead);
+}
+
+/**
+ * @brief Moves rax back into the region [rdi, rsi) of length rcx if it has run off the end. Branch-free, so it costs the same every time.
+ * @param forward Direction of the walk.
+ * @param inclusive For reverse walks, also wrap when rax equals the start of the region. Used after a whole batch, where the next access pre-decrements.
+ */
+static void emit_wrap(JitCode& code, bool forward, bool inclusive) {
+    if (forward) {
+        emit(code, { 0x49, 0x89, 0xC1 }); //mov r9, rax
+        emit(code, { 0x49, 0x29, 0xC9 }); //sub r9, rcx
+        emit(code, { 0x48, 0x39, 0xF0 }); //cmp rax, rsi
+        emit(code, { 0x49, 0x0F, 0x43, 0xC1 }); //cmovae rax, r9
+    } else {
+        emit(code, { 0x4C, 0x8D, 0x0C, 0x08 }); //lea r9, [rax+rcx]
+        emit(code, { 0x48, 0x39, 0xF8 }); //cmp rax, rdi
+        emit(code, { 0x49, 0x0F, static_cast<uint8_t>(inclusive ? 0x46 : 0x42), 0xC1 }); //cmovbe/cmovb rax, r9
+    }
+}
+
+/**
+ * @brief Describes the loop of a sequential or strided kernel.
+ */
+struct JitSequentialLoop {
+    rw_mode_t rw_mode; /**< Read/write mode. */
+    uint32_t chunk_bytes; /**< Bytes per access. */
+    int32_t stride_bytes; /**< Signed distance between accesses in bytes. */
+    bool wrap_per_batch; /**< If true, the end of the region is only checked after each batch. Otherwise it is checked after every access. */
+    uint32_t unroll; /**< Accesses per batch. */
+    uint32_t delay; /**< Nops after every access. */
+    bool prefetch; /**< If true, one prefetch is issued every per_line accesses. */
+    uint32_t per_line; /**< Accesses per cache line. */
+    int32_t prefetch_ahead; /**< Signed prefetch distance in bytes. */
+    prefetch_hint_t prefetch_hint; /**< Prefetch hint. */
+};
+
+/**
+ * @brief Emits access number j of a batch, including the pointer update.
+ */
+static void emit_sequential_step(JitCode& code, const JitSequentialLoop& loop, uint32_t j, bool dummy) {
+    bool forward = loop.stride_bytes > 0;
+    int32_t step = forward ? loop.stride_bytes : -loop.stride_bytes;
+
+    if (!dummy && loop.prefetch && j % loop.per_line == 0)
+        emit_prefetch(code, loop.prefetch_hint, loop.prefetch_ahead);
+
+    if (forward) {
+        if (!dummy)
+            emit_access(code, loop.rw_mode, loop.chunk_bytes);
+        emit(code, { 0x48, 0x05 }); //add rax, imm32
+        emit_imm32(code, step);
+        if (!loop.wrap_per_batch)
+            emit_wrap(code, true, false);
+    } else {
+        emit(code, { 0x48, 0x2D }); //sub rax, imm32
+        emit_imm32(code, step);
+        if (!loop.wrap_per_batch)
+            emit_wrap(code, false, false);
+        if (!dummy)
+            emit_access(code, loop.rw_mode, loop.chunk_bytes);
+    }
+
+    if (!dummy)
+        emit_delay(code, loop.delay);
+}
+
+static void emit_sequential_kernel(JitCode& code, const JitSequentialLoop& loop, bool dummy) {
+    bool forward = loop.stride_bytes > 0;
+
+    emit(code, { 0x48, 0x89, static_cast<uint8_t>(forward ? 0xF8 : 0xF0) }); //mov rax, rdi (forward) or rsi (reverse)
+    emit(code, { 0x48, 0x89, 0xF1 }); //mov rcx, rsi
+    emit(code, { 0x48, 0x29, 0xF9 }); //sub rcx, rdi
+    emit(code, { 0x31, 0xD2 }); //xor edx, edx
+    emit(code, { 0x48, 0x85, 0xC9 }); //test rcx, rcx
+    size_t empty_jump = emit_jump_forward(code, 0x84); //jz done
+    if (!dummy && loop.rw_mode != READ)
+        emit_write_value(code, loop.chunk_bytes);
+
+    size_t loop_start = code.size();
+    for (uint32_t j = 0; j < loop.unroll; j++)
+        emit_sequential_step(code, loop, j, dummy);
+    if (loop.wrap_per_batch)
+        emit_wrap(code, forward, true);
+    emit(code, { 0x48, 0x81, 0xC2 }); //add rdx, imm32
+    emit_imm32(code, static_cast<int32_t>(loop.unroll) * (forward ? loop.stride_bytes : -loop.stride_bytes)); //One access per stride, so no chunk is accessed twice
+    emit(code, { 0x48, 0x39, 0xCA }); //cmp rdx, rcx
+    emit_jump_back(code, 0x82, loop_start); //jb loop_start
+
+    if (!dummy && loop.rw_mode == WRITE_NT)
+        emit(code, { 0x0F, 0xAE, 0xF8 }); //sfence: make the streaming stores globally visible before returning, like stridedWriteNT()
+    patch_jump(code, empty_jump, code.size());
+    emit_return(code, !dummy && loop.chunk_bytes >= 32);
+}
+
+/**
+ * @brief Emits a 64-bit pointer-chasing loop.
+ */
+static void emit_random_kernel(JitCode& code, rw_mode_t rw_mode, uint32_t unroll, uint32_t delay, bool dummy) {
+    emit(code, { 0x48, 0x89, 0xF8 }); //mov rax, rdi
+    emit(code, { 0x31, 0xC9 }); //xor ecx, ecx
+    emit(code, { 0x48, 0x85, 0xD2 }); //test rdx, rdx
+    size_t empty_jump = emit_jump_forward(code, 0x84); //jz done
+
+    size_t loop_start = code.size();
+    if (!dummy) {
+        for (uint32_t j = 0; j < unroll; j++) {
+            if (rw_mode == READ) {
+                emit(code, { 0x48, 0x8B, 0x00 }); //mov rax, [rax]
+            } else {
+                emit(code, { 0x4C, 0x8B, 0x00 }); //mov r8, [rax]
+                emit(code, { 0x4C, 0x89, 0x00 }); //mov [rax], r8
+                emit(code, { 0x4C, 0x89, 0xC0 }); //mov rax, r8
+            }
+            emit_delay(code, delay);
+        }
+    }
+    emit(code, { 0x48, 0x81, 0xC1 }); //add rcx, imm32
+    emit_imm32(code, static_cast<int32_t>(unroll * 8));
+    emit(code, { 0x48, 0x39, 0xD1 }); //cmp rcx, rdx
+    emit_jump_back(code, 0x82, loop_start); //jb loop_start
+
+    if (!dummy)
+        emit(code, { 0x48, 0x89, 0x06 }); //mov [rsi], rax
+    patch_jump(code, empty_jump, code.size());
+    emit_return(code, false);
+}
+
+/**
+ * @brief Copies generated code into a fresh executable mapping.
+ * @returns The entry point, or NULL on failure.
+ */
+static void* jit_install(const JitCode& code) {
+    size_t len = ((code.size() + g_page_size - 1) / g_page_size) * g_page_size;
+    void* buf = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (buf == MAP_FAILED) {
+        std::cerr << "ERROR: Failed to allocate memory for a generated kernel." << std::endl;
+        return NULL;
+    }
+    memcpy(buf, code.data(), code.size());
+    if (mprotect(buf, len, PROT_READ | PROT_EXEC) != 0) { //Never writable and executable at the same time
+        std::cerr << "ERROR: Failed to make a generated kernel executable. The system may forbid executable memory." << std::endl;
+        munmap(buf, len);
+        return NULL;
+    }
+    return buf;
+}
+
+/**
+ * @brief Installs a kernel and its dummy and records them in the cache.
+ */
+static bool jit_install_pair(const JitKernelKey& key, const JitCode& kernel_code, const JitCode& dummy_code, JitKernelPair* pair) {
+    pair->kernel = jit_install(kernel_code);
+    pair->dummy = (pair->kernel != NULL) ? jit_install(dummy_code) : NULL;
+    if (pair->dummy == NULL)
+        return false;
+
+    jit_kernel_cache[key] = *pair;
+    if (g_verbose)
+        std::cout << "Generated a " << kernel_code.size() << "-byte kernel and a " << dummy_code.size() << "-byte dummy kernel at run time." << std::endl;
+    return true;
+}
+
+/**
+ * @brief Halves the unroll factor until the loop body fits in JIT_KERNEL_CODE_BUDGET bytes.
+ */
+static uint32_t jit_fit_unroll(uint32_t unroll, size_t bytes_per_access) {
+    while (unroll > 1 && unroll * bytes_per_access > JIT_KERNEL_CODE_BUDGET)
+        unroll /= 2;
+    return unroll;
+}
+
+bool xmem::jit_supports_stride(chunk_size_t chunk_size, int32_t stride_size) {
+    uint32_t chunk_bytes = jit_chunk_bytes(chunk_size);
+    if (chunk_bytes == 0 || stride_size == 0)
+        return false;
+    int64_t stride_bytes = static_cast<int64_t>(stride_size) * chunk_bytes;
+    return stride_bytes >= -KERNEL_BATCH_SIZE && stride_bytes <= KERNEL_BATCH_SIZE;
+}
+
+bool xmem::jit_sequential_kernel(rw_mode_t rw_mode, chunk_size_t chunk_size, int32_t stride_size, uint32_t delay, bool prefetch, SequentialFunction* kernel_function, SequentialFunction* dummy_kernel_function) {
+    if (!chunk_size_supported(chunk_size) || !jit_supports_stride(chunk_size, stride_size))
+        return false;
+    if (rw_mode != READ && rw_mode != WRITE && rw_mode != WRITE_NT)
+        return false;
+    if (prefetch && rw_mode != READ)
+        return false;
+
+    if (g_prefetch_distance == 0) //Nothing to prefetch, so emit the plain read kernel
+        prefetch = false;
+    JitKernelKey key = { false, rw_mode, chunk_size, stride_size, delay, prefetch ? g_prefetch_distance : 0, prefetch ? g_prefetch_hint : PREFETCH_T0 };
+
+    JitKernelPair pair;
+    auto cached = jit_kernel_cache.find(key);
+    if (cached != jit_kernel_cache.end()) {
+        pair = cached->second;
+    } else {
+        JitSequentialLoop loop;
+        loop.rw_mode = rw_mode;
+        loop.chunk_bytes = jit_chunk_bytes(chunk_size);
+        loop.stride_bytes = stride_size * static_cast<int32_t>(loop.chunk_bytes);
+        uint32_t step = static_cast<uint32_t>(loop.stride_bytes > 0 ? loop.stride_bytes : -loop.stride_bytes);
+        loop.wrap_per_batch = (step & (step - 1)) == 0; //Power-of-two strides tile the region exactly
+        loop.unroll = 1;
+        while (loop.unroll * 2 * step <= KERNEL_BATCH_SIZE)
+            loop.unroll *= 2;
+        loop.delay = delay;
+        loop.prefetch = prefetch;
+        loop.per_line = 1;
+        while (loop.per_line * 2 * step <= DEFAULT_CACHE_LINE_SIZE)
+            loop.per_line *= 2;
+        loop.prefetch_ahead = static_cast<int32_t>(g_prefetch_distance * (step > DEFAULT_CACHE_LINE_SIZE ? step : DEFAULT_CACHE_LINE_SIZE)) * (loop.stride_bytes > 0 ? 1 : -1);
+        loop.prefetch_hint = g_prefetch_hint;
+
+        JitCode sample;
+        for (uint32_t j = 0; j < loop.per_line; j++)
+            emit_sequential_step(sample, loop, j, false);
+        loop.unroll = jit_fit_unroll(loop.unroll, (sample.size() + loop.per_line - 1) / loop.per_line);
+        if (loop.unroll < loop.per_line)
+            loop.per_line = loop.unroll;
+
+        JitCode kernel_code, dummy_code;
+        emit_sequential_kernel(kernel_code, loop, false);
+        emit_sequential_kernel(dummy_code, loop, true);
+        if (!jit_install_pair(key, kernel_code, dummy_code, &pair))
+            return false;
+    }
+
+    *kernel_function = reinterpret_cast<SequentialFunction>(pair.kernel);
+    *dummy_kernel_function = reinterpret_cast<SequentialFunction>(pair.dummy);
+    return true;
+}
+
+bool xmem::jit_random_kernel(rw_mode_t rw_mode, chunk_size_t chunk_size, uint32_t delay, RandomFunction* kernel_function, RandomFunction* dummy_kernel_function) {
+    if (chunk_size != CHUNK_64b || (rw_mode != READ && rw_mode != WRITE))
+        return false;
+
+    JitKernelKey key = { true, rw_mode, chunk_size, 0, delay, 0, PREFETCH_T0 };
+
+    JitKernelPair pair;
+    auto cached = jit_kernel_cache.find(key);
+    if (cached != jit_kernel_cache.end()) {
+        pair = cached->second;
+    } else {
+        uint32_t unroll = jit_fit_unroll(THROUGHPUT_BENCHMARK_BYTES_PER_PASS / 8, (rw_mode == READ ? 3 : 9) + delay);
+
+        JitCode kernel_code, dummy_code;
+        emit_random_kernel(kernel_code, rw_mode, unroll, delay, false);
+        emit_random_kernel(dummy_code, rw_mode, unroll, delay, true);
+        if (!jit_install_pair(key, kernel_code, dummy_code, &pair))
+            return false;
+    }
+
+    *kernel_function = reinterpret_cast<RandomFunction>(pair.kernel);
+    *dummy_kernel_function = reinterpret_cast<RandomFunction>(pair.dummy);
+    return true;
+}
+
+#endif
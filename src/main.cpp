@@ -44,6 +44,7 @@
 //Libraries
 #include <iostream>
 #include <string>
+#include <vector>
 
 using namespace xmem;
 
@@ -133,50 +134,87 @@ int main(int argc, char* argv[]) {
                 report_timer();
 
             BenchmarkManager benchmgr(config);
-            if (config.throughputTestSelected()) {
-                benchmgr.runThroughputBenchmarks();
-            }
+            std::vector<page_mode_t> page_modes = config.getPageModes();
+            for (auto page_mode_it = page_modes.cbegin(); page_mode_it != page_modes.cend(); page_mode_it++) { //All selected benchmarks are repeated for each page size
+                benchmgr.setPageMode(*page_mode_it);
+                if (page_modes.size() > 1) {
+                    std::cout << std::endl;
+                    std::cout << "*** Memory regions backed by " << page_mode_name(*page_mode_it) << " pages ***" << std::endl;
+                }
 
-            if (config.latencyTestSelected()) {
-                benchmgr.runLatencyBenchmarks();
-            }
+                if (config.throughputTestSelected()) {
+                    benchmgr.runThroughputBenchmarks();
+                }
 
-            if (config.latencyMatrixTestSelected()) {
-                benchmgr.runLatencyMatrixBenchmarks();
-            }
+                if (config.latencyTestSelected()) {
+                    benchmgr.runLatencyBenchmarks();
+                }
 
-            if (config.throughputMatrixTestSelected()) {
-                benchmgr.runThroughputMatrixBenchmarks();
-            }
+                if (config.latencyMatrixTestSelected()) {
+                    benchmgr.runLatencyMatrixBenchmarks();
+                }
 
-            if (config.extensionsEnabled()) {
-                std::cout << std::endl;
-                std::cout << "++++++++++++++++++++++++++++++++++++++++++++++++++++++++++" << std::endl;
-                std::cout << "++++++++++++ Starting custom X-Mem extensions ++++++++++++" << std::endl;
-                std::cout << "++++++++++++++++++++++++++++++++++++++++++++++++++++++++++" << std::endl;
-                std::cout << std::endl;
-
-                /***** USER-DEFINED FUNCTIONAL EXTENSIONS ******/
-#ifdef EXT_DELAY_INJECTED_LOADED_LATENCY_BENCHMARK
-                if (config.runExtDelayInjectedLoadedLatencyBenchmark()) {
-                    std::cout << "EXTENSION " << EXT_NUM_DELAY_INJECTED_LOADED_LATENCY_BENCHMARK << ": Loaded latency benchmarks with delay injected kernels on load threads." << std::endl;
-                    benchmgr.runExtDelayInjectedLoadedLatencyBenchmark();
+                if (config.throughputMatrixTestSelected()) {
+                    benchmgr.runThroughputMatrixBenchmarks();
                 }
-#endif
 
-#ifdef EXT_STREAM_BENCHMARK
-                if (config.runExtStreamBenchmark()) {
-                    std::cout << "EXTENSION " << EXT_NUM_STREAM_BENCHMARK << ": STREAM-like throughput benchmark using stream copy, add, and triad kernels." << std::endl;
-                    benchmgr.runExtStreamBenchmark();
+                if (config.prefetchSweepSelected()) {
+                    benchmgr.runPrefetchSweep();
+                }
+
+                if (config.mlpSweepSelected()) {
+                    benchmgr.runMlpSweep();
                 }
-#endif
-                /***********************************************/
 
-                std::cout << std::endl;
-                std::cout << "++++++++++++++++++++++++++++++++++++++++++++++++++++++++++" << std::endl;
-                std::cout << "++++++++++++ Finished custom X-Mem extensions ++++++++++++" << std::endl;
-                std::cout << "++++++++++++++++++++++++++++++++++++++++++++++++++++++++++" << std::endl;
-                std::cout << std::endl;
+                if (config.contentionSelected()) {
+                    benchmgr.runContentionBenchmarks();
+                }
+
+                if (config.coreToCoreMatrixSelected()) {
+                    benchmgr.runCoreToCoreMatrix();
+                }
+
+                if (config.producerConsumerSelected()) {
+                    benchmgr.runProducerConsumerBenchmarks();
+                }
+
+                if (config.falseSharingSelected()) {
+                    benchmgr.runFalseSharingBenchmarks();
+                }
+
+                if (config.dramMappingSelected()) {
+                    benchmgr.runDRAMMappingBenchmarks();
+                }
+
+                if (config.extensionsEnabled()) {
+                    std::cout << std::endl;
+                    std::cout << "++++++++++++++++++++++++++++++++++++++++++++++++++++++++++" << std::endl;
+                    std::cout << "++++++++++++ Starting custom X-Mem extensions ++++++++++++" << std::endl;
+                    std::cout << "++++++++++++++++++++++++++++++++++++++++++++++++++++++++++" << std::endl;
+                    std::cout << std::endl;
+
+                    /***** USER-DEFINED FUNCTIONAL EXTENSIONS ******/
+    #ifdef EXT_DELAY_INJECTED_LOADED_LATENCY_BENCHMARK
+                    if (config.runExtDelayInjectedLoadedLatencyBenchmark()) {
+                        std::cout << "EXTENSION " << EXT_NUM_DELAY_INJECTED_LOADED_LATENCY_BENCHMARK << ": Loaded latency benchmarks with delay injected kernels on load threads." << std::endl;
+                        benchmgr.runExtDelayInjectedLoadedLatencyBenchmark();
+                    }
+    #endif
+
+    #ifdef EXT_STREAM_BENCHMARK
+                    if (config.runExtStreamBenchmark()) {
+                        std::cout << "EXTENSION " << EXT_NUM_STREAM_BENCHMARK << ": STREAM-like throughput benchmark using stream copy, scale, add, and triad kernels." << std::endl;
+                        benchmgr.runExtStreamBenchmark();
+                    }
+    #endif
+                    /***********************************************/
+
+                    std::cout << std::endl;
+                    std::cout << "++++++++++++++++++++++++++++++++++++++++++++++++++++++++++" << std::endl;
+                    std::cout << "++++++++++++ Finished custom X-Mem extensions ++++++++++++" << std::endl;
+                    std::cout << "++++++++++++++++++++++++++++++++++++++++++++++++++++++++++" << std::endl;
+                    std::cout << std::endl;
+                }
             }
         }
     }
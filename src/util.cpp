@@ -9,6 +9,7 @@
 
 //Libraries
 #include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <vector> //for std::vector
 
@@ -28,3 +29,27 @@ double compute_median(std::vector<double> values) {
     return median;
 }
 
+void compute_median_95_CI(std::vector<double> metrics, uint32_t n, double* lower, double* upper) {
+    // Keep only first n elems, sorted.
+    metrics.resize(n);
+    std::sort(metrics.begin(), metrics.end());
+
+    uint32_t lower_95_CI_rank = std::max((uint32_t) 1, static_cast<uint32_t>(      (n - Z_CI_95 * sqrt(n)) / 2.0));
+    uint32_t upper_95_CI_rank = std::min(           n, static_cast<uint32_t>(ceil(((n + Z_CI_95 * sqrt(n)) / 2.0) + 1.0)));
+
+    *lower = metrics[lower_95_CI_rank - 1]; //-1 since it is zero-indexed
+    *upper = metrics[upper_95_CI_rank - 1]; //-1 since it is zero-indexed
+}
+
+bool median_95_CI_within(const std::vector<double>& values, double max_deviation) {
+    uint32_t n = values.size();
+    if (n < MIN_SAMPLES_FOR_CI)
+        return false;
+
+    double median = compute_median(values);
+    double lower = 0;
+    double upper = 0;
+    compute_median_95_CI(values, n, &lower, &upper);
+
+    return (lower >= (1 - max_deviation) * median) && (upper <= (1 + max_deviation) * median);
+}